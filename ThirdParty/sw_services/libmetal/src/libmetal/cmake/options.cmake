@@ -42,6 +42,7 @@ option (WITH_STATIC_LIB "Build with a static library" ON)
 if ("${PROJECT_SYSTEM}" STREQUAL "linux")
   option (WITH_SHARED_LIB "Build with a shared library" ON)
   option (WITH_TESTS      "Install test applications" ON)
+  option (WITH_BENCHMARKS "Add benchmarks to test applications" OFF)
 endif ("${PROJECT_SYSTEM}" STREQUAL "linux")
 
 if (WITH_TESTS AND (${_host} STREQUAL ${_target}))
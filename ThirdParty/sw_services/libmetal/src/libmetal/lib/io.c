@@ -6,6 +6,7 @@
 
 #include <errno.h>
 #include <limits.h>
+#include <string.h>
 #include <metal/io.h>
 #include <metal/sys.h>
 
@@ -28,15 +29,173 @@ void metal_io_init(struct metal_io_region *io, void *virt,
 	else
 		io->page_mask = (1UL << page_shift) - 1UL;
 	io->mem_flags = mem_flags;
+	io->io_flags = 0;
 	io->ops = ops ? *ops : nops;
 	metal_sys_io_mem_map(io);
 }
 
-int metal_io_block_read(struct metal_io_region *io, unsigned long offset,
-	       void *restrict dst, int len)
+/*
+ * Block accesses to the I/O region side keep the access widths of 32-bit
+ * registers: the bytes up to the first 32-bit aligned address are accessed
+ * one at a time, then every 32-bit aligned word is accessed as a whole and
+ * is never split into bytes.  Native words (unsigned long, 64-bit on AArch64)
+ * are only used on regions flagged METAL_IO_NORMAL_MEM, for the part of the
+ * block where the buffer shares the native word alignment of the region.
+ * The region is accessed through volatile pointers, so that the
+ * compiler neither vectorizes the loops nor turns them into memcpy()/memset()
+ * calls, which don't give these guarantees.  The buffer side is normal memory
+ * and may be unaligned.
+ */
+typedef unsigned long metal_io_word_t;
+
+#define METAL_IO_WORD		((int)sizeof(metal_io_word_t))
+#define METAL_IO_WORD32		((int)sizeof(uint32_t))
+#define METAL_IO_UNROLL		4
+
+static void metal_io_copy_from(void *restrict dst,
+			       const volatile unsigned char *ptr, int len,
+			       int wide)
 {
-	unsigned char *ptr = metal_io_virt(io, offset);
 	unsigned char *dest = dst;
+	uint32_t w32;
+
+	for (; len && ((uintptr_t)ptr % METAL_IO_WORD32); dest++, ptr++, len--)
+		*dest = *ptr;
+
+	if (wide && !(((uintptr_t)ptr ^ (uintptr_t)dest) % METAL_IO_WORD)) {
+		const volatile metal_io_word_t *wptr;
+		metal_io_word_t *wdest;
+
+		if (len >= METAL_IO_WORD32 &&
+		    ((uintptr_t)ptr % METAL_IO_WORD)) {
+			w32 = *(const volatile uint32_t *)ptr;
+			memcpy(dest, &w32, sizeof(w32));
+			ptr += METAL_IO_WORD32;
+			dest += METAL_IO_WORD32;
+			len -= METAL_IO_WORD32;
+		}
+
+		wptr = (const volatile metal_io_word_t *)ptr;
+		wdest = (metal_io_word_t *)dest;
+		for (; len >= METAL_IO_UNROLL * METAL_IO_WORD;
+		     wdest += METAL_IO_UNROLL, wptr += METAL_IO_UNROLL,
+		     len -= METAL_IO_UNROLL * METAL_IO_WORD) {
+			wdest[0] = wptr[0];
+			wdest[1] = wptr[1];
+			wdest[2] = wptr[2];
+			wdest[3] = wptr[3];
+		}
+		for (; len >= METAL_IO_WORD; len -= METAL_IO_WORD)
+			*wdest++ = *wptr++;
+		ptr = (const volatile unsigned char *)wptr;
+		dest = (unsigned char *)wdest;
+	}
+
+	for (; len >= METAL_IO_WORD32; ptr += METAL_IO_WORD32,
+	     dest += METAL_IO_WORD32, len -= METAL_IO_WORD32) {
+		w32 = *(const volatile uint32_t *)ptr;
+		memcpy(dest, &w32, sizeof(w32));
+	}
+
+	for (; len != 0; dest++, ptr++, len--)
+		*dest = *ptr;
+}
+
+static void metal_io_copy_to(volatile unsigned char *ptr,
+			     const void *restrict src, int len, int wide)
+{
+	const unsigned char *source = src;
+	uint32_t w32;
+
+	for (; len && ((uintptr_t)ptr % METAL_IO_WORD32);
+	     ptr++, source++, len--)
+		*ptr = *source;
+
+	if (wide && !(((uintptr_t)ptr ^ (uintptr_t)source) % METAL_IO_WORD)) {
+		volatile metal_io_word_t *wptr;
+		const metal_io_word_t *wsource;
+
+		if (len >= METAL_IO_WORD32 &&
+		    ((uintptr_t)ptr % METAL_IO_WORD)) {
+			memcpy(&w32, source, sizeof(w32));
+			*(volatile uint32_t *)ptr = w32;
+			ptr += METAL_IO_WORD32;
+			source += METAL_IO_WORD32;
+			len -= METAL_IO_WORD32;
+		}
+
+		wptr = (volatile metal_io_word_t *)ptr;
+		wsource = (const metal_io_word_t *)source;
+		for (; len >= METAL_IO_UNROLL * METAL_IO_WORD;
+		     wptr += METAL_IO_UNROLL, wsource += METAL_IO_UNROLL,
+		     len -= METAL_IO_UNROLL * METAL_IO_WORD) {
+			wptr[0] = wsource[0];
+			wptr[1] = wsource[1];
+			wptr[2] = wsource[2];
+			wptr[3] = wsource[3];
+		}
+		for (; len >= METAL_IO_WORD; len -= METAL_IO_WORD)
+			*wptr++ = *wsource++;
+		ptr = (volatile unsigned char *)wptr;
+		source = (const unsigned char *)wsource;
+	}
+
+	for (; len >= METAL_IO_WORD32; ptr += METAL_IO_WORD32,
+	     source += METAL_IO_WORD32, len -= METAL_IO_WORD32) {
+		memcpy(&w32, source, sizeof(w32));
+		*(volatile uint32_t *)ptr = w32;
+	}
+
+	for (; len != 0; ptr++, source++, len--)
+		*ptr = *source;
+}
+
+static void metal_io_fill(volatile unsigned char *ptr, unsigned char value,
+			  int len, int wide)
+{
+	/* Replicate the value to every byte of a word */
+	const metal_io_word_t cword = ((metal_io_word_t)-1 / UCHAR_MAX) * value;
+
+	for (; len && ((uintptr_t)ptr % METAL_IO_WORD32); ptr++, len--)
+		*ptr = value;
+
+	if (wide) {
+		volatile metal_io_word_t *wptr;
+
+		if (len >= METAL_IO_WORD32 &&
+		    ((uintptr_t)ptr % METAL_IO_WORD)) {
+			*(volatile uint32_t *)ptr = (uint32_t)cword;
+			ptr += METAL_IO_WORD32;
+			len -= METAL_IO_WORD32;
+		}
+
+		wptr = (volatile metal_io_word_t *)ptr;
+		for (; len >= METAL_IO_UNROLL * METAL_IO_WORD;
+		     wptr += METAL_IO_UNROLL,
+		     len -= METAL_IO_UNROLL * METAL_IO_WORD) {
+			wptr[0] = cword;
+			wptr[1] = cword;
+			wptr[2] = cword;
+			wptr[3] = cword;
+		}
+		for (; len >= METAL_IO_WORD; len -= METAL_IO_WORD)
+			*wptr++ = cword;
+		ptr = (volatile unsigned char *)wptr;
+	}
+
+	for (; len >= METAL_IO_WORD32; ptr += METAL_IO_WORD32,
+	     len -= METAL_IO_WORD32)
+		*(volatile uint32_t *)ptr = (uint32_t)cword;
+
+	for (; len != 0; ptr++, len--)
+		*ptr = value;
+}
+
+int metal_io_block_read_explicit(struct metal_io_region *io,
+				 unsigned long offset, void *restrict dst,
+				 memory_order order, int len)
+{
+	unsigned char *ptr = metal_io_virt(io, offset);
 	int retlen;
 
 	if (offset >= io->size)
@@ -46,34 +205,29 @@ int metal_io_block_read(struct metal_io_region *io, unsigned long offset,
 	retlen = len;
 	if (io->ops.block_read) {
 		retlen = (*io->ops.block_read)(
-			io, offset, dst, memory_order_seq_cst, len);
+			io, offset, dst, order, len);
 	} else {
-		atomic_thread_fence(memory_order_seq_cst);
-		while ( len && (
-			((uintptr_t)dest % sizeof(int)) ||
-			((uintptr_t)ptr % sizeof(int)))) {
-			*(unsigned char *)dest =
-				*(const unsigned char *)ptr;
-			dest++;
-			ptr++;
-			len--;
-		}
-		for (; len >= (int)sizeof(int); dest += sizeof(int),
-					ptr += sizeof(int),
-					len -= sizeof(int))
-			*(unsigned int *)dest = *(const unsigned int *)ptr;
-		for (; len != 0; dest++, ptr++, len--)
-			*(unsigned char *)dest =
-				*(const unsigned char *)ptr;
+		if (order != memory_order_relaxed)
+			atomic_thread_fence(order);
+		metal_io_copy_from(dst, ptr, len,
+				   io->io_flags & METAL_IO_NORMAL_MEM);
 	}
 	return retlen;
 }
 
-int metal_io_block_write(struct metal_io_region *io, unsigned long offset,
-	       const void *restrict src, int len)
+int metal_io_block_read(struct metal_io_region *io, unsigned long offset,
+	       void *restrict dst, int len)
+{
+	return metal_io_block_read_explicit(io, offset, dst,
+					    memory_order_seq_cst, len);
+}
+
+int metal_io_block_write_explicit(struct metal_io_region *io,
+				  unsigned long offset,
+				  const void *restrict src,
+				  memory_order order, int len)
 {
 	unsigned char *ptr = metal_io_virt(io, offset);
-	const unsigned char *source = src;
 	int retlen;
 
 	if (offset >= io->size)
@@ -83,31 +237,26 @@ int metal_io_block_write(struct metal_io_region *io, unsigned long offset,
 	retlen = len;
 	if (io->ops.block_write) {
 		retlen = (*io->ops.block_write)(
-			io, offset, src, memory_order_seq_cst, len);
+			io, offset, src, order, len);
 	} else {
-		while ( len && (
-			((uintptr_t)ptr % sizeof(int)) ||
-			((uintptr_t)source % sizeof(int)))) {
-			*(unsigned char *)ptr =
-				*(const unsigned char *)source;
-			ptr++;
-			source++;
-			len--;
-		}
-		for (; len >= (int)sizeof(int); ptr += sizeof(int),
-					source += sizeof(int),
-					len -= sizeof(int))
-			*(unsigned int *)ptr = *(const unsigned int *)source;
-		for (; len != 0; ptr++, source++, len--)
-			*(unsigned char *)ptr =
-				*(const unsigned char *)source;
-		atomic_thread_fence(memory_order_seq_cst);
+		metal_io_copy_to(ptr, src, len,
+				 io->io_flags & METAL_IO_NORMAL_MEM);
+		if (order != memory_order_relaxed)
+			atomic_thread_fence(order);
 	}
 	return retlen;
 }
 
-int metal_io_block_set(struct metal_io_region *io, unsigned long offset,
-	       unsigned char value, int len)
+int metal_io_block_write(struct metal_io_region *io, unsigned long offset,
+	       const void *restrict src, int len)
+{
+	return metal_io_block_write_explicit(io, offset, src,
+					     memory_order_seq_cst, len);
+}
+
+int metal_io_block_set_explicit(struct metal_io_region *io,
+				unsigned long offset, unsigned char value,
+				memory_order order, int len)
 {
 	unsigned char *ptr = metal_io_virt(io, offset);
 	int retlen = len;
@@ -119,23 +268,19 @@ int metal_io_block_set(struct metal_io_region *io, unsigned long offset,
 	retlen = len;
 	if (io->ops.block_set) {
 		(*io->ops.block_set)(
-			io, offset, value, memory_order_seq_cst, len);
+			io, offset, value, order, len);
 	} else {
-		unsigned int cint = value;
-		unsigned int i;
-
-		for (i = 1; i < sizeof(int); i++)
-			cint |= ((unsigned int)value << (CHAR_BIT * i));
-
-		for (; len && ((uintptr_t)ptr % sizeof(int)); ptr++, len--)
-			*(unsigned char *)ptr = (unsigned char) value;
-		for (; len >= (int)sizeof(int); ptr += sizeof(int),
-						len -= sizeof(int))
-			*(unsigned int *)ptr = cint;
-		for (; len != 0; ptr++, len--)
-			*(unsigned char *)ptr = (unsigned char) value;
-		atomic_thread_fence(memory_order_seq_cst);
+		metal_io_fill(ptr, value, len,
+			      io->io_flags & METAL_IO_NORMAL_MEM);
+		if (order != memory_order_relaxed)
+			atomic_thread_fence(order);
 	}
 	return retlen;
 }
 
+int metal_io_block_set(struct metal_io_region *io, unsigned long offset,
+	       unsigned char value, int len)
+{
+	return metal_io_block_set_explicit(io, offset, value,
+					   memory_order_seq_cst, len);
+}
@@ -69,6 +69,12 @@ struct metal_io_ops {
 					  metal_phys_addr_t phys);
 };
 
+/**
+ * I/O region flag: the region is normal memory (e.g. shared memory), block
+ * accesses may use native words instead of at most 32-bit accesses.
+ */
+#define METAL_IO_NORMAL_MEM	0x1U
+
 /** Libmetal I/O region structure. */
 struct metal_io_region {
 	void			*virt;      /**< base virtual address */
@@ -80,6 +86,8 @@ struct metal_io_region {
 	metal_phys_addr_t	page_mask;  /**< page mask of I/O region */
 	unsigned int		mem_flags;  /**< memory attribute of the
 						 I/O region */
+	unsigned int		io_flags;   /**< METAL_IO_* flags of the
+						 I/O region */
 	struct metal_io_ops	ops;        /**< I/O region operations */
 };
 
@@ -100,6 +108,21 @@ metal_io_init(struct metal_io_region *io, void *virt,
 	      unsigned page_shift, unsigned int mem_flags,
 	      const struct metal_io_ops *ops);
 
+/**
+ * @brief	Set the flags of a libmetal I/O region.
+ *
+ * Regions start without flags, so that block accesses to them are at most
+ * 32 bits wide, as device registers expect.
+ *
+ * @param[in, out]	io		I/O region handle.
+ * @param[in]		io_flags	METAL_IO_* flags.
+ */
+static inline void metal_io_set_flags(struct metal_io_region *io,
+				      unsigned int io_flags)
+{
+	io->io_flags = io_flags;
+}
+
 /**
  * @brief	Close a libmetal shared memory segment.
  * @param[in]	io	I/O region handle.
@@ -323,6 +346,70 @@ metal_io_write(struct metal_io_region *io, unsigned long offset,
 #define metal_io_write64(_io, _ofs, _val)				\
 	metal_io_write((_io), (_ofs), (_val), memory_order_seq_cst, 8)
 
+/*
+ * Register accessors with weaker ordering than the sequentially consistent
+ * default.  Accesses to a device region are kept in program order by the
+ * memory type of the mapping (e.g. Device memory on ARM):
+ *  - the _acquire reads and _release writes keep the device accesses in
+ *    order with the surrounding accesses to normal memory, except for a write
+ *    followed by a read,
+ *  - the _relaxed accesses don't order anything but the accesses to the
+ *    same register, and a metal_io_fence() is to be issued after a batch of
+ *    them, e.g. before a buffer written by the device is read.
+ * What is saved depends on the target: on AArch64, acquire and release
+ * accesses are the same LDAR/STLR instructions as sequentially consistent
+ * ones, and only the relaxed accesses avoid them; on ARMv7, a release write
+ * saves the trailing DMB of a sequentially consistent write; on x86, it
+ * saves the locked exchange.
+ */
+#define metal_io_read8_relaxed(_io, _ofs)				\
+	metal_io_read((_io), (_ofs), memory_order_relaxed, 1)
+#define metal_io_read8_acquire(_io, _ofs)				\
+	metal_io_read((_io), (_ofs), memory_order_acquire, 1)
+#define metal_io_write8_relaxed(_io, _ofs, _val)			\
+	metal_io_write((_io), (_ofs), (_val), memory_order_relaxed, 1)
+#define metal_io_write8_release(_io, _ofs, _val)			\
+	metal_io_write((_io), (_ofs), (_val), memory_order_release, 1)
+
+#define metal_io_read16_relaxed(_io, _ofs)				\
+	metal_io_read((_io), (_ofs), memory_order_relaxed, 2)
+#define metal_io_read16_acquire(_io, _ofs)				\
+	metal_io_read((_io), (_ofs), memory_order_acquire, 2)
+#define metal_io_write16_relaxed(_io, _ofs, _val)			\
+	metal_io_write((_io), (_ofs), (_val), memory_order_relaxed, 2)
+#define metal_io_write16_release(_io, _ofs, _val)			\
+	metal_io_write((_io), (_ofs), (_val), memory_order_release, 2)
+
+#define metal_io_read32_relaxed(_io, _ofs)				\
+	metal_io_read((_io), (_ofs), memory_order_relaxed, 4)
+#define metal_io_read32_acquire(_io, _ofs)				\
+	metal_io_read((_io), (_ofs), memory_order_acquire, 4)
+#define metal_io_write32_relaxed(_io, _ofs, _val)			\
+	metal_io_write((_io), (_ofs), (_val), memory_order_relaxed, 4)
+#define metal_io_write32_release(_io, _ofs, _val)			\
+	metal_io_write((_io), (_ofs), (_val), memory_order_release, 4)
+
+#define metal_io_read64_relaxed(_io, _ofs)				\
+	metal_io_read((_io), (_ofs), memory_order_relaxed, 8)
+#define metal_io_read64_acquire(_io, _ofs)				\
+	metal_io_read((_io), (_ofs), memory_order_acquire, 8)
+#define metal_io_write64_relaxed(_io, _ofs, _val)			\
+	metal_io_write((_io), (_ofs), (_val), memory_order_relaxed, 8)
+#define metal_io_write64_release(_io, _ofs, _val)			\
+	metal_io_write((_io), (_ofs), (_val), memory_order_release, 8)
+
+/**
+ * @brief	Order the accesses to I/O regions.
+ *
+ * All the accesses to I/O regions and to memory before the fence are
+ * ordered before all the accesses after it.  This is meant to be issued once
+ * after a batch of relaxed register or block accesses.
+ */
+static inline void metal_io_fence(void)
+{
+	atomic_thread_fence(memory_order_seq_cst);
+}
+
 /**
  * @brief	Read a block from an I/O region.
  * @param[in]	io	I/O region handle.
@@ -334,6 +421,24 @@ metal_io_write(struct metal_io_region *io, unsigned long offset,
 int metal_io_block_read(struct metal_io_region *io, unsigned long offset,
 	       void *restrict dst, int len);
 
+/**
+ * @brief	Read a block from an I/O region with an explicit memory order.
+ *
+ * metal_io_block_read() is this function with memory_order_seq_cst.  With
+ * memory_order_relaxed, no fence is issued, so a sequence of block accesses
+ * can be ordered with a single atomic_thread_fence() around it.
+ *
+ * @param[in]	io	I/O region handle.
+ * @param[in]	offset	Offset into I/O region.
+ * @param[in]	dst	destination to store the read data.
+ * @param[in]	order	Memory order of the fence issued before the read.
+ * @param[in]	len	length in bytes to read.
+ * @return      On success, number of bytes read. On failure, negative value
+ */
+int metal_io_block_read_explicit(struct metal_io_region *io,
+				 unsigned long offset, void *restrict dst,
+				 memory_order order, int len);
+
 /**
  * @brief	Write a block into an I/O region.
  * @param[in]	io	I/O region handle.
@@ -345,6 +450,25 @@ int metal_io_block_read(struct metal_io_region *io, unsigned long offset,
 int metal_io_block_write(struct metal_io_region *io, unsigned long offset,
 	       const void *restrict src, int len);
 
+/**
+ * @brief	Write a block into an I/O region with an explicit memory order.
+ *
+ * metal_io_block_write() is this function with memory_order_seq_cst.  With
+ * memory_order_relaxed, no fence is issued, so a sequence of block accesses
+ * can be ordered with a single atomic_thread_fence() after it.
+ *
+ * @param[in]	io	I/O region handle.
+ * @param[in]	offset	Offset into I/O region.
+ * @param[in]	src	source to write.
+ * @param[in]	order	Memory order of the fence issued after the write.
+ * @param[in]	len	length in bytes to write.
+ * @return      On success, number of bytes written. On failure, negative value
+ */
+int metal_io_block_write_explicit(struct metal_io_region *io,
+				  unsigned long offset,
+				  const void *restrict src,
+				  memory_order order, int len);
+
 /**
  * @brief	fill a block of an I/O region.
  * @param[in]	io	I/O region handle.
@@ -356,6 +480,22 @@ int metal_io_block_write(struct metal_io_region *io, unsigned long offset,
 int metal_io_block_set(struct metal_io_region *io, unsigned long offset,
 	       unsigned char value, int len);
 
+/**
+ * @brief	fill a block of an I/O region with an explicit memory order.
+ *
+ * metal_io_block_set() is this function with memory_order_seq_cst.
+ *
+ * @param[in]	io	I/O region handle.
+ * @param[in]	offset	Offset into I/O region.
+ * @param[in]	value	value to fill into the block
+ * @param[in]	order	Memory order of the fence issued after the fill.
+ * @param[in]	len	length in bytes to fill.
+ * @return      On success, number of bytes filled. On failure, negative value
+ */
+int metal_io_block_set_explicit(struct metal_io_region *io,
+				unsigned long offset, unsigned char value,
+				memory_order order, int len);
+
 #include <metal/system/@PROJECT_SYSTEM@/io.h>
 
 /** @} */
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2021, Xilinx Inc. and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "metal-test.h"
+#include <metal/io.h>
+#include <metal/log.h>
+
+#define IO_TEST_SIZE	256
+#define IO_TEST_MAX_LEN	80
+#define IO_TEST_ALIGN	16
+
+static unsigned char io_mem[IO_TEST_SIZE];
+static unsigned char io_buf[IO_TEST_SIZE];
+static unsigned char io_ref[IO_TEST_SIZE];
+
+static void io_pattern(unsigned char *p, int len, unsigned char seed)
+{
+	int i;
+
+	for (i = 0; i < len; i++)
+		p[i] = (unsigned char)(seed + i * 7);
+}
+
+/*
+ * Check the block accesses for all the combinations of the region offset,
+ * buffer offset and length alignments, and that no byte outside the accessed
+ * block is touched, with the default access widths and on normal memory.
+ */
+static int block_io_flags(unsigned int io_flags)
+{
+	struct metal_io_region io;
+	int off, boff, len, ret;
+
+	metal_io_init(&io, io_mem, NULL, sizeof(io_mem), -1, 0, NULL);
+	metal_io_set_flags(&io, io_flags);
+
+	for (off = 0; off < IO_TEST_ALIGN; off++) {
+		for (boff = 0; boff < IO_TEST_ALIGN; boff++) {
+			for (len = 0; len <= IO_TEST_MAX_LEN; len++) {
+				/* Write */
+				io_pattern(io_mem, IO_TEST_SIZE, 0);
+				memcpy(io_ref, io_mem, IO_TEST_SIZE);
+				io_pattern(io_buf, IO_TEST_SIZE, 0x55);
+				memcpy(io_ref + off, io_buf + boff, len);
+				ret = metal_io_block_write(&io, off,
+							   io_buf + boff, len);
+				if (ret != len ||
+				    memcmp(io_mem, io_ref, IO_TEST_SIZE)) {
+					metal_log(METAL_LOG_ERROR,
+						  "block write %d@%d from +%d failed\n",
+						  len, off, boff);
+					return -1;
+				}
+
+				/* Read */
+				io_pattern(io_buf, IO_TEST_SIZE, 0xaa);
+				memcpy(io_ref, io_buf, IO_TEST_SIZE);
+				memcpy(io_ref + boff, io_mem + off, len);
+				ret = metal_io_block_read_explicit(&io, off,
+						io_buf + boff,
+						memory_order_relaxed, len);
+				if (ret != len ||
+				    memcmp(io_buf, io_ref, IO_TEST_SIZE)) {
+					metal_log(METAL_LOG_ERROR,
+						  "block read %d@%d to +%d failed\n",
+						  len, off, boff);
+					return -1;
+				}
+			}
+		}
+
+		for (len = 0; len <= IO_TEST_MAX_LEN; len++) {
+			/* Set */
+			io_pattern(io_mem, IO_TEST_SIZE, 0);
+			memcpy(io_ref, io_mem, IO_TEST_SIZE);
+			memset(io_ref + off, 0xa5, len);
+			ret = metal_io_block_set(&io, off, 0xa5, len);
+			if (ret != len || memcmp(io_mem, io_ref, IO_TEST_SIZE)) {
+				metal_log(METAL_LOG_ERROR,
+					  "block set %d@%d failed\n", len, off);
+				return -1;
+			}
+		}
+	}
+
+	/* Accesses are truncated at the end of the region */
+	ret = metal_io_block_read(&io, IO_TEST_SIZE - 3, io_buf, 8);
+	if (ret != 3) {
+		metal_log(METAL_LOG_ERROR, "truncated block read failed\n");
+		return -1;
+	}
+	ret = metal_io_block_write(&io, IO_TEST_SIZE, io_buf, 8);
+	if (ret != -ERANGE) {
+		metal_log(METAL_LOG_ERROR, "out of range block write failed\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+static int block_io(void)
+{
+	int ret;
+
+	ret = block_io_flags(0);
+	if (!ret)
+		ret = block_io_flags(METAL_IO_NORMAL_MEM);
+	return ret;
+}
+METAL_ADD_TEST(block_io);
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2021, Xilinx Inc. and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <time.h>
+
+#include "metal-test.h"
+#include <metal/alloc.h>
+#include <metal/io.h>
+#include <metal/log.h>
+#include <metal/scatterlist.h>
+#include <metal/shmem.h>
+
+#define IO_BENCH_SHM		"linux_shm/io_bench"
+#define IO_BENCH_MIN_LEN	64
+#define IO_BENCH_MAX_LEN	(4 * 1024 * 1024)
+#define IO_BENCH_BYTES		(64 * 1024 * 1024)
+
+static double io_bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+ * Report the throughput of the block accesses to an I/O region, from 64 bytes
+ * to 4 MB, with the default sequentially consistent fence per access and with
+ * relaxed accesses and a single fence per batch.
+ */
+static void io_bench_run(struct metal_io_region *io, unsigned char *buf)
+{
+	double start, rd, wr, rd_relaxed, wr_relaxed;
+	int len, i, iters;
+
+	metal_log(METAL_LOG_INFO, "%10s %12s %12s %12s %12s (GB/s)\n", "bytes",
+		  "read", "write", "read relax", "write relax");
+	for (len = IO_BENCH_MIN_LEN; len <= IO_BENCH_MAX_LEN; len *= 4) {
+		iters = IO_BENCH_BYTES / len;
+
+		start = io_bench_now();
+		for (i = 0; i < iters; i++)
+			metal_io_block_read(io, 0, buf, len);
+		rd = io_bench_now() - start;
+
+		start = io_bench_now();
+		for (i = 0; i < iters; i++)
+			metal_io_block_write(io, 0, buf, len);
+		wr = io_bench_now() - start;
+
+		start = io_bench_now();
+		atomic_thread_fence(memory_order_seq_cst);
+		for (i = 0; i < iters; i++)
+			metal_io_block_read_explicit(io, 0, buf,
+						     memory_order_relaxed, len);
+		rd_relaxed = io_bench_now() - start;
+
+		start = io_bench_now();
+		for (i = 0; i < iters; i++)
+			metal_io_block_write_explicit(io, 0, buf,
+						      memory_order_relaxed,
+						      len);
+		atomic_thread_fence(memory_order_seq_cst);
+		wr_relaxed = io_bench_now() - start;
+
+		metal_log(METAL_LOG_INFO, "%10d %12.2f %12.2f %12.2f %12.2f\n",
+			  len, IO_BENCH_BYTES / rd / 1e9,
+			  IO_BENCH_BYTES / wr / 1e9,
+			  IO_BENCH_BYTES / rd_relaxed / 1e9,
+			  IO_BENCH_BYTES / wr_relaxed / 1e9);
+	}
+}
+
+/*
+ * Benchmark a shared memory I/O region, first with the default 32-bit block
+ * accesses, then flagged as normal memory, with native word accesses.
+ */
+static int io_bench(void)
+{
+	struct metal_generic_shmem *shm;
+	struct metal_scatter_list *sg;
+	struct metal_io_region *io;
+	unsigned char *buf;
+	int error;
+
+	error = metal_shmem_open(IO_BENCH_SHM, IO_BENCH_MAX_LEN, 0, &shm);
+	if (error) {
+		metal_log(METAL_LOG_ERROR, "Failed shmem_open: %d.\n", error);
+		return error;
+	}
+	sg = metal_shmem_mmap(shm, IO_BENCH_MAX_LEN);
+	if (!sg) {
+		metal_log(METAL_LOG_ERROR, "Failed to shmem_mmap %s.\n",
+			  IO_BENCH_SHM);
+		metal_shmem_close(shm);
+		return -ENOMEM;
+	}
+	if (metal_scatterlist_get_ios(sg, &io) != 1) {
+		metal_log(METAL_LOG_ERROR, "Failed to get shmem I/O region.\n");
+		error = -EINVAL;
+		goto out_unmap;
+	}
+
+	buf = metal_allocate_memory(IO_BENCH_MAX_LEN);
+	if (!buf) {
+		metal_log(METAL_LOG_ERROR, "Failed to allocate memory.\n");
+		error = -ENOMEM;
+		goto out_unmap;
+	}
+	metal_io_block_set(io, 0, 0x5a, IO_BENCH_MAX_LEN);
+
+	metal_log(METAL_LOG_INFO, "32-bit accesses:\n");
+	io_bench_run(io, buf);
+	metal_io_set_flags(io, METAL_IO_NORMAL_MEM);
+	metal_log(METAL_LOG_INFO, "normal memory accesses:\n");
+	io_bench_run(io, buf);
+
+	metal_free_memory(buf);
+out_unmap:
+	metal_shmem_munmap(shm, sg);
+	metal_shmem_close(shm);
+	return error;
+}
+METAL_ADD_TEST(io_bench);
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2021, Xilinx Inc. and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <time.h>
+
+#include "metal-test.h"
+#include <metal/io.h>
+#include <metal/log.h>
+#include <metal/scatterlist.h>
+#include <metal/shmem.h>
+
+#define IO_REG_BENCH_SHM	"linux_shm/io_reg_bench"
+#define IO_REG_BENCH_SIZE	(64 * 1024)
+#define IO_REG_BENCH_ROUNDS	64
+#define IO_REG_BENCH_ACCESSES	(IO_REG_BENCH_ROUNDS * 3 * IO_REG_BENCH_SIZE / 4)
+
+static double io_reg_bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+ * Register configuration sequence of the drivers: every register of the
+ * region is written, then a bit field of it is updated with a read, modify,
+ * write, as done by the rfdc and DFE register bit field helpers.
+ */
+#define IO_REG_BENCH_SEQ(_io, _read, _write)				\
+	do {								\
+		unsigned long ofs;					\
+		uint32_t val;						\
+									\
+		for (ofs = 0; ofs < IO_REG_BENCH_SIZE; ofs += 4) {	\
+			_write((_io), ofs, (uint32_t)ofs);		\
+			val = _read((_io), ofs);			\
+			_write((_io), ofs, (val & ~0xff00U) | 0x5a00U);	\
+		}							\
+	} while (0)
+
+static int io_reg_bench(void)
+{
+	struct metal_generic_shmem *shm;
+	struct metal_scatter_list *sg;
+	struct metal_io_region *io;
+	double start, seq_cst, acq_rel, relaxed;
+	int i, error;
+
+	error = metal_shmem_open(IO_REG_BENCH_SHM, IO_REG_BENCH_SIZE, 0, &shm);
+	if (error) {
+		metal_log(METAL_LOG_ERROR, "Failed shmem_open: %d.\n", error);
+		return error;
+	}
+	sg = metal_shmem_mmap(shm, IO_REG_BENCH_SIZE);
+	if (!sg) {
+		metal_log(METAL_LOG_ERROR, "Failed to shmem_mmap %s.\n",
+			  IO_REG_BENCH_SHM);
+		metal_shmem_close(shm);
+		return -ENOMEM;
+	}
+	if (metal_scatterlist_get_ios(sg, &io) != 1) {
+		metal_log(METAL_LOG_ERROR, "Failed to get shmem I/O region.\n");
+		metal_shmem_munmap(shm, sg);
+		metal_shmem_close(shm);
+		return -EINVAL;
+	}
+
+	start = io_reg_bench_now();
+	for (i = 0; i < IO_REG_BENCH_ROUNDS; i++)
+		IO_REG_BENCH_SEQ(io, metal_io_read32, metal_io_write32);
+	seq_cst = io_reg_bench_now() - start;
+
+	start = io_reg_bench_now();
+	for (i = 0; i < IO_REG_BENCH_ROUNDS; i++)
+		IO_REG_BENCH_SEQ(io, metal_io_read32_acquire,
+				 metal_io_write32_release);
+	acq_rel = io_reg_bench_now() - start;
+
+	start = io_reg_bench_now();
+	for (i = 0; i < IO_REG_BENCH_ROUNDS; i++) {
+		IO_REG_BENCH_SEQ(io, metal_io_read32_relaxed,
+				 metal_io_write32_relaxed);
+		metal_io_fence();
+	}
+	relaxed = io_reg_bench_now() - start;
+
+	if (metal_io_read32(io, IO_REG_BENCH_SIZE - 4) !=
+	    (((IO_REG_BENCH_SIZE - 4) & ~0xff00U) | 0x5a00U)) {
+		metal_log(METAL_LOG_ERROR, "Register sequence mismatch.\n");
+		error = -EINVAL;
+	}
+
+	metal_log(METAL_LOG_INFO, "seq_cst:         %10.2f ns/access\n",
+		  seq_cst * 1e9 / IO_REG_BENCH_ACCESSES);
+	metal_log(METAL_LOG_INFO, "acquire/release: %10.2f ns/access\n",
+		  acq_rel * 1e9 / IO_REG_BENCH_ACCESSES);
+	metal_log(METAL_LOG_INFO, "relaxed + fence: %10.2f ns/access\n",
+		  relaxed * 1e9 / IO_REG_BENCH_ACCESSES);
+
+	metal_shmem_munmap(shm, sg);
+	metal_shmem_close(shm);
+	return error;
+}
+METAL_ADD_TEST(io_reg_bench);
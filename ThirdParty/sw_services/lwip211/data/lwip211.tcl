@@ -783,6 +783,13 @@ proc generate_lwip_opts {libhandle} {
 		if {$tx_full_csum_temp == true} {
 			puts $lwipopts_fd "\#define LWIP_FULL_CSUM_OFFLOAD_TX  1"
 		}
+		set lso [common::get_property CONFIG.tcp_large_send_offload $libhandle]
+		if {$lso == true} {
+			if {$tx_full_csum_temp != true} {
+				error "ERROR: TCP large send offload requires Full TCP/IP checksum offload on Tx path (tcp_ip_tx_checksum_offload)" "" "mdt_error"
+			}
+			puts $lwipopts_fd "\#define LWIP_TCP_LSO  1"
+		}
 		if {$rx_full_csum_temp == true} {
 			puts $lwipopts_fd "\#define LWIP_FULL_CSUM_OFFLOAD_RX  1"
 		}
@@ -837,6 +844,13 @@ proc generate_lwip_opts {libhandle} {
 		}
 	}
 
+	set rx_recycle_pbufs [common::get_property CONFIG.n_rx_recycle_pbufs $libhandle]
+	if {$rx_recycle_pbufs > 0} {
+		puts $lwipopts_fd "\#define GEM_RX_RECYCLE_PBUFS $rx_recycle_pbufs"
+		puts $lwipopts_fd "\#define LWIP_SUPPORT_CUSTOM_PBUF 1"
+		puts $lwipopts_fd ""
+	}
+
 	# DHCP options
 	set lwip_dhcp 		[expr [common::get_property CONFIG.lwip_dhcp $libhandle] == true]
 	set dhcp_does_arp_check [expr [common::get_property CONFIG.dhcp_does_arp_check $libhandle] == true]
@@ -65,6 +65,13 @@ extern "C" {
 #define INTC_DIST_BASE_ADDR     XPAR_SCUGIC_0_DIST_BASEADDR
 #endif
 
+/* MTU of the interface, large sends are cut into frames of this size */
+#ifdef USE_JUMBO_FRAMES
+#define XAXIEMACIF_MTU		(XAE_JUMBO_MTU - XAE_HDR_SIZE)
+#else
+#define XAXIEMACIF_MTU		(XAE_MTU - XAE_HDR_SIZE)
+#endif
+
 void 	xaxiemacif_setmac(u32_t index, u8_t *addr);
 u8_t*	xaxiemacif_getmac(u32_t index);
 err_t 	xaxiemacif_init(struct netif *netif);
@@ -100,6 +100,11 @@ extern "C" {
 
 #define MAX_FRAME_SIZE_JUMBO (XEMACPS_MTU_JUMBO + XEMACPS_HDR_SIZE + XEMACPS_TRL_SIZE)
 
+/* Number of RX pbufs recycled by the adapter, 0 uses the pbuf pool only */
+#ifndef GEM_RX_RECYCLE_PBUFS
+#define GEM_RX_RECYCLE_PBUFS 0
+#endif
+
 void 	xemacpsif_setmac(u32_t index, u8_t *addr);
 u8_t*	xemacpsif_getmac(u32_t index);
 err_t 	xemacpsif_init(struct netif *netif);
@@ -158,6 +163,10 @@ void init_emacps_on_error (xemacpsif_s *xemacps, struct netif *netif);
 void clean_dma_txdescs(struct xemac_s *xemac);
 void resetrx_on_no_rxdata(xemacpsif_s *xemacpsif);
 void reset_dma(struct xemac_s *xemac);
+#if GEM_RX_RECYCLE_PBUFS && LWIP_STATS
+/* usage and high-water mark of the RX recycle pool */
+extern struct stats_mem xemacps_rx_recycle_stats;
+#endif
 
 #ifdef __cplusplus
 }
@@ -113,6 +113,30 @@ xtopology_find_index(unsigned base)
 	return -1;
 }
 
+/* checksum offload used by the adapters, printed once per interface */
+static void print_csum_offload(void)
+{
+	const char *tx = "none", *rx = "none";
+
+#if LWIP_FULL_CSUM_OFFLOAD_TX==1
+	tx = "full";
+#elif LWIP_PARTIAL_CSUM_OFFLOAD_TX==1
+	tx = "partial";
+#endif
+#if LWIP_FULL_CSUM_OFFLOAD_RX==1
+	rx = "full";
+#elif LWIP_PARTIAL_CSUM_OFFLOAD_RX==1
+	rx = "partial";
+#endif
+	xil_printf("Checksum offload: TX %s, RX %s\r\n", tx, rx);
+#if LWIP_TCP_LSO
+	xil_printf("TCP large send offload: on, %d byte segments\r\n",
+			TCP_LSO_SEG_SIZE);
+#else
+	xil_printf("TCP large send offload: off\r\n");
+#endif
+}
+
 /*
  * xemac_add: this is a wrapper around lwIP's netif_add function.
  * The objective is to provide portability between the different Xilinx MAC's
@@ -138,6 +162,8 @@ xemac_add(struct netif *netif,
 	for (i = 0; i < 6; i++)
 		netif->hwaddr[i] = mac_ethernet_address[i];
 
+	print_csum_offload();
+
 	/* initialize based on MAC type */
 		switch (find_mac_type(mac_baseaddr)) {
 			case xemac_type_xps_emaclite:
@@ -316,11 +316,7 @@ static err_t low_level_init(struct netif *netif)
 		return ERR_MEM;
 
 	/* maximum transfer unit */
-#ifdef USE_JUMBO_FRAMES
-	netif->mtu = XAE_JUMBO_MTU - XAE_HDR_SIZE;
-#else
-	netif->mtu = XAE_MTU - XAE_HDR_SIZE;
-#endif
+	netif->mtu = XAXIEMACIF_MTU;
 
 #if LWIP_IGMP
 	netif->igmp_mac_filter = xaxiemacif_mac_filter_update;
@@ -377,6 +373,13 @@ static err_t low_level_init(struct netif *netif)
 		return ERR_IF;
 	}
 
+#if LWIP_TCP_LSO && LWIP_FULL_CSUM_OFFLOAD_TX==1
+	/* the DMA adapters cut large TCP segments into frames */
+	if (!XAxiEthernet_IsFifo(&xaxiemacif->axi_ethernet)) {
+		netif->flags |= NETIF_FLAG_LSO;
+	}
+#endif
+
 	/* initialize the mac */
 	init_axiemac(xaxiemacif, netif);
 
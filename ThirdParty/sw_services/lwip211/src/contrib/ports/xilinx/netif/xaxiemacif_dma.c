@@ -42,6 +42,7 @@
 
 #include "netif/xadapter.h"
 #include "netif/xaxiemacif.h"
+#include "xaxiemacif_hw.h"
 
 #if XLWIP_CONFIG_INCLUDE_AXIETH_ON_ZYNQ == 1
 #include "xscugic.h"
@@ -228,6 +229,51 @@ s32_t is_checksum_valid(XAxiDma_Bd *rxbd, struct pbuf *p) {
 	}
 }
 
+#if LWIP_FULL_CSUM_OFFLOAD_RX==1
+/* full checksum offload status, bits [5:3] of AXI4-Stream status word 2 */
+#define FULL_CSUM_STATUS_MASK		0x00000038
+#define FULL_CSUM_STATUS_SHIFT		3
+#define IP_TCP_CSUMS_NOT_CHECKED	0x00000000
+#define IP_CSUM_OK_TCP_NOT_CHECKED	0x00000001
+#define IP_TCP_CSUMS_OK			0x00000002
+#define IP_UDP_CSUMS_OK			0x00000003
+#define TCP_CSUM_NOT_CHECKED_IP_NOT_OK	0x00000005
+
+/*
+ * lwIP does not verify checksums with full RX offload, so drop the packets
+ * the h/w found to be bad (IP, TCP or UDP checksum error) and verify in
+ * software what the h/w did not check: the IPv4 header for status 0, the
+ * TCP or UDP checksum for status 0 and 1 (and the reserved status 4).
+ */
+static s32_t is_full_checksum_valid(XAxiDma_Bd *rxbd, struct pbuf *p)
+{
+	u32_t status;
+
+	status = (XAxiDma_BdRead(rxbd, XAXIDMA_BD_USR2_OFFSET) &
+			FULL_CSUM_STATUS_MASK) >> FULL_CSUM_STATUS_SHIFT;
+	if (status >= TCP_CSUM_NOT_CHECKED_IP_NOT_OK) {
+		return 0;
+	}
+	if (status == IP_TCP_CSUMS_OK || status == IP_UDP_CSUMS_OK) {
+		return 1;
+	}
+
+	return xaxiemac_sw_csum_valid(p,
+			status != IP_CSUM_OK_TCP_NOT_CHECKED);
+}
+#endif
+
+#if LWIP_PARTIAL_CSUM_OFFLOAD_RX==1 || LWIP_FULL_CSUM_OFFLOAD_RX==1
+static inline s32_t is_rx_checksum_valid(XAxiDma_Bd *rxbd, struct pbuf *p)
+{
+#if LWIP_FULL_CSUM_OFFLOAD_RX==1
+	return is_full_checksum_valid(rxbd, p);
+#else
+	return is_checksum_valid(rxbd, p);
+#endif
+}
+#endif
+
 static inline void *alloc_bdspace(int n_desc)
 {
 	int space = XAxiDma_BdRingMemCalc(BD_ALIGNMENT, n_desc);
@@ -432,10 +478,17 @@ static void axidma_recv_handler(void *arg)
 #endif
 #endif
 
-#if LWIP_PARTIAL_CSUM_OFFLOAD_RX==1
-			/* Verify for partial checksum offload case */
-			if (!is_checksum_valid(rxbd, p)) {
+#if LWIP_PARTIAL_CSUM_OFFLOAD_RX==1 || LWIP_FULL_CSUM_OFFLOAD_RX==1
+			/* lwIP trusts the h/w checksum verification, drop bad packets */
+			if (!is_rx_checksum_valid(rxbd, p)) {
 				LWIP_DEBUGF(NETIF_DEBUG, ("Incorrect csum as calculated by the hw\r\n"));
+#if LINK_STATS
+				lwip_stats.link.chkerr++;
+				lwip_stats.link.drop++;
+#endif
+				pbuf_free(p);
+				rxbd = (XAxiDma_Bd *)XAxiDma_BdRingNext(rxring, rxbd);
+				continue;
 			}
 #endif
 			/* store it in the receive queue,
@@ -493,6 +546,75 @@ s32_t process_sent_bds(XAxiDma_BdRing *txring)
 	return (XAxiDma_BdRingFree(txring, n_bds, txbdset));
 }
 
+#if LWIP_TCP_LSO
+/*
+ * Send a TCP segment larger than the MTU as frames of one MSS: for each
+ * frame, one BD for its copy of the headers followed by BDs pointing into
+ * the payload of the segment. The h/w fills in the checksums of each frame.
+ */
+static XStatus axidma_lso_send(XAxiDma_BdRing *txring, xaxiemac_lso_s *lso)
+{
+	XAxiDma_Bd *txbdset, *txbd, *last_txbd = NULL;
+	struct pbuf *hdrs, *q;
+	XStatus status;
+	u32_t n_bds;
+	u16_t len;
+	u8_t *hdr;
+	void *data;
+
+	n_bds = xaxiemac_lso_bd_count(lso);
+	status = XAxiDma_BdRingAlloc(txring, n_bds, &txbdset);
+	if (status != XST_SUCCESS) {
+		/* reclaim the BDs of frames already sent and try once more */
+		process_sent_bds(txring);
+		status = XAxiDma_BdRingAlloc(txring, n_bds, &txbdset);
+	}
+	if (status != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("sgsend: Error allocating TxBD\r\n"));
+		return ERR_IF;
+	}
+
+	hdrs = xaxiemac_lso_hdrs(lso);
+	if (hdrs == NULL) {
+		XAxiDma_BdRingUnAlloc(txring, n_bds, txbdset);
+		return ERR_MEM;
+	}
+	XCACHE_FLUSH_DCACHE_RANGE(hdrs->payload, hdrs->len);
+
+	hdr = hdrs->payload;
+	txbd = txbdset;
+	while (xaxiemac_lso_next_frame(lso)) {
+		XAxiDma_BdSetBufAddr(txbd, (UINTPTR)hdr);
+		XAxiDma_BdSetLength(txbd, lso->hdr_len, txring->MaxTransferLen);
+		XAxiDma_BdSetId(txbd, (void *)hdrs);
+		XAxiDma_BdSetCtrl(txbd, XAXIDMA_BD_CTRL_TXSOF_MASK);
+		bd_fullcsum_disable(txbd);
+		bd_fullcsum_enable(txbd);
+		pbuf_ref(hdrs);
+		hdr += LWIP_MEM_ALIGN_SIZE(lso->hdr_len);
+		txbd = (XAxiDma_Bd *)XAxiDma_BdRingNext(txring, txbd);
+
+		while ((len = xaxiemac_lso_next_buf(lso, &q, &data)) != 0) {
+			XAxiDma_BdSetBufAddr(txbd, (UINTPTR)data);
+			XAxiDma_BdSetLength(txbd, len, txring->MaxTransferLen);
+			XAxiDma_BdSetId(txbd, (void *)q);
+			XAxiDma_BdSetCtrl(txbd, 0);
+			XCACHE_FLUSH_DCACHE_RANGE(data, len);
+			pbuf_ref(q);
+			last_txbd = txbd;
+			txbd = (XAxiDma_Bd *)XAxiDma_BdRingNext(txring, txbd);
+		}
+		/* in the last payload BD of the frame, set the EOP */
+		XAxiDma_BdSetCtrl(last_txbd, XAXIDMA_BD_CTRL_TXEOF_MASK);
+	}
+	/* the BDs hold the references to the headers now */
+	pbuf_free(hdrs);
+
+	/* enq to h/w */
+	return XAxiDma_BdRingToHw(txring, n_bds, txbdset);
+}
+#endif
+
 XStatus axidma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p)
 {
 	struct pbuf *q;
@@ -509,6 +631,16 @@ XStatus axidma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p)
 #endif
 	txring = XAxiDma_GetTxRing(&xaxiemacif->axidma);
 
+#if LWIP_TCP_LSO
+	{
+		xaxiemac_lso_s lso;
+
+		if (xaxiemac_lso_start(&lso, p)) {
+			return axidma_lso_send(txring, &lso);
+		}
+	}
+#endif
+
 	/* first count the number of pbufs */
 	for (q = p, n_pbufs = 0; q != NULL; q = q->next)
 		n_pbufs++;
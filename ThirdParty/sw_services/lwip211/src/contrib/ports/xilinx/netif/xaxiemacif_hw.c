@@ -30,6 +30,10 @@
 
 #include "netif/xaxiemacif.h"
 #include "lwipopts.h"
+#include "lwip/inet_chksum.h"
+#include "lwip/prot/tcp.h"
+#include "lwip/prot/udp.h"
+#include "xaxiemacif_hw.h"
 
 extern enum ethernet_link_status eth_link_status;
 
@@ -122,3 +126,260 @@ void xaxiemac_error_handler(XAxiEthernet * Temac)
 	Pending = XAxiEthernet_IntPending(Temac);
 	XAxiEthernet_IntClear(Temac, Pending);
 }
+
+#if LWIP_FULL_CSUM_OFFLOAD_RX==1
+static s32_t ip4_csum_valid(struct pbuf *p, s32_t check_ip)
+{
+	struct ip_hdr *iphdr = (struct ip_hdr *)((u8_t *)p->payload + XAE_HDR_SIZE);
+	ip4_addr_t src, dest;
+	u16_t iphdr_len, ip_len, proto_len, csum;
+	u8_t proto;
+
+	if (p->len < XAE_HDR_SIZE + IP_HLEN) {
+		return 0;
+	}
+	iphdr_len = IPH_HL_BYTES(iphdr);
+	ip_len = lwip_ntohs(IPH_LEN(iphdr));
+	if (iphdr_len < IP_HLEN || p->len < XAE_HDR_SIZE + iphdr_len ||
+			ip_len < iphdr_len || p->tot_len < XAE_HDR_SIZE + ip_len) {
+		return 0;
+	}
+	if (check_ip && inet_chksum(iphdr, iphdr_len) != 0) {
+		return 0;
+	}
+
+	/* a fragment can only be checked after reassembly */
+	proto = IPH_PROTO(iphdr);
+	if ((proto != IP_PROTO_TCP && proto != IP_PROTO_UDP) ||
+			(IPH_OFFSET(iphdr) & PP_HTONS(IP_OFFMASK | IP_MF))) {
+		return 1;
+	}
+	proto_len = ip_len - iphdr_len;
+	if (proto_len < ((proto == IP_PROTO_TCP) ? TCP_HLEN : UDP_HLEN)) {
+		return 0;
+	}
+	/* UDP over IPv4 may be sent without checksum */
+	if (proto == IP_PROTO_UDP &&
+			pbuf_get_at(p, XAE_HDR_SIZE + iphdr_len + 6) == 0 &&
+			pbuf_get_at(p, XAE_HDR_SIZE + iphdr_len + 7) == 0) {
+		return 1;
+	}
+
+	ip4_addr_copy(src, iphdr->src);
+	ip4_addr_copy(dest, iphdr->dest);
+	pbuf_header(p, -(s16_t)(XAE_HDR_SIZE + iphdr_len));
+	csum = inet_chksum_pseudo_partial(p, proto, proto_len, proto_len,
+			&src, &dest);
+	pbuf_header(p, (s16_t)(XAE_HDR_SIZE + iphdr_len));
+
+	return csum == 0;
+}
+
+#if LWIP_IPV6
+static s32_t ip6_csum_valid(struct pbuf *p)
+{
+	struct ip6_hdr *ip6hdr = (struct ip6_hdr *)((u8_t *)p->payload + XAE_HDR_SIZE);
+	ip6_addr_t src, dest;
+	u16_t plen, csum;
+	u8_t proto;
+
+	if (p->len < XAE_HDR_SIZE + IP6_HLEN) {
+		return 0;
+	}
+	/* TCP or UDP behind extension headers is passed on unchecked */
+	proto = IP6H_NEXTH(ip6hdr);
+	if (proto != IP6_NEXTH_TCP && proto != IP6_NEXTH_UDP) {
+		return 1;
+	}
+	plen = IP6H_PLEN(ip6hdr);
+	if (p->tot_len < XAE_HDR_SIZE + IP6_HLEN + plen) {
+		return 0;
+	}
+
+	ip6_addr_copy_from_packed(src, ip6hdr->src);
+	ip6_addr_copy_from_packed(dest, ip6hdr->dest);
+	pbuf_header(p, -(s16_t)(XAE_HDR_SIZE + IP6_HLEN));
+	csum = ip6_chksum_pseudo_partial(p, proto, plen, plen, &src, &dest);
+	pbuf_header(p, (s16_t)(XAE_HDR_SIZE + IP6_HLEN));
+
+	return csum == 0;
+}
+#endif
+
+/*
+ * Verify the checksums of a received frame that the full RX checksum offload
+ * did not check, lwIP does not check them again (CHECKSUM_CHECK_IP, _TCP and
+ * _UDP are 0). The IPv4 header checksum is only verified if check_ip is set,
+ * TCP and UDP checksums are always verified.
+ */
+s32_t xaxiemac_sw_csum_valid(struct pbuf *p, s32_t check_ip)
+{
+	struct eth_hdr *ethhdr = p->payload;
+
+	if (p->len < XAE_HDR_SIZE) {
+		return 1;
+	}
+
+	switch (lwip_htons(ethhdr->type)) {
+	case ETHTYPE_IP:
+		return ip4_csum_valid(p, check_ip);
+#if LWIP_IPV6
+	case ETHTYPE_IPV6:
+		return ip6_csum_valid(p);
+#endif
+	default:
+		return 1;
+	}
+}
+#endif
+
+#if LWIP_TCP_LSO
+/*
+ * Large send offload: lwIP hands TCP segments larger than the MTU to the
+ * adapter (NETIF_FLAG_LSO). Each segment is sent as frames of one MSS. A
+ * frame is a copy of the Ethernet/IP/TCP headers with its own length, IP ID
+ * and sequence number, followed by BDs pointing into the payload of the
+ * segment. The h/w fills in the IP and TCP checksums of every frame.
+ */
+
+/* start cutting a segment into frames, returns 0 if it fits one frame */
+s32_t xaxiemac_lso_start(xaxiemac_lso_s *lso, struct pbuf *p)
+{
+	struct ethip_hdr *ehdr = p->payload;
+	struct tcp_hdr *tcphdr;
+	u16_t iphdr_len;
+
+	if (p->tot_len <= XAXIEMACIF_MTU + XAE_HDR_SIZE ||
+			p->len < sizeof(struct ethip_hdr) ||
+			lwip_htons(ehdr->eth.type) != ETHTYPE_IP ||
+			IPH_PROTO(&ehdr->ip) != IP_PROTO_TCP) {
+		return 0;
+	}
+	iphdr_len = IPH_HL_BYTES(&ehdr->ip);
+	if (p->len < XAE_HDR_SIZE + iphdr_len + TCP_HLEN) {
+		return 0;
+	}
+	tcphdr = (struct tcp_hdr *)((u8_t *)p->payload + XAE_HDR_SIZE + iphdr_len);
+	lso->hdr_len = XAE_HDR_SIZE + iphdr_len + TCPH_HDRLEN_BYTES(tcphdr);
+	if (p->len < lso->hdr_len) {
+		return 0;
+	}
+
+	lso->p = p;
+	lso->mss = XAXIEMACIF_MTU + XAE_HDR_SIZE - lso->hdr_len;
+	lso->left = p->tot_len - lso->hdr_len;
+	lso->n_frames = (lso->left + lso->mss - 1) / lso->mss;
+	lso->frame_left = 0;
+	lso->q = p;
+	lso->off = lso->hdr_len;
+
+	return 1;
+}
+
+/*
+ * Headers of all frames, each one starting at a multiple of
+ * LWIP_MEM_ALIGN_SIZE(hdr_len). The caller frees the pbuf.
+ */
+struct pbuf *xaxiemac_lso_hdrs(const xaxiemac_lso_s *lso)
+{
+	struct pbuf *hdrs;
+	struct ip_hdr *iphdr;
+	struct tcp_hdr *tcphdr;
+	u32_t seqno, left, len;
+	u16_t id, i, iphdr_len;
+	u8_t *hdr;
+
+	hdrs = pbuf_alloc(PBUF_RAW, lso->n_frames *
+			LWIP_MEM_ALIGN_SIZE(lso->hdr_len), PBUF_RAM);
+	if (hdrs == NULL) {
+		return NULL;
+	}
+
+	iphdr = (struct ip_hdr *)((u8_t *)lso->p->payload + XAE_HDR_SIZE);
+	iphdr_len = IPH_HL_BYTES(iphdr);
+	tcphdr = (struct tcp_hdr *)((u8_t *)iphdr + iphdr_len);
+	id = lwip_ntohs(IPH_ID(iphdr));
+	seqno = lwip_ntohl(tcphdr->seqno);
+	left = lso->left;
+
+	hdr = hdrs->payload;
+	for (i = 0; i < lso->n_frames; i++) {
+		len = LWIP_MIN(left, lso->mss);
+		MEMCPY(hdr, lso->p->payload, lso->hdr_len);
+		iphdr = (struct ip_hdr *)(hdr + XAE_HDR_SIZE);
+		tcphdr = (struct tcp_hdr *)((u8_t *)iphdr + iphdr_len);
+
+		IPH_LEN_SET(iphdr, lwip_htons(lso->hdr_len - XAE_HDR_SIZE + len));
+		IPH_ID_SET(iphdr, lwip_htons(id + i));
+		IPH_CHKSUM_SET(iphdr, 0);
+		tcphdr->seqno = lwip_htonl(seqno);
+		tcphdr->chksum = 0;
+		/* only the last frame pushes or finishes */
+		if (i + 1 < lso->n_frames) {
+			TCPH_UNSET_FLAG(tcphdr, TCP_PSH | TCP_FIN);
+		}
+
+		seqno += len;
+		left -= len;
+		hdr += LWIP_MEM_ALIGN_SIZE(lso->hdr_len);
+	}
+
+	return hdrs;
+}
+
+/* move to the next frame, returns 0 after the last frame */
+s32_t xaxiemac_lso_next_frame(xaxiemac_lso_s *lso)
+{
+	if (lso->left == 0) {
+		return 0;
+	}
+	lso->frame_left = LWIP_MIN(lso->left, lso->mss);
+
+	return 1;
+}
+
+/*
+ * Next piece of payload of the current frame, returns its length and the
+ * pbuf holding it, 0 at the end of the frame.
+ */
+u16_t xaxiemac_lso_next_buf(xaxiemac_lso_s *lso, struct pbuf **q,
+		void **data)
+{
+	u16_t len;
+
+	if (lso->frame_left == 0) {
+		return 0;
+	}
+	while (lso->off >= lso->q->len) {
+		lso->q = lso->q->next;
+		lso->off = 0;
+	}
+
+	len = LWIP_MIN((u32_t)(lso->q->len - lso->off), lso->frame_left);
+	*q = lso->q;
+	*data = (u8_t *)lso->q->payload + lso->off;
+	lso->off += len;
+	lso->frame_left -= len;
+	lso->left -= len;
+
+	return len;
+}
+
+/* number of BDs to send the whole segment, including the header BDs */
+u32_t xaxiemac_lso_bd_count(const xaxiemac_lso_s *lso)
+{
+	xaxiemac_lso_s walk = *lso;
+	struct pbuf *q;
+	void *data;
+	u32_t n_bds = 0;
+
+	while (xaxiemac_lso_next_frame(&walk)) {
+		n_bds++;
+		while (xaxiemac_lso_next_buf(&walk, &q, &data) != 0) {
+			n_bds++;
+		}
+	}
+
+	return n_bds;
+}
+#endif
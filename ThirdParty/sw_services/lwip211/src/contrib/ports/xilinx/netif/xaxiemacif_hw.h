@@ -42,6 +42,31 @@ XAxiEthernet_Config * xaxiemac_lookup_config(unsigned mac_base);
 
 void init_axiemac(xaxiemacif_s *xaxiemacif, struct netif *netif);
 
+#if LWIP_FULL_CSUM_OFFLOAD_RX==1
+s32_t xaxiemac_sw_csum_valid(struct pbuf *p, s32_t check_ip);
+#endif
+
+#if LWIP_TCP_LSO
+/* state of a TCP segment being cut into frames */
+typedef struct {
+	struct pbuf *p;		/* the segment, headers in the first pbuf */
+	u16_t hdr_len;		/* Ethernet, IP and TCP header bytes */
+	u16_t mss;		/* payload bytes of a full frame */
+	u16_t n_frames;
+	u32_t left;		/* payload bytes not cut yet */
+	u32_t frame_left;	/* payload bytes left in the current frame */
+	struct pbuf *q;		/* next payload byte is at q->payload + off */
+	u16_t off;
+} xaxiemac_lso_s;
+
+s32_t xaxiemac_lso_start(xaxiemac_lso_s *lso, struct pbuf *p);
+struct pbuf *xaxiemac_lso_hdrs(const xaxiemac_lso_s *lso);
+s32_t xaxiemac_lso_next_frame(xaxiemac_lso_s *lso);
+u16_t xaxiemac_lso_next_buf(xaxiemac_lso_s *lso, struct pbuf **q,
+		void **data);
+u32_t xaxiemac_lso_bd_count(const xaxiemac_lso_s *lso);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
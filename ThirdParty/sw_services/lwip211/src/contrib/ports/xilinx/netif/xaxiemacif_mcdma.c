@@ -40,6 +40,7 @@
 
 #include "netif/xadapter.h"
 #include "netif/xaxiemacif.h"
+#include "xaxiemacif_hw.h"
 
 #if XLWIP_CONFIG_INCLUDE_AXIETH_ON_ZYNQ == 1
 #include "xscugic.h"
@@ -223,6 +224,51 @@ s32_t is_checksum_valid(XMcdma_Bd *rxbd, struct pbuf *p)
 	}
 }
 
+#if LWIP_FULL_CSUM_OFFLOAD_RX==1
+/* full checksum offload status, bits [5:3] of AXI4-Stream status word 2 */
+#define FULL_CSUM_STATUS_MASK		0x00000038
+#define FULL_CSUM_STATUS_SHIFT		3
+#define IP_TCP_CSUMS_NOT_CHECKED	0x00000000
+#define IP_CSUM_OK_TCP_NOT_CHECKED	0x00000001
+#define IP_TCP_CSUMS_OK			0x00000002
+#define IP_UDP_CSUMS_OK			0x00000003
+#define TCP_CSUM_NOT_CHECKED_IP_NOT_OK	0x00000005
+
+/*
+ * lwIP does not verify checksums with full RX offload, so drop the packets
+ * the h/w found to be bad (IP, TCP or UDP checksum error) and verify in
+ * software what the h/w did not check: the IPv4 header for status 0, the
+ * TCP or UDP checksum for status 0 and 1 (and the reserved status 4).
+ */
+static s32_t is_full_checksum_valid(XMcdma_Bd *rxbd, struct pbuf *p)
+{
+	u32_t status;
+
+	status = (XMcdma_BdRead64(rxbd, XMCDMA_BD_USR2_OFFSET) &
+			FULL_CSUM_STATUS_MASK) >> FULL_CSUM_STATUS_SHIFT;
+	if (status >= TCP_CSUM_NOT_CHECKED_IP_NOT_OK) {
+		return 0;
+	}
+	if (status == IP_TCP_CSUMS_OK || status == IP_UDP_CSUMS_OK) {
+		return 1;
+	}
+
+	return xaxiemac_sw_csum_valid(p,
+			status != IP_CSUM_OK_TCP_NOT_CHECKED);
+}
+#endif
+
+#if LWIP_PARTIAL_CSUM_OFFLOAD_RX==1 || LWIP_FULL_CSUM_OFFLOAD_RX==1
+static inline s32_t is_rx_checksum_valid(XMcdma_Bd *rxbd, struct pbuf *p)
+{
+#if LWIP_FULL_CSUM_OFFLOAD_RX==1
+	return is_full_checksum_valid(rxbd, p);
+#else
+	return is_checksum_valid(rxbd, p);
+#endif
+}
+#endif
+
 #define XMcdma_BdMemCalc(Alignment, NumBd) \
 	(int)((sizeof(XMcdma_Bd)+((Alignment)-1)) & ~((Alignment)-1))*(NumBd)
 
@@ -413,10 +459,17 @@ static void axi_mcdma_recv_handler(void *CallBackRef, u32 ChanId)
 #endif
 		pbuf_realloc(p, rx_bytes);
 
-#if LWIP_PARTIAL_CSUM_OFFLOAD_RX==1
-		/* Verify for partial checksum offload case */
-		if (!is_checksum_valid(rxbd, p)) {
+#if LWIP_PARTIAL_CSUM_OFFLOAD_RX==1 || LWIP_FULL_CSUM_OFFLOAD_RX==1
+		/* lwIP trusts the h/w checksum verification, drop bad packets */
+		if (!is_rx_checksum_valid(rxbd, p)) {
 			LWIP_DEBUGF(NETIF_DEBUG, ("Incorrect csum as calculated by the hw\r\n"));
+#if LINK_STATS
+			lwip_stats.link.chkerr++;
+			lwip_stats.link.drop++;
+#endif
+			pbuf_free(p);
+			rxbd = (XMcdma_Bd *)XMcdma_BdChainNextBd(Rx_Chan, rxbd);
+			continue;
 		}
 #endif
 		/* store it in the receive queue,
@@ -527,6 +580,73 @@ static void update_partial_cksum_offload(XMcdma_Bd *txbdset, struct pbuf *p)
 }
 #endif
 
+#if LWIP_TCP_LSO
+/*
+ * Send a TCP segment larger than the MTU as frames of one MSS: for each
+ * frame, one BD for its copy of the headers followed by BDs pointing into
+ * the payload of the segment. The h/w fills in the checksums of each frame.
+ */
+static XStatus axi_mcdma_lso_send(XMcdma_ChanCtrl *Tx_Chan,
+		xaxiemac_lso_s *lso)
+{
+	XMcdma_Bd *txbd, *last_txbd = NULL;
+	struct pbuf *hdrs, *q;
+	XStatus status;
+	u16_t len;
+	u8_t *hdr;
+	void *data;
+
+	hdrs = xaxiemac_lso_hdrs(lso);
+	if (hdrs == NULL) {
+		return ERR_MEM;
+	}
+	Xil_DCacheFlushRange((UINTPTR)hdrs->payload, hdrs->len);
+
+	hdr = hdrs->payload;
+	txbd = (XMcdma_Bd *)XMcdma_GetChanCurBd(Tx_Chan);
+	while (xaxiemac_lso_next_frame(lso)) {
+		XMcDma_BdSetCtrl(txbd, 0);
+		XMcdma_BdSetSwId(txbd, (void *)hdrs);
+		status = XMcDma_ChanSubmit(Tx_Chan, (UINTPTR)hdr,
+				lso->hdr_len);
+		if (status != XST_SUCCESS) {
+			xil_printf("ChanSubmit failed\n\r");
+			pbuf_free(hdrs);
+			return XST_FAILURE;
+		}
+		XMcDma_BdSetCtrl(txbd, XMCDMA_BD_CTRL_SOF_MASK);
+		bd_fullcsum_disable(txbd);
+		bd_fullcsum_enable(txbd);
+		pbuf_ref(hdrs);
+		hdr += LWIP_MEM_ALIGN_SIZE(lso->hdr_len);
+		txbd = (XMcdma_Bd *)XMcdma_BdChainNextBd(Tx_Chan, txbd);
+
+		while ((len = xaxiemac_lso_next_buf(lso, &q, &data)) != 0) {
+			XMcDma_BdSetCtrl(txbd, 0);
+			XMcdma_BdSetSwId(txbd, (void *)q);
+			Xil_DCacheFlushRange((UINTPTR)data, len);
+			status = XMcDma_ChanSubmit(Tx_Chan, (UINTPTR)data, len);
+			if (status != XST_SUCCESS) {
+				xil_printf("ChanSubmit failed\n\r");
+				pbuf_free(hdrs);
+				return XST_FAILURE;
+			}
+			pbuf_ref(q);
+			last_txbd = txbd;
+			txbd = (XMcdma_Bd *)XMcdma_BdChainNextBd(Tx_Chan, txbd);
+		}
+		/* in the last payload BD of the frame, set the EOP */
+		XMcDma_BdSetCtrl(last_txbd, XMCDMA_BD_CTRL_EOF_MASK);
+	}
+	/* the BDs hold the references to the headers now */
+	pbuf_free(hdrs);
+
+	DATA_SYNC;
+	/* enq to h/w */
+	return XMcDma_ChanToHw(Tx_Chan);
+}
+#endif
+
 XStatus axi_mcdma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p)
 {
 	struct pbuf *q;
@@ -536,7 +656,15 @@ XStatus axi_mcdma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p)
 	XStatus status;
 	static u8_t ChanId = 1;
 	u8_t next_ChanId = ChanId;
-
+#if LWIP_TCP_LSO
+	xaxiemac_lso_s lso;
+	s32_t is_lso = xaxiemac_lso_start(&lso, p);
+
+	/* a segment larger than the MTU takes a BD per frame and per piece */
+	if (is_lso)
+		n_pbufs = xaxiemac_lso_bd_count(&lso);
+	else
+#endif
 	/* first count the number of pbufs */
 	for (q = p; q != NULL; q = q->next)
 		n_pbufs++;
@@ -555,6 +683,11 @@ XStatus axi_mcdma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p)
 
 	} while (n_pbufs > Tx_Chan->BdCnt);
 
+#if LWIP_TCP_LSO
+	if (is_lso)
+		return axi_mcdma_lso_send(Tx_Chan, &lso);
+#endif
+
 	txbdset = (XMcdma_Bd *)XMcdma_GetChanCurBd(Tx_Chan);
 
 	for (q = p, txbd = txbdset; q != NULL; q = q->next) {
@@ -126,6 +126,160 @@ long xInsideISR = 0;
 #define XEMACPS_BD_TO_INDEX(ringptr, bdptr)				\
 	(((UINTPTR)bdptr - (UINTPTR)(ringptr)->BaseBdAddr) / (ringptr)->Separation)
 
+#ifdef ZYNQMP_USE_JUMBO
+#define XEMACPS_RX_FRAME_SIZE	MAX_FRAME_SIZE_JUMBO
+#else
+#define XEMACPS_RX_FRAME_SIZE	XEMACPS_MAX_FRAME_SIZE
+#endif
+
+#if GEM_RX_RECYCLE_PBUFS
+/******************************************************************************
+ * RX pbuf recycling.
+ *
+ * RX buffers are custom pbufs from a static pool. When the stack frees one,
+ * it goes straight back on a free list that setup_rx_bds uses to refill the
+ * RX BD ring, so the RX path does not go through the lwIP pbuf pool and its
+ * SYS_ARCH_PROTECT critical sections.
+ *
+ * The free list is a lock-free LIFO shared by all GEM instances. Buffers are
+ * freed from any context and taken by the RX interrupt of every GEM and by
+ * init_dma, so a pop can be interrupted by another pop and push of the same
+ * buffer (ABA). The list head holds the index of the first buffer in its low
+ * 32 bits and a count of the pops in its high 32 bits, so that the compare
+ * and swap in rx_recycle_get fails if the list changed under it.
+ *
+ * When the pool runs dry, RX buffers are allocated from the pbuf pool.
+ *****************************************************************************/
+#if !LWIP_SUPPORT_CUSTOM_PBUF
+#error "GEM_RX_RECYCLE_PBUFS requires LWIP_SUPPORT_CUSTOM_PBUF"
+#endif
+
+#define RX_RECYCLE_ALIGN	64U
+
+/* List head: pool index + 1 of the first buffer (0 if empty), pop count */
+#define RX_RECYCLE_IDX(head)	((u32_t)(head))
+#define RX_RECYCLE_TAG(head)	((u32_t)((head) >> 32))
+#define RX_RECYCLE_HEAD(idx, tag)	(((u64_t)(tag) << 32) | (u32_t)(idx))
+
+struct rx_recycle_pbuf {
+	struct pbuf_custom pc;
+	u32_t next;	/* pool index + 1 of the next free buffer, 0 if none */
+	u8_t payload[XEMACPS_RX_FRAME_SIZE] __attribute__ ((aligned (RX_RECYCLE_ALIGN)));
+};
+
+static struct rx_recycle_pbuf rx_recycle_pool[GEM_RX_RECYCLE_PBUFS];
+static u64_t rx_recycle_head;
+static u8_t rx_recycle_ready;
+
+#if LWIP_STATS
+struct stats_mem xemacps_rx_recycle_stats = {
+#if defined(LWIP_DEBUG) || LWIP_STATS_DISPLAY
+	.name = "RX_RECYCLE",
+#endif
+	.avail = GEM_RX_RECYCLE_PBUFS,
+};
+#endif
+
+static void rx_recycle_put(struct rx_recycle_pbuf *rp)
+{
+	u32_t idx = (u32_t)(rp - rx_recycle_pool) + 1U;
+	u64_t head;
+
+	head = __atomic_load_n(&rx_recycle_head, __ATOMIC_RELAXED);
+	do {
+		__atomic_store_n(&rp->next, RX_RECYCLE_IDX(head),
+				__ATOMIC_RELAXED);
+	} while (!__atomic_compare_exchange_n(&rx_recycle_head, &head,
+			RX_RECYCLE_HEAD(idx, RX_RECYCLE_TAG(head)), 1,
+			__ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+static struct rx_recycle_pbuf *rx_recycle_get(void)
+{
+	struct rx_recycle_pbuf *rp;
+	u64_t head;
+	u32_t next;
+
+	head = __atomic_load_n(&rx_recycle_head, __ATOMIC_ACQUIRE);
+	do {
+		if (RX_RECYCLE_IDX(head) == 0U) {
+			return NULL;
+		}
+		rp = &rx_recycle_pool[RX_RECYCLE_IDX(head) - 1U];
+		/* may be stale if rp was taken meanwhile, then the tag differs */
+		next = __atomic_load_n(&rp->next, __ATOMIC_RELAXED);
+	} while (!__atomic_compare_exchange_n(&rx_recycle_head, &head,
+			RX_RECYCLE_HEAD(next, RX_RECYCLE_TAG(head) + 1U), 1,
+			__ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE));
+
+	return rp;
+}
+
+#if LWIP_STATS
+/* The pool is taken from several contexts, update the stats atomically */
+static void rx_recycle_stats_get(void)
+{
+	mem_size_t used, max;
+
+	used = __atomic_add_fetch(&xemacps_rx_recycle_stats.used, 1,
+			__ATOMIC_RELAXED);
+	max = __atomic_load_n(&xemacps_rx_recycle_stats.max, __ATOMIC_RELAXED);
+	while (used > max && !__atomic_compare_exchange_n(
+			&xemacps_rx_recycle_stats.max, &max, used, 1,
+			__ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+	}
+}
+#endif
+
+/* custom_free_function, called by pbuf_free when the stack is done */
+static void rx_recycle_free(struct pbuf *p)
+{
+	rx_recycle_put((struct rx_recycle_pbuf *)p);
+#if LWIP_STATS
+	__atomic_fetch_sub(&xemacps_rx_recycle_stats.used, 1, __ATOMIC_RELAXED);
+#endif
+}
+
+static void rx_recycle_init(void)
+{
+	u32_t i;
+
+	/* the pool is shared by all GEM instances */
+	if (rx_recycle_ready) {
+		return;
+	}
+	rx_recycle_ready = 1;
+
+	for (i = 0; i < GEM_RX_RECYCLE_PBUFS; i++) {
+		rx_recycle_pool[i].pc.custom_free_function = rx_recycle_free;
+		rx_recycle_put(&rx_recycle_pool[i]);
+	}
+}
+#endif /* GEM_RX_RECYCLE_PBUFS */
+
+/* Get a pbuf for one RX BD, recycled when possible */
+static struct pbuf *alloc_rx_pbuf(void)
+{
+#if GEM_RX_RECYCLE_PBUFS
+	struct rx_recycle_pbuf *rp;
+
+	rp = rx_recycle_get();
+	if (rp != NULL) {
+#if LWIP_STATS
+		rx_recycle_stats_get();
+#endif
+		return pbuf_alloced_custom(PBUF_RAW, XEMACPS_RX_FRAME_SIZE,
+				PBUF_REF, &rp->pc, rp->payload,
+				XEMACPS_RX_FRAME_SIZE);
+	}
+#if LWIP_STATS
+	__atomic_fetch_add(&xemacps_rx_recycle_stats.err, 1, __ATOMIC_RELAXED);
+#endif
+#endif /* GEM_RX_RECYCLE_PBUFS */
+
+	return pbuf_alloc(PBUF_RAW, XEMACPS_RX_FRAME_SIZE, PBUF_POOL);
+}
+
 
 s32_t is_tx_space_available(xemacpsif_s *emac)
 {
@@ -427,11 +581,7 @@ void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
 	freebds = XEmacPs_BdRingGetFreeCnt (rxring);
 	while (freebds > 0) {
 		freebds--;
-#ifdef ZYNQMP_USE_JUMBO
-		p = pbuf_alloc(PBUF_RAW, MAX_FRAME_SIZE_JUMBO, PBUF_POOL);
-#else
-		p = pbuf_alloc(PBUF_RAW, XEMACPS_MAX_FRAME_SIZE, PBUF_POOL);
-#endif
+		p = alloc_rx_pbuf();
 		if (!p) {
 #if LINK_STATS
 			lwip_stats.link.memerr++;
@@ -716,15 +866,15 @@ XStatus init_dma(struct xemac_s *xemac)
 		return ERR_IF;
 	}
 
+#if GEM_RX_RECYCLE_PBUFS
+	rx_recycle_init();
+#endif
+
 	/*
 	 * Allocate RX descriptors, 1 RxBD at a time.
 	 */
 	for (i = 0; i < XLWIP_CONFIG_N_RX_DESC; i++) {
-#ifdef ZYNQMP_USE_JUMBO
-		p = pbuf_alloc(PBUF_RAW, MAX_FRAME_SIZE_JUMBO, PBUF_POOL);
-#else
-		p = pbuf_alloc(PBUF_RAW, XEMACPS_MAX_FRAME_SIZE, PBUF_POOL);
-#endif
+		p = alloc_rx_pbuf();
 		if (!p) {
 #if LINK_STATS
 			lwip_stats.link.memerr++;
@@ -332,6 +332,9 @@ PACK_STRUCT_END
 #if TCP_WND < TCP_MSS
 #error "lwip_sanity_check: WARNING: TCP_WND is smaller than MSS. If you know what you are doing, define LWIP_DISABLE_TCP_SANITY_CHECKS to 1 to disable this error."
 #endif
+#if LWIP_TCP_LSO && ((TCP_LSO_SEG_SIZE < TCP_MSS) || (TCP_LSO_SEG_SIZE > (0xFFFF - IP_HLEN - TCP_HLEN - 40)))
+#error "lwip_sanity_check: WARNING: TCP_LSO_SEG_SIZE must be at least TCP_MSS and fit the IP total length with headers and options. If you know what you are doing, define LWIP_DISABLE_TCP_SANITY_CHECKS to 1 to disable this error."
+#endif
 #endif /* LWIP_TCP */
 #endif /* !LWIP_DISABLE_TCP_SANITY_CHECKS */
 
@@ -998,7 +998,12 @@ ip4_output_if_opt_src(struct pbuf *p, const ip4_addr_t *src, const ip4_addr_t *d
 #endif /* ENABLE_LOOPBACK */
 #if IP_FRAG
   /* don't fragment if interface has mtu set to 0 [loopif] */
-  if (netif->mtu && (p->tot_len > netif->mtu)) {
+  if (netif->mtu && (p->tot_len > netif->mtu)
+#if LWIP_TCP_LSO
+      /* large TCP segments are cut into frames by the netif */
+      && !((netif->flags & NETIF_FLAG_LSO) && (IPH_PROTO(iphdr) == IP_PROTO_TCP))
+#endif /* LWIP_TCP_LSO */
+     ) {
     return ip4_frag(p, netif, dest);
   }
 #endif /* IP_FRAG */
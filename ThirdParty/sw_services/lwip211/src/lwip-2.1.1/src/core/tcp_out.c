@@ -145,6 +145,51 @@ tcp_route(const struct tcp_pcb *pcb, const ip_addr_t *src, const ip_addr_t *dst)
   }
 }
 
+#if LWIP_TCP_LSO
+/* tcp_lso_mss: largest segment built for a pcb, TCP_LSO_SEG_SIZE if its netif
+ * cuts segments into frames of one MSS each, the MSS otherwise */
+static u16_t
+tcp_lso_mss(struct tcp_pcb *pcb)
+{
+  struct netif *netif;
+
+  if (!IP_IS_V4(&pcb->remote_ip)) {
+    return pcb->mss;
+  }
+  netif = tcp_route(pcb, &pcb->local_ip, &pcb->remote_ip);
+  if ((netif != NULL) && (netif->flags & NETIF_FLAG_LSO) &&
+      (pcb->mss + IP_HLEN + TCP_HLEN == netif->mtu)) {
+    return TCP_LSO_SEG_SIZE;
+  }
+  return pcb->mss;
+}
+
+/* tcp_lso_fit_wnd: a large segment on the head of the unsent queue that is
+ * bigger than the whole window would never be sent (cwnd starts below it and
+ * drops to one MSS after a timeout), so it is cut down to the frames that fit
+ * the space left in the window. Smaller segments wait for the window to open. */
+static void
+tcp_lso_fit_wnd(struct tcp_pcb *pcb, u32_t wnd)
+{
+  struct tcp_seg *seg = pcb->unsent;
+  u32_t inflight = lwip_ntohl(seg->tcphdr->seqno) - pcb->lastack;
+  u16_t frame = (u16_t)(pcb->mss - LWIP_TCP_OPT_LENGTH(seg->flags));
+  u32_t space;
+
+  if ((seg->len <= wnd) || (inflight >= wnd)) {
+    return;
+  }
+  space = wnd - inflight;
+  if (space < frame) {
+    return;
+  }
+  if (tcp_split_unsent_seg(pcb, (u16_t)(space - (space % frame))) != ERR_OK) {
+    /* retried from tcp_fasttmr */
+    tcp_set_flags(pcb, TF_NAGLEMEMERR);
+  }
+}
+#endif /* LWIP_TCP_LSO */
+
 /**
  * Create a TCP segment with prefilled header.
  *
@@ -419,7 +464,11 @@ tcp_write(struct tcp_pcb *pcb, const void *arg, u16_t len, u8_t apiflags)
   LWIP_ERROR("tcp_write: invalid pcb", pcb != NULL, return ERR_ARG);
 
   /* don't allocate segments bigger than half the maximum window we ever received */
+#if LWIP_TCP_LSO
+  mss_local = LWIP_MIN(tcp_lso_mss(pcb), TCPWND_MIN16(pcb->snd_wnd_max / 2));
+#else /* LWIP_TCP_LSO */
   mss_local = LWIP_MIN(pcb->mss, TCPWND_MIN16(pcb->snd_wnd_max / 2));
+#endif /* LWIP_TCP_LSO */
   mss_local = mss_local ? mss_local : pcb->mss;
 
   LWIP_ASSERT_CORE_LOCKED();
@@ -453,6 +502,14 @@ tcp_write(struct tcp_pcb *pcb, const void *arg, u16_t len, u8_t apiflags)
   {
     optlen = LWIP_TCP_OPT_LENGTH_SEGMENT(0, pcb);
   }
+#if LWIP_TCP_LSO
+  /* large segments carry whole frames of (mss - optlen) data bytes, so that
+     the netif does not send a short frame at the end of each segment */
+  if (mss_local > pcb->mss) {
+    u16_t frame = (u16_t)(pcb->mss - optlen);
+    mss_local = (u16_t)((mss_local - optlen) / frame * frame + optlen);
+  }
+#endif /* LWIP_TCP_LSO */
 
 
   /*
@@ -861,7 +918,11 @@ tcp_split_unsent_seg(struct tcp_pcb *pcb, u16_t split)
     return ERR_OK;
   }
 
+#if LWIP_TCP_LSO
+  LWIP_ASSERT("split <= mss", split <= TCP_LSO_SEG_SIZE);
+#else /* LWIP_TCP_LSO */
   LWIP_ASSERT("split <= mss", split <= pcb->mss);
+#endif /* LWIP_TCP_LSO */
   LWIP_ASSERT("useg->len > 0", useg->len > 0);
 
   /* We should check that we don't exceed TCP_SND_QUEUELEN but we need
@@ -1306,6 +1367,10 @@ tcp_output(struct tcp_pcb *pcb)
     ip_addr_copy(pcb->local_ip, *local_ip);
   }
 
+#if LWIP_TCP_LSO
+  tcp_lso_fit_wnd(pcb, wnd);
+#endif /* LWIP_TCP_LSO */
+
   /* Handle the current segment not fitting within the window */
   if (lwip_ntohl(seg->tcphdr->seqno) - pcb->lastack + seg->len > wnd) {
     /* We need to start the persistent timer when the next unsent segment does not fit
@@ -1411,6 +1476,11 @@ tcp_output(struct tcp_pcb *pcb)
       tcp_seg_free(seg);
     }
     seg = pcb->unsent;
+#if LWIP_TCP_LSO
+    if (seg != NULL) {
+      tcp_lso_fit_wnd(pcb, wnd);
+    }
+#endif /* LWIP_TCP_LSO */
   }
 #if TCP_OVERSIZE
   if (pcb->unsent == NULL) {
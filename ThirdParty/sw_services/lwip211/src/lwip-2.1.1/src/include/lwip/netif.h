@@ -105,6 +105,10 @@ extern "C" {
 /** If set, the netif has MLD6 capability.
  * Set by the netif driver in its init function. */
 #define NETIF_FLAG_MLD6         0x40U
+/** If set, the netif cuts TCP segments larger than its MTU into frames
+ * (large send offload, see @ref LWIP_TCP_LSO).
+ * Set by the netif driver in its init function. */
+#define NETIF_FLAG_LSO          0x80U
 
 /**
  * @}
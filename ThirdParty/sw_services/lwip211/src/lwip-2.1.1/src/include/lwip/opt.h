@@ -1424,6 +1424,24 @@
 #define TCP_OVERSIZE                    TCP_MSS
 #endif
 
+/**
+ * LWIP_TCP_LSO==1: Build TCP segments of up to TCP_LSO_SEG_SIZE bytes for
+ * netifs that set NETIF_FLAG_LSO, the netif cuts them into frames (large
+ * send offload). Only used for IPv4 connections whose MSS fills the MTU of
+ * the netif, so that every frame carries one MSS.
+ */
+#if !defined LWIP_TCP_LSO || defined __DOXYGEN__
+#define LWIP_TCP_LSO                    0
+#endif
+
+/**
+ * TCP_LSO_SEG_SIZE: The largest TCP segment built with LWIP_TCP_LSO.
+ * Segments are also limited to half the largest window of the peer.
+ */
+#if !defined TCP_LSO_SEG_SIZE || defined __DOXYGEN__
+#define TCP_LSO_SEG_SIZE                (8 * TCP_MSS)
+#endif
+
 /**
  * LWIP_TCP_TIMESTAMPS==1: support the TCP timestamp option.
  * The timestamp option is currently only used to help remote hosts, it is not
@@ -14,3 +14,9 @@ else()
   collect (PROJECT_LIB_DIRS "${CMAKE_BINARY_DIR}/aienginev2-src/src")
   collect (PROJECT_LIB_DEPS "xaiengine")
 endif (WITH_XAIEDRV_FIND)
+
+# Profiling samplers and trace stream run background threads
+find_package (Threads REQUIRED)
+if (CMAKE_THREAD_LIBS_INIT)
+  collect (PROJECT_LIB_DEPS "${CMAKE_THREAD_LIBS_INIT}")
+endif (CMAKE_THREAD_LIBS_INIT)
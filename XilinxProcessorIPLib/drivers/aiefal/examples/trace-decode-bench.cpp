@@ -0,0 +1,148 @@
+// (c) Copyright(C) 2021 by Xilinx, Inc. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "xaiefal/xaiefal.hpp"
+
+using namespace std;
+using namespace xaiefal;
+
+// Words per trace packet including the header
+#define TRACE_PKT_WORDS 8
+// Words per chunk passed to the decode thread
+#define TRACE_CHUNK_WORDS (TRACE_PKT_WORDS * 512)
+
+static uint32_t pktHeader(uint8_t Col, uint8_t Row, uint8_t Type, uint8_t Id)
+{
+	uint32_t H = (Col << 21) | (Row << 16) | (Type << 12) | Id;
+	uint32_t P = H;
+
+	P ^= P >> 16;
+	P ^= P >> 8;
+	P ^= P >> 4;
+	P ^= P >> 2;
+	P ^= P >> 1;
+	return H | (((P & 1) ^ 1) << 31);
+}
+
+// Generate packet switched event-time trace of 8 tiles, each payload
+// word holds a start frame or single and multiple event frames.
+static void genTrace(vector<uint32_t> &Words, size_t NumWords)
+{
+	const uint8_t NumTiles = 8;
+
+	Words.resize(NumWords / TRACE_PKT_WORDS * TRACE_PKT_WORDS);
+	for (size_t i = 0; i < Words.size(); i += TRACE_PKT_WORDS) {
+		size_t Pkt = i / TRACE_PKT_WORDS;
+		uint8_t Tile = Pkt % NumTiles;
+
+		Words[i] = pktHeader(Tile, 1, 0, Tile);
+		for (size_t j = 1; j < TRACE_PKT_WORDS; j++) {
+			if (Pkt < NumTiles && j < 3) {
+				// start frame, timer 0
+				Words[i + j] = (j == 1) ? 0xF0000000 : 0;
+			} else {
+				// two single frames and a multiple frame
+				Words[i + j] = 0x1325C085 + (j & 0x3);
+			}
+		}
+	}
+}
+
+static void usage(const char *Prog)
+{
+	cout << "Usage: " << Prog << " [-i trace.bin] [-m MBytes]" <<
+		" [-c columns.bin] [-j trace.json] [-f MHz]" << endl <<
+		"  -i recorded trace words, generated trace if not set" << endl <<
+		"  -m size of generated trace, default 64 MBytes" << endl <<
+		"  -c write decoded events in columnar binary" << endl <<
+		"  -j write decoded events in Chrome trace JSON" << endl <<
+		"  -f AI engine clock for the JSON timestamps, default 1000" <<
+		endl;
+}
+
+int main(int argc, char *argv[])
+{
+	string In, ColOut, JsonOut;
+	size_t MBytes = 64;
+	double Mhz = 1000;
+	vector<uint32_t> Words;
+
+	for (int i = 1; i < argc; i++) {
+		string A = argv[i];
+
+		if (i + 1 >= argc) {
+			usage(argv[0]);
+			return -1;
+		}
+		if (A == "-i") {
+			In = argv[++i];
+		} else if (A == "-m") {
+			MBytes = stoul(argv[++i]);
+		} else if (A == "-c") {
+			ColOut = argv[++i];
+		} else if (A == "-j") {
+			JsonOut = argv[++i];
+		} else if (A == "-f") {
+			Mhz = stod(argv[++i]);
+		} else {
+			usage(argv[0]);
+			return -1;
+		}
+	}
+
+	if (!In.empty()) {
+		ifstream F(In, ios::binary | ios::ate);
+
+		if (!F) {
+			cout << "failed to open " << In << endl;
+			return -1;
+		}
+		Words.resize(F.tellg() / 4);
+		F.seekg(0);
+		F.read(reinterpret_cast<char *>(Words.data()), Words.size() * 4);
+	} else {
+		genTrace(Words, MBytes * 1024 * 1024 / 4);
+	}
+
+	XAieTraceStream Stream(nullptr, XAIE_TRACE_EVENT_TIME, 64,
+		TRACE_PKT_WORDS);
+
+	auto T0 = chrono::steady_clock::now();
+	Stream.start();
+	for (size_t i = 0; i < Words.size(); i += TRACE_CHUNK_WORDS) {
+		size_t N = min(Words.size() - i, (size_t)TRACE_CHUNK_WORDS);
+		vector<uint32_t> Chunk(Words.begin() + i, Words.begin() + i + N);
+
+		while (!Stream.push(Chunk)) {
+			this_thread::yield();
+		}
+	}
+	Stream.stop();
+	auto T1 = chrono::steady_clock::now();
+
+	double Secs = chrono::duration<double>(T1 - T0).count();
+	const XAieTraceColumns &C = Stream.getColumns();
+	cout << "decoded " << Stream.getBytes() << " bytes, " << C.size() <<
+		" events in " << Secs * 1000 << " ms, " <<
+		Stream.getBytes() / Secs / 1e6 << " MB/s, " <<
+		C.size() / Secs / 1e6 << " Mevents/s" << endl;
+	cout << "invalid packets " << Stream.decoder().getInvalidPkts() <<
+		", invalid frame bytes " <<
+		Stream.decoder().getInvalidFrames() << endl;
+
+	if (!ColOut.empty()) {
+		ofstream F(ColOut, ios::binary);
+		C.writeBinary(F);
+	}
+	if (!JsonOut.empty()) {
+		ofstream F(JsonOut);
+		C.writeChromeTrace(F, Mhz);
+	}
+	return 0;
+}
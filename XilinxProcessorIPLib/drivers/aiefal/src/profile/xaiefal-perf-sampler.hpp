@@ -0,0 +1,352 @@
+// Copyright(C) 2021 by Xilinx, Inc. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <xaiengine.h>
+#include <xaiefal/common/xaiefal-base.hpp>
+#include <xaiefal/common/xaiefal-log.hpp>
+#include <xaiefal/rsc/xaiefal-perf.hpp>
+
+#pragma once
+
+namespace xaiefal {
+	/**
+	 * @struct XAiePerfSample
+	 * @brief one sample of the perfcounter sampler. Deltas[i] is the
+	 *	  increment of the i-th added counter since the previous sample.
+	 */
+	struct XAiePerfSample {
+		std::chrono::steady_clock::time_point Time;
+		std::vector<uint32_t> Deltas;
+	};
+
+	/**
+	 * @class XAiePerfSampler
+	 * @brief class to sample many perfcounters periodically.
+	 * The added counters are grouped by tile and module, each group is
+	 * read with one XAie_PerfCounterGetRange() call. Samples hold the
+	 * counter deltas since the previous sample and are kept in a ring
+	 * buffer of fixed depth, when the ring is full the oldest sample is
+	 * dropped.
+	 * Sampling runs either on demand with sample() or on a background
+	 * thread with start(). sample() can also be called while the
+	 * background thread is running, the samples are taken one at a time.
+	 * Apart from sample(), while the background thread is running, the
+	 * caller must not access the AI engine device from other threads
+	 * without its own locking, as the AI engine driver is not thread safe.
+	 */
+	class XAiePerfSampler {
+	public:
+		XAiePerfSampler() = delete;
+		XAiePerfSampler(std::shared_ptr<XAieDevHandle> DevHd,
+			uint32_t D = 1024):
+			AieHd(DevHd), Depth(D), Head(0), Count(0), Dropped(0),
+			Prepared(false), HasPrev(false), Running(false),
+			LastRC(XAIE_OK) {
+			if (!AieHd) {
+				throw std::invalid_argument("perf sampler: empty device handle");
+			}
+			if (Depth == 0) {
+				throw std::invalid_argument("perf sampler: depth is 0");
+			}
+		}
+		XAiePerfSampler(XAieDev &Dev, uint32_t D = 1024):
+			XAiePerfSampler(Dev.getDevHandle(), D) {}
+		~XAiePerfSampler() {
+			stop();
+		}
+		/**
+		 * This function adds a perfcounter to the sampler. The counter
+		 * must be reserved. Counters cannot be added while sampling
+		 * is running.
+		 *
+		 * @param C perfcounter
+		 * @return index of the counter in the sample deltas for
+		 *	   success, -1 for failure
+		 */
+		int addCounter(std::shared_ptr<XAiePerfCounter> C) {
+			XAie_LocType L;
+			XAie_ModuleType M;
+			uint32_t I;
+
+			if (Running) {
+				Logger::log(LogLevel::ERROR) << "perf sampler " << __func__ <<
+					" sampler is running." << std::endl;
+				return -1;
+			}
+			if (!C || C->getRscId(L, M, I) != XAIE_OK) {
+				Logger::log(LogLevel::ERROR) << "perf sampler " << __func__ <<
+					" counter is not reserved." << std::endl;
+				return -1;
+			}
+			Counters.push_back({L, M, static_cast<uint8_t>(I), 0});
+			Prepared = false;
+			return static_cast<int>(Counters.size() - 1);
+		}
+		/**
+		 * This function returns the number of added counters.
+		 *
+		 * @return number of counters
+		 */
+		uint32_t getNumCounters() const {
+			return static_cast<uint32_t>(Counters.size());
+		}
+		/**
+		 * This function returns the number of block reads needed for
+		 * one sample.
+		 *
+		 * @return number of block reads
+		 */
+		uint32_t getNumBlocks() {
+			std::lock_guard<std::mutex> Lock(SampleLock);
+
+			_prepare();
+			return static_cast<uint32_t>(Blocks.size());
+		}
+		/**
+		 * This function reads all the added counters and pushes their
+		 * deltas since the previous call to the ring buffer. The first
+		 * call after adding counters only captures the baseline.
+		 * It is serialized with the background sampling thread.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC sample() {
+			std::lock_guard<std::mutex> SLock(SampleLock);
+			XAiePerfSample S;
+			AieRC RC;
+
+			_prepare();
+			S.Time = std::chrono::steady_clock::now();
+			for (auto &B: Blocks) {
+				RC = XAie_PerfCounterGetRange(AieHd->dev(), B.Loc,
+					B.Mod, B.Start, B.Num, &Raw[B.Offset]);
+				if (RC != XAIE_OK) {
+					Logger::log(LogLevel::ERROR) << "perf sampler " <<
+						__func__ << " (" << (uint32_t)B.Loc.Col <<
+						"," << (uint32_t)B.Loc.Row << ")" <<
+						" Mod=" << B.Mod << " failed to read counters." <<
+						std::endl;
+					return RC;
+				}
+			}
+			if (!HasPrev) {
+				Prev = Raw;
+				HasPrev = true;
+				return XAIE_OK;
+			}
+			S.Deltas.resize(Counters.size());
+			for (size_t i = 0; i < Counters.size(); i++) {
+				// Unsigned subtraction handles counter wrap around
+				S.Deltas[i] = Raw[Counters[i].RawIdx] -
+					Prev[Counters[i].RawIdx];
+			}
+			Prev.swap(Raw);
+
+			std::lock_guard<std::mutex> Lock(RingLock);
+			if (Count == Depth) {
+				Head = (Head + 1) % Depth;
+				Count--;
+				Dropped++;
+			}
+			Ring[(Head + Count) % Depth] = std::move(S);
+			Count++;
+			return XAIE_OK;
+		}
+		/**
+		 * This function pops the oldest sample from the ring buffer.
+		 *
+		 * @param S returns the sample
+		 * @return true if a sample is returned, false if the ring
+		 *	   buffer is empty
+		 */
+		bool readSample(XAiePerfSample &S) {
+			std::lock_guard<std::mutex> Lock(RingLock);
+
+			if (Count == 0) {
+				return false;
+			}
+			S = std::move(Ring[Head]);
+			Head = (Head + 1) % Depth;
+			Count--;
+			return true;
+		}
+		/**
+		 * This function returns the number of samples dropped because
+		 * the ring buffer was full.
+		 *
+		 * @return number of dropped samples
+		 */
+		uint64_t getDropped() {
+			std::lock_guard<std::mutex> Lock(RingLock);
+			return Dropped;
+		}
+		/**
+		 * This function starts sampling on a background thread at a
+		 * fixed period. Sampling stops on the first read failure, the
+		 * failure is returned by stop().
+		 *
+		 * @param Period sampling period
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC start(std::chrono::microseconds Period) {
+			AieRC RC;
+
+			if (Running) {
+				Logger::log(LogLevel::ERROR) << "perf sampler " << __func__ <<
+					" sampler is already running." << std::endl;
+				return XAIE_ERR;
+			}
+			if (Counters.empty() || Period.count() <= 0) {
+				Logger::log(LogLevel::ERROR) << "perf sampler " << __func__ <<
+					" no counters or invalid period." << std::endl;
+				return XAIE_INVALID_ARGS;
+			}
+			HasPrev = false;
+			RC = sample();
+			if (RC != XAIE_OK) {
+				return RC;
+			}
+			LastRC = XAIE_OK;
+			Running = true;
+			Sampler = std::thread([this, Period]() {
+				auto Next = std::chrono::steady_clock::now();
+
+				while (Running) {
+					Next += Period;
+					std::this_thread::sleep_until(Next);
+					if (!Running) {
+						break;
+					}
+					AieRC R = sample();
+					if (R != XAIE_OK) {
+						LastRC = R;
+						break;
+					}
+					// Skip the missed periods instead of bursting
+					auto Now = std::chrono::steady_clock::now();
+					if (Now > Next + Period) {
+						Next = Now;
+					}
+				}
+			});
+			return XAIE_OK;
+		}
+		/**
+		 * This function stops the background sampling.
+		 *
+		 * @return XAIE_OK if background sampling had no failure,
+		 *	   otherwise the failure from the sampling thread
+		 */
+		AieRC stop() {
+			Running = false;
+			if (Sampler.joinable()) {
+				Sampler.join();
+			}
+			return LastRC;
+		}
+	private:
+		struct CounterEntry {
+			XAie_LocType Loc;
+			XAie_ModuleType Mod;
+			uint8_t Id;
+			size_t RawIdx;
+		};
+		struct CounterBlock {
+			XAie_LocType Loc;
+			XAie_ModuleType Mod;
+			uint8_t Start;
+			uint8_t Num;
+			size_t Offset;
+		};
+		std::shared_ptr<XAieDevHandle> AieHd; /**< device handle */
+		uint32_t Depth; /**< ring buffer depth */
+		uint32_t Head; /**< ring buffer oldest entry */
+		uint32_t Count; /**< ring buffer number of entries */
+		uint64_t Dropped; /**< number of dropped samples */
+		bool Prepared; /**< if counter blocks are up to date */
+		bool HasPrev; /**< if baseline values are captured */
+		std::atomic<bool> Running; /**< if background thread runs */
+		std::atomic<AieRC> LastRC; /**< background sampling failure */
+		std::vector<CounterEntry> Counters; /**< added counters */
+		std::vector<CounterBlock> Blocks; /**< block reads per sample */
+		std::vector<uint32_t> Raw; /**< latest raw counter values */
+		std::vector<uint32_t> Prev; /**< previous raw counter values */
+		std::vector<XAiePerfSample> Ring; /**< sample ring buffer */
+		std::mutex SampleLock; /**< protects the counter values */
+		std::mutex RingLock; /**< protects the ring buffer */
+		std::thread Sampler; /**< background sampling thread */
+
+		/**
+		 * This function groups the counters by tile and module. Each
+		 * group is read from its lowest to its highest counter ID in
+		 * one block, the unused counters in between are read too as
+		 * it is cheaper than a separate read.
+		 */
+		void _prepare() {
+			std::vector<size_t> Order(Counters.size());
+
+			if (Prepared) {
+				return;
+			}
+			for (size_t i = 0; i < Order.size(); i++) {
+				Order[i] = i;
+			}
+			std::sort(Order.begin(), Order.end(),
+				[this](size_t A, size_t B) {
+				const CounterEntry &CA = Counters[A];
+				const CounterEntry &CB = Counters[B];
+				if (CA.Loc.Col != CB.Loc.Col) {
+					return CA.Loc.Col < CB.Loc.Col;
+				}
+				if (CA.Loc.Row != CB.Loc.Row) {
+					return CA.Loc.Row < CB.Loc.Row;
+				}
+				if (CA.Mod != CB.Mod) {
+					return CA.Mod < CB.Mod;
+				}
+				return CA.Id < CB.Id;
+			});
+
+			Blocks.clear();
+			for (auto i: Order) {
+				CounterEntry &C = Counters[i];
+
+				if (Blocks.empty() ||
+					Blocks.back().Loc.Col != C.Loc.Col ||
+					Blocks.back().Loc.Row != C.Loc.Row ||
+					Blocks.back().Mod != C.Mod) {
+					size_t Offset = 0;
+
+					if (!Blocks.empty()) {
+						Offset = Blocks.back().Offset +
+							Blocks.back().Num;
+					}
+					Blocks.push_back({C.Loc, C.Mod, C.Id, 0, Offset});
+				}
+				CounterBlock &B = Blocks.back();
+				B.Num = C.Id - B.Start + 1;
+				C.RawIdx = B.Offset + C.Id - B.Start;
+			}
+
+			size_t NumRaw = 0;
+			if (!Blocks.empty()) {
+				NumRaw = Blocks.back().Offset + Blocks.back().Num;
+			}
+			Raw.assign(NumRaw, 0);
+			Prev.assign(NumRaw, 0);
+			HasPrev = false;
+
+			std::lock_guard<std::mutex> Lock(RingLock);
+			Ring.assign(Depth, XAiePerfSample());
+			Head = 0;
+			Count = 0;
+			Prepared = true;
+		}
+	};
+}
@@ -0,0 +1,418 @@
+// Copyright(C) 2021 by Xilinx, Inc. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <cstring>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+#include <xaiengine.h>
+
+#pragma once
+
+namespace xaiefal {
+	/**
+	 * @enum XAieTraceFrameType
+	 * @brief type of trace frame.
+	 */
+	enum class XAieTraceFrameType {
+		INVALID,
+		SINGLE,
+		MULTIPLE,
+		START,
+		STOP,
+		REPEAT,
+		SYNC,
+		FILLER,
+	};
+
+	/**
+	 * @struct XAieTraceFrameFmt
+	 * @brief format of one trace frame.
+	 * A frame is identified by its first byte, (Byte & Mask) == Match.
+	 * The frame bytes are accumulated most significant byte first into
+	 * a 64 bits integer, the event field and the value field are then
+	 * extracted with their shift and width. For SINGLE frames the event
+	 * field is the trace slot, for MULTIPLE frames it is a bitmap of
+	 * trace slots. The value field is a cycle delta for event frames in
+	 * event-time mode, the PC in event-PC mode, the timer for START
+	 * frames and the repeat count for REPEAT frames.
+	 */
+	struct XAieTraceFrameFmt {
+		uint8_t Mask;
+		uint8_t Match;
+		uint8_t Len;
+		XAieTraceFrameType Type;
+		uint8_t EvShift;
+		uint8_t EvWidth;
+		uint8_t ValShift;
+		uint8_t ValWidth;
+	};
+
+	/**
+	 * This function returns the default trace frame table of the AIE
+	 * trace unit in event-time and event-PC modes.
+	 *
+	 * @return frame table
+	 */
+	static inline const std::vector<XAieTraceFrameFmt> &XAieTraceDefaultFrames() {
+		static const std::vector<XAieTraceFrameFmt> Frames = {
+			// 0eee tttt
+			{0x80, 0x00, 1, XAieTraceFrameType::SINGLE, 4, 3, 0, 4},
+			// 100e eett tttt tttt
+			{0xE0, 0x80, 2, XAieTraceFrameType::SINGLE, 10, 3, 0, 10},
+			// 101e eett tttt tttt tttt tttt
+			{0xE0, 0xA0, 3, XAieTraceFrameType::SINGLE, 18, 3, 0, 18},
+			// 1100 eeee eeee tttt
+			{0xF0, 0xC0, 2, XAieTraceFrameType::MULTIPLE, 4, 8, 0, 4},
+			// 1101 eeee eeee 00tt tttt tttt
+			{0xF0, 0xD0, 3, XAieTraceFrameType::MULTIPLE, 12, 8, 0, 10},
+			// 1110 eeee eeee 00tt tttt tttt tttt tttt
+			{0xF0, 0xE0, 4, XAieTraceFrameType::MULTIPLE, 20, 8, 0, 18},
+			// 1111 0000 followed by 56 bits timer
+			{0xFF, 0xF0, 8, XAieTraceFrameType::START, 0, 0, 0, 56},
+			// 1111 0001
+			{0xFF, 0xF1, 1, XAieTraceFrameType::STOP, 0, 0, 0, 0},
+			// 1111 01rr
+			{0xFC, 0xF4, 1, XAieTraceFrameType::REPEAT, 0, 0, 0, 2},
+			// 1111 1000 rrrr rrrr
+			{0xFF, 0xF8, 2, XAieTraceFrameType::REPEAT, 0, 0, 0, 8},
+			// 1111 1110
+			{0xFF, 0xFE, 1, XAieTraceFrameType::SYNC, 0, 0, 0, 0},
+			// 1111 1111
+			{0xFF, 0xFF, 1, XAieTraceFrameType::FILLER, 0, 0, 0, 0},
+		};
+		return Frames;
+	}
+
+	/**
+	 * @struct XAieTraceColumns
+	 * @brief decoded trace events in columnar layout.
+	 * Entry i of each column describes the i-th decoded event. Value is
+	 * the timestamp in cycles in event-time mode, or the PC in event-PC
+	 * mode. Loc is (column << 8 | row) of the traced tile.
+	 */
+	struct XAieTraceColumns {
+		std::vector<uint64_t> Value;
+		std::vector<uint16_t> Loc;
+		std::vector<uint8_t> PktType;
+		std::vector<uint8_t> Slot;
+		bool IsPc = false;
+
+		size_t size() const {
+			return Value.size();
+		}
+		void clear() {
+			Value.clear();
+			Loc.clear();
+			PktType.clear();
+			Slot.clear();
+		}
+		void push(uint64_t V, uint16_t L, uint8_t T, uint8_t S) {
+			Value.push_back(V);
+			Loc.push_back(L);
+			PktType.push_back(T);
+			Slot.push_back(S);
+		}
+		void append(const XAieTraceColumns &C) {
+			Value.insert(Value.end(), C.Value.begin(), C.Value.end());
+			Loc.insert(Loc.end(), C.Loc.begin(), C.Loc.end());
+			PktType.insert(PktType.end(), C.PktType.begin(),
+				C.PktType.end());
+			Slot.insert(Slot.end(), C.Slot.begin(), C.Slot.end());
+		}
+		/**
+		 * This function writes the columns in binary. The layout is
+		 * the "AIETRC1" magic, a flags byte (bit 0 set for PC
+		 * values), the little endian 64 bits number of events, then
+		 * each column stored contiguously in host byte order.
+		 *
+		 * @param OS output stream
+		 * @return true for success, false for failure
+		 */
+		bool writeBinary(std::ostream &OS) const {
+			uint64_t N = size();
+			uint8_t Hdr[16] = {'A', 'I', 'E', 'T', 'R', 'C', '1',
+				static_cast<uint8_t>(IsPc ? 1 : 0)};
+
+			for (int i = 0; i < 8; i++) {
+				Hdr[8 + i] = static_cast<uint8_t>(N >> (8 * i));
+			}
+			OS.write(reinterpret_cast<const char *>(Hdr), sizeof(Hdr));
+			OS.write(reinterpret_cast<const char *>(Value.data()),
+				N * sizeof(Value[0]));
+			OS.write(reinterpret_cast<const char *>(Loc.data()),
+				N * sizeof(Loc[0]));
+			OS.write(reinterpret_cast<const char *>(PktType.data()), N);
+			OS.write(reinterpret_cast<const char *>(Slot.data()), N);
+			return OS.good();
+		}
+		/**
+		 * This function writes the events as Chrome trace event
+		 * JSON, which can be loaded by Perfetto or chrome://tracing.
+		 * Each tile is a process and each trace packet type of the
+		 * tile is a thread. In event-PC mode the event order is used
+		 * as timestamp and the PC is added as argument.
+		 *
+		 * @param OS output stream
+		 * @param CyclesPerUs AI engine clock cycles per microsecond
+		 * @return true for success, false for failure
+		 */
+		bool writeChromeTrace(std::ostream &OS, double CyclesPerUs) const {
+			OS << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+			for (size_t i = 0; i < size(); i++) {
+				double Ts;
+
+				if (IsPc) {
+					Ts = static_cast<double>(i);
+				} else {
+					Ts = static_cast<double>(Value[i]) / CyclesPerUs;
+				}
+				OS << (i ? ",\n" : "\n") <<
+					"{\"name\":\"slot " << (uint32_t)Slot[i] <<
+					"\",\"ph\":\"i\",\"s\":\"t\",\"pid\":" <<
+					Loc[i] << ",\"tid\":" << (uint32_t)PktType[i] <<
+					",\"ts\":" << Ts;
+				if (IsPc) {
+					OS << ",\"args\":{\"pc\":" << Value[i] << "}";
+				}
+				OS << "}";
+			}
+			OS << "\n]}\n";
+			return OS.good();
+		}
+	};
+
+	/**
+	 * @class XAieTraceDecoder
+	 * @brief decoder of the AI engine trace stream.
+	 * The trace stream is a sequence of 32 bits words. If the trace is
+	 * packet switched, it is made of packets of a header word followed
+	 * by payload words, and the trace of each tile module is decoded
+	 * separately using the source column and row and packet type of the
+	 * header. Frames can span packets of the same source.
+	 * The decoder keeps its state across decode() calls, so the stream
+	 * can be fed in chunks of any number of words.
+	 */
+	class XAieTraceDecoder {
+	public:
+		XAieTraceDecoder(XAie_TraceMode M = XAIE_TRACE_EVENT_TIME,
+			bool Packetized = true, uint32_t PktWords = 8):
+			Mode(M), Pkt(Packetized), PktLen(PktWords), WordIdx(0),
+			Cur(nullptr), InvalidPkts(0), InvalidFrames(0) {
+			setFrameTable(XAieTraceDefaultFrames());
+			Raw.Loc = 0;
+			Raw.PktType = 0;
+		}
+		/**
+		 * This function sets the frame table used to decode the
+		 * trace. Entries listed first take priority.
+		 *
+		 * @param Frames frame table
+		 */
+		void setFrameTable(const std::vector<XAieTraceFrameFmt> &Frames) {
+			Table = Frames;
+			for (uint32_t b = 0; b < 256; b++) {
+				Lut[b] = -1;
+				for (size_t i = 0; i < Table.size(); i++) {
+					if ((b & Table[i].Mask) == Table[i].Match) {
+						Lut[b] = static_cast<int8_t>(i);
+						break;
+					}
+				}
+			}
+		}
+		/**
+		 * This function sets the source location and packet type
+		 * reported for a trace which is not packet switched.
+		 *
+		 * @param L traced tile location
+		 * @param PktType packet type reported for the events
+		 */
+		void setSource(XAie_LocType L, uint8_t PktType) {
+			Raw.Loc = (static_cast<uint16_t>(L.Col) << 8) | L.Row;
+			Raw.PktType = PktType;
+		}
+		/**
+		 * This function decodes trace words and appends the decoded
+		 * events to the output columns.
+		 *
+		 * @param Words trace words
+		 * @param NumWords number of trace words
+		 * @param Out output columns
+		 */
+		void decode(const uint32_t *Words, size_t NumWords,
+			XAieTraceColumns &Out) {
+			Out.IsPc = (Mode == XAIE_TRACE_EVENT_PC);
+			for (size_t i = 0; i < NumWords; i++) {
+				uint32_t W = Words[i];
+
+				if (!Pkt) {
+					_decodeWord(Raw, W, Out);
+					continue;
+				}
+				if (WordIdx == 0) {
+					Cur = _header(W);
+				} else if (Cur != nullptr) {
+					_decodeWord(*Cur, W, Out);
+				}
+				if (++WordIdx == PktLen) {
+					WordIdx = 0;
+				}
+			}
+		}
+		/**
+		 * This function returns the number of packets dropped due to
+		 * header parity error.
+		 *
+		 * @return number of invalid packets
+		 */
+		uint64_t getInvalidPkts() const {
+			return InvalidPkts;
+		}
+		/**
+		 * This function returns the number of bytes which do not
+		 * match any frame of the frame table.
+		 *
+		 * @return number of invalid frame bytes
+		 */
+		uint64_t getInvalidFrames() const {
+			return InvalidFrames;
+		}
+	private:
+		struct Source {
+			uint16_t Loc;
+			uint8_t PktType;
+			uint8_t Len = 0;
+			int8_t Fmt = -1;
+			uint64_t Frame = 0;
+			uint64_t Timer = 0;
+			XAieTraceFrameType LastType = XAieTraceFrameType::INVALID;
+			uint32_t LastEv = 0;
+			uint64_t LastVal = 0;
+		};
+		XAie_TraceMode Mode; /**< trace mode */
+		bool Pkt; /**< if the trace is packet switched */
+		uint32_t PktLen; /**< words per packet including header */
+		uint32_t WordIdx; /**< word index in current packet */
+		Source *Cur; /**< source of current packet */
+		Source Raw; /**< source of not packet switched trace */
+		uint64_t InvalidPkts; /**< packets with bad header */
+		uint64_t InvalidFrames; /**< bytes not matching any frame */
+		std::vector<XAieTraceFrameFmt> Table; /**< frame table */
+		int8_t Lut[256]; /**< first byte to frame table index */
+		std::unordered_map<uint32_t, Source> Sources; /**< packet sources */
+
+		/**
+		 * This function parses a packet header. The header has odd
+		 * parity in bit 31, the source column in bits 27:21, the
+		 * source row in bits 20:16, the packet type in bits 14:12 and
+		 * the packet ID in bits 4:0.
+		 */
+		Source *_header(uint32_t W) {
+			uint32_t P = W;
+
+			P ^= P >> 16;
+			P ^= P >> 8;
+			P ^= P >> 4;
+			P ^= P >> 2;
+			P ^= P >> 1;
+			if ((P & 1) == 0) {
+				InvalidPkts++;
+				return nullptr;
+			}
+
+			uint32_t Key = W & 0x0FFF701F;
+			auto It = Sources.find(Key);
+			if (It == Sources.end()) {
+				Source S;
+
+				S.Loc = static_cast<uint16_t>((((W >> 21) & 0x7F) << 8) |
+					((W >> 16) & 0x1F));
+				S.PktType = (W >> 12) & 0x7;
+				It = Sources.emplace(Key, S).first;
+			}
+			return &It->second;
+		}
+		void _decodeWord(Source &S, uint32_t W, XAieTraceColumns &Out) {
+			for (int Shift = 24; Shift >= 0; Shift -= 8) {
+				uint8_t B = (W >> Shift) & 0xFF;
+
+				if (S.Fmt < 0) {
+					S.Fmt = Lut[B];
+					if (S.Fmt < 0) {
+						InvalidFrames++;
+						continue;
+					}
+					S.Frame = 0;
+					S.Len = 0;
+				}
+				S.Frame = (S.Frame << 8) | B;
+				S.Len++;
+				if (S.Len == Table[S.Fmt].Len) {
+					_frame(S, Table[S.Fmt], Out);
+					S.Fmt = -1;
+				}
+			}
+		}
+		static uint64_t _field(uint64_t F, uint8_t Shift, uint8_t Width) {
+			if (Width == 0) {
+				return 0;
+			}
+			return (F >> Shift) & ((Width >= 64) ? ~0ULL :
+				((1ULL << Width) - 1));
+		}
+		void _events(Source &S, XAieTraceFrameType T, uint32_t Ev,
+			uint64_t Val, XAieTraceColumns &Out) {
+			uint64_t V;
+
+			if (Mode == XAIE_TRACE_EVENT_PC) {
+				V = Val;
+			} else {
+				S.Timer += Val;
+				V = S.Timer;
+			}
+			if (T == XAieTraceFrameType::SINGLE) {
+				Out.push(V, S.Loc, S.PktType, Ev);
+			} else {
+				for (uint8_t i = 0; Ev != 0; i++, Ev >>= 1) {
+					if (Ev & 1) {
+						Out.push(V, S.Loc, S.PktType, i);
+					}
+				}
+			}
+		}
+		void _frame(Source &S, const XAieTraceFrameFmt &F,
+			XAieTraceColumns &Out) {
+			uint32_t Ev = static_cast<uint32_t>(_field(S.Frame,
+				F.EvShift, F.EvWidth));
+			uint64_t Val = _field(S.Frame, F.ValShift, F.ValWidth);
+
+			switch (F.Type) {
+			case XAieTraceFrameType::SINGLE:
+			case XAieTraceFrameType::MULTIPLE:
+				_events(S, F.Type, Ev, Val, Out);
+				S.LastType = F.Type;
+				S.LastEv = Ev;
+				S.LastVal = Val;
+				break;
+			case XAieTraceFrameType::START:
+				S.Timer = Val;
+				S.LastType = XAieTraceFrameType::INVALID;
+				break;
+			case XAieTraceFrameType::REPEAT:
+				if (S.LastType != XAieTraceFrameType::INVALID) {
+					for (uint64_t i = 0; i <= Val; i++) {
+						_events(S, S.LastType, S.LastEv,
+							S.LastVal, Out);
+					}
+				}
+				break;
+			case XAieTraceFrameType::STOP:
+				S.LastType = XAieTraceFrameType::INVALID;
+				break;
+			default:
+				break;
+			}
+		}
+	};
+}
@@ -0,0 +1,340 @@
+// Copyright(C) 2021 by Xilinx, Inc. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <xaiengine.h>
+#include <xaiefal/common/xaiefal-log.hpp>
+#include <xaiefal/profile/xaiefal-trace-decode.hpp>
+
+#pragma once
+
+namespace xaiefal {
+	/**
+	 * @class XAieSpscQueue
+	 * @brief fixed capacity lock free queue of one producer thread and
+	 *	  one consumer thread.
+	 */
+	template<typename T>
+	class XAieSpscQueue {
+	public:
+		XAieSpscQueue() = delete;
+		XAieSpscQueue(size_t Depth): Head(0), Tail(0) {
+			size_t C = 1;
+
+			while (C < Depth) {
+				C <<= 1;
+			}
+			Buf.resize(C);
+			Mask = C - 1;
+		}
+		/**
+		 * This function pushes an entry, it must only be called by
+		 * the producer thread.
+		 *
+		 * @param V entry to push, moved into the queue on success
+		 * @return true for success, false if the queue is full
+		 */
+		bool push(T &V) {
+			size_t T0 = Tail.load(std::memory_order_relaxed);
+
+			if (T0 - Head.load(std::memory_order_acquire) > Mask) {
+				return false;
+			}
+			Buf[T0 & Mask] = std::move(V);
+			Tail.store(T0 + 1, std::memory_order_release);
+			return true;
+		}
+		/**
+		 * This function pops an entry, it must only be called by the
+		 * consumer thread.
+		 *
+		 * @param V returns the popped entry
+		 * @return true for success, false if the queue is empty
+		 */
+		bool pop(T &V) {
+			size_t H0 = Head.load(std::memory_order_relaxed);
+
+			if (H0 == Tail.load(std::memory_order_acquire)) {
+				return false;
+			}
+			V = std::move(Buf[H0 & Mask]);
+			Head.store(H0 + 1, std::memory_order_release);
+			return true;
+		}
+	private:
+		std::vector<T> Buf; /**< queue entries */
+		size_t Mask; /**< capacity - 1 */
+		std::atomic<size_t> Head; /**< next entry to pop */
+		std::atomic<size_t> Tail; /**< next entry to push */
+	};
+
+	/**
+	 * @class XAieTraceStream
+	 * @brief pipeline to drain the trace written by the shim DMA to a
+	 *	  memory buffer and decode it while tracing is running.
+	 * The shim DMA is expected to write packet switched trace to the
+	 * buffer as a ring, that is with a BD pointing to itself as next BD.
+	 * The buffer is zeroed before the trace starts, a packet header
+	 * never reads as zero because of its odd parity bit, so the drain
+	 * thread consumes packets from its read offset until it finds a
+	 * zero header. A nonzero header does not mean the rest of the
+	 * packet has landed, so a packet is only consumed once the header
+	 * of the packet after it is visible, the DMA writes the ring in
+	 * order. Consumed packets are zeroed for the next round of the
+	 * ring in whole cache lines only, a line shared with a packet
+	 * which is not consumed yet is left alone until it is, as writing
+	 * it back from a non-coherent cache would overwrite what the DMA
+	 * has written to it since. The drained words are passed to the
+	 * decode thread through a lock free queue.
+	 * A recorded trace can be fed with push() without memory buffer.
+	 */
+	class XAieTraceStream {
+	public:
+		XAieTraceStream() = delete;
+		XAieTraceStream(XAie_MemInst *M, XAie_TraceMode Mode =
+			XAIE_TRACE_EVENT_TIME, size_t QDepth = 64,
+			uint32_t PktWords = 8):
+			Mem(M), Decoder(Mode, true, PktWords), Queue(QDepth),
+			PktLen(PktWords), Offset(0), Cleared(0), Running(false),
+			Draining(false), Bytes(0), Dropped(0) {}
+		~XAieTraceStream() {
+			stop();
+		}
+		/**
+		 * This function returns the decoder, it can be used to
+		 * change the frame table before start().
+		 *
+		 * @return trace decoder
+		 */
+		XAieTraceDecoder &decoder() {
+			return Decoder;
+		}
+		/**
+		 * This function zeroes the trace buffer, it is to be called
+		 * before the trace starts.
+		 *
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC reset() {
+			if (Mem == nullptr || Running) {
+				return XAIE_ERR;
+			}
+			memset(XAie_MemGetVAddr(Mem), 0, Mem->Size);
+			Offset = 0;
+			Cleared = 0;
+			return XAie_MemSyncForDev(Mem);
+		}
+		/**
+		 * This function starts the decode thread, and the drain
+		 * thread if there is a memory buffer.
+		 *
+		 * @param Poll drain polling period
+		 * @return XAIE_OK for success, error code for failure
+		 */
+		AieRC start(std::chrono::microseconds Poll =
+			std::chrono::microseconds(1000)) {
+			if (Running) {
+				Logger::log(LogLevel::ERROR) << "trace stream " <<
+					__func__ << " already started." << std::endl;
+				return XAIE_ERR;
+			}
+			Running = true;
+			Draining = (Mem != nullptr);
+			Decode = std::thread([this]() {
+				_decodeLoop();
+			});
+			if (Mem != nullptr) {
+				Drain = std::thread([this, Poll]() {
+					while (Running) {
+						std::this_thread::sleep_for(Poll);
+						drain();
+					}
+					drain(true);
+					Draining = false;
+				});
+			}
+			return XAIE_OK;
+		}
+		/**
+		 * This function drains the trace buffer once. It is called by
+		 * the drain thread, it can be called directly if start() is
+		 * not used with a memory buffer.
+		 *
+		 * @param Final true if the trace has stopped and the DMA has
+		 *	  written all of it, the last packet is consumed without
+		 *	  waiting for the header of the packet after it.
+		 * @return number of drained words
+		 */
+		size_t drain(bool Final = false) {
+			std::vector<uint32_t> Chunk;
+			uint32_t *Base;
+			size_t NumWords, Next, Stale;
+
+			if (Mem == nullptr ||
+				XAie_MemSyncForCPU(Mem) != XAIE_OK) {
+				return 0;
+			}
+			Base = static_cast<uint32_t *>(XAie_MemGetVAddr(Mem));
+			NumWords = (Mem->Size / 4) / PktLen * PktLen;
+			while (Base[Offset] != 0) {
+				// Consumed words not zeroed yet must not be
+				// taken for a new packet after the ring wraps
+				Stale = (Offset + NumWords - Cleared) % NumWords;
+				Next = (Offset + PktLen) % NumWords;
+				if (Final) {
+					if (Stale + PktLen >= NumWords) {
+						break;
+					}
+				} else if (Stale + 2 * PktLen > NumWords ||
+					Base[Next] == 0) {
+					break;
+				}
+				Chunk.insert(Chunk.end(), &Base[Offset],
+					&Base[Offset + PktLen]);
+				Offset = Next;
+			}
+			if (Chunk.empty()) {
+				return 0;
+			}
+			if (_clear(Base, NumWords, Final)) {
+				XAie_MemSyncForDev(Mem);
+			}
+			NumWords = Chunk.size();
+			if (!push(Chunk)) {
+				Dropped += NumWords * 4;
+			}
+			return NumWords;
+		}
+		/**
+		 * This function passes trace words to the decode thread. It
+		 * must not be called while the drain thread is running.
+		 *
+		 * @param Chunk trace words, moved on success
+		 * @return true for success, false if the queue is full
+		 */
+		bool push(std::vector<uint32_t> &Chunk) {
+			size_t N = Chunk.size() * 4;
+
+			if (!Queue.push(Chunk)) {
+				return false;
+			}
+			Bytes += N;
+			return true;
+		}
+		/**
+		 * This function stops the pipeline, the remaining trace in
+		 * the buffer and in the queue is decoded before it returns.
+		 *
+		 * @return XAIE_OK
+		 */
+		AieRC stop() {
+			Running = false;
+			if (Drain.joinable()) {
+				Drain.join();
+			}
+			Draining = false;
+			if (Decode.joinable()) {
+				Decode.join();
+			}
+			return XAIE_OK;
+		}
+		/**
+		 * This function returns the decoded events, it must only be
+		 * called after stop().
+		 *
+		 * @return decoded events
+		 */
+		const XAieTraceColumns &getColumns() const {
+			return Columns;
+		}
+		/**
+		 * This function returns the number of trace bytes passed to
+		 * the decoder.
+		 *
+		 * @return number of bytes
+		 */
+		uint64_t getBytes() const {
+			return Bytes;
+		}
+		/**
+		 * This function returns the number of trace bytes dropped
+		 * because the decoder was not keeping up.
+		 *
+		 * @return number of bytes
+		 */
+		uint64_t getDropped() const {
+			return Dropped;
+		}
+	private:
+		XAie_MemInst *Mem; /**< trace memory buffer */
+		XAieTraceDecoder Decoder; /**< trace decoder */
+		XAieSpscQueue<std::vector<uint32_t>> Queue; /**< drained words */
+		uint32_t PktLen; /**< words per packet */
+		size_t Offset; /**< drain read offset in words */
+		size_t Cleared; /**< offset up to which the ring is zeroed */
+		std::atomic<bool> Running; /**< if pipeline is running */
+		std::atomic<bool> Draining; /**< if drain thread can push */
+		std::atomic<uint64_t> Bytes; /**< bytes passed to decoder */
+		std::atomic<uint64_t> Dropped; /**< bytes dropped */
+		XAieTraceColumns Columns; /**< decoded events */
+		std::thread Drain; /**< drain thread */
+		std::thread Decode; /**< decode thread */
+
+		/** largest data cache line of the supported hosts in words */
+		static constexpr size_t LineWords = 64 / 4;
+
+		/**
+		 * This function zeroes the consumed words of the ring from
+		 * the cleared offset, up to the start of the cache line of
+		 * the read offset. The end of the ring is not written by the
+		 * DMA, so it ends the last line.
+		 *
+		 * @param Base trace buffer virtual address
+		 * @param NumWords ring size in words
+		 * @param Final true to zero up to the read offset
+		 * @return true if anything is zeroed, false otherwise
+		 */
+		bool _clear(uint32_t *Base, size_t NumWords, bool Final) {
+			size_t End = Final ? Offset :
+				Offset / LineWords * LineWords;
+			bool Zeroed = false;
+
+			if (End < Cleared) {
+				memset(&Base[Cleared], 0,
+					(NumWords - Cleared) * 4);
+				Cleared = 0;
+				Zeroed = true;
+			}
+			if (End > Cleared) {
+				memset(&Base[Cleared], 0, (End - Cleared) * 4);
+				Cleared = End;
+				Zeroed = true;
+			}
+			return Zeroed;
+		}
+
+		void _decodeLoop() {
+			std::vector<uint32_t> Chunk;
+
+			while (true) {
+				if (Queue.pop(Chunk)) {
+					Decoder.decode(Chunk.data(), Chunk.size(),
+						Columns);
+				} else if (!Running && !Draining) {
+					// Producers are done, drain what is left
+					while (Queue.pop(Chunk)) {
+						Decoder.decode(Chunk.data(),
+							Chunk.size(), Columns);
+					}
+					break;
+				} else {
+					std::this_thread::yield();
+				}
+			}
+		}
+	};
+}
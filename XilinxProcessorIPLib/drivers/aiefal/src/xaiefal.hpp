@@ -9,6 +9,9 @@
 #include <xaiefal/common/xaiefal-common.hpp>
 #include <xaiefal/common/xaiefal-log.hpp>
 #include <xaiefal/profile/xaiefal-profile.hpp>
+#include <xaiefal/profile/xaiefal-perf-sampler.hpp>
+#include <xaiefal/profile/xaiefal-trace-decode.hpp>
+#include <xaiefal/profile/xaiefal-trace-stream.hpp>
 #include <xaiefal/rsc/xaiefal-bc.hpp>
 #include <xaiefal/rsc/xaiefal-events.hpp>
 #include <xaiefal/rsc/xaiefal-groupevent.hpp>
@@ -0,0 +1,105 @@
+// Copyright(C) 2021 by Xilinx, Inc. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "xaiefal/xaiefal.hpp"
+
+#include "CppUTest/CommandLineTestRunner.h"
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestRegistry.h"
+
+#include "common/tc_config.h"
+
+using namespace xaiefal;
+
+TEST_GROUP(PerfSampler)
+{
+};
+
+TEST(PerfSampler, Basic)
+{
+	AieRC RC;
+	XAiePerfSample S;
+
+	XAie_SetupConfig(ConfigPtr, HW_GEN, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_MEM_TILE_ROW_START, XAIE_MEM_TILE_NUM_ROWS,
+			XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+
+	RC = XAie_CfgInitialize(&(DevInst), &ConfigPtr);
+	CHECK_EQUAL(RC, XAIE_OK);
+
+	XAieDev Aie(&DevInst, true);
+	XAiePerfSampler Sampler(Aie, 2);
+
+	auto PCounter0 = Aie.tile(1,1).core().perfCounter();
+	auto PCounter1 = Aie.tile(1,1).core().perfCounter();
+	auto PCounter2 = Aie.tile(2,1).core().perfCounter();
+	auto PCounter3 = Aie.tile(1,1).core().perfCounter();
+
+	RC = PCounter0->initialize(XAIE_CORE_MOD, XAIE_EVENT_ACTIVE_CORE,
+		   XAIE_CORE_MOD, XAIE_EVENT_DISABLED_CORE);
+	CHECK_EQUAL(RC, XAIE_OK);
+	RC = PCounter1->initialize(XAIE_CORE_MOD, XAIE_EVENT_ACTIVE_CORE,
+		   XAIE_CORE_MOD, XAIE_EVENT_DISABLED_CORE);
+	CHECK_EQUAL(RC, XAIE_OK);
+	RC = PCounter2->initialize(XAIE_CORE_MOD, XAIE_EVENT_ACTIVE_CORE,
+		   XAIE_CORE_MOD, XAIE_EVENT_DISABLED_CORE);
+	CHECK_EQUAL(RC, XAIE_OK);
+
+	// Test add counter without reservation
+	CHECK_EQUAL(Sampler.addCounter(PCounter3), -1);
+
+	RC = PCounter0->reserve();
+	CHECK_EQUAL(RC, XAIE_OK);
+	RC = PCounter1->reserve();
+	CHECK_EQUAL(RC, XAIE_OK);
+	RC = PCounter2->reserve();
+	CHECK_EQUAL(RC, XAIE_OK);
+
+	CHECK_EQUAL(Sampler.addCounter(PCounter0), 0);
+	CHECK_EQUAL(Sampler.addCounter(PCounter2), 1);
+	CHECK_EQUAL(Sampler.addCounter(PCounter1), 2);
+	CHECK_EQUAL(Sampler.getNumCounters(), 3);
+	// Counters of the same tile module are read in one block
+	CHECK_EQUAL(Sampler.getNumBlocks(), 2);
+
+	// First sample only captures the baseline
+	RC = Sampler.sample();
+	CHECK_EQUAL(RC, XAIE_OK);
+	CHECK_EQUAL(Sampler.readSample(S), false);
+
+	RC = Sampler.sample();
+	CHECK_EQUAL(RC, XAIE_OK);
+	CHECK_EQUAL(Sampler.readSample(S), true);
+	CHECK_EQUAL(S.Deltas.size(), 3);
+
+	// Test ring buffer overflow
+	for (int i = 0; i < 3; i++) {
+		RC = Sampler.sample();
+		CHECK_EQUAL(RC, XAIE_OK);
+	}
+	CHECK_EQUAL(Sampler.getDropped(), 1);
+	CHECK_EQUAL(Sampler.readSample(S), true);
+	CHECK_EQUAL(Sampler.readSample(S), true);
+	CHECK_EQUAL(Sampler.readSample(S), false);
+
+	// Test background sampling
+	RC = Sampler.start(std::chrono::microseconds(1000));
+	CHECK_EQUAL(RC, XAIE_OK);
+	RC = Sampler.start(std::chrono::microseconds(1000));
+	CHECK_EQUAL(RC, XAIE_ERR);
+	CHECK_EQUAL(Sampler.addCounter(PCounter0), -1);
+	// Test on demand sampling while the background thread runs
+	for (int i = 0; i < 10; i++) {
+		RC = Sampler.sample();
+		CHECK_EQUAL(RC, XAIE_OK);
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	RC = Sampler.stop();
+	CHECK_EQUAL(RC, XAIE_OK);
+	CHECK_EQUAL(Sampler.readSample(S), true);
+	CHECK_EQUAL(S.Deltas.size(), 3);
+}
@@ -0,0 +1,127 @@
+// Copyright(C) 2021 by Xilinx, Inc. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "xaiefal/xaiefal.hpp"
+
+#include "CppUTest/CommandLineTestRunner.h"
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestRegistry.h"
+
+#include "common/tc_config.h"
+
+using namespace xaiefal;
+
+TEST_GROUP(TraceDecode)
+{
+};
+
+TEST(TraceDecode, Packets)
+{
+	XAieTraceColumns C;
+	XAieTraceDecoder D;
+	// Tile (2,1) packet type 1, odd parity without parity bit
+	uint32_t Hdr = (2 << 21) | (1 << 16) | (1 << 12);
+	std::vector<uint32_t> Words = {
+		Hdr,
+		// Start frame, timer 0x100
+		0xF0000000, 0x00000100,
+		// Single0 slot 1 +3, Single1 slot 2 +0x105, Repeat0 once
+		0x138905F4,
+		// Multiple0 slots 0 and 7 +2, Filler, Filler
+		0xC812FFFF,
+		0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+		// Packet with bad parity is dropped
+		Hdr | 0x80000000,
+		0x10101010, 0x10101010, 0x10101010,
+		0x10101010, 0x10101010, 0x10101010, 0x10101010,
+	};
+
+	// Feed in two chunks to test frames across calls
+	D.decode(Words.data(), 3, C);
+	D.decode(Words.data() + 3, Words.size() - 3, C);
+
+	CHECK_EQUAL(C.IsPc, false);
+	CHECK_EQUAL(C.size(), 5);
+	CHECK_EQUAL(D.getInvalidPkts(), 1);
+	CHECK_EQUAL(D.getInvalidFrames(), 0);
+	CHECK_EQUAL(C.Loc[0], (2 << 8) | 1);
+	CHECK_EQUAL(C.PktType[0], 1);
+	CHECK_EQUAL(C.Value[0], 0x103);
+	CHECK_EQUAL(C.Slot[0], 1);
+	CHECK_EQUAL(C.Value[1], 0x208);
+	CHECK_EQUAL(C.Slot[1], 2);
+	CHECK_EQUAL(C.Value[2], 0x30D);
+	CHECK_EQUAL(C.Slot[2], 2);
+	CHECK_EQUAL(C.Value[3], 0x30F);
+	CHECK_EQUAL(C.Slot[3], 0);
+	CHECK_EQUAL(C.Value[4], 0x30F);
+	CHECK_EQUAL(C.Slot[4], 7);
+}
+
+TEST(TraceDecode, Stream)
+{
+	XAieTraceStream S(nullptr, XAIE_TRACE_EVENT_TIME, 4);
+	std::vector<uint32_t> Words = {
+		(1 << 16),
+		0x01020304, 0x05060708, 0xFFFFFFFF,
+		0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+	};
+
+	CHECK_EQUAL(S.start(), XAIE_OK);
+	for (int i = 0; i < 16; i++) {
+		std::vector<uint32_t> Chunk = Words;
+
+		while (!S.push(Chunk)) {
+			std::this_thread::yield();
+		}
+	}
+	CHECK_EQUAL(S.stop(), XAIE_OK);
+	CHECK_EQUAL(S.getBytes(), 16 * Words.size() * 4);
+	CHECK_EQUAL(S.getColumns().size(), 16 * 8);
+}
+
+TEST(TraceDecode, StreamRing)
+{
+	XAie_SetupConfig(ConfigPtr, HW_GEN, XAIE_BASE_ADDR, XAIE_COL_SHIFT,
+		XAIE_ROW_SHIFT, XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+		XAIE_MEM_TILE_ROW_START, XAIE_MEM_TILE_NUM_ROWS,
+		XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+	AieRC RC = XAie_CfgInitialize(&DevInst, &ConfigPtr);
+	CHECK_EQUAL(RC, XAIE_OK);
+
+	// Ring of four packets in two 64 bytes lines
+	XAie_MemInst *M = XAie_MemAllocate(&DevInst, 4 * 8 * 4,
+		XAIE_MEM_CACHEABLE);
+	CHECK_TRUE(M != nullptr);
+	uint32_t *B = static_cast<uint32_t *>(XAie_MemGetVAddr(M));
+	XAieTraceStream S(M);
+
+	CHECK_EQUAL(S.reset(), XAIE_OK);
+	// Header of packet 0 without the header of packet 1 is not enough
+	B[0] = 1 << 16;
+	CHECK_EQUAL(S.drain(), 0);
+	// Packet 0 is consumed, its line is shared with packet 1 so it is
+	// not zeroed yet
+	B[8] = 1 << 16;
+	CHECK_EQUAL(S.drain(), 8);
+	CHECK_EQUAL(B[0], 1 << 16);
+	// Packet 1 is consumed, the first line is zeroed
+	B[16] = 1 << 16;
+	CHECK_EQUAL(S.drain(), 8);
+	CHECK_EQUAL(B[0], 0);
+	CHECK_EQUAL(B[8], 0);
+	// The DMA wraps to packet 0, the last packet is consumed by the
+	// final drain only
+	B[24] = 1 << 16;
+	B[0] = 1 << 16;
+	CHECK_EQUAL(S.drain(), 16);
+	CHECK_EQUAL(S.drain(), 0);
+	CHECK_EQUAL(S.drain(true), 8);
+	CHECK_EQUAL(B[0], 0);
+	CHECK_EQUAL(B[16], 0);
+	CHECK_EQUAL(B[24], 0);
+
+	XAie_MemFree(M);
+	XAie_Finish(&DevInst);
+}
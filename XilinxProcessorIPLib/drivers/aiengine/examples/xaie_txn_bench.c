@@ -0,0 +1,221 @@
+/******************************************************************************
+* Copyright (C) 2021 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_txn_bench.c
+* @{
+*
+* This file contains the benchmark of the transaction record / replay of the
+* AIE driver IO layer.
+*
+* Every iteration sets up the DMA of all the tiles and NoC shim tiles of the
+* array: a ping / pong BD pair with locks, the start BD and the channel enable,
+* on an S2MM channel of the tiles and an MM2S channel of the shim tiles. The
+* time per iteration is reported for two methods:
+*	- the DMA driver APIs, called every iteration,
+*	- a transaction of the same API calls, recorded once and replayed every
+*	  iteration.
+* The benchmark is meant to be run with the simulation or Linux backend, where
+* every register access is a transaction with the device.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  dc      10/31/2021  Initial creation
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <time.h>
+
+#include "xaiegbl_defs.h"
+#include "xaiegbl.h"
+#include "xaiedma_shim.h"
+#include "xaiedma_tile.h"
+
+#ifndef __AIEBAREMTL__
+/************************** Constant Definitions *****************************/
+#define XAIE_NUM_ROWS		8
+#define XAIE_NUM_COLS		50
+#define XAIE_ADDR_ARRAY_OFF	0x800
+
+#define NUM_ITERS		16
+#define PING_BD			0U
+#define PONG_BD			1U
+#define PING_ADDR		0x1000U
+#define PONG_ADDR		0x2000U
+#define BUF_LEN			0x400U
+#define SHIM_PING_ADDR		0x80000000U
+#define SHIM_PONG_ADDR		0x80010000U
+
+/************************** Variable Definitions *****************************/
+XAieGbl_Config *AieConfigPtr;	/**< AIE configuration pointer */
+XAieGbl AieInst;		/**< AIE global instance */
+XAieGbl_HwCfg AieConfig;	/**< AIE HW configuration instance */
+
+XAieGbl_Tile TileInst[XAIE_NUM_COLS][XAIE_NUM_ROWS + 1];
+XAieDma_Tile TileDmaInst[XAIE_NUM_COLS][XAIE_NUM_ROWS];
+XAieDma_Shim ShimDmaInst[XAIE_NUM_COLS];
+
+/************************** Function Definitions *****************************/
+static double NowUs(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return Ts.tv_sec * 1e6 + Ts.tv_nsec / 1e3;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sets up the ping / pong BDs and the channels of the tile and
+* NoC shim tile DMAs of the whole array.
+*
+* @param	None.
+*
+* @return	None.
+*
+*******************************************************************************/
+static void SetupDmas(void)
+{
+	u32 Col, Row;
+
+	for(Col = 0U; Col < XAIE_NUM_COLS; Col++) {
+		XAieDma_Shim *Shim = &ShimDmaInst[Col];
+
+		for(Row = 0U; Row < XAIE_NUM_ROWS; Row++) {
+			XAieDma_Tile *Dma = &TileDmaInst[Col][Row];
+
+			XAieDma_TileBdSetLock(Dma, PING_BD, XAIEDMA_TILE_BD_ADDRA,
+					0U, 1U, 1U, 1U, 0U);
+			XAieDma_TileBdSetAdrLenMod(Dma, PING_BD, PING_ADDR, 0U,
+					BUF_LEN, XAIE_DISABLE, XAIE_DISABLE);
+			XAieDma_TileBdSetNext(Dma, PING_BD, PONG_BD);
+			XAieDma_TileBdWrite(Dma, PING_BD);
+
+			XAieDma_TileBdSetLock(Dma, PONG_BD, XAIEDMA_TILE_BD_ADDRA,
+					1U, 1U, 1U, 1U, 0U);
+			XAieDma_TileBdSetAdrLenMod(Dma, PONG_BD, PONG_ADDR, 0U,
+					BUF_LEN, XAIE_DISABLE, XAIE_DISABLE);
+			XAieDma_TileBdSetNext(Dma, PONG_BD, PING_BD);
+			XAieDma_TileBdWrite(Dma, PONG_BD);
+
+			XAieDma_TileSetStartBd(Dma, XAIEDMA_TILE_CHNUM_S2MM0,
+					PING_BD);
+			XAieDma_TileChControl(Dma, XAIEDMA_TILE_CHNUM_S2MM0,
+					XAIE_RESETDISABLE, XAIE_ENABLE);
+		}
+
+		if(TileInst[Col][0U].TileType != XAIEGBL_TILE_TYPE_SHIMNOC) {
+			continue;
+		}
+
+		XAieDma_ShimBdSetLock(Shim, PING_BD, 0U, 1U, 1U, 1U, 0U);
+		XAieDma_ShimBdSetAddr(Shim, PING_BD, 0U, SHIM_PING_ADDR,
+				BUF_LEN);
+		XAieDma_ShimBdSetNext(Shim, PING_BD, PONG_BD);
+		XAieDma_ShimBdWrite(Shim, PING_BD);
+
+		XAieDma_ShimBdSetLock(Shim, PONG_BD, 1U, 1U, 1U, 1U, 0U);
+		XAieDma_ShimBdSetAddr(Shim, PONG_BD, 0U, SHIM_PONG_ADDR,
+				BUF_LEN);
+		XAieDma_ShimBdSetNext(Shim, PONG_BD, PING_BD);
+		XAieDma_ShimBdWrite(Shim, PONG_BD);
+
+		XAieDma_ShimSetStartBd(Shim, XAIEDMA_SHIM_CHNUM_MM2S0, PING_BD);
+		XAieDma_ShimChControl(Shim, XAIEDMA_SHIM_CHNUM_MM2S0,
+				XAIE_DISABLE, XAIE_DISABLE, XAIE_ENABLE);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the main entry point for the AIE driver transaction benchmark.
+*
+* @param	None.
+*
+* @return	0 on success and 1 on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int main(void)
+{
+	XAieGbl_TxnInst *Txn;
+	u32 Col, Row, Iter, NumShims = 0U, Ret = XAIE_SUCCESS;
+	double Start, Direct, Replay;
+
+	XAIEGBL_HWCFG_SET_CONFIG((&AieConfig), XAIE_NUM_ROWS, XAIE_NUM_COLS,
+			XAIE_ADDR_ARRAY_OFF);
+	XAieGbl_HwInit(&AieConfig);
+	AieConfigPtr = XAieGbl_LookupConfig(XPAR_AIE_DEVICE_ID);
+	XAieGbl_CfgInitialize(&AieInst, &TileInst[0][0], AieConfigPtr);
+
+	for(Col = 0U; Col < XAIE_NUM_COLS; Col++) {
+		for(Row = 0U; Row < XAIE_NUM_ROWS; Row++) {
+			XAieDma_TileSoftInitialize(&TileInst[Col][Row + 1U],
+					&TileDmaInst[Col][Row]);
+		}
+		if(TileInst[Col][0U].TileType == XAIEGBL_TILE_TYPE_SHIMNOC) {
+			XAieDma_ShimSoftInitialize(&TileInst[Col][0U],
+					&ShimDmaInst[Col]);
+			NumShims++;
+		}
+	}
+
+	/* DMA driver APIs every iteration */
+	Start = NowUs();
+	for(Iter = 0U; Iter < NUM_ITERS; Iter++) {
+		SetupDmas();
+	}
+	Direct = (NowUs() - Start) / NUM_ITERS;
+
+	/* Record once, replay every iteration */
+	Txn = XAieGbl_TxnStart();
+	if(Txn == XAIE_NULL) {
+		printf("Failed to start the transaction.\n");
+		return 1;
+	}
+	SetupDmas();
+	if(XAieGbl_TxnStop(Txn) != XAIE_SUCCESS) {
+		printf("Failed to record the transaction.\n");
+		XAieGbl_TxnFree(Txn);
+		return 1;
+	}
+
+	Start = NowUs();
+	for(Iter = 0U; Iter < NUM_ITERS; Iter++) {
+		Ret |= XAieGbl_TxnReplay(Txn);
+	}
+	Replay = (NowUs() - Start) / NUM_ITERS;
+
+	if(Ret != XAIE_SUCCESS) {
+		printf("Failed to replay the transaction.\n");
+		XAieGbl_TxnFree(Txn);
+		return 1;
+	}
+
+	printf("%d tiles, %u shim tiles, %d iterations\n",
+			XAIE_NUM_COLS * XAIE_NUM_ROWS, NumShims, NUM_ITERS);
+	printf("transaction: %u words in %u accesses\n",
+			XAieGbl_TxnGetNumWords(Txn), XAieGbl_TxnGetNumCmds(Txn));
+	printf("dma driver apis:    %10.1f us/iteration\n", Direct);
+	printf("transaction replay: %10.1f us/iteration\n", Replay);
+
+	XAieGbl_TxnFree(Txn);
+
+	return 0;
+}
+#endif
+
+/** @} */
@@ -22,6 +22,7 @@
 * 1.3  Hyun    01/08/2019  Use the poll function
 * 1.4  Hyun    06/20/2019  Added APIs for individual BD / Channel reset
 * 1.5  Hyun    06/20/2019  Add XAieDma_ShimSoftInitialize()
+* 1.6  dc      10/31/2021  Write the BD words with one block write
 * </pre>
 *
 ******************************************************************************/
@@ -371,7 +372,6 @@ void XAieDma_ShimBdWrite(XAieDma_Shim *DmaInstPtr, u8 BdNum)
 {
 	u64 BdAddr;
 	u32 BdWord[XAIEDMA_SHIM_NUM_BD_WORDS];
-	u32 Idx;
 	XAieDma_ShimBd *DescrPtr;
 
 	XAie_AssertNonvoid(DmaInstPtr != XAIE_NULL);
@@ -433,10 +433,9 @@ void XAieDma_ShimBdWrite(XAieDma_Shim *DmaInstPtr, u8 BdNum)
                 XAie_SetField(DescrPtr->PktId, ShimBd[BdNum].Pkt.Id.Lsb,
                                         ShimBd[BdNum].Pkt.Id.Mask));
 
-	for(Idx = 0U; Idx < XAIEDMA_SHIM_NUM_BD_WORDS; Idx++) {
-		BdAddr = DmaInstPtr->BaseAddress + ShimBd[BdNum].RegOff[Idx];
-                XAieGbl_Write32(BdAddr, BdWord[Idx]);
-	}
+	/* The BD words are at contiguous register offsets */
+	BdAddr = DmaInstPtr->BaseAddress + ShimBd[BdNum].RegOff[0U];
+	XAieGbl_BlockWrite32(BdAddr, BdWord, XAIEDMA_SHIM_NUM_BD_WORDS);
 }
 
 /*****************************************************************************/
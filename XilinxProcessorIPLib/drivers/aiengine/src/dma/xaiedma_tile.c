@@ -28,6 +28,7 @@
 * 1.8  Hyun    06/20/2019  Add XAieDma_TileBdClearAll() that resets all sw BDs
 * 1.9  Hyun    06/20/2019  Added APIs for individual BD / Channel reset
 * 2.0  Hyun    06/20/2019  Add XAieDma_TileSoftInitialize()
+* 2.1  dc      10/31/2021  Write the BD words with one block write
 * </pre>
 *
 ******************************************************************************/
@@ -414,7 +415,6 @@ void XAieDma_TileBdWrite(XAieDma_Tile *DmaInstPtr, u8 BdNum)
 {
 	u64 BdAddr;
 	u32 BdWord[XAIEDMA_TILE_NUM_BD_WORDS];
-	u32 Idx;
 	XAieDma_TileBd *DescrPtr;
 
 	DescrPtr = (XAieDma_TileBd *)&(DmaInstPtr->Descrs[BdNum]);
@@ -531,10 +531,9 @@ void XAieDma_TileBdWrite(XAieDma_Tile *DmaInstPtr, u8 BdNum)
 				TileBd[BdNum].Ctrl.Len.Lsb,
 				TileBd[BdNum].Ctrl.Len.Mask);
 
-	for(Idx = 0U; Idx < XAIEDMA_TILE_NUM_BD_WORDS; Idx++) {
-		BdAddr = DmaInstPtr->BaseAddress + TileBd[BdNum].RegOff[Idx];
-		XAieGbl_Write32(BdAddr, BdWord[Idx]);
-	}
+	/* The BD words are at contiguous register offsets */
+	BdAddr = DmaInstPtr->BaseAddress + TileBd[BdNum].RegOff[0U];
+	XAieGbl_BlockWrite32(BdAddr, BdWord, XAIEDMA_TILE_NUM_BD_WORDS);
 }
 
 /*****************************************************************************/
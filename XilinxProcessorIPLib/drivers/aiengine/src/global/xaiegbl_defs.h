@@ -22,6 +22,7 @@
 * 1.3  Nishad  12/05/2018  Renamed ME attributes to AIE
 * 1.4  Hyun    01/08/2019  Add the mask poll function
 * 1.5  Tejus   10/14/2019  Enable assertion for linux and simulation
+* 1.6  dc      10/31/2021  Add block write and transaction APIs
 * </pre>
 *
 ******************************************************************************/
@@ -59,6 +60,7 @@
 #define XAieGbl_Write32                  XAieLib_Write32
 #define XAieGbl_MaskWrite32              XAieLib_MaskWrite32
 #define XAieGbl_Write128                 XAieLib_Write128
+#define XAieGbl_BlockWrite32             XAieLib_BlockWrite32
 #define XAieGbl_WriteCmd                 XAieLib_WriteCmd
 #define XAieGbl_MaskPoll                 XAieLib_MaskPoll
 #define XAieGbl_LoadElf                  XAieLib_LoadElf
@@ -84,6 +86,14 @@
 #define XAieGbl_MemRead32                XAieLib_MemRead32
 #define XAieGbl_MemWrite32               XAieLib_MemWrite32
 
+#define XAieGbl_TxnInst                  XAieLib_TxnInst
+#define XAieGbl_TxnStart                 XAieLib_TxnStart
+#define XAieGbl_TxnStop                  XAieLib_TxnStop
+#define XAieGbl_TxnReplay                XAieLib_TxnReplay
+#define XAieGbl_TxnFree                  XAieLib_TxnFree
+#define XAieGbl_TxnGetNumCmds            XAieLib_TxnGetNumCmds
+#define XAieGbl_TxnGetNumWords           XAieLib_TxnGetNumWords
+
 #define XAieGbl_IntrRegisterIsr          XAieLib_InterruptRegisterIsr
 #define XAieGbl_IntrUnregisterIsr        XAieLib_InterruptUnregisterIsr
 
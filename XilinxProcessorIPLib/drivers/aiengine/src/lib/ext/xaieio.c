@@ -20,6 +20,7 @@
 * 1.0  Hyun    07/12/2018  Initial creation
 * 1.1  Hyun    10/11/2018  Initialize the IO device for mem instance
 * 1.2  Nishad  12/05/2018  Renamed ME attributes to AIE
+* 1.3  dc      10/31/2021  Add XAieIO_BlockWrite32()
 * </pre>
 *
 ******************************************************************************/
@@ -382,6 +383,32 @@ void XAieIO_Write128(u64 Addr, u32 *Data)
 	}
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to write a block of contiguous 32bit words
+* starting from the specified address.
+*
+* @param	Addr: Address to write to.
+* @param	Data: Pointer to the data buffer.
+* @param	Size: Number of 32bit words to write.
+*
+* @return	None.
+*
+* @note		The registers only support 32bit accesses, so the words are
+*		written one at a time, as the access widths of a libmetal
+*		block write are not guaranteed.
+*
+*******************************************************************************/
+void XAieIO_BlockWrite32(u64 Addr, const u32 *Data, u32 Size)
+{
+	u32 Idx;
+
+	for(Idx = 0U; Idx < Size; Idx++) {
+		XAieIO_Write32(Addr + Idx * 4U, Data[Idx]);
+	}
+}
+
 /*****************************************************************************/
 /**
 *
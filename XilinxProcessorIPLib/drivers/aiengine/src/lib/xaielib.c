@@ -38,6 +38,7 @@
 * 2.6  Tejus   10/14/2019  Enable assertion for linux and simulation
 * 2.7  Wendy   02/25/2020  Add logging API
 * 2.8  Tejus   04/17/2020  Fix variable overflow issue.
+* 2.9  dc      10/31/2021  Add block write and transaction record / replay
 * </pre>
 *
 ******************************************************************************/
@@ -46,6 +47,7 @@
 #include "xaielib_npi.h"
 #include <stdarg.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #ifdef __AIESIM__ /* AIE simulator */
@@ -95,6 +97,14 @@
 /* Address should be aligned at 128 bit / 16 bytes */
 #define XAIELIB_SHIM_MEM_ALIGN		16
 
+/* Transaction command opcodes */
+#define XAIELIB_TXN_OP_WRITE		0U
+#define XAIELIB_TXN_OP_MASKWRITE	1U
+
+/* Initial transaction buffer sizes, doubled when full */
+#define XAIELIB_TXN_INIT_CMDS		16U
+#define XAIELIB_TXN_INIT_WORDS		64U
+
 /************************** Variable Definitions *****************************/
 typedef struct XAieLib_MemInst
 {
@@ -104,10 +114,36 @@ typedef struct XAieLib_MemInst
 	void *Platform;	/**< Platform specific data */
 } XAieLib_MemInst;
 
+typedef struct XAieLib_TxnCmd
+{
+	u64 Addr;	/**< Register address */
+	u32 Mask;	/**< Mask, mask write only */
+	u32 DataIdx;	/**< Index of the first data word */
+	u32 Size;	/**< Number of data words */
+	u8 Opcode;	/**< XAIELIB_TXN_OP_* */
+} XAieLib_TxnCmd;
+
+typedef struct XAieLib_TxnInst
+{
+	XAieLib_TxnCmd *Cmds;	/**< Recorded commands */
+	u32 NumCmds;		/**< Number of recorded commands */
+	u32 MaxCmds;		/**< Size of the command buffer */
+	u32 *Data;		/**< Data words of all commands */
+	u32 NumWords;		/**< Number of recorded data words */
+	u32 MaxWords;		/**< Size of the data buffer */
+	u8 Failed;		/**< Set if the recording ran out of memory */
+} XAieLib_TxnInst;
+
 #ifdef __linux__
 static FILE *XAieLib_LogFPtr; /**< Pointer to Log file pointer. */
 #endif
 
+#ifdef __linux__
+static __thread XAieLib_TxnInst *XAieLib_TxnCur; /**< Transaction being recorded */
+#else
+static XAieLib_TxnInst *XAieLib_TxnCur; /**< Transaction being recorded */
+#endif
+
 /************************** Function Definitions *****************************/
 
 /*****************************************************************************/
@@ -879,6 +915,118 @@ u32 XAieLib_MemRead32(XAieLib_MemInst *XAieLib_MemInstPtr, u64 Addr)
 #endif
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the platform IO function to write a block of contiguous 32bit words.
+*
+* @param	Addr: Address to write to.
+* @param	Data: Pointer to the data buffer.
+* @param	Size: Number of 32bit words to write.
+*
+* @return	None.
+*
+* @note		Internal only. It bypasses the transaction recording.
+*
+*******************************************************************************/
+static void XAieLib_IOBlockWrite32(u64 Addr, const u32 *Data, u32 Size)
+{
+#ifdef __AIESIM__
+	u32 Idx;
+
+	for(Idx = 0U; Idx < Size; Idx++) {
+		XAieSim_Write32(Addr + Idx * 4U, Data[Idx]);
+	}
+#elif defined __AIEBAREMTL__
+	u32 Idx;
+
+	for(Idx = 0U; Idx < Size; Idx++) {
+		Xil_Out32((u32)Addr + Idx * 4U, Data[Idx]);
+	}
+#else
+	XAieIO_BlockWrite32(Addr, Data, Size);
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This function appends a write command to the transaction being recorded.
+* A write to the address right after the previous write command is merged
+* into it, so contiguous register writes are replayed as one block write.
+*
+* @param	Opcode: XAIELIB_TXN_OP_WRITE or XAIELIB_TXN_OP_MASKWRITE.
+* @param	Addr: Address to write to.
+* @param	Mask: Mask of the mask write. Unused for the write.
+* @param	Data: Pointer to the data words.
+* @param	Size: Number of data words. Should be 1 for the mask write.
+*
+* @return	None.
+*
+* @note		Internal only. If the buffers can't be grown, the transaction
+*		is marked as failed and XAieLib_TxnStop() reports it.
+*
+*******************************************************************************/
+static void XAieLib_TxnRecord(u8 Opcode, u64 Addr, u32 Mask, const u32 *Data,
+		u32 Size)
+{
+	XAieLib_TxnInst *Txn = XAieLib_TxnCur;
+	XAieLib_TxnCmd *Cmd;
+
+	if(Txn->Failed != 0U) {
+		return;
+	}
+
+	if(Txn->NumWords + Size > Txn->MaxWords) {
+		u32 MaxWords = Txn->MaxWords;
+		u32 *Words;
+
+		while(Txn->NumWords + Size > MaxWords) {
+			MaxWords *= 2U;
+		}
+		Words = realloc(Txn->Data, MaxWords * sizeof(*Words));
+		if(Words == XAIE_NULL) {
+			Txn->Failed = 1U;
+			return;
+		}
+		Txn->Data = Words;
+		Txn->MaxWords = MaxWords;
+	}
+
+	Cmd = XAIE_NULL;
+	if(Txn->NumCmds > 0U) {
+		Cmd = &Txn->Cmds[Txn->NumCmds - 1U];
+	}
+
+	if((Cmd == XAIE_NULL) || (Opcode != XAIELIB_TXN_OP_WRITE) ||
+			(Cmd->Opcode != XAIELIB_TXN_OP_WRITE) ||
+			(Cmd->Addr + Cmd->Size * 4U != Addr)) {
+		if(Txn->NumCmds == Txn->MaxCmds) {
+			XAieLib_TxnCmd *Cmds;
+
+			Cmds = realloc(Txn->Cmds,
+					Txn->MaxCmds * 2U * sizeof(*Cmds));
+			if(Cmds == XAIE_NULL) {
+				Txn->Failed = 1U;
+				return;
+			}
+			Txn->Cmds = Cmds;
+			Txn->MaxCmds *= 2U;
+		}
+
+		Cmd = &Txn->Cmds[Txn->NumCmds++];
+		Cmd->Opcode = Opcode;
+		Cmd->Addr = Addr;
+		Cmd->Mask = Mask;
+		Cmd->DataIdx = Txn->NumWords;
+		Cmd->Size = 0U;
+	}
+
+	memcpy(&Txn->Data[Txn->NumWords], Data, Size * sizeof(*Data));
+	Txn->NumWords += Size;
+	Cmd->Size += Size;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -945,6 +1093,11 @@ void XAieLib_Read128(u64 Addr, u32 *Data)
 *******************************************************************************/
 void XAieLib_Write32(u64 Addr, u32 Data)
 {
+	if(XAieLib_TxnCur != XAIE_NULL) {
+		XAieLib_TxnRecord(XAIELIB_TXN_OP_WRITE, Addr, 0U, &Data, 1U);
+		return;
+	}
+
 #ifdef __AIESIM__
 	XAieSim_Write32(Addr, Data);
 #elif defined __AIEBAREMTL__
@@ -973,6 +1126,12 @@ void XAieLib_MaskWrite32(u64 Addr, u32 Mask, u32 Data)
 {
 	u32 RegVal;
 
+	if(XAieLib_TxnCur != XAIE_NULL) {
+		XAieLib_TxnRecord(XAIELIB_TXN_OP_MASKWRITE, Addr, Mask, &Data,
+				1U);
+		return;
+	}
+
 #ifdef __AIESIM__
 	XAieSim_MaskWrite32(Addr, Mask, Data);
 #elif defined __AIEBAREMTL__
@@ -1003,6 +1162,11 @@ void XAieLib_MaskWrite32(u64 Addr, u32 Mask, u32 Data)
 *******************************************************************************/
 void XAieLib_Write128(u64 Addr, u32 *Data)
 {
+	if(XAieLib_TxnCur != XAIE_NULL) {
+		XAieLib_TxnRecord(XAIELIB_TXN_OP_WRITE, Addr, 0U, Data, 4U);
+		return;
+	}
+
 #ifdef __AIESIM__
 	XAieSim_Write128(Addr, Data);
 #elif defined __AIEBAREMTL__
@@ -1016,6 +1180,33 @@ void XAieLib_Write128(u64 Addr, u32 *Data)
 #endif
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to write a block of contiguous 32bit words
+* starting from the specified address.
+*
+* @param	Addr: Address to write to.
+* @param	Data: Pointer to the data buffer.
+* @param	Size: Number of 32bit words to write.
+*
+* @return	None.
+*
+* @note		This is the same as XAieLib_Write32() of every word, but the
+*		backend can move the block in one access, and a transaction
+*		records it as one command.
+*
+*******************************************************************************/
+void XAieLib_BlockWrite32(u64 Addr, const u32 *Data, u32 Size)
+{
+	if(XAieLib_TxnCur != XAIE_NULL) {
+		XAieLib_TxnRecord(XAIELIB_TXN_OP_WRITE, Addr, 0U, Data, Size);
+		return;
+	}
+
+	XAieLib_IOBlockWrite32(Addr, Data, Size);
+}
+
 /*****************************************************************************/
 /**
 *
@@ -1090,6 +1281,208 @@ u32 XAieLib_MaskPoll(u64 Addr, u32 Mask, u32 Value, u32 TimeOutUs)
 	return Ret;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function starts recording a transaction. Until XAieLib_TxnStop(), the
+* register writes, mask writes, 128bit writes and block writes are not sent to
+* the device, but recorded in the returned transaction. Writes to contiguous
+* addresses are merged into block writes. The transaction can then be
+* replayed any number of times with XAieLib_TxnReplay().
+*
+* On Linux, a transaction only records the writes of the thread which started
+* it, and the writes of the other threads go to the device. It is to be
+* stopped and freed by that thread.
+*
+* @param	None.
+*
+* @return	Pointer to the transaction instance. NULL on failure, or if
+*		another transaction is being recorded by the thread.
+*
+* @note		Only the writes are recorded. Reads, polls, NPI accesses and
+*		commands still go to the device right away, and a read doesn't
+*		see the value of a recorded write. The mask writes are
+*		resolved against the register value at replay.
+*
+*******************************************************************************/
+XAieLib_TxnInst *XAieLib_TxnStart(void)
+{
+	XAieLib_TxnInst *Txn;
+
+	if(XAieLib_TxnCur != XAIE_NULL) {
+		XAieLib_print("Error: a transaction is already being recorded\n");
+		return XAIE_NULL;
+	}
+
+	Txn = malloc(sizeof(*Txn));
+	if(Txn == XAIE_NULL) {
+		return XAIE_NULL;
+	}
+
+	Txn->Cmds = malloc(XAIELIB_TXN_INIT_CMDS * sizeof(*Txn->Cmds));
+	Txn->Data = malloc(XAIELIB_TXN_INIT_WORDS * sizeof(*Txn->Data));
+	if((Txn->Cmds == XAIE_NULL) || (Txn->Data == XAIE_NULL)) {
+		free(Txn->Cmds);
+		free(Txn->Data);
+		free(Txn);
+		return XAIE_NULL;
+	}
+
+	Txn->NumCmds = 0U;
+	Txn->MaxCmds = XAIELIB_TXN_INIT_CMDS;
+	Txn->NumWords = 0U;
+	Txn->MaxWords = XAIELIB_TXN_INIT_WORDS;
+	Txn->Failed = 0U;
+
+	XAieLib_TxnCur = Txn;
+
+	return Txn;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function stops recording the transaction. The following writes go to
+* the device again.
+*
+* @param	TxnInstPtr: Transaction instance from XAieLib_TxnStart().
+*
+* @return	XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE. The
+*		transaction is incomplete if it ran out of memory while
+*		recording, and it can't be replayed.
+*
+* @note		None.
+*
+*******************************************************************************/
+u32 XAieLib_TxnStop(XAieLib_TxnInst *TxnInstPtr)
+{
+	if((TxnInstPtr == XAIE_NULL) || (TxnInstPtr != XAieLib_TxnCur)) {
+		XAieLib_print("Error: transaction is not being recorded\n");
+		return XAIELIB_FAILURE;
+	}
+
+	XAieLib_TxnCur = XAIE_NULL;
+
+	if(TxnInstPtr->Failed != 0U) {
+		XAieLib_print("Error: transaction ran out of memory\n");
+		return XAIELIB_FAILURE;
+	}
+
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function replays the recorded writes of a transaction to the device in
+* the recorded order. A merged write is sent as one block write.
+*
+* @param	TxnInstPtr: Transaction instance.
+*
+* @return	XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE.
+*
+* @note		If another transaction is being recorded, the writes are
+*		appended to it, so recorded transactions can be composed.
+*
+*******************************************************************************/
+u32 XAieLib_TxnReplay(XAieLib_TxnInst *TxnInstPtr)
+{
+	u32 Idx;
+
+	if((TxnInstPtr == XAIE_NULL) || (TxnInstPtr == XAieLib_TxnCur) ||
+			(TxnInstPtr->Failed != 0U)) {
+		XAieLib_print("Error: transaction can't be replayed\n");
+		return XAIELIB_FAILURE;
+	}
+
+	for(Idx = 0U; Idx < TxnInstPtr->NumCmds; Idx++) {
+		XAieLib_TxnCmd *Cmd = &TxnInstPtr->Cmds[Idx];
+		u32 *Data = &TxnInstPtr->Data[Cmd->DataIdx];
+
+		if(Cmd->Opcode == XAIELIB_TXN_OP_MASKWRITE) {
+			XAieLib_MaskWrite32(Cmd->Addr, Cmd->Mask, Data[0U]);
+		} else if(Cmd->Size == 1U) {
+			XAieLib_Write32(Cmd->Addr, Data[0U]);
+		} else {
+			XAieLib_BlockWrite32(Cmd->Addr, Data, Cmd->Size);
+		}
+	}
+
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function frees the transaction instance. If the transaction is being
+* recorded, the recording stops.
+*
+* @param	TxnInstPtr: Transaction instance.
+*
+* @return	None.
+*
+* @note		@TxnInstPtr is freed and invalid after this function.
+*
+*******************************************************************************/
+void XAieLib_TxnFree(XAieLib_TxnInst *TxnInstPtr)
+{
+	if(TxnInstPtr == XAIE_NULL) {
+		return;
+	}
+
+	if(TxnInstPtr == XAieLib_TxnCur) {
+		XAieLib_TxnCur = XAIE_NULL;
+	}
+
+	free(TxnInstPtr->Cmds);
+	free(TxnInstPtr->Data);
+	free(TxnInstPtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the number of device accesses of a transaction replay,
+* after the contiguous writes are merged.
+*
+* @param	TxnInstPtr: Transaction instance.
+*
+* @return	Number of recorded commands, 0 if TxnInstPtr is NULL.
+*
+* @note		None.
+*
+*******************************************************************************/
+u32 XAieLib_TxnGetNumCmds(XAieLib_TxnInst *TxnInstPtr)
+{
+	if(TxnInstPtr == XAIE_NULL) {
+		return 0U;
+	}
+
+	return TxnInstPtr->NumCmds;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the number of 32bit words written by a transaction
+* replay.
+*
+* @param	TxnInstPtr: Transaction instance.
+*
+* @return	Number of recorded data words, 0 if TxnInstPtr is NULL.
+*
+* @note		None.
+*
+*******************************************************************************/
+u32 XAieLib_TxnGetNumWords(XAieLib_TxnInst *TxnInstPtr)
+{
+	if(TxnInstPtr == XAIE_NULL) {
+		return 0U;
+	}
+
+	return TxnInstPtr->NumWords;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -26,6 +26,7 @@
 * 1.7  Hyun    01/08/2019  Add XAieLib_MaskPoll()
 * 1.8  Tejus   10/14/2019  Enable assertion for linux and simulation
 * 1.9  Wendy   02/25/2020  Add Logging API
+* 2.0  dc      10/31/2021  Add block write and transaction APIs
 * </pre>
 *
 ******************************************************************************/
@@ -67,6 +68,7 @@ void XAieLib_Read128(u64 Addr, u32 *Data);
 void XAieLib_Write32(u64 Addr, u32 Data);
 void XAieLib_MaskWrite32(u64 Addr, u32 Mask, u32 Data);
 void XAieLib_Write128(u64 Addr, u32 *Data);
+void XAieLib_BlockWrite32(u64 Addr, const u32 *Data, u32 Size);
 void XAieLib_WriteCmd(u8 Command, u8 ColId, u8 RowId, u32 CmdWd0, u32 CmdWd1, u8 *CmdStr);
 u32 XAieLib_MaskPoll(u64 Addr, u32 Mask, u32 Value, u32 TimeOutUs);
 
@@ -122,6 +124,16 @@ u64 XAieLib_MemGetPaddr(XAieLib_MemInst *XAieLib_MemInstPtr);
 void XAieLib_MemWrite32(XAieLib_MemInst *XAieLib_MemInstPtr, u64 Addr, u32 Data);
 u32 XAieLib_MemRead32(XAieLib_MemInst *XAieLib_MemInstPtr, u64 Addr);
 
+struct XAieLib_TxnInst;
+typedef struct XAieLib_TxnInst XAieLib_TxnInst;
+
+XAieLib_TxnInst *XAieLib_TxnStart(void);
+u32 XAieLib_TxnStop(XAieLib_TxnInst *TxnInstPtr);
+u32 XAieLib_TxnReplay(XAieLib_TxnInst *TxnInstPtr);
+void XAieLib_TxnFree(XAieLib_TxnInst *TxnInstPtr);
+u32 XAieLib_TxnGetNumCmds(XAieLib_TxnInst *TxnInstPtr);
+u32 XAieLib_TxnGetNumWords(XAieLib_TxnInst *TxnInstPtr);
+
 #endif		/* end of protection macro */
 /** @} */
 
@@ -0,0 +1,254 @@
+/******************************************************************************
+* Copyright (C) 2021 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_clear_mems_check.c
+* @{
+*
+* This file contains the validation of the parallel partition memory clear.
+*
+* The writes of XAie_ClearPartitionMems() are captured from the debug backend
+* output and used as the reference. The writes of
+* XAie_ClearPartitionMemsParallel() are captured the same way for several
+* numbers of threads. The threads interleave their writes, so the writes are
+* sorted before they are compared. The check passes if every run writes
+* exactly the same registers with the same values as the reference.
+*
+* The driver must be built with the debug backend (__AIEDEBUG__).
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0   dc      10/31/2021  Initial creation
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <xaiengine.h>
+
+/************************** Constant Definitions *****************************/
+/* AIE-ML Device parameters */
+#define XAIE_BASE_ADDR		0x20000000000
+#define XAIE_NUM_ROWS		11
+#define XAIE_NUM_COLS		4
+#define XAIE_COL_SHIFT		25
+#define XAIE_ROW_SHIFT		20
+#define XAIE_SHIM_ROW		0
+#define XAIE_MEM_TILE_ROW_START	1
+#define XAIE_MEM_TILE_NUM_ROWS	2
+#define XAIE_AIE_TILE_ROW_START	3
+#define XAIE_AIE_TILE_NUM_ROWS	8
+
+/* Run XAie_ClearPartitionMems() instead of the parallel version */
+#define XAIE_CLEAR_SERIAL	0xFFFFFFFFU
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	unsigned long Addr;
+	unsigned long Val;
+} WriteLog;
+
+/************************** Variable Definitions *****************************/
+/* Numbers of threads to check, 0 is as many threads as online CPUs */
+static const u32 NumThreads[] = {1U, 2U, 3U, 0U};
+
+/************************** Function Definitions *****************************/
+static int CmpWrite(const void *A, const void *B)
+{
+	const WriteLog *WA = A, *WB = B;
+
+	if(WA->Addr != WB->Addr) {
+		return (WA->Addr < WB->Addr) ? -1 : 1;
+	}
+	if(WA->Val != WB->Val) {
+		return (WA->Val < WB->Val) ? -1 : 1;
+	}
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function clears the partition memories with the debug backend output
+* redirected to a temporary file, and returns the sorted writes.
+*
+* @param	DevInst: Device Instance
+* @param	Threads: Number of threads for
+*			 XAie_ClearPartitionMemsParallel(), or XAIE_CLEAR_SERIAL
+*			 for XAie_ClearPartitionMems().
+* @param	Log: Pointer to return the writes, to be freed by the caller.
+* @param	NumWrites: Pointer to return the number of writes.
+*
+* @return	0 on success and -1 on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static int CaptureClear(XAie_DevInst *DevInst, u32 Threads, WriteLog **Log,
+		size_t *NumWrites)
+{
+	char Line[128];
+	WriteLog *Writes = NULL;
+	size_t Num = 0U, Max = 0U;
+	FILE *Tmp;
+	int Saved;
+	AieRC RC;
+
+	Tmp = tmpfile();
+	if(Tmp == NULL) {
+		return -1;
+	}
+
+	fflush(stdout);
+	Saved = dup(STDOUT_FILENO);
+	if((Saved < 0) || (dup2(fileno(Tmp), STDOUT_FILENO) < 0)) {
+		fclose(Tmp);
+		return -1;
+	}
+
+	if(Threads == XAIE_CLEAR_SERIAL) {
+		RC = XAie_ClearPartitionMems(DevInst);
+	} else {
+		RC = XAie_ClearPartitionMemsParallel(DevInst, Threads);
+	}
+
+	fflush(stdout);
+	dup2(Saved, STDOUT_FILENO);
+	close(Saved);
+	if(RC != XAIE_OK) {
+		fclose(Tmp);
+		return -1;
+	}
+
+	rewind(Tmp);
+	while(fgets(Line, sizeof(Line), Tmp) != NULL) {
+		WriteLog W;
+
+		if(sscanf(Line, "W: 0x%lx, 0x%lx", &W.Addr, &W.Val) != 2) {
+			continue;
+		}
+
+		if(Num == Max) {
+			WriteLog *New;
+
+			Max = (Max == 0U) ? 4096U : Max * 2U;
+			New = realloc(Writes, Max * sizeof(*Writes));
+			if(New == NULL) {
+				free(Writes);
+				fclose(Tmp);
+				return -1;
+			}
+			Writes = New;
+		}
+		Writes[Num++] = W;
+	}
+	fclose(Tmp);
+
+	qsort(Writes, Num, sizeof(*Writes), CmpWrite);
+	*Log = Writes;
+	*NumWrites = Num;
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the main entry point for the validation of the parallel partition
+* memory clear.
+*
+* @param	None.
+*
+* @return	0 on success and error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int main()
+{
+	WriteLog *Ref, *Log;
+	size_t NumRef, Num;
+	int Ret = 0;
+	AieRC RC;
+
+	XAie_SetupConfig(ConfigPtr, XAIE_DEV_GEN_AIEML, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_MEM_TILE_ROW_START, XAIE_MEM_TILE_NUM_ROWS,
+			XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+
+	RC = XAie_CfgInitialize(&DevInst, &ConfigPtr);
+	if(RC != XAIE_OK) {
+		printf("Driver initialization failed.\n");
+		return -1;
+	}
+
+	RC = XAie_SetIOBackend(&DevInst, XAIE_IO_BACKEND_DEBUG);
+	if(RC != XAIE_OK) {
+		printf("The driver is not built with the debug backend.\n");
+		return -1;
+	}
+
+	RC = XAie_PmRequestTiles(&DevInst, NULL, 0);
+	if(RC != XAIE_OK) {
+		printf("Failed to request tiles.\n");
+		return -1;
+	}
+
+	if(CaptureClear(&DevInst, XAIE_CLEAR_SERIAL, &Ref, &NumRef) != 0) {
+		printf("Failed to clear partition memories.\n");
+		return -1;
+	}
+	printf("serial clear: %zu writes\n", NumRef);
+
+	for(u32 i = 0U; i < sizeof(NumThreads) / sizeof(NumThreads[0]); i++) {
+		int Same;
+
+		if(CaptureClear(&DevInst, NumThreads[i], &Log, &Num) != 0) {
+			printf("Failed to clear partition memories.\n");
+			Ret = -1;
+			break;
+		}
+
+		Same = (Num == NumRef) &&
+			(memcmp(Log, Ref, Num * sizeof(*Log)) == 0);
+		if(NumThreads[i] == 0U) {
+			printf("parallel clear, all cpus: ");
+		} else {
+			printf("parallel clear, %u threads: ", NumThreads[i]);
+		}
+		printf("%zu writes, %s\n", Num,
+				Same ? "identical" : "DIFFERENT");
+		if(!Same) {
+			Ret = -1;
+		}
+		free(Log);
+	}
+
+	free(Ref);
+	XAie_Finish(&DevInst);
+
+	if(Ret == 0) {
+		printf("Parallel partition memory clear check passed.\n");
+	} else {
+		printf("Parallel partition memory clear check failed.\n");
+	}
+
+	return Ret;
+}
+
+/** @} */
@@ -0,0 +1,205 @@
+/******************************************************************************
+* Copyright (C) 2021 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_ctx_switch_bench.c
+* @{
+*
+* This file contains the benchmark of the partition context switch on the
+* full AIE-ML array.
+*
+* Two graphs are configured one after the other, each with a stream switch
+* connection and a DMA BD in every AIE tile, and the partition context of
+* each graph is captured. The partition is then switched between the two
+* graphs. The time is reported for:
+*	- the capture of a partition context,
+*	- a context switch which reads the current value of every register,
+*	- a context switch which takes the current values from a cache of the
+*	  partition registers, kept up to date by the restore.
+* Both context switches only write the registers which differ. The benchmark
+* is meant to be run with the simulation backend, where every register access
+* is a transaction with the simulator.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0   dc      10/31/2021  Initial creation
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <time.h>
+#include <xaiengine.h>
+
+/************************** Constant Definitions *****************************/
+/* AIE-ML Device parameters */
+#define XAIE_BASE_ADDR		0x20000000000
+#define XAIE_NUM_ROWS		11
+#define XAIE_NUM_COLS		38
+#define XAIE_COL_SHIFT		25
+#define XAIE_ROW_SHIFT		20
+#define XAIE_SHIM_ROW		0
+#define XAIE_MEM_TILE_ROW_START	1
+#define XAIE_MEM_TILE_NUM_ROWS	2
+#define XAIE_AIE_TILE_ROW_START	3
+#define XAIE_AIE_TILE_NUM_ROWS	8
+
+/* Benchmark parameters */
+#define NUM_ITERS		16
+#define GRAPH_BD		0U
+#define GRAPH_ADDR		0x2000U
+#define GRAPH_LEN		0x400U
+
+/************************** Function Definitions *****************************/
+static double NowUs(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return Ts.tv_sec * 1e6 + Ts.tv_nsec / 1e3;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function configures a graph on all the AIE tiles. Graph 0 and graph 1
+* use different DMA channels and buffers.
+*
+* @param	DevInst: Device Instance
+* @param	Graph: Graph number, 0 or 1
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+*******************************************************************************/
+static AieRC ConfigGraph(XAie_DevInst *DevInst, u8 Graph)
+{
+	AieRC RC = XAIE_OK;
+
+	for(u32 Col = 0U; Col < XAIE_NUM_COLS; Col++) {
+		for(u32 Row = XAIE_AIE_TILE_ROW_START; Row < XAIE_NUM_ROWS;
+				Row++) {
+			XAie_LocType Loc = XAie_TileLoc(Col, Row);
+			XAie_DmaDesc Desc;
+
+			RC |= XAie_StrmConnCctEnable(DevInst, Loc, DMA, Graph,
+					SOUTH, Graph);
+			RC |= XAie_DmaDescInit(DevInst, &Desc, Loc);
+			RC |= XAie_DmaSetAddrLen(&Desc,
+					GRAPH_ADDR + Graph * GRAPH_LEN,
+					GRAPH_LEN);
+			RC |= XAie_DmaEnableBd(&Desc);
+			RC |= XAie_DmaWriteBd(DevInst, &Desc, Loc,
+					GRAPH_BD + Graph);
+		}
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the main entry point for the AIE driver partition context switch
+* benchmark.
+*
+* @param	None.
+*
+* @return	0 on success and error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int main()
+{
+	AieRC RC = XAIE_OK;
+	XAie_PartCtx Idle, Graphs[2], Cur;
+	double Start, Capture, Read, Cached;
+	u32 NumDiffs = 0U;
+
+	XAie_SetupConfig(ConfigPtr, XAIE_DEV_GEN_AIEML, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_MEM_TILE_ROW_START, XAIE_MEM_TILE_NUM_ROWS,
+			XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+
+	RC = XAie_CfgInitialize(&DevInst, &ConfigPtr);
+	if(RC != XAIE_OK) {
+		printf("Driver initialization failed.\n");
+		return -1;
+	}
+
+	RC = XAie_PmRequestTiles(&DevInst, NULL, 0);
+	if(RC != XAIE_OK) {
+		printf("Failed to request tiles.\n");
+		return -1;
+	}
+
+	/* Capture the idle partition and the partition with each graph */
+	Start = NowUs();
+	RC = XAie_CtxCapture(&DevInst, &Idle);
+	Capture = NowUs() - Start;
+	if(RC != XAIE_OK) {
+		printf("Failed to capture context.\n");
+		return -1;
+	}
+
+	for(u8 g = 0U; g < 2U; g++) {
+		RC = XAie_CtxRestore(&DevInst, &Idle, NULL);
+		RC |= ConfigGraph(&DevInst, g);
+		RC |= XAie_CtxCapture(&DevInst, &Graphs[g]);
+		if(RC != XAIE_OK) {
+			printf("Failed to capture graph %u context.\n", g);
+			return -1;
+		}
+	}
+
+	/* Graph 1 is configured, Cur caches its registers */
+	RC = XAie_CtxCapture(&DevInst, &Cur);
+	RC |= XAie_CtxDiff(&Graphs[0], &Graphs[1], &NumDiffs);
+	if(RC != XAIE_OK) {
+		printf("Failed to capture context.\n");
+		return -1;
+	}
+
+	/* Context switch reading the current registers */
+	Start = NowUs();
+	for(u32 n = 0U; n < NUM_ITERS; n++)
+		RC |= XAie_CtxRestore(&DevInst, &Graphs[n & 1U], NULL);
+	Read = (NowUs() - Start) / NUM_ITERS;
+
+	/* Context switch with the current registers cached in Cur */
+	Start = NowUs();
+	for(u32 n = 0U; n < NUM_ITERS; n++)
+		RC |= XAie_CtxRestore(&DevInst, &Graphs[n & 1U], &Cur);
+	Cached = (NowUs() - Start) / NUM_ITERS;
+
+	if(RC != XAIE_OK) {
+		printf("Failed to switch context.\n");
+		return -1;
+	}
+
+	printf("%u tiles, %u registers per context, %u registers differ\n",
+			Idle.NumTiles, Idle.NumVals, NumDiffs);
+	printf("context capture:                %12.1f us\n", Capture);
+	printf("context switch, read registers: %12.1f us/switch\n", Read);
+	printf("context switch, cached:         %12.1f us/switch\n", Cached);
+
+	XAie_CtxFree(&Idle);
+	XAie_CtxFree(&Graphs[0]);
+	XAie_CtxFree(&Graphs[1]);
+	XAie_CtxFree(&Cur);
+
+	return 0;
+}
+
+/** @} */
@@ -0,0 +1,208 @@
+/******************************************************************************
+* Copyright (C) 2021 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_dma_bd_batch.c
+* @{
+*
+* This file contains the benchmark of aie dma buffer descriptor reprogramming.
+*
+* Every iteration reprograms a ping and a pong BD on NUM_TILES aie tiles with
+* swapped buffer addresses and a new length, as a double buffered kernel does
+* between invocations. The time per iteration is reported for three methods:
+*	- XAie_DmaWriteBd() for every BD,
+*	- XAie_DmaUpdateBdAddr() and XAie_DmaUpdateBdLen() for every BD,
+*	- a BD batch, which only writes the changed BD words.
+* The benchmark is meant to be run with the simulation backend, where every
+* register access is a transaction with the simulator.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0   dc      10/31/2021  Initial creation
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <time.h>
+#include <xaiengine.h>
+
+/************************** Constant Definitions *****************************/
+/* AIE Device parameters */
+#define XAIE_BASE_ADDR		0x20000000000
+#define XAIE_NUM_ROWS		9
+#define XAIE_NUM_COLS		50
+#define XAIE_COL_SHIFT		23
+#define XAIE_ROW_SHIFT		18
+#define XAIE_SHIM_ROW		0
+#define XAIE_RES_TILE_ROW_START	0
+#define XAIE_RES_TILE_NUM_ROWS	0
+#define XAIE_AIE_TILE_ROW_START	1
+#define XAIE_AIE_TILE_NUM_ROWS	8
+
+/* Benchmark parameters */
+#define NUM_TILES	64
+#define NUM_ITERS	16
+#define PING_BD		0U
+#define PONG_BD		1U
+#define PING_ADDR	0x2000
+#define PONG_ADDR	0x4000
+#define BUF_LEN		0x400
+
+/************************** Function Definitions *****************************/
+static double NowUs(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return Ts.tv_sec * 1e6 + Ts.tv_nsec / 1e3;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the main entry point for the AIE driver BD batch benchmark.
+*
+* @param	None.
+*
+* @return	0 on success and error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int main()
+{
+	AieRC RC = XAIE_OK;
+	XAie_LocType Loc[NUM_TILES];
+	XAie_DmaDesc Ping[NUM_TILES], Pong[NUM_TILES];
+	XAie_DmaBdShadow Shadow[NUM_TILES * 2];
+	XAie_DmaBdBatch Batch;
+	u32 Words = 0U, Writes = 0U;
+	double Start, Full, Update, Batched;
+
+	XAie_SetupConfig(ConfigPtr, XAIE_DEV_GEN_AIE, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_RES_TILE_ROW_START, XAIE_RES_TILE_NUM_ROWS,
+			XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+
+	RC = XAie_CfgInitialize(&DevInst, &ConfigPtr);
+	if(RC != XAIE_OK) {
+		printf("Driver initialization failed.\n");
+		return -1;
+	}
+
+	RC = XAie_PmRequestTiles(&DevInst, NULL, 0);
+	if(RC != XAIE_OK) {
+		printf("Failed to request tiles.\n");
+		return -1;
+	}
+
+	for(u32 i = 0U; i < NUM_TILES; i++) {
+		Loc[i] = XAie_TileLoc(i / XAIE_AIE_TILE_NUM_ROWS,
+				XAIE_AIE_TILE_ROW_START +
+				i % XAIE_AIE_TILE_NUM_ROWS);
+		RC |= XAie_DmaDescInit(&DevInst, &Ping[i], Loc[i]);
+		RC |= XAie_DmaDescInit(&DevInst, &Pong[i], Loc[i]);
+		RC |= XAie_DmaSetLock(&Ping[i], XAie_LockInit(0U, 0),
+				XAie_LockInit(0U, 1));
+		RC |= XAie_DmaSetLock(&Pong[i], XAie_LockInit(1U, 0),
+				XAie_LockInit(1U, 1));
+		RC |= XAie_DmaSetNextBd(&Ping[i], PONG_BD, XAIE_ENABLE);
+		RC |= XAie_DmaSetNextBd(&Pong[i], PING_BD, XAIE_ENABLE);
+		RC |= XAie_DmaEnableBd(&Ping[i]);
+		RC |= XAie_DmaEnableBd(&Pong[i]);
+	}
+	RC |= XAie_DmaBdBatchInit(&Batch, Shadow, NUM_TILES * 2);
+	if(RC != XAIE_OK) {
+		printf("Failed to setup software dma descriptors.\n");
+		return -1;
+	}
+
+	/* Full BD write of every BD */
+	Start = NowUs();
+	for(u32 n = 0U; n < NUM_ITERS; n++) {
+		u32 Swap = n & 1U;
+		u32 Len = BUF_LEN + n * 4U;
+
+		for(u32 i = 0U; i < NUM_TILES; i++) {
+			RC |= XAie_DmaSetAddrLen(&Ping[i],
+					Swap ? PONG_ADDR : PING_ADDR, Len);
+			RC |= XAie_DmaSetAddrLen(&Pong[i],
+					Swap ? PING_ADDR : PONG_ADDR, Len);
+			RC |= XAie_DmaWriteBd(&DevInst, &Ping[i], Loc[i],
+					PING_BD);
+			RC |= XAie_DmaWriteBd(&DevInst, &Pong[i], Loc[i],
+					PONG_BD);
+		}
+	}
+	Full = (NowUs() - Start) / NUM_ITERS;
+
+	/* Runtime update of the address and length of every BD */
+	Start = NowUs();
+	for(u32 n = 0U; n < NUM_ITERS; n++) {
+		u32 Swap = n & 1U;
+		u32 Len = BUF_LEN + n * 4U;
+
+		for(u32 i = 0U; i < NUM_TILES; i++) {
+			RC |= XAie_DmaUpdateBdAddr(&DevInst, Loc[i],
+					Swap ? PONG_ADDR : PING_ADDR, PING_BD);
+			RC |= XAie_DmaUpdateBdLen(&DevInst, Loc[i], Len,
+					PING_BD);
+			RC |= XAie_DmaUpdateBdAddr(&DevInst, Loc[i],
+					Swap ? PING_ADDR : PONG_ADDR, PONG_BD);
+			RC |= XAie_DmaUpdateBdLen(&DevInst, Loc[i], Len,
+					PONG_BD);
+		}
+	}
+	Update = (NowUs() - Start) / NUM_ITERS;
+
+	/* BD batch, the first submit writes the full BDs */
+	Start = NowUs();
+	for(u32 n = 0U; n < NUM_ITERS; n++) {
+		u32 Swap = n & 1U;
+		u32 Len = BUF_LEN + n * 4U;
+
+		for(u32 i = 0U; i < NUM_TILES; i++) {
+			RC |= XAie_DmaSetAddrLen(&Ping[i],
+					Swap ? PONG_ADDR : PING_ADDR, Len);
+			RC |= XAie_DmaSetAddrLen(&Pong[i],
+					Swap ? PING_ADDR : PONG_ADDR, Len);
+			RC |= XAie_DmaBdBatchAdd(&DevInst, &Batch, &Ping[i],
+					Loc[i], PING_BD);
+			RC |= XAie_DmaBdBatchAdd(&DevInst, &Batch, &Pong[i],
+					Loc[i], PONG_BD);
+		}
+		RC |= XAie_DmaBdBatchSubmit(&DevInst, &Batch);
+		Words += Batch.WordsWritten;
+		Writes += Batch.NumWrites;
+	}
+	Batched = (NowUs() - Start) / NUM_ITERS;
+
+	if(RC != XAIE_OK) {
+		printf("Failed to reprogram dma buffer descriptors.\n");
+		return -1;
+	}
+
+	printf("%d tiles, %d BDs per iteration, %d iterations\n", NUM_TILES,
+			NUM_TILES * 2, NUM_ITERS);
+	printf("full bd write:    %10.1f us/iteration\n", Full);
+	printf("bd addr/len update: %8.1f us/iteration\n", Update);
+	printf("bd batch:         %10.1f us/iteration, %u words in %u "
+			"accesses/iteration\n", Batched, Words / NUM_ITERS,
+			Writes / NUM_ITERS);
+
+	return 0;
+}
+
+/** @} */
@@ -0,0 +1,165 @@
+/******************************************************************************
+* Copyright (C) 2021 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_part_init_bench.c
+* @{
+*
+* This file contains the benchmark of the AIE-ML partition initialization.
+*
+* The time of every phase of the partition bring up is reported:
+*	- the driver instance initialization,
+*	- the partition initialization, with one initialization option at a
+*	  time,
+*	- the request of all the tiles of the partition,
+*	- the zeroization of the data and program memories of the partition
+*	  by the driver, with XAie_ClearPartitionMems() and with
+*	  XAie_ClearPartitionMemsParallel() on 1 thread and on as many threads
+*	  as online CPUs.
+* The benchmark is meant to be run with the Linux backend, or with the debug
+* backend to time the driver overhead without the device. A failing partition
+* initialization phase is reported with its time, and the benchmark moves on
+* to the next one. The debug backend fails every mask poll at once, so the
+* memory zeroization option fails there on its final status poll, and its time
+* is the time to start the zeroization of all the tiles.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0   dc      10/31/2021  Initial creation
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <time.h>
+#include <xaiengine.h>
+
+/************************** Constant Definitions *****************************/
+/* AIE-ML Device parameters */
+#define XAIE_BASE_ADDR		0x20000000000
+#define XAIE_NUM_ROWS		11
+#define XAIE_NUM_COLS		38
+#define XAIE_COL_SHIFT		25
+#define XAIE_ROW_SHIFT		20
+#define XAIE_SHIM_ROW		0
+#define XAIE_MEM_TILE_ROW_START	1
+#define XAIE_MEM_TILE_NUM_ROWS	2
+#define XAIE_AIE_TILE_ROW_START	3
+#define XAIE_AIE_TILE_NUM_ROWS	8
+
+/************************** Variable Definitions *****************************/
+static const struct {
+	u32 Opt;
+	const char *Name;
+} InitPhases[] = {
+	{XAIE_PART_INIT_OPT_COLUMN_RST, "column reset"},
+	{XAIE_PART_INIT_OPT_SHIM_RST, "shim reset"},
+	{XAIE_PART_INIT_OPT_BLOCK_NOCAXIMMERR, "block noc axi-mm errors"},
+	{XAIE_PART_INIT_OPT_ISOLATE, "isolation"},
+	{XAIE_PART_INIT_OPT_ZEROIZEMEM, "memory zeroization"},
+};
+
+/************************** Function Definitions *****************************/
+static double NowUs(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return Ts.tv_sec * 1e6 + Ts.tv_nsec / 1e3;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the main entry point for the AIE driver partition initialization
+* benchmark.
+*
+* @param	None.
+*
+* @return	0 on success and error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int main()
+{
+	AieRC RC = XAIE_OK;
+	double Start;
+
+	XAie_SetupConfig(ConfigPtr, XAIE_DEV_GEN_AIEML, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_MEM_TILE_ROW_START, XAIE_MEM_TILE_NUM_ROWS,
+			XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+
+	printf("%d tiles\n", XAIE_NUM_COLS * XAIE_NUM_ROWS);
+
+	Start = NowUs();
+	RC = XAie_CfgInitialize(&DevInst, &ConfigPtr);
+	if(RC != XAIE_OK) {
+		printf("Driver initialization failed.\n");
+		return -1;
+	}
+	printf("%-40s %12.1f us\n", "driver initialization",
+			NowUs() - Start);
+
+	for(u32 p = 0U; p < sizeof(InitPhases) / sizeof(InitPhases[0]); p++) {
+		XAie_PartInitOpts Opts = {NULL, 0U, InitPhases[p].Opt};
+
+		Start = NowUs();
+		RC = XAie_PartitionInitialize(&DevInst, &Opts);
+		printf("partition init, %-24s %12.1f us%s\n",
+				InitPhases[p].Name, NowUs() - Start,
+				(RC != XAIE_OK) ? " (failed)" : "");
+	}
+
+	Start = NowUs();
+	RC = XAie_PmRequestTiles(&DevInst, NULL, 0);
+	if(RC != XAIE_OK) {
+		printf("Failed to request tiles.\n");
+		return -1;
+	}
+	printf("%-40s %12.1f us\n", "request tiles", NowUs() - Start);
+
+	Start = NowUs();
+	RC = XAie_ClearPartitionMems(&DevInst);
+	if(RC != XAIE_OK) {
+		printf("Failed to clear partition memories.\n");
+		return -1;
+	}
+	printf("%-40s %12.1f us\n", "clear memories", NowUs() - Start);
+
+	Start = NowUs();
+	RC = XAie_ClearPartitionMemsParallel(&DevInst, 1U);
+	if(RC != XAIE_OK) {
+		printf("Failed to clear partition memories.\n");
+		return -1;
+	}
+	printf("%-40s %12.1f us\n", "clear memories parallel, 1 thread",
+			NowUs() - Start);
+
+	Start = NowUs();
+	RC = XAie_ClearPartitionMemsParallel(&DevInst, 0U);
+	if(RC != XAIE_OK) {
+		printf("Failed to clear partition memories.\n");
+		return -1;
+	}
+	printf("%-40s %12.1f us\n", "clear memories parallel, all cpus",
+			NowUs() - Start);
+
+	XAie_Finish(&DevInst);
+
+	return 0;
+}
+
+/** @} */
@@ -0,0 +1,188 @@
+/******************************************************************************
+* Copyright (C) 2021 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_rsc_bench.c
+* @{
+*
+* This file contains the benchmark of the resource manager on the full AIE-ML
+* array.
+*
+* Every iteration allocates and frees resources in all the tiles of the
+* partition:
+*	- two performance counters in every core module, requested with one
+*	  request per tile,
+*	- the same counters requested with XAie_RequestRscAllTiles(),
+*	- all the broadcast channels for the whole partition, one after the
+*	  other,
+*	- the available resource statistics of every core module.
+* The time per iteration is reported for each of them.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0   dc      10/31/2021  Initial creation
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <time.h>
+#include <xaiengine.h>
+
+/************************** Constant Definitions *****************************/
+/* AIE-ML Device parameters */
+#define XAIE_BASE_ADDR		0x20000000000
+#define XAIE_NUM_ROWS		11
+#define XAIE_NUM_COLS		38
+#define XAIE_COL_SHIFT		25
+#define XAIE_ROW_SHIFT		20
+#define XAIE_SHIM_ROW		0
+#define XAIE_MEM_TILE_ROW_START	1
+#define XAIE_MEM_TILE_NUM_ROWS	2
+#define XAIE_AIE_TILE_ROW_START	3
+#define XAIE_AIE_TILE_NUM_ROWS	8
+
+/* Benchmark parameters */
+#define NUM_ITERS		64
+#define NUM_AIE_TILES		(XAIE_NUM_COLS * XAIE_AIE_TILE_NUM_ROWS)
+#define NUM_CNTRS_PER_TILE	2U
+#define NUM_BCAST_CHANNELS	16U
+/* Shim, memory tile and two aie tile modules per row of a column */
+#define NUM_BCAST_RSCS		(XAIE_NUM_COLS * (1 + XAIE_MEM_TILE_NUM_ROWS + \
+				2 * XAIE_AIE_TILE_NUM_ROWS))
+
+/************************** Variable Definitions *****************************/
+static XAie_UserRscReq RscReq[NUM_AIE_TILES];
+static XAie_UserRsc CntrRscs[NUM_AIE_TILES * NUM_CNTRS_PER_TILE];
+static XAie_UserRsc BcastRscs[NUM_BCAST_CHANNELS][NUM_BCAST_RSCS];
+static XAie_UserRscStat RscStats[NUM_AIE_TILES];
+
+/************************** Function Definitions *****************************/
+static double NowUs(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return Ts.tv_sec * 1e6 + Ts.tv_nsec / 1e3;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the main entry point for the AIE driver resource manager benchmark.
+*
+* @param	None.
+*
+* @return	0 on success and error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int main()
+{
+	AieRC RC = XAIE_OK;
+	double Start, PerTile, AllTiles, Bcast, Stat;
+	u32 NumBcastRscs = 0U;
+
+	XAie_SetupConfig(ConfigPtr, XAIE_DEV_GEN_AIEML, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_MEM_TILE_ROW_START, XAIE_MEM_TILE_NUM_ROWS,
+			XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+
+	RC = XAie_CfgInitialize(&DevInst, &ConfigPtr);
+	if(RC != XAIE_OK) {
+		printf("Driver initialization failed.\n");
+		return -1;
+	}
+
+	RC = XAie_PmRequestTiles(&DevInst, NULL, 0);
+	if(RC != XAIE_OK) {
+		printf("Failed to request tiles.\n");
+		return -1;
+	}
+
+	for(u32 i = 0U; i < NUM_AIE_TILES; i++) {
+		XAie_LocType Loc = XAie_TileLoc(i / XAIE_AIE_TILE_NUM_ROWS,
+				XAIE_AIE_TILE_ROW_START +
+				i % XAIE_AIE_TILE_NUM_ROWS);
+
+		RscReq[i] = XAie_SetupRscRequest(Loc, XAIE_CORE_MOD,
+				NUM_CNTRS_PER_TILE);
+		RscStats[i].Loc = Loc;
+		RscStats[i].Mod = XAIE_CORE_MOD;
+		RscStats[i].RscType = XAIE_PERFCNT_RSC;
+	}
+
+	/* One request per tile */
+	Start = NowUs();
+	for(u32 n = 0U; n < NUM_ITERS; n++) {
+		RC |= XAie_RequestPerfcnt(&DevInst, NUM_AIE_TILES, RscReq,
+				NUM_AIE_TILES * NUM_CNTRS_PER_TILE, CntrRscs);
+		RC |= XAie_FreePerfcnt(&DevInst,
+				NUM_AIE_TILES * NUM_CNTRS_PER_TILE, CntrRscs);
+	}
+	PerTile = (NowUs() - Start) / NUM_ITERS;
+
+	/* One request for the whole partition */
+	Start = NowUs();
+	for(u32 n = 0U; n < NUM_ITERS; n++) {
+		u32 UserRscNum = NUM_AIE_TILES * NUM_CNTRS_PER_TILE;
+
+		RC |= XAie_RequestRscAllTiles(&DevInst, XAIE_PERFCNT_RSC,
+				XAIE_CORE_MOD, NUM_CNTRS_PER_TILE, &UserRscNum,
+				CntrRscs);
+		RC |= XAie_FreePerfcnt(&DevInst, UserRscNum, CntrRscs);
+	}
+	AllTiles = (NowUs() - Start) / NUM_ITERS;
+
+	/* All broadcast channels of the partition */
+	Start = NowUs();
+	for(u32 n = 0U; n < NUM_ITERS; n++) {
+		for(u32 c = 0U; c < NUM_BCAST_CHANNELS; c++) {
+			NumBcastRscs = NUM_BCAST_RSCS;
+			RC |= XAie_RequestBroadcastChannel(&DevInst,
+					&NumBcastRscs, BcastRscs[c], 1U);
+		}
+		for(u32 c = 0U; c < NUM_BCAST_CHANNELS; c++)
+			RC |= XAie_ReleaseBroadcastChannel(&DevInst,
+					NumBcastRscs, BcastRscs[c]);
+	}
+	Bcast = (NowUs() - Start) / NUM_ITERS;
+
+	/* Available resource statistics */
+	Start = NowUs();
+	for(u32 n = 0U; n < NUM_ITERS; n++)
+		RC |= XAie_GetAvailRscStat(&DevInst, NUM_AIE_TILES, RscStats);
+	Stat = (NowUs() - Start) / NUM_ITERS;
+
+	if(RC != XAIE_OK) {
+		printf("Failed to allocate resources.\n");
+		return -1;
+	}
+
+	printf("%d tiles, %d iterations\n", XAIE_NUM_COLS * XAIE_NUM_ROWS,
+			NUM_ITERS);
+	printf("perf counters, per tile requests: %10.1f us/iteration\n",
+			PerTile);
+	printf("perf counters, all tiles request: %10.1f us/iteration\n",
+			AllTiles);
+	printf("%u broadcast channels, %u modules: %9.1f us/iteration\n",
+			NUM_BCAST_CHANNELS, NumBcastRscs, Bcast);
+	printf("available perf counter stats:     %10.1f us/iteration\n",
+			Stat);
+
+	return 0;
+}
+
+/** @} */
@@ -0,0 +1,218 @@
+/******************************************************************************
+* Copyright (C) 2021 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_ss_route_bench.c
+* @{
+*
+* This file contains the benchmark of the stream switch route planner on the
+* full AIE-ML array.
+*
+* For an increasing number of routes, circuit switched routes are requested
+* from memory tile DMA MM2S channels to AIE tile DMA S2MM channels at random
+* locations, and packet switched routes from AIE tile DMA MM2S channels are
+* merged into memory tile DMA S2MM channels. The time to compute the routes,
+* the number of negotiation iterations and of configured hops, and the time
+* to configure the routes are reported.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0   dc      10/31/2021  Initial creation
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <xaiengine.h>
+
+/************************** Constant Definitions *****************************/
+/* AIE-ML Device parameters */
+#define XAIE_BASE_ADDR		0x20000000000
+#define XAIE_NUM_ROWS		11
+#define XAIE_NUM_COLS		38
+#define XAIE_COL_SHIFT		25
+#define XAIE_ROW_SHIFT		20
+#define XAIE_SHIM_ROW		0
+#define XAIE_MEM_TILE_ROW_START	1
+#define XAIE_MEM_TILE_NUM_ROWS	2
+#define XAIE_AIE_TILE_ROW_START	3
+#define XAIE_AIE_TILE_NUM_ROWS	8
+
+/* Benchmark parameters */
+#define MAX_ROUTES		(128 + XAIE_PACKET_ID_MAX + 1)
+#define MEM_TILE_DMA_PORTS	6
+#define AIE_TILE_DMA_PORTS	2
+
+/************************** Variable Definitions *****************************/
+static XAie_StrmRouteReq Reqs[MAX_ROUTES];
+static u32 Seed = 1U;
+
+/************************** Function Definitions *****************************/
+static double NowUs(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return Ts.tv_sec * 1e6 + Ts.tv_nsec / 1e3;
+}
+
+static u32 Rand(u32 Max)
+{
+	Seed = Seed * 1103515245U + 12345U;
+	return (Seed >> 16) % Max;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function fills the route requests of a benchmark round. Circuit routes
+* take distinct memory tile DMA channels as sources and distinct AIE tile DMA
+* channels as destinations. Packet routes start at AIE tile DMA channels not
+* used by the circuit routes and end at memory tile DMA channels, eight
+* packet routes per channel.
+*
+* @param	NumCct: Number of circuit switched routes
+* @param	NumPkt: Number of packet switched routes
+*
+* @return	None.
+*
+*******************************************************************************/
+static void GenRoutes(u32 NumCct, u32 NumPkt)
+{
+	static u8 Used[XAIE_NUM_COLS][XAIE_AIE_TILE_NUM_ROWS][AIE_TILE_DMA_PORTS];
+	u32 NumMemDma = XAIE_NUM_COLS * XAIE_MEM_TILE_NUM_ROWS *
+		MEM_TILE_DMA_PORTS;
+
+	memset(Used, 0, sizeof(Used));
+	for(u32 i = 0U; i < NumCct + NumPkt; i++) {
+		XAie_StrmRouteReq *Req = &Reqs[i];
+		u32 Col, Row, Port, Mem;
+
+		do {
+			Col = Rand(XAIE_NUM_COLS);
+			Row = Rand(XAIE_AIE_TILE_NUM_ROWS);
+			Port = Rand(AIE_TILE_DMA_PORTS);
+		} while(Used[Col][Row][Port]);
+		Used[Col][Row][Port] = 1U;
+
+		memset(Req, 0, sizeof(*Req));
+		if(i < NumCct) {
+			/* Spread the sources over all memory tile channels */
+			Mem = (i * 7U) % NumMemDma;
+			Req->Mode = XAIE_SS_ROUTE_CIRCUIT;
+			Req->SrcPort = DMA;
+			Req->SrcPortNum = Mem % MEM_TILE_DMA_PORTS;
+			Req->SrcLoc = XAie_TileLoc(
+					Mem / MEM_TILE_DMA_PORTS % XAIE_NUM_COLS,
+					XAIE_MEM_TILE_ROW_START + Mem /
+					(MEM_TILE_DMA_PORTS * XAIE_NUM_COLS));
+			Req->DstPort = DMA;
+			Req->DstPortNum = Port;
+			Req->DstLoc = XAie_TileLoc(Col,
+					XAIE_AIE_TILE_ROW_START + Row);
+		} else {
+			/* Merge packet routes into the last memory tile row */
+			Mem = (i - NumCct) / 8U;
+			Req->Mode = XAIE_SS_ROUTE_PACKET;
+			Req->Pkt = XAie_PacketInit(i - NumCct, 0U);
+			Req->DropHeader = XAIE_SS_PKT_DONOT_DROP_HEADER;
+			Req->SrcPort = DMA;
+			Req->SrcPortNum = Port;
+			Req->SrcLoc = XAie_TileLoc(Col,
+					XAIE_AIE_TILE_ROW_START + Row);
+			Req->DstPort = DMA;
+			Req->DstPortNum = Mem % MEM_TILE_DMA_PORTS;
+			Req->DstLoc = XAie_TileLoc(XAIE_NUM_COLS - 1U -
+					Mem / MEM_TILE_DMA_PORTS,
+					XAIE_MEM_TILE_ROW_START +
+					XAIE_MEM_TILE_NUM_ROWS - 1U);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the main entry point for the AIE driver stream switch route
+* planner benchmark.
+*
+* @param	None.
+*
+* @return	0 on success and error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int main()
+{
+	AieRC RC = XAIE_OK;
+	const u32 NumCcts[] = {16U, 32U, 64U, 128U};
+
+	XAie_SetupConfig(ConfigPtr, XAIE_DEV_GEN_AIEML, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_MEM_TILE_ROW_START, XAIE_MEM_TILE_NUM_ROWS,
+			XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+
+	RC = XAie_CfgInitialize(&DevInst, &ConfigPtr);
+	if(RC != XAIE_OK) {
+		printf("Driver initialization failed.\n");
+		return -1;
+	}
+
+	RC = XAie_PmRequestTiles(&DevInst, NULL, 0);
+	if(RC != XAIE_OK) {
+		printf("Failed to request tiles.\n");
+		return -1;
+	}
+
+	printf("%10s %10s %10s %10s %12s %12s\n", "circuit", "packet",
+			"iterations", "hops", "compute(ms)", "apply(ms)");
+	for(u32 r = 0U; r < sizeof(NumCcts) / sizeof(NumCcts[0]); r++) {
+		XAie_StrmRoutePlan Plan;
+		u32 NumPkt = XAIE_PACKET_ID_MAX + 1U;
+		double Start, Compute, Apply;
+
+		GenRoutes(NumCcts[r], NumPkt);
+
+		Start = NowUs();
+		RC = XAie_StrmRouteCompute(&DevInst, Reqs, NumCcts[r] + NumPkt,
+				&Plan);
+		Compute = (NowUs() - Start) / 1e3;
+		if(RC != XAIE_OK) {
+			printf("Failed to route %d circuit routes.\n",
+					NumCcts[r]);
+			return -1;
+		}
+
+		Start = NowUs();
+		RC = XAie_StrmRouteApply(&DevInst, &Plan);
+		Apply = (NowUs() - Start) / 1e3;
+		if(RC != XAIE_OK) {
+			printf("Failed to configure routes.\n");
+			XAie_StrmRouteFree(&Plan);
+			return -1;
+		}
+
+		printf("%10d %10d %10d %10d %12.3f %12.3f\n", NumCcts[r],
+				NumPkt, Plan.NumIters, Plan.NumHops, Compute,
+				Apply);
+		XAie_StrmRouteFree(&Plan);
+	}
+
+	return 0;
+}
+
+/** @} */
@@ -27,6 +27,8 @@
 * 1.7   Nishad  07/24/2020  Add _XAie_GetFatalGroupErrors() helper function.
 * 1.8   Dishita 08/10/2020  Add api to get bit position from tile location
 * 1.9   Nishad  08/26/2020  Fix tiletype check in _XAie_CheckModule()
+* 1.10  dc      10/31/2021  Operate on bitmap words instead of single bits
+* 1.11  dc      10/31/2021  Add _XAie_TxnIsActive() helper API
 * </pre>
 *
 ******************************************************************************/
@@ -44,6 +46,9 @@
 #define XAIE_TXN_INST_EXPORTED_MASK XAIE_TXN_INSTANCE_EXPORTED
 #define XAIE_TXN_AUTO_FLUSH_MASK XAIE_TRANSACTION_ENABLE_AUTO_FLUSH
 
+#define XAIE_BITMAP_WORD_BITS	32U
+#define XAIE_BITMAP_WINDOW_BITS	64U
+
 /************************** Variable Definitions *****************************/
 /***************************** Macro Definitions *****************************/
 /************************** Function Definitions *****************************/
@@ -355,6 +360,25 @@ u32 _XAie_GetTileBitPosFromLoc(XAie_DevInst *DevInst, XAie_LocType Loc)
 	return Loc.Col * (DevInst->NumRows - 1U) + Loc.Row - 1U;
 }
 
+/*****************************************************************************/
+/**
+* This API returns a mask of the given number of least significant bits.
+*
+* @param        NumBit: Number of bits in the mask, 0 to 32.
+*
+* @return       Mask
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static inline u32 _XAie_BitmapMask(u32 NumBit)
+{
+	if(NumBit >= XAIE_BITMAP_WORD_BITS)
+		return ~0U;
+
+	return (1U << NumBit) - 1U;
+}
+
 /*****************************************************************************/
 /**
 * This API sets given number of bits from given start bit in the given bitmap.
@@ -372,9 +396,17 @@ u32 _XAie_GetTileBitPosFromLoc(XAie_DevInst *DevInst, XAie_LocType Loc)
 void _XAie_SetBitInBitmap(u32 *Bitmap, u32 StartSetBit,
 		u32 NumSetBit)
 {
-	for(u32 i = StartSetBit; i < StartSetBit + NumSetBit; i++) {
-		Bitmap[i / (sizeof(Bitmap[0]) * 8U)] |=
-			1U << (i % (sizeof(Bitmap[0]) * 8U));
+	while(NumSetBit > 0U) {
+		u32 Pos = StartSetBit % XAIE_BITMAP_WORD_BITS;
+		u32 Num = XAIE_BITMAP_WORD_BITS - Pos;
+
+		if(Num > NumSetBit)
+			Num = NumSetBit;
+
+		Bitmap[StartSetBit / XAIE_BITMAP_WORD_BITS] |=
+			_XAie_BitmapMask(Num) << Pos;
+		StartSetBit += Num;
+		NumSetBit -= Num;
 	}
 }
 
@@ -394,10 +426,201 @@ void _XAie_SetBitInBitmap(u32 *Bitmap, u32 StartSetBit,
 ******************************************************************************/
 void _XAie_ClrBitInBitmap(u32 *Bitmap, u32 StartBit, u32 NumBit)
 {
-	for(u32 i = StartBit; i < StartBit + NumBit; i++) {
-		Bitmap[i / (sizeof(Bitmap[0]) * 8U)] &=
-			~(1U << (i % (sizeof(Bitmap[0]) * 8U)));
+	while(NumBit > 0U) {
+		u32 Pos = StartBit % XAIE_BITMAP_WORD_BITS;
+		u32 Num = XAIE_BITMAP_WORD_BITS - Pos;
+
+		if(Num > NumBit)
+			Num = NumBit;
+
+		Bitmap[StartBit / XAIE_BITMAP_WORD_BITS] &=
+			~(_XAie_BitmapMask(Num) << Pos);
+		StartBit += Num;
+		NumBit -= Num;
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API returns given number of bits from given start bit in the given
+* bitmap. The start bit doesn't need to be word aligned.
+*
+* @param        Bitmap: bitmap to read from
+* @param        StartBit: Bit position in the bitmap
+* @param        NumBit: Number of bits to be read, 0 to 32.
+*
+* @return       Bits, the bit at StartBit is returned in bit 0.
+*
+* @note         This API is internal, hence all the argument checks are taken
+*               care of in the caller API.
+*
+******************************************************************************/
+u32 _XAie_GetBitsInBitmap(const u32 *Bitmap, u32 StartBit, u32 NumBit)
+{
+	u32 Word = StartBit / XAIE_BITMAP_WORD_BITS;
+	u32 Pos = StartBit % XAIE_BITMAP_WORD_BITS;
+	u64 Val;
+
+	if(NumBit == 0U)
+		return 0U;
+
+	Val = Bitmap[Word] >> Pos;
+	if(Pos + NumBit > XAIE_BITMAP_WORD_BITS)
+		Val |= (u64)Bitmap[Word + 1U] << (XAIE_BITMAP_WORD_BITS - Pos);
+
+	return (u32)Val & _XAie_BitmapMask(NumBit);
+}
+
+/*****************************************************************************/
+/**
+* This API returns up to 64 bits from given start bit in the given bitmap.
+*
+* @param        Bitmap: bitmap to read from
+* @param        StartBit: Bit position in the bitmap
+* @param        NumBit: Number of bits to be read, 0 to 64.
+*
+* @return       Bits, the bit at StartBit is returned in bit 0.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static u64 _XAie_GetBitsInBitmap64(const u32 *Bitmap, u32 StartBit,
+		u32 NumBit)
+{
+	u64 Val;
+
+	if(NumBit <= XAIE_BITMAP_WORD_BITS)
+		return _XAie_GetBitsInBitmap(Bitmap, StartBit, NumBit);
+
+	Val = _XAie_GetBitsInBitmap(Bitmap, StartBit, XAIE_BITMAP_WORD_BITS);
+	Val |= (u64)_XAie_GetBitsInBitmap(Bitmap,
+			StartBit + XAIE_BITMAP_WORD_BITS,
+			NumBit - XAIE_BITMAP_WORD_BITS) << XAIE_BITMAP_WORD_BITS;
+
+	return Val;
+}
+
+/*****************************************************************************/
+/**
+* This API counts the set bits in given number of bits from given start bit in
+* the given bitmap.
+*
+* @param        Bitmap: bitmap to read from
+* @param        StartBit: Bit position in the bitmap
+* @param        NumBit: Number of bits to be checked.
+*
+* @return       Number of set bits.
+*
+* @note         This API is internal, hence all the argument checks are taken
+*               care of in the caller API.
+*
+******************************************************************************/
+u32 _XAie_CountSetBitsInBitmap(const u32 *Bitmap, u32 StartBit, u32 NumBit)
+{
+	u32 Count = 0U;
+
+	while(NumBit > 0U) {
+		u32 Num = NumBit;
+
+		if(Num > XAIE_BITMAP_WORD_BITS)
+			Num = XAIE_BITMAP_WORD_BITS;
+
+		Count += _XAie_PopCount(_XAie_GetBitsInBitmap(Bitmap, StartBit,
+					Num));
+		StartBit += Num;
+		NumBit -= Num;
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+* This API finds the first run of free bits within a range of a resource
+* bitmap. A bit is free if it is neither set in the runtime bitmap nor in the
+* static bitmap located StaticBitmapOffset bits after it.
+*
+* The range is scanned in 64 bit windows. In a window, the free bits are
+* ANDed with themselves shifted right by doubling amounts, which leaves a bit
+* set only where a run of RunLen free bits starts. Consecutive windows overlap
+* by RunLen - 1 bits so that runs across a window boundary are found.
+*
+* @param        Bitmap: Resource bitmap
+* @param        StaticBitmapOffset: Offset for static bitmap
+* @param        StartBit: Bit position of the range in the bitmap
+* @param        NumBit: Number of bits in the range
+* @param        RunLen: Number of contiguous free bits required, 1 to 32.
+* @param        Align: Alignment of the run start relative to StartBit,
+*                      1 to 32.
+* @param        Index: Pointer to store the start of the run relative to
+*                      StartBit.
+*
+* @return       XAIE_OK if a run is found, XAIE_ERR otherwise.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+AieRC _XAie_FindFreeBitsInBitmap(const u32 *Bitmap, u32 StaticBitmapOffset,
+		u32 StartBit, u32 NumBit, u32 RunLen, u32 Align, u32 *Index)
+{
+	u64 AlignMask = ~(u64)0U;
+	u32 Step;
+
+	if((RunLen == 0U) || (RunLen > XAIE_BITMAP_WORD_BITS) ||
+			(Align == 0U) || (Align > XAIE_BITMAP_WORD_BITS))
+		return XAIE_ERR;
+
+	if(Align > 1U) {
+		AlignMask = 0U;
+		for(u32 i = 0U; i < XAIE_BITMAP_WINDOW_BITS; i += Align)
+			AlignMask |= (u64)1U << i;
+	}
+
+	/* Next window starts at the first unchecked aligned position */
+	Step = XAIE_BITMAP_WINDOW_BITS - RunLen + 1U;
+	Step -= Step % Align;
+
+	for(u32 Pos = 0U; Pos + RunLen <= NumBit; Pos += Step) {
+		u32 Len = NumBit - Pos;
+		u64 Free, Run;
+
+		if(Len > XAIE_BITMAP_WINDOW_BITS)
+			Len = XAIE_BITMAP_WINDOW_BITS;
+
+		Free = ~(_XAie_GetBitsInBitmap64(Bitmap, StartBit + Pos, Len) |
+			_XAie_GetBitsInBitmap64(Bitmap,
+				StartBit + StaticBitmapOffset + Pos, Len));
+		if(Len < XAIE_BITMAP_WINDOW_BITS)
+			Free &= ((u64)1U << Len) - 1U;
+
+		Run = Free;
+		for(u32 Done = 1U; Done < RunLen;) {
+			u32 Shift = RunLen - Done;
+
+			if(Shift > Done)
+				Shift = Done;
+			Run &= Run >> Shift;
+			Done += Shift;
+		}
+
+		Run &= AlignMask;
+		if(Run != 0U) {
+			u32 Low = (u32)Run;
+
+			if(Low != 0U)
+				*Index = Pos + _XAie_CountTrailingZeros(Low);
+			else
+				*Index = Pos + XAIE_BITMAP_WORD_BITS +
+					_XAie_CountTrailingZeros(
+						(u32)(Run >> XAIE_BITMAP_WORD_BITS));
+			return XAIE_OK;
+		}
+
+		if(Len < XAIE_BITMAP_WINDOW_BITS)
+			break;
 	}
+
+	return XAIE_ERR;
 }
 
 /*****************************************************************************/
@@ -814,6 +1037,31 @@ XAie_TxnInst* _XAie_TxnExport(XAie_DevInst *DevInst)
 	return Inst;
 }
 
+/*****************************************************************************/
+/**
+*
+* This api checks if the calling thread has a transaction in progress.
+*
+* @param	DevInst - Device instance pointer.
+*
+* @return	XAIE_ENABLE if the calling thread has a transaction in progress,
+*		XAIE_DISABLE otherwise.
+*
+* @note		Internal only. The transactions of the other threads are not
+*		taken into account.
+*
+******************************************************************************/
+u8 _XAie_TxnIsActive(XAie_DevInst *DevInst)
+{
+	const XAie_Backend *Backend = DevInst->Backend;
+
+	if(_XAie_GetTxnInst(DevInst, Backend->Ops.GetTid()) == NULL) {
+		return XAIE_DISABLE;
+	}
+
+	return XAIE_ENABLE;
+}
+
 /*****************************************************************************/
 /**
 *
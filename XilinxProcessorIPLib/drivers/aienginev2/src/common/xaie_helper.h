@@ -26,6 +26,8 @@
 * 1.5   Tejus   06/10/2020  Add helper functions for IO backend.
 * 1.6   Nishad  07/06/2020  Add helper functions for stream switch module.
 * 1.7   Nishad  07/24/2020  Add _XAie_GetFatalGroupErrors() helper function.
+* 1.8   dc      10/31/2021  Add word based bitmap helper functions.
+* 1.9   dc      10/31/2021  Add _XAie_TxnIsActive() helper function.
 * </pre>
 *
 ******************************************************************************/
@@ -98,6 +100,57 @@ static inline u64 _XAie_GetTileAddr(XAie_DevInst *DevInst, int R, int C)
 	return (R << DevInst->DevProp.RowShift) | (C << DevInst->DevProp.ColShift);
 }
 
+/*****************************************************************************/
+/**
+*
+* Returns the index of the least significant set bit of a word.
+*
+* @param	Val: Word value, must not be 0.
+* @return	Index of the least significant set bit
+*
+* @note		Internal API only.
+*
+******************************************************************************/
+static inline u32 _XAie_CountTrailingZeros(u32 Val)
+{
+#if defined(__GNUC__)
+	return (u32)__builtin_ctz(Val);
+#else
+	u32 Count = 0U;
+
+	while((Val & 1U) == 0U) {
+		Val >>= 1U;
+		Count++;
+	}
+
+	return Count;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* Returns the number of set bits of a word.
+*
+* @param	Val: Word value
+* @return	Number of set bits
+*
+* @note		Internal API only.
+*
+******************************************************************************/
+static inline u32 _XAie_PopCount(u32 Val)
+{
+#if defined(__GNUC__)
+	return (u32)__builtin_popcount(Val);
+#else
+	Val = Val - ((Val >> 1U) & 0x55555555U);
+	Val = (Val & 0x33333333U) + ((Val >> 2U) & 0x33333333U);
+	Val = (Val + (Val >> 4U)) & 0x0F0F0F0FU;
+
+	return (Val * 0x01010101U) >> 24U;
+#endif
+}
+
 void XAie_Log(FILE *Fd, const char* prefix, const char *Format, ...);
 u8 _XAie_GetTileTypefromLoc(XAie_DevInst *DevInst, XAie_LocType Loc);
 AieRC _XAie_CheckModule(XAie_DevInst *DevInst, XAie_LocType Loc,
@@ -111,6 +164,10 @@ u32 _XAie_GetFatalGroupErrors(XAie_DevInst *DevInst, XAie_LocType Loc,
 u32 _XAie_GetTileBitPosFromLoc(XAie_DevInst *DevInst, XAie_LocType Loc);
 void _XAie_SetBitInBitmap(u32 *Bitmap, u32 StartSetBit, u32 NumSetBit);
 void _XAie_ClrBitInBitmap(u32 *Bitmap, u32 StartBit, u32 NumBit);
+u32 _XAie_GetBitsInBitmap(const u32 *Bitmap, u32 StartBit, u32 NumBit);
+u32 _XAie_CountSetBitsInBitmap(const u32 *Bitmap, u32 StartBit, u32 NumBit);
+AieRC _XAie_FindFreeBitsInBitmap(const u32 *Bitmap, u32 StaticBitmapOffset,
+		u32 StartBit, u32 NumBit, u32 RunLen, u32 Align, u32 *Index);
 AieRC XAie_Write32(XAie_DevInst *DevInst, u64 RegOff, u32 Value);
 AieRC XAie_Read32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data);
 AieRC XAie_MaskWrite32(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value);
@@ -125,6 +182,7 @@ AieRC _XAie_Txn_Start(XAie_DevInst *DevInst, u32 Flags);
 AieRC _XAie_Txn_Submit(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst);
 XAie_TxnInst* _XAie_TxnExport(XAie_DevInst *DevInst);
 AieRC _XAie_TxnFree(XAie_TxnInst *Inst);
+u8 _XAie_TxnIsActive(XAie_DevInst *DevInst);
 void _XAie_TxnResourceCleanup(XAie_DevInst *DevInst);
 u32 _XAie_GetNumRows(XAie_DevInst *DevInst, u8 TileType);
 u32 _XAie_GetStartRow(XAie_DevInst *DevInst, u8 TileType);
@@ -28,6 +28,7 @@
 *			    XAie_DmaFifoCounter values in
 *			    XAie_DmaChannelResetAll, and XAie_DmaConfigFifoMode,
 *			    respectively.
+* 1.9   dc      10/31/2021  Add apis to program bds in batches with shadow.
 * </pre>
 *
 ******************************************************************************/
@@ -779,6 +780,302 @@ AieRC XAie_DmaWriteBd(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
 	return DmaMod->WriteBd(DevInst, DmaDesc, Loc, BdNum);
 }
 
+/*****************************************************************************/
+/**
+*
+* This API initializes a batch of dma buffer descriptors. A batch keeps a host
+* side shadow of the BDs it programmed, so that reprogramming a BD only writes
+* the words which changed since the last submit.
+*
+* @param	Batch: Pointer to the batch.
+* @param	Bds: Shadow storage of MaxBds elements.
+* @param	MaxBds: Maximum number of distinct BDs in the batch.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_DmaBdBatchInit(XAie_DmaBdBatch *Batch, XAie_DmaBdShadow *Bds,
+		u32 MaxBds)
+{
+	if((Batch == XAIE_NULL) || (Bds == XAIE_NULL) || (MaxBds == 0U)) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Batch->Bds = Bds;
+	Batch->NumBds = 0U;
+	Batch->MaxBds = MaxBds;
+	Batch->Cursor = 0U;
+	Batch->WordsWritten = 0U;
+	Batch->WordsSkipped = 0U;
+	Batch->NumWrites = 0U;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API finds the shadow of a BD in a batch. Batches are usually refilled
+* in the same order every iteration, so the lookup starts after the previous
+* match.
+*
+* @param	Batch: Pointer to the batch.
+* @param	Loc: Location of AIE Tile
+* @param	BdNum: Hardware BD number.
+*
+* @return	Pointer to the shadow, NULL if not found.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static XAie_DmaBdShadow *_XAie_DmaBdBatchFind(XAie_DmaBdBatch *Batch,
+		XAie_LocType Loc, u8 BdNum)
+{
+	for(u32 i = 0U; i < Batch->NumBds; i++) {
+		u32 Idx = Batch->Cursor + i;
+		XAie_DmaBdShadow *Bd;
+
+		if(Idx >= Batch->NumBds) {
+			Idx -= Batch->NumBds;
+		}
+
+		Bd = &Batch->Bds[Idx];
+		if((Bd->BdNum == BdNum) && (Bd->Loc.Col == Loc.Col) &&
+				(Bd->Loc.Row == Loc.Row)) {
+			Batch->Cursor = Idx + 1U;
+			if(Batch->Cursor == Batch->NumBds) {
+				Batch->Cursor = 0U;
+			}
+			return Bd;
+		}
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API adds a dma buffer descriptor to a batch. The descriptor is encoded
+* and queued, nothing is written to the hardware until XAie_DmaBdBatchSubmit().
+* Adding a BD which is already queued replaces the queued words.
+*
+* @param	DevInst: Device Instance
+* @param	Batch: Pointer to the batch.
+* @param	DmaDesc: Initialized Dma Descriptor.
+* @param	Loc: Location of AIE Tile
+* @param	BdNum: Hardware BD number to be written to.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Shim tile BDs are written immediately through
+*		XAie_DmaWriteBd() as the backend may need to map their buffers.
+*
+******************************************************************************/
+AieRC XAie_DmaBdBatchAdd(XAie_DevInst *DevInst, XAie_DmaBdBatch *Batch,
+		XAie_DmaDesc *DmaDesc, XAie_LocType Loc, u8 BdNum)
+{
+	AieRC RC;
+	XAie_DmaBdShadow *Bd;
+	const XAie_DmaMod *DmaMod;
+
+	if((DevInst == XAIE_NULL) || (Batch == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((DmaDesc == XAIE_NULL) ||
+			(DmaDesc->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(DmaDesc->TileType != DevInst->DevOps->GetTTypefromLoc(DevInst, Loc)) {
+		XAIE_ERROR("Tile type mismatch\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	DmaMod = DmaDesc->DmaMod;
+	if(BdNum > DmaMod->NumBds) {
+		XAIE_ERROR("Invalid BD number\n");
+		return XAIE_INVALID_BD_NUM;
+	}
+
+	if(DmaMod->EncodeBd == NULL) {
+		return DmaMod->WriteBd(DevInst, DmaDesc, Loc, BdNum);
+	}
+
+	Bd = _XAie_DmaBdBatchFind(Batch, Loc, BdNum);
+	if(Bd == NULL) {
+		if(Batch->NumBds == Batch->MaxBds) {
+			XAIE_ERROR("BD batch is full\n");
+			return XAIE_ERR;
+		}
+
+		Bd = &Batch->Bds[Batch->NumBds++];
+		Bd->Loc = Loc;
+		Bd->BdNum = BdNum;
+		Bd->Valid = 0U;
+		Bd->Queued = 0U;
+		Bd->Addr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset +
+			_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+	}
+
+	RC = DmaMod->EncodeBd(DevInst, DmaDesc, &Bd->NewWords);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	Bd->Queued = 1U;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes the queued BDs of a batch to the hardware. Only the words
+* which differ from the shadow are written, consecutive changed words of a BD
+* are written with one block write, and the words updated by the hardware are
+* always written. If the backend supports transactions and no transaction is
+* in progress, all the writes are submitted as one transaction.
+*
+* @param	DevInst: Device Instance
+* @param	Batch: Pointer to the batch.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The number of words written and skipped, and the number of
+*		register accesses are reported in the batch.
+*
+******************************************************************************/
+AieRC XAie_DmaBdBatchSubmit(XAie_DevInst *DevInst, XAie_DmaBdBatch *Batch)
+{
+	AieRC RC = XAIE_OK;
+	u8 Txn = XAIE_DISABLE;
+
+	if((DevInst == XAIE_NULL) || (Batch == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Batch->WordsWritten = 0U;
+	Batch->WordsSkipped = 0U;
+	Batch->NumWrites = 0U;
+
+	if((DevInst->Backend->Ops.SubmitTxn != NULL) &&
+			(DevInst->TxnList.Next == NULL)) {
+		if(XAie_StartTransaction(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH) == XAIE_OK) {
+			Txn = XAIE_ENABLE;
+		}
+	}
+
+	for(u32 i = 0U; (i < Batch->NumBds) && (RC == XAIE_OK); i++) {
+		XAie_DmaBdShadow *Bd = &Batch->Bds[i];
+		u32 Changed = 0U;
+		u8 NumWords = Bd->NewWords.NumWords;
+		u8 Start = 0U;
+
+		if(Bd->Queued == 0U) {
+			continue;
+		}
+
+		for(u8 w = 0U; w < NumWords; w++) {
+			if((Bd->Valid == 0U) ||
+					(Bd->Words.Words[w] != Bd->NewWords.Words[w])) {
+				Changed |= (1U << w);
+			}
+		}
+		Changed |= Bd->NewWords.HwUpdatedMask;
+
+		while(Start < NumWords) {
+			u8 End = Start;
+
+			if((Changed & (1U << Start)) == 0U) {
+				Batch->WordsSkipped++;
+				Start++;
+				continue;
+			}
+
+			while((End < NumWords) && (Changed & (1U << End))) {
+				End++;
+			}
+
+			if(End - Start == 1U) {
+				RC = XAie_Write32(DevInst, Bd->Addr + Start * 4U,
+						Bd->NewWords.Words[Start]);
+			} else {
+				RC = XAie_BlockWrite32(DevInst,
+						Bd->Addr + Start * 4U,
+						&Bd->NewWords.Words[Start],
+						End - Start);
+			}
+			if(RC != XAIE_OK) {
+				break;
+			}
+
+			Batch->WordsWritten += End - Start;
+			Batch->NumWrites++;
+			Start = End;
+		}
+
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to write BD %d of tile (%d, %d)\n",
+					Bd->BdNum, Bd->Loc.Col, Bd->Loc.Row);
+			Bd->Valid = 0U;
+			break;
+		}
+
+		Bd->Words = Bd->NewWords;
+		Bd->Valid = 1U;
+		Bd->Queued = 0U;
+	}
+
+	if(Txn == XAIE_ENABLE) {
+		AieRC TxnRC = XAie_SubmitTransaction(DevInst, NULL);
+
+		if(RC == XAIE_OK) {
+			RC = TxnRC;
+		}
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API invalidates the shadow of all the BDs of a batch, the next submit
+* writes the queued BDs in full. It is to be called when the BDs may have
+* been changed without the batch, for example after a tile reset.
+*
+* @param	Batch: Pointer to the batch.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_DmaBdBatchInvalidate(XAie_DmaBdBatch *Batch)
+{
+	if(Batch == XAIE_NULL) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < Batch->NumBds; i++) {
+		Batch->Bds[i].Valid = 0U;
+	}
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /**
 *
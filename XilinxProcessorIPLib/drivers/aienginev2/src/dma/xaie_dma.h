@@ -21,6 +21,7 @@
 * 1.2   Tejus   03/22/2020  Dma apis for aie
 * 1.3   Tejus   04/09/2020  Remove unused argument from interleave enable api
 * 1.4   Tejus   06/05/2020  Add api to enable fifo mode.
+* 1.5   dc      10/31/2021  Add bd batch data structures and apis.
 * </pre>
 *
 ******************************************************************************/
@@ -40,6 +41,34 @@ typedef enum {
 	XAIE_DMA_FIFO_COUNTER_1 = 3U,
 } XAie_DmaFifoCounter;
 
+/*
+ * This structure captures the host side shadow of a dma buffer descriptor
+ * programmed through a BD batch.
+ */
+typedef struct {
+	XAie_LocType Loc;
+	u8 BdNum;
+	u8 Valid;	/* Words holds the last words written to hardware */
+	u8 Queued;	/* NewWords waits for the next batch submit */
+	u64 Addr;	/* Register address of the BD */
+	XAie_DmaBdWords Words;
+	XAie_DmaBdWords NewWords;
+} XAie_DmaBdShadow;
+
+/*
+ * This structure captures a batch of dma buffer descriptors across tiles. The
+ * shadow storage is provided by the caller.
+ */
+typedef struct {
+	XAie_DmaBdShadow *Bds;
+	u32 NumBds;
+	u32 MaxBds;
+	u32 Cursor;		/* Hint for the next shadow lookup */
+	u32 WordsWritten;	/* BD words written by the last submit */
+	u32 WordsSkipped;	/* Unchanged BD words of the last submit */
+	u32 NumWrites;		/* Register accesses of the last submit */
+} XAie_DmaBdBatch;
+
 /************************** Function Prototypes  *****************************/
 
 /*****************************************************************************/
@@ -99,6 +128,12 @@ AieRC XAie_DmaSetInterleaveEnable(XAie_DmaDesc *DmaDesc, u8 DoubleBuff,
 		u8 IntrleaveCount, u16 IntrleaveCurr);
 AieRC XAie_DmaWriteBd(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
 		XAie_LocType Loc, u8 BdNum);
+AieRC XAie_DmaBdBatchInit(XAie_DmaBdBatch *Batch, XAie_DmaBdShadow *Bds,
+		u32 MaxBds);
+AieRC XAie_DmaBdBatchAdd(XAie_DevInst *DevInst, XAie_DmaBdBatch *Batch,
+		XAie_DmaDesc *DmaDesc, XAie_LocType Loc, u8 BdNum);
+AieRC XAie_DmaBdBatchSubmit(XAie_DevInst *DevInst, XAie_DmaBdBatch *Batch);
+AieRC XAie_DmaBdBatchInvalidate(XAie_DmaBdBatch *Batch);
 AieRC XAie_DmaChannelResetAll(XAie_DevInst *DevInst, XAie_LocType Loc,
 		XAie_DmaChReset Reset);
 AieRC XAie_DmaChannelReset(XAie_DevInst *DevInst, XAie_LocType Loc,
@@ -18,6 +18,7 @@
 * ----- ------  -------- -----------------------------------------------------
 * 1.0   Tejus   03/23/2020  Initial creation
 * 1.1   Tejus   06/10/2020  Switch to new io backend apis.
+* 1.2   dc      10/31/2021  Split bd encoding out of tile dma write bd.
 * </pre>
 *
 ******************************************************************************/
@@ -312,35 +313,29 @@ AieRC _XAie_ShimDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 /*****************************************************************************/
 /**
 *
-* This API writes a Dma Descriptor which is initialized and setup by other APIs
-* into the corresponding registers and register fields in the hardware. This API
+* This API encodes a Dma Descriptor which is initialized and setup by other
+* APIs into the register words of a hardware BD, without writing them. This API
 * is specific to AIE Tiles only.
 *
 * @param	DevInst: Device Instance
 * @param	DmaDesc: Initialized Dma Descriptor.
-* @param	Loc: Location of AIE Tile
-* @param	BdNum: Hardware BD number to be written to.
+* @param	Bd: Pointer to return the encoded BD words.
 *
 * @return	XAIE_OK on success, Error code on failure.
 *
 * @note		Internal only. For AIE Tiles only.
 *
 ******************************************************************************/
-AieRC _XAie_TileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
-		XAie_LocType Loc, u8 BdNum)
+AieRC _XAie_TileDmaEncodeBd(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
+		XAie_DmaBdWords *Bd)
 {
-	AieRC RC;
-	u64 Addr;
-	u64 BdBaseAddr;
-	u32 BdWord[XAIE_TILEDMA_NUM_BD_WORDS];
+	u32 *BdWord = Bd->Words;
 	const XAie_DmaMod *DmaMod;
 	const XAie_DmaBdProp *BdProp;
 
 	DmaMod = DevInst->DevProp.DevMod[DmaDesc->TileType].DmaMod;
 	BdProp = DmaMod->BdProp;
 
-	BdBaseAddr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset;
-
 	/* AcqLockId and RelLockId are the same in AIE */
 	BdWord[0U] = XAie_SetField(DmaDesc->LockDesc.LockAcqId,
 			BdProp->Lock->AieDmaLock.LckId_A.Lsb,
@@ -454,16 +449,48 @@ AieRC _XAie_TileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 				BdProp->Buffer->TileDmaBuff.BufferLen.Lsb,
 				BdProp->Buffer->TileDmaBuff.BufferLen.Mask);
 
-	Addr = BdBaseAddr + _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+	Bd->NumWords = XAIE_TILEDMA_NUM_BD_WORDS;
+	/* Interleave current pointer is updated by hardware */
+	Bd->HwUpdatedMask = (1U << 5U);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes a Dma Descriptor which is initialized and setup by other APIs
+* into the corresponding registers and register fields in the hardware. This API
+* is specific to AIE Tiles only.
+*
+* @param	DevInst: Device Instance
+* @param	DmaDesc: Initialized Dma Descriptor.
+* @param	Loc: Location of AIE Tile
+* @param	BdNum: Hardware BD number to be written to.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. For AIE Tiles only.
+*
+******************************************************************************/
+AieRC _XAie_TileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
+		XAie_LocType Loc, u8 BdNum)
+{
+	AieRC RC;
+	u64 Addr;
+	XAie_DmaBdWords Bd;
+	const XAie_DmaMod *DmaMod;
 
-	for(u8 i = 0U; i < XAIE_TILEDMA_NUM_BD_WORDS; i++) {
-		RC = XAie_Write32(DevInst, Addr + i * 4U, BdWord[i]);
-		if(RC != XAIE_OK) {
-			return RC;
-		}
+	RC = _XAie_TileDmaEncodeBd(DevInst, DmaDesc, &Bd);
+	if(RC != XAIE_OK) {
+		return RC;
 	}
 
-	return XAIE_OK;
+	DmaMod = DevInst->DevProp.DevMod[DmaDesc->TileType].DmaMod;
+	Addr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset +
+		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+
+	return XAie_BlockWrite32(DevInst, Addr, Bd.Words, Bd.NumWords);
 }
 
 /*****************************************************************************/
@@ -18,6 +18,7 @@
 * ----- ------  -------- -----------------------------------------------------
 * 1.0   Tejus   03/23/2020  Initial creation
 * 1.1   Tejus   06/10/2020  Switch to new io backend apis.
+* 1.2   dc      10/31/2021  Split bd encoding out of tile dma write bd.
 * </pre>
 *
 ******************************************************************************/
@@ -248,27 +249,24 @@ static AieRC _XAieMl_DmaMemTileCheckPaddingConfig(XAie_DmaDesc *DmaDesc)
 /*****************************************************************************/
 /**
 *
-* This API writes a Dma Descriptor which is initialized and setup by other APIs
-* into the corresponding registers and register fields in the hardware. This API
-* is specific to AIEML Memory Tiles only.
+* This API encodes a Dma Descriptor which is initialized and setup by other
+* APIs into the register words of a hardware BD, without writing them. This API
+* is specific to AIEML Mem Tiles only.
 *
 * @param	DevInst: Device Instance
 * @param	DmaDesc: Initialized Dma Descriptor.
-* @param	Loc: Location of AIE Tile
-* @param	BdNum: Hardware BD number to be written to.
+* @param	Bd: Pointer to return the encoded BD words.
 *
 * @return	XAIE_OK on success, Error code on failure.
 *
 * @note		Internal only. For AIEML Mem Tiles only.
 *
 ******************************************************************************/
-AieRC _XAieMl_MemTileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
-		XAie_LocType Loc, u8 BdNum)
+AieRC _XAieMl_MemTileDmaEncodeBd(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
+		XAie_DmaBdWords *Bd)
 {
 	AieRC RC;
-	u64 Addr;
-	u64 BdBaseAddr;
-	u32 BdWord[XAIEML_MEMTILEDMA_NUM_BD_WORDS];
+	u32 *BdWord = Bd->Words;
 	const XAie_DmaMod *DmaMod;
 	const XAie_DmaBdProp *BdProp;
 
@@ -279,8 +277,6 @@ AieRC _XAieMl_MemTileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 	DmaMod = DevInst->DevProp.DevMod[DmaDesc->TileType].DmaMod;
 	BdProp = DmaMod->BdProp;
 
-	BdBaseAddr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset;
-
 	/* Setup BdWord with the right values from DmaDesc */
 	BdWord[0U] = XAie_SetField(DmaDesc->PktDesc.PktEn,
 			BdProp->Pkt->EnPkt.Lsb, BdProp->Pkt->EnPkt.Mask) |
@@ -382,14 +378,9 @@ AieRC _XAieMl_MemTileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 				BdProp->Lock->AieMlDmaLock.LckAcqEn.Lsb,
 				BdProp->Lock->AieMlDmaLock.LckAcqEn.Mask);
 
-	Addr = BdBaseAddr + _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
-
-	for(u8 i = 0U; i < XAIEML_MEMTILEDMA_NUM_BD_WORDS; i++) {
-		RC = XAie_Write32(DevInst, Addr + i * 4U, BdWord[i]);
-		if(RC != XAIE_OK) {
-			return RC;
-		}
-	}
+	Bd->NumWords = XAIEML_MEMTILEDMA_NUM_BD_WORDS;
+	/* Iteration current is incremented by hardware */
+	Bd->HwUpdatedMask = (1U << 6U);
 
 	return XAIE_OK;
 }
@@ -399,7 +390,7 @@ AieRC _XAieMl_MemTileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 *
 * This API writes a Dma Descriptor which is initialized and setup by other APIs
 * into the corresponding registers and register fields in the hardware. This API
-* is specific to AIEML Tiles only.
+* is specific to AIEML Memory Tiles only.
 *
 * @param	DevInst: Device Instance
 * @param	DmaDesc: Initialized Dma Descriptor.
@@ -408,24 +399,55 @@ AieRC _XAieMl_MemTileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 *
 * @return	XAIE_OK on success, Error code on failure.
 *
-* @note		Internal only. For AIEML Tiles only.
+* @note		Internal only. For AIEML Mem Tiles only.
 *
 ******************************************************************************/
-AieRC _XAieMl_TileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
+AieRC _XAieMl_MemTileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 		XAie_LocType Loc, u8 BdNum)
 {
 	AieRC RC;
 	u64 Addr;
-	u64 BdBaseAddr;
-	u32 BdWord[XAIEML_TILEDMA_NUM_BD_WORDS];
+	XAie_DmaBdWords Bd;
+	const XAie_DmaMod *DmaMod;
+
+	RC = _XAieMl_MemTileDmaEncodeBd(DevInst, DmaDesc, &Bd);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	DmaMod = DevInst->DevProp.DevMod[DmaDesc->TileType].DmaMod;
+	Addr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset +
+		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+
+	return XAie_BlockWrite32(DevInst, Addr, Bd.Words, Bd.NumWords);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API encodes a Dma Descriptor which is initialized and setup by other
+* APIs into the register words of a hardware BD, without writing them. This API
+* is specific to AIEML Tiles only.
+*
+* @param	DevInst: Device Instance
+* @param	DmaDesc: Initialized Dma Descriptor.
+* @param	Bd: Pointer to return the encoded BD words.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. For AIEML Tiles only.
+*
+******************************************************************************/
+AieRC _XAieMl_TileDmaEncodeBd(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
+		XAie_DmaBdWords *Bd)
+{
+	u32 *BdWord = Bd->Words;
 	const XAie_DmaMod *DmaMod;
 	const XAie_DmaBdProp *BdProp;
 
 	DmaMod = DevInst->DevProp.DevMod[DmaDesc->TileType].DmaMod;
 	BdProp = DmaMod->BdProp;
 
-	BdBaseAddr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset;
-
 	/* Setup BdWord with the right values from DmaDesc */
 	BdWord[0U] = XAie_SetField(DmaDesc->AddrDesc.Address,
 				BdProp->Buffer->TileDmaBuff.BaseAddr.Lsb,
@@ -502,16 +524,48 @@ AieRC _XAieMl_TileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
 				BdProp->BdEn->TlastSuppress.Lsb,
 				BdProp->BdEn->TlastSuppress.Mask);
 
-	Addr = BdBaseAddr + _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+	Bd->NumWords = XAIEML_TILEDMA_NUM_BD_WORDS;
+	/* Iteration current is incremented by hardware */
+	Bd->HwUpdatedMask = (1U << 4U);
 
-	for(u8 i = 0U; i < XAIEML_TILEDMA_NUM_BD_WORDS; i++) {
-		RC = XAie_Write32(DevInst, Addr + i * 4U, BdWord[i]);
-		if(RC != XAIE_OK) {
-			return RC;
-		}
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes a Dma Descriptor which is initialized and setup by other APIs
+* into the corresponding registers and register fields in the hardware. This API
+* is specific to AIEML Tiles only.
+*
+* @param	DevInst: Device Instance
+* @param	DmaDesc: Initialized Dma Descriptor.
+* @param	Loc: Location of AIE Tile
+* @param	BdNum: Hardware BD number to be written to.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. For AIEML Tiles only.
+*
+******************************************************************************/
+AieRC _XAieMl_TileDmaWriteBd(XAie_DevInst *DevInst , XAie_DmaDesc *DmaDesc,
+		XAie_LocType Loc, u8 BdNum)
+{
+	AieRC RC;
+	u64 Addr;
+	XAie_DmaBdWords Bd;
+	const XAie_DmaMod *DmaMod;
+
+	RC = _XAieMl_TileDmaEncodeBd(DevInst, DmaDesc, &Bd);
+	if(RC != XAIE_OK) {
+		return RC;
 	}
 
-	return XAIE_OK;
+	DmaMod = DevInst->DevProp.DevMod[DmaDesc->TileType].DmaMod;
+	Addr = DmaMod->BaseAddr + BdNum * DmaMod->IdxOffset +
+		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+
+	return XAie_BlockWrite32(DevInst, Addr, Bd.Words, Bd.NumWords);
 }
 
 /*****************************************************************************/
@@ -33,6 +33,7 @@
 * 2.1   Tejus   06/10/2020  Add IO backend data structures.
 * 2.2   Tejus   06/10/2020  Add ess simulation backend.
 * 2.3   Tejus   06/10/2020  Add api to change backend at runtime.
+* 2.4   dc      10/31/2021  Add data structure for encoded dma bd words.
 * </pre>
 *
 ******************************************************************************/
@@ -48,6 +49,7 @@
 #define XAIE_PACKET_ID_MAX		0x1F
 #define XAIE_PACKET_TYPE_MAX		0x7
 #define XAIE_TILES_BITMAP_SIZE          32
+#define XAIE_DMA_BD_MAX_WORDS		8U
 
 #define XAIE_TRANSACTION_ENABLE_AUTO_FLUSH	0b1
 #define XAIE_TRANSACTION_DISABLE_AUTO_FLUSH	0b0
@@ -351,6 +353,13 @@ typedef struct {
 	u8 IsReady;
 } XAie_DmaDesc;
 
+/* typedef to capture the register words of an encoded dma buffer descriptor */
+typedef struct {
+	u32 Words[XAIE_DMA_BD_MAX_WORDS];
+	u8 NumWords;
+	u8 HwUpdatedMask; /* Bitmap of words updated by hardware */
+} XAie_DmaBdWords;
+
 typedef struct {
 	u32 RepeatCount;
 	u8 StartBd;
@@ -41,6 +41,7 @@
 * 2.8   Nishad 07/21/2020  Add data structure for interrupt controller.
 * 2.9   Nishad 07/24/2020  Add event property to capture default group error
 *			   mask.
+* 3.0   dc     10/31/2021  Add dma property to encode a bd without writing it.
 * </pre>
 *
 ******************************************************************************/
@@ -519,6 +520,8 @@ typedef struct XAie_DmaMod {
 			u8 IterCurr);
 	AieRC (*WriteBd)(XAie_DevInst *DevInst, XAie_DmaDesc *Desc,
 			XAie_LocType Loc, u8 BdNum);
+	AieRC (*EncodeBd)(XAie_DevInst *DevInst, XAie_DmaDesc *Desc,
+			XAie_DmaBdWords *Bd);
 	AieRC (*PendingBd)(XAie_DevInst *DevInst, XAie_LocType Loc,
 			const XAie_DmaMod *DmaMod, u8 ChNum,
 			XAie_DmaDirection Dir, u8 *PendingBd);
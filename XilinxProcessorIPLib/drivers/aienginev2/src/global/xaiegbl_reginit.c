@@ -49,6 +49,7 @@
 *			    register properties
 * 3.3   Nishad  07/21/2020  Populate interrupt controller data structure.
 * 3.4   Nishad  07/24/2020  Populate value of default group error mask.
+* 3.5   dc      10/31/2021  Populate dma bd encode function.
 * </pre>
 *
 ******************************************************************************/
@@ -1472,6 +1473,7 @@ static const XAie_DmaMod AieTileDmaMod =
 	.SetMultiDim = &_XAie_DmaSetMultiDim,
 	.SetBdIter = &_XAie_DmaSetBdIteration,
 	.WriteBd = &_XAie_TileDmaWriteBd,
+	.EncodeBd = &_XAie_TileDmaEncodeBd,
 	.PendingBd = &_XAie_DmaGetPendingBdCount,
 	.WaitforDone = &_XAie_DmaWaitForDone,
 	.BdChValidity = &_XAie_DmaCheckBdChValidity,
@@ -1674,6 +1676,7 @@ static const XAie_DmaMod AieShimDmaMod =
 	.SetMultiDim = NULL,
 	.SetBdIter = &_XAie_DmaSetBdIteration,
 	.WriteBd = &_XAie_ShimDmaWriteBd,
+	.EncodeBd = NULL,
 	.PendingBd = &_XAie_DmaGetPendingBdCount,
 	.WaitforDone = &_XAie_DmaWaitForDone,
 	.BdChValidity = &_XAie_DmaCheckBdChValidity,
@@ -51,6 +51,7 @@
 *			    register properties
 * 3.5   Nishad  07/21/2020  Populate interrupt controller data structure.
 * 3.4   Nishad  07/24/2020  Populate value of default group error mask.
+* 3.6   dc      10/31/2021  Populate dma bd encode function.
 * </pre>
 *
 ******************************************************************************/
@@ -408,6 +409,7 @@ static const  XAie_DmaMod AieMlMemTileDmaMod =
 	.SetMultiDim = &_XAieMl_DmaSetMultiDim,
 	.SetBdIter = &_XAieMl_DmaSetBdIteration,
 	.WriteBd = &_XAieMl_MemTileDmaWriteBd,
+	.EncodeBd = &_XAieMl_MemTileDmaEncodeBd,
 	.PendingBd = &_XAieMl_DmaGetPendingBdCount,
 	.WaitforDone = &_XAieMl_DmaWaitForDone,
 	.BdChValidity = &_XAieMl_MemTileDmaCheckBdChValidity,
@@ -637,6 +639,7 @@ static const  XAie_DmaMod AieMlTileDmaMod =
 	.SetMultiDim = &_XAieMl_DmaSetMultiDim,
 	.SetBdIter = &_XAieMl_DmaSetBdIteration,
 	.WriteBd = &_XAieMl_TileDmaWriteBd,
+	.EncodeBd = &_XAieMl_TileDmaEncodeBd,
 	.PendingBd = &_XAieMl_DmaGetPendingBdCount,
 	.WaitforDone = &_XAieMl_DmaWaitForDone,
 	.BdChValidity = &_XAieMl_DmaCheckBdChValidity,
@@ -881,6 +884,7 @@ static const  XAie_DmaMod AieMlShimDmaMod =
 	.SetMultiDim = &_XAieMl_DmaSetMultiDim,
 	.SetBdIter = &_XAieMl_DmaSetBdIteration,
 	.WriteBd = &_XAieMl_ShimDmaWriteBd,
+	.EncodeBd = NULL,
 	.PendingBd = &_XAieMl_DmaGetPendingBdCount,
 	.WaitforDone = &_XAieMl_DmaWaitForDone,
 	.BdChValidity = &_XAieMl_DmaCheckBdChValidity,
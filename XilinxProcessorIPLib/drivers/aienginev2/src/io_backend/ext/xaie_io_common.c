@@ -17,6 +17,7 @@
 * Ver   Who     Date        Changes
 * ----- ------  --------    ---------------------------------------------------
 * 1.0   Dishita 03/08/2021  Initial creation
+* 1.1   dc      10/31/2021  Search resource bitmaps word by word
 *
 * </pre>
 *
@@ -31,86 +32,8 @@
 #include "xaie_rsc_internal.h"
 /*****************************************************************************/
 /***************************** Macro Definitions *****************************/
-#define XAIE_BROADCAST_CHANNEL_MASK     0xFFFF
-
 /************************** Function Definitions *****************************/
 #ifdef XAIE_FEATURE_RSC_ENABLE
-/*****************************************************************************/
-/**
-* This API finds free resource after checking static and runtime allocated
-* resource status in bitmap.
-*
-* @param	Bitmap: Bitmap of the resource
-* @param	StaticBitmapOffset: Offset for static bitmap
-* @param	StartBit: Index for the resource start bit in the bitmap
-* @param	MaxRscVal: Number of resource per tile
-* @param	Index: Pointer to store free resource found
-*
-* @return	XAIE_OK on success.
-*
-* @note		Internal only.
-*
-*******************************************************************************/
-static AieRC _XAie_FindAvailableRsc(u32 *Bitmap, u32 StaticBitmapOffset,
-		u32 StartBit, u32 MaxRscVal, u32 *Index)
-{
-	for(u32 i = StartBit; i < StartBit + MaxRscVal; i++) {
-		if(!((CheckBit(Bitmap, i)) |
-				CheckBit(Bitmap, (i + StaticBitmapOffset)))) {
-			*Index = i - StartBit;
-			return XAIE_OK;
-		}
-	}
-
-	return XAIE_ERR;
-}
-
-/*****************************************************************************/
-/**
-* This API finds free resource after checking static and runtime allocated
-* resource status in bitmap. This API checks for contiguous free bits.
-*
-* @param	Bitmap: Bitmap of the resource
-* @param	SBmOff: Offset for static bitmap
-* @param	StartBit: Index for the resource start bit in the bitmap
-* @param	MaxRscVal: Number of resource per tile
-* @param	Index: Pointer to store free resource found
-* @param	NumContigRscs: Number of conitguous resource required
-*
-* @return	XAIE_OK on success.
-*
-* @note		Internal only.
-*
-*******************************************************************************/
-static AieRC _XAie_FindAvailableRscContig(u32 *Bitmap, u32 SBmOff,
-		u32 StartBit, u32 MaxRscVal, u32 *Index, u8 NumContigRscs,
-		XAie_RscType RscType)
-{
-	for(u32 i = StartBit; i < StartBit + MaxRscVal; i += NumContigRscs) {
-		u32 j;
-
-		if(!((CheckBit(Bitmap, i)) |
-				CheckBit(Bitmap, (i + SBmOff)))) {
-			*Index = i - StartBit;
-			for(j = i + 1; j < i + NumContigRscs; j++) {
-				if(CheckBit(Bitmap, j) ||
-						CheckBit(Bitmap, (j + SBmOff)))
-					break;
-			}
-
-			if(j == (i + NumContigRscs)) {
-				if ((RscType == XAIE_PC_EVENTS_RSC ||
-					  RscType == XAIE_COMBO_EVENTS_RSC) &&
-					  *Index % 2 == 0) {
-					return XAIE_OK;
-				}
-			}
-		}
-	}
-
-	return XAIE_ERR;
-}
-
 /*****************************************************************************/
 /**
 * This API grants resource based on availibility for the given location and
@@ -125,7 +48,9 @@ static AieRC _XAie_FindAvailableRscContig(u32 *Bitmap, u32 SBmOff,
 *
 * @return	XAIE_OK on success.
 *
-* @note		Internal only.
+* @note		Internal only. Every granted resource is marked before the
+*		next one is searched, and all of them are unmarked again if
+*		the request can't be granted completely.
 *
 *******************************************************************************/
 static AieRC _XAie_RequestRsc(u32 *Bitmap, u32 StartBit,
@@ -134,20 +59,22 @@ static AieRC _XAie_RequestRsc(u32 *Bitmap, u32 StartBit,
 {
 	AieRC RC;
 
-	/* Check for the requested resource in the bitmap locally */
 	for(u32 i = 0; i < NumRscPerTile; i++) {
 		u32 Index;
-		RC = _XAie_FindAvailableRsc(Bitmap, StaticBitmapOffset,
-				StartBit, MaxRscVal, &Index);
-		if(RC != XAIE_OK)
+
+		RC = _XAie_FindFreeBitsInBitmap(Bitmap, StaticBitmapOffset,
+				StartBit, MaxRscVal, 1U, 1U, &Index);
+		if(RC != XAIE_OK) {
+			for(u32 j = 0; j < i; j++)
+				_XAie_ClrBitInBitmap(Bitmap,
+						RscArrPerTile[j] + StartBit, 1U);
 			return XAIE_ERR;
+		}
 
+		_XAie_SetBitInBitmap(Bitmap, Index + StartBit, 1U);
 		RscArrPerTile[i] = Index;
 	}
 
-	for(u32 i = 0; i < NumRscPerTile; i++)
-		_XAie_SetBitInBitmap(Bitmap, RscArrPerTile[i] + StartBit, 1U);
-
 	return XAIE_OK;
 }
 
@@ -167,7 +94,9 @@ static AieRC _XAie_RequestRsc(u32 *Bitmap, u32 StartBit,
 *
 * @return	XAIE_OK on success.
 *
-* @note		Internal only.
+* @note		Internal only. Contiguous resources start at a multiple of
+*		NumContigRscs. PC and combo events are paired, so their
+*		contiguous resources also start at an even index.
 *
 *******************************************************************************/
 AieRC _XAie_RequestRscContig(u32 *Bitmaps, u32 StartBit,
@@ -175,26 +104,31 @@ AieRC _XAie_RequestRscContig(u32 *Bitmaps, u32 StartBit,
 		u32 *RscArrPerTile, u8 NumContigRscs, XAie_RscType RscType)
 {
 	AieRC RC;
+	u32 Align = NumContigRscs;
+
+	if((RscType == XAIE_PC_EVENTS_RSC || RscType == XAIE_COMBO_EVENTS_RSC)
+			&& (Align % 2U != 0U))
+		Align *= 2U;
 
-	/* Check for the requested resource in the bitmap locally */
 	for(u32 i = 0U; i < NumRscPerTile; i += NumContigRscs) {
 		u32 Index;
 
-		RC = _XAie_FindAvailableRscContig(Bitmaps, StaticBitmapOffset,
-				StartBit, MaxRscVal, &Index, NumContigRscs,
-				RscType);
-		if(RC != XAIE_OK)
+		RC = _XAie_FindFreeBitsInBitmap(Bitmaps, StaticBitmapOffset,
+				StartBit, MaxRscVal, NumContigRscs, Align,
+				&Index);
+		if(RC != XAIE_OK) {
+			for(u32 j = 0U; j < i; j++)
+				_XAie_ClrBitInBitmap(Bitmaps,
+						RscArrPerTile[j] + StartBit, 1U);
 			return XAIE_ERR;
+		}
 
+		/* Set the bits as allocated before searching the next run */
+		_XAie_SetBitInBitmap(Bitmaps, Index + StartBit, NumContigRscs);
 		for(u8 j = 0U; j < NumContigRscs; j++)
 			RscArrPerTile[i + j] = Index + j;
 	}
 
-	/* Set the bit as allocated if the request was successful*/
-	for(u32 i = 0U; i < NumRscPerTile; i++) {
-		_XAie_SetBitInBitmap(Bitmaps, RscArrPerTile[i] + StartBit, 1U);
-	}
-
 	return XAIE_OK;
 }
 
@@ -218,14 +152,13 @@ AieRC _XAie_RequestRscContig(u32 *Bitmaps, u32 StartBit,
 static u32 _XAie_GetChannelStatusPerMod(u32 *Bitmap, u32 StaticBitmapOffset,
 		u32 StartBit, u8 StaticAllocCheckFlag)
 {
-	u32 Size = sizeof(Bitmap[0]) * 8U;
-	u32 ChannelStatus = (XAIE_BROADCAST_CHANNEL_MASK &
-			(Bitmap[StartBit / Size] >> (StartBit % Size)));
+	u32 ChannelStatus = _XAie_GetBitsInBitmap(Bitmap, StartBit,
+			XAIE_NUM_BROADCAST_CHANNELS);
 
 	if(StaticAllocCheckFlag)
-		return ChannelStatus | (XAIE_BROADCAST_CHANNEL_MASK &
-			(Bitmap[(StartBit  + StaticBitmapOffset) / Size] >>
-			((StartBit + StaticBitmapOffset) % Size)));
+		return ChannelStatus | _XAie_GetBitsInBitmap(Bitmap,
+				StartBit + StaticBitmapOffset,
+				XAIE_NUM_BROADCAST_CHANNELS);
 
 	return ChannelStatus;
 }
@@ -286,18 +219,17 @@ static u32 _XAie_GetCommonChannelStatus(XAie_DevInst *DevInst, u32 *UserRscNum,
 static AieRC _XAie_FindCommonChannel(u32 MaxRscVal, u32 ChannelStatus,
 		                u32 *ChannelIndex)
 {
-	u32 i;
+	u32 FreeChannels = ~ChannelStatus;
 
-	for(i = 0; i < MaxRscVal; i++) {
-		if(ChannelStatus & 1U) {
-			ChannelStatus >>= 1U;
-		} else {
-			*ChannelIndex = i;
-			return XAIE_OK;
-		}
-	}
+	if(MaxRscVal < sizeof(ChannelStatus) * 8U)
+		FreeChannels &= (1U << MaxRscVal) - 1U;
 
-	return XAIE_ERR;
+	if(FreeChannels == 0U)
+		return XAIE_ERR;
+
+	*ChannelIndex = _XAie_CountTrailingZeros(FreeChannels);
+
+	return XAIE_OK;
 }
 
 /*****************************************************************************/
@@ -522,11 +454,16 @@ static u32 _XAie_GetAvailRscsFromBitmap(u32 *Bitmap,
 	u32 MaxRscVal = Offsets->MaxRscVal;
 	u32 Count = 0;
 
-	for(u32 i = StartBit; i < StartBit + MaxRscVal; i++) {
-		if(!((CheckBit(Bitmap, i)) |
-			CheckBit(Bitmap, (i + StaticBitmapOffset)))) {
-			Count++;
-		}
+	for(u32 i = 0U; i < MaxRscVal; i += 32U) {
+		u32 Num = MaxRscVal - i;
+
+		if(Num > 32U)
+			Num = 32U;
+
+		Count += Num - _XAie_PopCount(
+			_XAie_GetBitsInBitmap(Bitmap, StartBit + i, Num) |
+			_XAie_GetBitsInBitmap(Bitmap,
+				StartBit + StaticBitmapOffset + i, Num));
 	}
 
 	return Count;
@@ -549,15 +486,8 @@ static u32 _XAie_GetStaticRscsFromBitmap(u32 *Bitmap,
 		XAie_BitmapOffsets *Offsets)
 {
 	u32 StartBit = Offsets->StartBit + Offsets->StaticBitmapOffset;
-	u32 Count = 0;
 
-	for(u32 i = StartBit; i < StartBit + Offsets->MaxRscVal; i++) {
-		if(CheckBit(Bitmap, i)) {
-			Count++;
-		}
-	}
-
-	return Count;
+	return _XAie_CountSetBitsInBitmap(Bitmap, StartBit, Offsets->MaxRscVal);
 }
 
 /*****************************************************************************/
@@ -22,6 +22,7 @@
 * 1.3   Dishita 05/04/2020  Added Module argument to all apis
 * 1.4   Tejus   06/10/2020  Switch to new io backend apis.
 * 1.5   Dishita 09/15/2020  Add api to read perf counter control configuration.
+* 1.6   dc      10/31/2021  Add api to read a range of perf counters.
 *
 * </pre>
 *
@@ -104,6 +105,87 @@ AieRC XAie_PerfCounterGet(XAie_DevInst *DevInst, XAie_LocType Loc,
 
 	return XAie_Read32(DevInst, CounterRegAddr, CounterVal);
 }
+
+/*****************************************************************************/
+/* This API reads a range of contiguous performance counters of the given
+* module of a tile. The arguments are validated and the register address is
+* computed once for the whole range. The counters are still read one at a
+* time, with one XAie_Read32() per counter, so only the validation work is
+* saved compared to calling XAie_PerfCounterGet() for each counter.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE tile
+* @param	Module: Module of tile.
+*			For AIE Tile - XAIE_MEM_MOD or XAIE_CORE_MOD,
+*			For Pl or Shim tile - XAIE_PL_MOD,
+*			For Mem tile - XAIE_MEM_MOD.
+* @param	StartCounter: First performance counter to read
+* @param	NumCounters: Number of performance counters to read
+* @param	CounterVals: Array of NumCounters elements to store the
+*			counter values
+* @return	XAIE_OK on success
+*		XAIE_INVALID_ARGS if any argument is invalid
+*		XAIE_INVALID_TILE if tile type from Loc is invalid
+*
+* @note		CounterVals[i] is the value of counter StartCounter + i.
+*
+******************************************************************************/
+AieRC XAie_PerfCounterGetRange(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_ModuleType Module, u8 StartCounter, u8 NumCounters,
+		u32 *CounterVals)
+{
+	u64 CounterRegAddr;
+	u8 TileType;
+	AieRC RC;
+	const XAie_PerfMod *PerfMod;
+
+	if((DevInst == XAIE_NULL) || (CounterVals == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance or CounterVals\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
+		XAIE_ERROR("Invalid Tile Type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	/* check for module and tiletype combination */
+	RC = _XAie_CheckModule(DevInst, Loc, Module);
+	if(RC != XAIE_OK) {
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Module == XAIE_PL_MOD) {
+		PerfMod = &DevInst->DevProp.DevMod[TileType].PerfMod[0U];
+	} else {
+		PerfMod = &DevInst->DevProp.DevMod[TileType].PerfMod[Module];
+	}
+
+	/* Checking for valid Counter range */
+	if((NumCounters == 0U) ||
+			((u32)StartCounter + NumCounters > PerfMod->MaxCounterVal)) {
+		XAIE_ERROR("Invalid Counter range: %d, %d\n", StartCounter,
+				NumCounters);
+		return XAIE_INVALID_ARGS;
+	}
+
+	CounterRegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
+		PerfMod->PerfCounterBaseAddr +
+		((StartCounter)*PerfMod->PerfCounterOffsetAdd);
+
+	for(u8 i = 0U; i < NumCounters; i++) {
+		RC = XAie_Read32(DevInst, CounterRegAddr, &CounterVals[i]);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		CounterRegAddr += PerfMod->PerfCounterOffsetAdd;
+	}
+
+	return XAIE_OK;
+}
 /*****************************************************************************/
 /* This API configures the control registers corresponding to the counters
 *  with the start and stop event for the given tile.
@@ -17,6 +17,7 @@
 * Ver   Who      Date     Changes
 * ----- ------   -------- -----------------------------------------------------
 * 1.0   Dishita  11/21/2019  Initial creation
+* 1.1   dc       10/31/2021  Add XAie_PerfCounterGetRange()
 * </pre>
 *
 ******************************************************************************/
@@ -33,6 +34,9 @@
 /************************** Function Prototypes  *****************************/
 AieRC XAie_PerfCounterGet(XAie_DevInst *DevInst, XAie_LocType Loc,
 		XAie_ModuleType Module, u8 Counter, u32 *CounterVal);
+AieRC XAie_PerfCounterGetRange(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_ModuleType Module, u8 StartCounter, u8 NumCounters,
+		u32 *CounterVals);
 AieRC XAie_PerfCounterControlSet(XAie_DevInst *DevInst, XAie_LocType Loc,
 		XAie_ModuleType Module, u8 Counter, XAie_Events StartEvent,
 		XAie_Events StopEvent);
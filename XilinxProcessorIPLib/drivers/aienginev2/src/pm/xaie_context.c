@@ -0,0 +1,647 @@
+/******************************************************************************
+* Copyright (C) 2021 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_context.c
+* @{
+*
+* This file contains routines to capture the configuration of the tiles of a
+* partition and restore it, to switch the partition between graphs.
+*
+* The captured registers are the configuration registers of the modules of
+* a tile, which keep the value they are written with:
+*	* stream switch master, slave and slave slot configuration,
+*	* DMA buffer descriptors and channel control,
+*	* lock values, where the lock value can be set directly,
+*	* event broadcast, group, combo and stream port selection,
+*	* trace control and events,
+*	* performance counter control and event values.
+* Lock values are changed by the cores and DMAs at run time, so they are
+* always written on restore, and never taken from a cached state.
+* Status, counter, timer and queue registers are not captured, as writing
+* them back would not restore them. The DMA start queues are not restored
+* either, so the restored channels don't start transferring.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0   dc      10/31/2021  Initial creation
+* </pre>
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "xaie_clock.h"
+#include "xaie_context.h"
+#include "xaie_feature_config.h"
+#include "xaie_helper.h"
+
+#ifdef XAIE_FEATURE_PRIVILEGED_ENABLE
+
+/************************** Constant Definitions *****************************/
+#define XAIE_CTX_MAX_TILE_RANGES	256U
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API adds a register range to the register ranges of a tile type.
+*
+* @param	Ranges: Register ranges of the tile type
+* @param	NumRanges: Pointer to the number of ranges
+* @param	RegOff: Offset of the first register
+* @param	NumRegs: Number of registers
+*
+* @return	None.
+*
+* @note		Internal only. Ranges at offset 0 are ignored, they belong to
+*		modules without the register.
+*
+*******************************************************************************/
+static void _XAie_CtxAddRange(XAie_CtxRange *Ranges, u32 *NumRanges,
+		u32 RegOff, u32 NumRegs)
+{
+	if((RegOff == 0U) || (NumRegs == 0U) ||
+			(*NumRanges == XAIE_CTX_MAX_TILE_RANGES)) {
+		return;
+	}
+
+	Ranges[*NumRanges].RegOff = RegOff;
+	Ranges[*NumRanges].NumRegs = NumRegs;
+	Ranges[*NumRanges].AlwaysWrite = XAIE_DISABLE;
+	(*NumRanges)++;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API builds the configuration register ranges of a tile type from the
+* module properties of the tile type. The ranges are sorted by offset, and
+* overlapping ranges, or adjacent ranges written the same way on restore, are
+* merged.
+*
+* @param	DevInst: Device Instance
+* @param	TileType: Tile type
+* @param	Ranges: Array of XAIE_CTX_MAX_TILE_RANGES ranges to fill
+*
+* @return	Number of ranges.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u32 _XAie_CtxTileRanges(XAie_DevInst *DevInst, u8 TileType,
+		XAie_CtxRange *Ranges)
+{
+	const XAie_TileMod *TileMod = &DevInst->DevProp.DevMod[TileType];
+	const XAie_StrmMod *StrmMod = TileMod->StrmSw;
+	const XAie_DmaMod *DmaMod = TileMod->DmaMod;
+	const XAie_LockMod *LockMod = TileMod->LockMod;
+	u32 NumRanges = 0U, Merged = 0U;
+
+	if(StrmMod != NULL) {
+		u32 SlotBase = 0U;
+
+		_XAie_CtxAddRange(Ranges, &NumRanges,
+				StrmMod->MstrConfigBaseAddr,
+				(StrmMod->MaxMasterPhyPortId + 1U) *
+				StrmMod->PortOffset / 4U);
+		_XAie_CtxAddRange(Ranges, &NumRanges,
+				StrmMod->SlvConfigBaseAddr,
+				(StrmMod->MaxSlavePhyPortId + 1U) *
+				StrmMod->PortOffset / 4U);
+
+		/* Slots of the first slave port type are the first ones */
+		for(u8 i = 0U; i < SS_PORT_TYPE_MAX; i++) {
+			u32 Base = StrmMod->SlvSlotConfig[i].PortBaseAddr;
+
+			if((StrmMod->SlvSlotConfig[i].NumPorts != 0U) &&
+					((SlotBase == 0U) || (Base < SlotBase))) {
+				SlotBase = Base;
+			}
+		}
+		_XAie_CtxAddRange(Ranges, &NumRanges, SlotBase,
+				(StrmMod->MaxSlavePhyPortId + 1U) *
+				StrmMod->SlotOffsetPerPort / 4U);
+	}
+
+	if(DmaMod != NULL) {
+		_XAie_CtxAddRange(Ranges, &NumRanges, DmaMod->BaseAddr,
+				DmaMod->NumBds * DmaMod->IdxOffset / 4U);
+		/* S2MM channels, then MM2S channels */
+		for(u32 Ch = 0U; Ch < DmaMod->NumChannels * 2U; Ch++) {
+			_XAie_CtxAddRange(Ranges, &NumRanges,
+					DmaMod->ChCtrlBase +
+					Ch * DmaMod->ChIdxOffset, 1U);
+		}
+	}
+
+	if((LockMod != NULL) && (LockMod->LockSetValOff != 0U)) {
+		u32 First = NumRanges;
+
+		for(u32 L = 0U; L < LockMod->NumLocks; L++) {
+			_XAie_CtxAddRange(Ranges, &NumRanges,
+					LockMod->LockSetValBase +
+					L * LockMod->LockSetValOff, 1U);
+		}
+		/* Lock values are changed by the cores and DMAs */
+		for(u32 i = First; i < NumRanges; i++) {
+			Ranges[i].AlwaysWrite = XAIE_ENABLE;
+		}
+	}
+
+	for(u8 M = 0U; M < TileMod->NumModules; M++) {
+		if(TileMod->EvntMod != NULL) {
+			const XAie_EvntMod *EvntMod = &TileMod->EvntMod[M];
+
+			_XAie_CtxAddRange(Ranges, &NumRanges,
+					EvntMod->BaseBroadcastRegOff,
+					EvntMod->NumBroadcastIds);
+			_XAie_CtxAddRange(Ranges, &NumRanges,
+					EvntMod->BaseGroupEventRegOff,
+					EvntMod->NumGroupEvents);
+			_XAie_CtxAddRange(Ranges, &NumRanges,
+					EvntMod->ComboInputRegOff, 1U);
+			_XAie_CtxAddRange(Ranges, &NumRanges,
+					EvntMod->ComboCtrlRegOff, 1U);
+			if(EvntMod->StrmPortSelectIdsPerReg != 0U) {
+				_XAie_CtxAddRange(Ranges, &NumRanges,
+					EvntMod->BaseStrmPortSelectRegOff,
+					(EvntMod->NumStrmPortSelectIds +
+					 EvntMod->StrmPortSelectIdsPerReg - 1U) /
+					EvntMod->StrmPortSelectIdsPerReg);
+			}
+		}
+
+		if(TileMod->TraceMod != NULL) {
+			const XAie_TraceMod *TraceMod = &TileMod->TraceMod[M];
+
+			_XAie_CtxAddRange(Ranges, &NumRanges,
+					TraceMod->CtrlRegOff, 1U);
+			_XAie_CtxAddRange(Ranges, &NumRanges,
+					TraceMod->PktConfigRegOff, 1U);
+			for(u8 E = 0U; (TraceMod->NumEventsPerSlot != 0U) &&
+					(E < TraceMod->NumTraceSlotIds /
+					 TraceMod->NumEventsPerSlot); E++) {
+				_XAie_CtxAddRange(Ranges, &NumRanges,
+						TraceMod->EventRegOffs[E], 1U);
+			}
+		}
+
+		if(TileMod->PerfMod != NULL) {
+			const XAie_PerfMod *PerfMod = &TileMod->PerfMod[M];
+
+			/* Start and stop events of two counters per register */
+			for(u8 C = 0U; C < PerfMod->MaxCounterVal; C += 2U) {
+				_XAie_CtxAddRange(Ranges, &NumRanges,
+						PerfMod->PerfCtrlBaseAddr +
+						C / 2U * PerfMod->PerfCtrlOffsetAdd,
+						1U);
+			}
+			_XAie_CtxAddRange(Ranges, &NumRanges,
+					PerfMod->PerfCtrlResetBaseAddr, 1U);
+			for(u8 C = 0U; C < PerfMod->MaxCounterVal; C++) {
+				_XAie_CtxAddRange(Ranges, &NumRanges,
+						PerfMod->PerfCounterEvtValBaseAddr +
+						C * PerfMod->PerfCounterOffsetAdd,
+						1U);
+			}
+		}
+	}
+
+	if(NumRanges == 0U) {
+		return 0U;
+	}
+
+	for(u32 i = 1U; i < NumRanges; i++) {
+		XAie_CtxRange Range = Ranges[i];
+		u32 j = i;
+
+		while((j > 0U) && (Ranges[j - 1U].RegOff > Range.RegOff)) {
+			Ranges[j] = Ranges[j - 1U];
+			j--;
+		}
+		Ranges[j] = Range;
+	}
+
+	for(u32 i = 1U; i < NumRanges; i++) {
+		XAie_CtxRange *Last = &Ranges[Merged];
+		u32 LastEnd = Last->RegOff + Last->NumRegs * 4U;
+		u32 End = Ranges[i].RegOff + Ranges[i].NumRegs * 4U;
+
+		if((Ranges[i].RegOff < LastEnd) ||
+				((Ranges[i].RegOff == LastEnd) &&
+				 (Ranges[i].AlwaysWrite == Last->AlwaysWrite))) {
+			if(End > LastEnd) {
+				Last->NumRegs = (End - Last->RegOff) / 4U;
+			}
+			Last->AlwaysWrite |= Ranges[i].AlwaysWrite;
+			continue;
+		}
+
+		Ranges[++Merged] = Ranges[i];
+	}
+
+	return Merged + 1U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks two partition contexts have the same layout.
+*
+* @param	Ctx: Partition context
+* @param	Cur: Partition context
+*
+* @return	XAIE_ENABLE if the layouts are the same, XAIE_DISABLE otherwise.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u8 _XAie_CtxSameLayout(const XAie_PartCtx *Ctx,
+		const XAie_PartCtx *Cur)
+{
+	if((Ctx->NumTiles != Cur->NumTiles) ||
+			(Ctx->NumVals != Cur->NumVals)) {
+		return XAIE_DISABLE;
+	}
+
+	for(u32 T = 0U; T < Ctx->NumTiles; T++) {
+		if((Ctx->Tiles[T].Loc.Col != Cur->Tiles[T].Loc.Col) ||
+				(Ctx->Tiles[T].Loc.Row != Cur->Tiles[T].Loc.Row)) {
+			return XAIE_DISABLE;
+		}
+	}
+
+	return XAIE_ENABLE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API reads the current value of the registers of a partition context.
+*
+* @param	DevInst: Device Instance
+* @param	Ctx: Partition context
+* @param	Vals: Array of Ctx->NumVals values to fill
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_CtxReadVals(XAie_DevInst *DevInst, const XAie_PartCtx *Ctx,
+		u32 *Vals)
+{
+	AieRC RC;
+
+	for(u32 T = 0U; T < Ctx->NumTiles; T++) {
+		const XAie_CtxTile *Tile = &Ctx->Tiles[T];
+		const XAie_CtxRange *Ranges =
+			&Ctx->Ranges[Ctx->RangeStart[Tile->TileType]];
+		u64 TileAddr = _XAie_GetTileAddr(DevInst, Tile->Loc.Row,
+				Tile->Loc.Col);
+		u32 V = Tile->ValIdx;
+
+		for(u32 i = 0U; i < Ctx->NumRanges[Tile->TileType]; i++) {
+			for(u32 k = 0U; k < Ranges[i].NumRegs; k++) {
+				RC = XAie_Read32(DevInst, TileAddr +
+						Ranges[i].RegOff + k * 4U,
+						&Vals[V++]);
+				if(RC != XAIE_OK) {
+					return RC;
+				}
+			}
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API captures the configuration registers of the requested tiles of the
+* partition into a partition context. The context buffers are allocated by
+* this API, and are released with XAie_CtxFree().
+*
+* @param	DevInst: Device Instance
+* @param	Ctx: Partition context to fill
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Only the tiles requested at the time of the capture are
+*		captured. The register ranges captured for each tile type are
+*		described in the context.
+*
+*******************************************************************************/
+AieRC XAie_CtxCapture(XAie_DevInst *DevInst, XAie_PartCtx *Ctx)
+{
+	AieRC RC;
+	u32 NumRanges = 0U, T = 0U, V = 0U;
+
+	if((DevInst == XAIE_NULL) || (Ctx == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	memset(Ctx, 0, sizeof(*Ctx));
+	Ctx->Ranges = (XAie_CtxRange *)malloc(XAIEGBL_TILE_TYPE_MAX *
+			XAIE_CTX_MAX_TILE_RANGES * sizeof(XAie_CtxRange));
+	if(Ctx->Ranges == NULL) {
+		XAIE_ERROR("Failed to allocate context memory\n");
+		return XAIE_ERR;
+	}
+
+	for(u8 TileType = 0U; TileType < XAIEGBL_TILE_TYPE_MAX; TileType++) {
+		XAie_CtxRange *Ranges = &Ctx->Ranges[NumRanges];
+
+		Ctx->RangeStart[TileType] = NumRanges;
+		Ctx->NumRanges[TileType] = _XAie_CtxTileRanges(DevInst,
+				TileType, Ranges);
+		for(u32 i = 0U; i < Ctx->NumRanges[TileType]; i++) {
+			Ctx->NumTileRegs[TileType] += Ranges[i].NumRegs;
+		}
+		NumRanges += Ctx->NumRanges[TileType];
+	}
+
+	for(u8 Pass = 0U; Pass < 2U; Pass++) {
+		for(u32 C = 0U; C < DevInst->NumCols; C++) {
+			for(u32 R = 0U; R < DevInst->NumRows; R++) {
+				XAie_LocType Loc = XAie_TileLoc(C, R);
+				u8 TileType;
+
+				TileType = DevInst->DevOps->GetTTypefromLoc(
+						DevInst, Loc);
+				if((TileType == XAIEGBL_TILE_TYPE_MAX) ||
+					(Ctx->NumTileRegs[TileType] == 0U) ||
+					(_XAie_PmIsTileRequested(DevInst, Loc)
+					 == XAIE_DISABLE)) {
+					continue;
+				}
+
+				if(Pass == 0U) {
+					Ctx->NumTiles++;
+					Ctx->NumVals +=
+						Ctx->NumTileRegs[TileType];
+					continue;
+				}
+
+				Ctx->Tiles[T].Loc = Loc;
+				Ctx->Tiles[T].TileType = TileType;
+				Ctx->Tiles[T].ValIdx = V;
+				V += Ctx->NumTileRegs[TileType];
+				T++;
+			}
+		}
+
+		if(Pass == 0U) {
+			Ctx->Tiles = (XAie_CtxTile *)malloc(Ctx->NumTiles *
+					sizeof(XAie_CtxTile));
+			Ctx->Vals = (u32 *)malloc(Ctx->NumVals * sizeof(u32));
+			if((Ctx->Tiles == NULL) || (Ctx->Vals == NULL)) {
+				XAIE_ERROR("Failed to allocate context "
+						"memory\n");
+				XAie_CtxFree(Ctx);
+				return XAIE_ERR;
+			}
+		}
+	}
+
+	RC = _XAie_CtxReadVals(DevInst, Ctx, Ctx->Vals);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to capture context\n");
+		XAie_CtxFree(Ctx);
+		return RC;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API restores a partition context. Only the registers whose value
+* differs from the current state, and the lock values, are written, and
+* consecutive registers to write are written with one block write.
+*
+* The current state is taken from Cur, if it is given. Cur is a cache of the
+* partition registers, separate from the contexts of the graphs: a context of
+* the same layout, captured once from the partition and then passed to every
+* restore. The restore overwrites it with the values of Ctx, so a context to
+* be restored later must not be passed as Cur. If Cur is NULL, the current
+* value of every register is read from the device before any write.
+*
+* @param	DevInst: Device Instance
+* @param	Ctx: Partition context to restore
+* @param	Cur: Cache of the current partition registers, or NULL
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The cores and DMAs of the tiles should be stopped. Registers
+*		written by the application after Cur was captured or restored
+*		are not known to Cur, use NULL in that case. If no transaction
+*		is in progress, the writes are issued as one transaction on
+*		backends supporting transactions.
+*
+*******************************************************************************/
+AieRC XAie_CtxRestore(XAie_DevInst *DevInst, const XAie_PartCtx *Ctx,
+		XAie_PartCtx *Cur)
+{
+	AieRC RC = XAIE_OK;
+	u8 Txn = XAIE_DISABLE;
+	u32 *Vals = XAIE_NULL;
+	const u32 *CurVals;
+
+	if((DevInst == XAIE_NULL) || (Ctx == XAIE_NULL) ||
+			(Ctx->Vals == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Cur != XAIE_NULL) && ((Cur->Vals == XAIE_NULL) ||
+			(_XAie_CtxSameLayout(Ctx, Cur) == XAIE_DISABLE))) {
+		XAIE_ERROR("Contexts layouts don't match\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Cur != XAIE_NULL) {
+		CurVals = Cur->Vals;
+	} else {
+		/*
+		 * Read the current state before the transaction is started,
+		 * reads are not supported once writes are queued in it.
+		 */
+		Vals = (u32 *)malloc(Ctx->NumVals * sizeof(u32));
+		if(Vals == XAIE_NULL) {
+			XAIE_ERROR("Failed to allocate context memory\n");
+			return XAIE_ERR;
+		}
+
+		RC = _XAie_CtxReadVals(DevInst, Ctx, Vals);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to read current context\n");
+			free(Vals);
+			return RC;
+		}
+		CurVals = Vals;
+	}
+
+	if((DevInst->Backend->Ops.SubmitTxn != NULL) &&
+			(DevInst->TxnList.Next == NULL)) {
+		if(XAie_StartTransaction(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH) == XAIE_OK) {
+			Txn = XAIE_ENABLE;
+		}
+	}
+
+	for(u32 T = 0U; (T < Ctx->NumTiles) && (RC == XAIE_OK); T++) {
+		const XAie_CtxTile *Tile = &Ctx->Tiles[T];
+		const XAie_CtxRange *Ranges =
+			&Ctx->Ranges[Ctx->RangeStart[Tile->TileType]];
+		u64 TileAddr = _XAie_GetTileAddr(DevInst, Tile->Loc.Row,
+				Tile->Loc.Col);
+		u32 V = Tile->ValIdx;
+
+		for(u32 i = 0U; (i < Ctx->NumRanges[Tile->TileType]) &&
+				(RC == XAIE_OK); i++) {
+			u64 RegAddr = TileAddr + Ranges[i].RegOff;
+			u32 Run = 0U;
+
+			/* Write runs of consecutive differing registers */
+			for(u32 k = 0U; k <= Ranges[i].NumRegs; k++) {
+				u8 Diff = XAIE_DISABLE;
+
+				if(k < Ranges[i].NumRegs) {
+					Diff = ((Ranges[i].AlwaysWrite ==
+						 XAIE_ENABLE) ||
+						(CurVals[V + k] !=
+						 Ctx->Vals[V + k])) ?
+						XAIE_ENABLE : XAIE_DISABLE;
+				}
+
+				if(Diff == XAIE_ENABLE) {
+					Run++;
+					continue;
+				}
+
+				if(Run == 1U) {
+					RC = XAie_Write32(DevInst,
+						RegAddr + (k - 1U) * 4U,
+						Ctx->Vals[V + k - 1U]);
+				} else if(Run > 1U) {
+					RC = XAie_BlockWrite32(DevInst,
+						RegAddr + (k - Run) * 4U,
+						&Ctx->Vals[V + k - Run], Run);
+				}
+				if(RC != XAIE_OK) {
+					break;
+				}
+				Run = 0U;
+			}
+			V += Ranges[i].NumRegs;
+		}
+	}
+
+	if(Txn == XAIE_ENABLE) {
+		AieRC TxnRC = XAie_SubmitTransaction(DevInst, NULL);
+
+		if(RC == XAIE_OK) {
+			RC = TxnRC;
+		}
+	}
+
+	free(Vals);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to restore context\n");
+		return RC;
+	}
+
+	if(Cur != XAIE_NULL) {
+		memcpy(Cur->Vals, Ctx->Vals, Ctx->NumVals * sizeof(u32));
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API counts the registers XAie_CtxRestore() writes to switch from Cur
+* to Ctx: the registers whose value differs between the two partition
+* contexts, and the lock values.
+*
+* @param	Ctx: Partition context
+* @param	Cur: Partition context of the same layout
+* @param	NumDiffs: Pointer to return the number of registers
+*
+* @return	XAIE_OK on success, XAIE_INVALID_ARGS if the layouts differ.
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_CtxDiff(const XAie_PartCtx *Ctx, const XAie_PartCtx *Cur,
+		u32 *NumDiffs)
+{
+	if((Ctx == XAIE_NULL) || (Cur == XAIE_NULL) ||
+			(NumDiffs == XAIE_NULL) ||
+			(_XAie_CtxSameLayout(Ctx, Cur) == XAIE_DISABLE)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	*NumDiffs = 0U;
+	for(u32 T = 0U; T < Ctx->NumTiles; T++) {
+		const XAie_CtxTile *Tile = &Ctx->Tiles[T];
+		const XAie_CtxRange *Ranges =
+			&Ctx->Ranges[Ctx->RangeStart[Tile->TileType]];
+		u32 V = Tile->ValIdx;
+
+		for(u32 i = 0U; i < Ctx->NumRanges[Tile->TileType]; i++) {
+			for(u32 k = 0U; k < Ranges[i].NumRegs; k++, V++) {
+				if((Ranges[i].AlwaysWrite == XAIE_ENABLE) ||
+						(Ctx->Vals[V] != Cur->Vals[V])) {
+					(*NumDiffs)++;
+				}
+			}
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases the buffers of a partition context.
+*
+* @param	Ctx: Partition context
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAie_CtxFree(XAie_PartCtx *Ctx)
+{
+	if(Ctx == XAIE_NULL) {
+		return;
+	}
+
+	free(Ctx->Ranges);
+	free(Ctx->Tiles);
+	free(Ctx->Vals);
+	memset(Ctx, 0, sizeof(*Ctx));
+}
+
+#endif /* XAIE_FEATURE_PRIVILEGED_ENABLE */
+/** @} */
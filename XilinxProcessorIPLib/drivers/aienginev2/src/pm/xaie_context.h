@@ -0,0 +1,72 @@
+/******************************************************************************
+* Copyright (C) 2021 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_context.h
+* @{
+*
+* Header file for the partition context capture and restore.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0   dc      10/31/2021  Initial creation
+* </pre>
+*
+******************************************************************************/
+#ifndef XAIE_CONTEXT_H
+#define XAIE_CONTEXT_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+
+/**************************** Type Definitions *******************************/
+/* Typedef to capture a range of consecutive registers of a tile */
+typedef struct {
+	u32 RegOff;			/* Offset of first register in tile */
+	u32 NumRegs;			/* Number of registers */
+	u8 AlwaysWrite;			/* Registers changed at run time */
+} XAie_CtxRange;
+
+/* Typedef to capture a tile of a partition context */
+typedef struct {
+	XAie_LocType Loc;		/* Location of the tile */
+	u8 TileType;			/* Type of the tile */
+	u32 ValIdx;			/* Index of first value of the tile */
+} XAie_CtxTile;
+
+/*
+ * Typedef to capture the configuration registers of the requested tiles of a
+ * partition. The registers of a tile are the ranges RangeStart[TileType] to
+ * RangeStart[TileType] + NumRanges[TileType] - 1, sorted by offset. Their
+ * values are stored one after the other from Vals[ValIdx] of the tile.
+ * Contexts captured from the same partition with the same requested tiles
+ * have the same layout, and their values can be compared word by word.
+ */
+typedef struct {
+	XAie_CtxRange *Ranges;		/* Register ranges of all tile types */
+	u32 RangeStart[XAIEGBL_TILE_TYPE_MAX]; /* First range of tile type */
+	u32 NumRanges[XAIEGBL_TILE_TYPE_MAX]; /* Number of ranges of tile type */
+	u32 NumTileRegs[XAIEGBL_TILE_TYPE_MAX]; /* Registers per tile of type */
+	XAie_CtxTile *Tiles;		/* Tiles of the context */
+	u32 NumTiles;			/* Number of tiles */
+	u32 *Vals;			/* Register values */
+	u32 NumVals;			/* Number of register values */
+} XAie_PartCtx;
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_CtxCapture(XAie_DevInst *DevInst, XAie_PartCtx *Ctx);
+AieRC XAie_CtxRestore(XAie_DevInst *DevInst, const XAie_PartCtx *Ctx,
+		XAie_PartCtx *Cur);
+AieRC XAie_CtxDiff(const XAie_PartCtx *Ctx, const XAie_PartCtx *Cur,
+		u32 *NumDiffs);
+void XAie_CtxFree(XAie_PartCtx *Ctx);
+
+#endif		/* end of protection macro */
+/** @} */
@@ -13,6 +13,11 @@
 *
 ******************************************************************************/
 /***************************** Include Files *********************************/
+#ifdef __linux__
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
 #include "xaie_clock.h"
 #include "xaie_feature_config.h"
 #include "xaie_helper.h"
@@ -24,6 +29,17 @@
 
 /*****************************************************************************/
 /***************************** Macro Definitions *****************************/
+/* Maximum number of threads to clear the partition memories */
+#define XAIE_CLEAR_MEMS_MAX_THREADS	16U
+
+/**************************** Type Definitions *******************************/
+/* Typedef to capture the columns cleared by a memory clearing thread */
+typedef struct {
+	XAie_DevInst *DevInst;	/* Device instance */
+	u32 StartCol;		/* First column to clear */
+	u32 ColStride;		/* Distance to the next column to clear */
+} XAie_ClearMemsWork;
+
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
 /**
@@ -290,52 +306,230 @@ static void _XAie_ClearProgMem(XAie_DevInst *DevInst, XAie_LocType Loc)
 	XAie_BlockSet32(DevInst, RegAddr, 0, CoreMod->ProgMemSize / 4);
 }
 
+/*****************************************************************************/
+/**
+*
+* This API clears the data and program memories of the requested tiles of a
+* column.
+*
+* @param	DevInst: Device Instance
+* @param	Col: Column to clear
+*
+* @return	None.
+*
+* @note		internal to this file.
+*******************************************************************************/
+static void _XAie_ClearColumnMems(XAie_DevInst *DevInst, u32 Col)
+{
+	for(u32 R = 0; R < DevInst->NumRows; R++) {
+		XAie_LocType Loc = XAie_TileLoc(Col, R);
+		u8 TileType;
+
+		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+		if(TileType == XAIEGBL_TILE_TYPE_SHIMNOC ||
+		   TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
+			continue;
+		}
+
+		if(_XAie_PmIsTileRequested(DevInst, Loc) == XAIE_DISABLE) {
+			continue;
+		}
+
+		_XAie_ClearDataMem(DevInst, Loc);
+		if(TileType == XAIEGBL_TILE_TYPE_AIETILE) {
+			_XAie_ClearProgMem(DevInst, Loc);
+		}
+	}
+}
+
+#ifdef __linux__
+/*****************************************************************************/
+/**
+*
+* This is the thread function to clear the memories of the columns
+* StartCol, StartCol + ColStride, ... of the partition.
+*
+* @param	Arg: Pointer to the XAie_ClearMemsWork of the thread
+*
+* @return	NULL.
+*
+* @note		internal to this file.
+*******************************************************************************/
+static void *_XAie_ClearColumnMemsThread(void *Arg)
+{
+	XAie_ClearMemsWork *Work = (XAie_ClearMemsWork *)Arg;
+
+	for(u32 C = Work->StartCol; C < Work->DevInst->NumCols;
+			C += Work->ColStride) {
+		_XAie_ClearColumnMems(Work->DevInst, C);
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API clears the partition memories with the columns spread over
+* NumThreads threads. The calling thread clears its share of the columns too.
+* If a thread can't be created, its columns are cleared by the calling thread.
+*
+* @param	DevInst: Device Instance
+* @param	NumThreads: Number of threads, from 2 to
+*			    XAIE_CLEAR_MEMS_MAX_THREADS.
+*
+* @return	XAIE_OK.
+*
+* @note		internal to this file.
+*******************************************************************************/
+static AieRC _XAie_ClearPartitionMemsThreads(XAie_DevInst *DevInst,
+		u32 NumThreads)
+{
+	pthread_t Threads[XAIE_CLEAR_MEMS_MAX_THREADS];
+	XAie_ClearMemsWork Work[XAIE_CLEAR_MEMS_MAX_THREADS] = {0};
+	u8 Started[XAIE_CLEAR_MEMS_MAX_THREADS] = {0U};
+
+	for(u32 T = 0U; T < NumThreads; T++) {
+		Work[T].DevInst = DevInst;
+		Work[T].StartCol = T;
+		Work[T].ColStride = NumThreads;
+		if(T == 0U) {
+			continue;
+		}
+
+		if(pthread_create(&Threads[T], NULL,
+				_XAie_ClearColumnMemsThread, &Work[T]) == 0) {
+			Started[T] = 1U;
+		} else {
+			XAIE_DBG("Failed to create thread, clear columns "
+					"in calling thread\n");
+			_XAie_ClearColumnMemsThread(&Work[T]);
+		}
+	}
+
+	_XAie_ClearColumnMemsThread(&Work[0U]);
+
+	for(u32 T = 1U; T < NumThreads; T++) {
+		if(Started[T] != 0U) {
+			pthread_join(Threads[T], NULL);
+		}
+	}
+
+	return XAIE_OK;
+}
+#endif /* __linux__ */
+
 /*****************************************************************************/
 /**
 *
 * This API clears AI engine partition pointed by the AI enigne device instance.
 * It will zeroize both data and program memories of the requested tiles.
+* It is the opt-in parallel version of XAie_ClearPartitionMems(). The columns
+* are independent of each other, and they are cleared in parallel where the
+* backend allows it:
+*	* On the Linux and debug backends, the columns are spread over
+*	  NumThreads threads. The Linux backend writes the memories through
+*	  their user space mappings, which can be accessed concurrently.
+*	* Otherwise, the clearing of all the columns is queued in one
+*	  transaction and submitted at once.
 *
 * @param	DevInst: Device Instance
+* @param	NumThreads: Number of threads to use. 0 selects the number of
+*			    online CPUs. It is capped to the number of columns
+*			    and to XAIE_CLEAR_MEMS_MAX_THREADS.
 *
 * @return	XAIE_OK on success.
 *		XAIE_INVALID_ARGS if any argument is invalid
 *
-* @note		None.
+* @note		If the calling thread has a transaction in progress, the
+*		memories are cleared in the calling thread and the writes are
+*		added to that transaction.
 *******************************************************************************/
-AieRC XAie_ClearPartitionMems(XAie_DevInst *DevInst)
+AieRC XAie_ClearPartitionMemsParallel(XAie_DevInst *DevInst, u32 NumThreads)
 {
+	u8 Txn = XAIE_DISABLE;
+	AieRC RC;
+
 	if((DevInst == XAIE_NULL) ||
 		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
 		XAIE_ERROR("Invalid Device Instance\n");
 		return XAIE_INVALID_ARGS;
 	}
 
+#ifdef __linux__
+	if(NumThreads == 0U) {
+		long NumCpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+		NumThreads = (NumCpus > 0) ? (u32)NumCpus : 1U;
+	}
+	if(NumThreads > XAIE_CLEAR_MEMS_MAX_THREADS) {
+		NumThreads = XAIE_CLEAR_MEMS_MAX_THREADS;
+	}
+	if(NumThreads > DevInst->NumCols) {
+		NumThreads = DevInst->NumCols;
+	}
+
+	if((NumThreads > 1U) &&
+			(_XAie_TxnIsActive(DevInst) == XAIE_DISABLE) &&
+			((DevInst->Backend->Type == XAIE_IO_BACKEND_LINUX) ||
+			 (DevInst->Backend->Type == XAIE_IO_BACKEND_DEBUG))) {
+		return _XAie_ClearPartitionMemsThreads(DevInst, NumThreads);
+	}
+#else
+	(void)NumThreads;
+#endif
+
+	if(_XAie_TxnIsActive(DevInst) == XAIE_DISABLE) {
+		if(XAie_StartTransaction(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH) == XAIE_OK) {
+			Txn = XAIE_ENABLE;
+		}
+	}
+
 	for(u32 C = 0; C < DevInst->NumCols; C++) {
-		for(u32 R = 0; R < DevInst->NumRows; R++) {
-			XAie_LocType Loc = XAie_TileLoc(C, R);
-			u8 TileType;
-
-			TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-			if(TileType == XAIEGBL_TILE_TYPE_SHIMNOC ||
-			   TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
-				continue;
-			}
-
-			if(_XAie_PmIsTileRequested(DevInst, Loc) ==
-			   XAIE_DISABLE) {
-				continue;
-			}
-
-			_XAie_ClearDataMem(DevInst, Loc);
-			if(TileType == XAIEGBL_TILE_TYPE_AIETILE) {
-				_XAie_ClearProgMem(DevInst, Loc);
-			}
+		_XAie_ClearColumnMems(DevInst, C);
+	}
+
+	if(Txn == XAIE_ENABLE) {
+		RC = XAie_SubmitTransaction(DevInst, NULL);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to clear partition memories\n");
+			return RC;
 		}
 	}
 
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This API clears AI engine partition pointed by the AI enigne device instance.
+* It will zeroize both data and program memories of the requested tiles.
+*
+* @param	DevInst: Device Instance
+*
+* @return	XAIE_OK on success.
+*		XAIE_INVALID_ARGS if any argument is invalid
+*
+* @note		The tiles are cleared one after the other in the calling thread.
+*		XAie_ClearPartitionMemsParallel() clears the columns in
+*		parallel.
+*******************************************************************************/
+AieRC XAie_ClearPartitionMems(XAie_DevInst *DevInst)
+{
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 C = 0; C < DevInst->NumCols; C++) {
+		_XAie_ClearColumnMems(DevInst, C);
+	}
+
+	return XAIE_OK;
+}
+
 #endif /* XAIE_FEATURE_PRIVILEGED_ENABLE */
 /** @} */
@@ -21,6 +21,7 @@
 /************************** Function Prototypes  *****************************/
 AieRC XAie_ResetPartition(XAie_DevInst *DevInst);
 AieRC XAie_ClearPartitionMems(XAie_DevInst *DevInst);
+AieRC XAie_ClearPartitionMemsParallel(XAie_DevInst *DevInst, u32 NumThreads);
 #endif		/* end of protection macro */
 
 /** @} */
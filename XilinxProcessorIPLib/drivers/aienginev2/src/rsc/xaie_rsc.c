@@ -17,6 +17,8 @@
 * Ver   Who     Date        Changes
 * ----- ------  --------    ---------------------------------------------------
 * 1.0   Dishita 01/11/2021  Initial creation
+* 1.1   dc      10/31/2021  Add partition wide resource request API and look
+*			    up the tile type once for bitmap offsets
 *
 * </pre>
 *
@@ -368,6 +370,30 @@ void _XAie_MarkChannelBitmapAndRscId(XAie_DevInst *DevInst,
 	}
 }
 
+/*****************************************************************************/
+/**
+* This API returns the ungated tiles of a column of the partition.
+*
+* @param        DevInst: Device Instance
+* @param        Col: Column of the partition
+*
+* @return       Bitmask with bit Row set for every ungated tile of the column.
+*
+* @note         Internal only. Shim tiles are never gated. The rows above the
+*		shim row of a column are consecutive bits of the tiles in use
+*		bitmap and are read as one word.
+*
+*******************************************************************************/
+u32 _XAie_RscMgr_GetUngatedRows(XAie_DevInst *DevInst, u32 Col)
+{
+	u32 StartBit;
+
+	StartBit = _XAie_GetTileBitPosFromLoc(DevInst, XAie_TileLoc(Col, 1U));
+
+	return (_XAie_GetBitsInBitmap(DevInst->TilesInUse, StartBit,
+				DevInst->NumRows - 1U) << 1U) | 1U;
+}
+
 /*****************************************************************************/
 /**
 * This API checks the validity of all the arugments passed to the resource
@@ -543,8 +569,8 @@ static const XAie_EvntMod *_XAie_GetEventMod(XAie_DevInst *DevInst, u8 TileType,
 
 /*****************************************************************************/
 /**
-* This API returns the max resource value for a give location, resource type and
-* module.
+* This API returns the max resource value for a given tile type, resource type
+* and module.
 *
 * @param	DevInst: Device Instance
 * @param	RscType: Resource type
@@ -556,33 +582,28 @@ static const XAie_EvntMod *_XAie_GetEventMod(XAie_DevInst *DevInst, u8 TileType,
 * @note		Internal only.
 *
 *******************************************************************************/
-u32 _XAie_RscMgr_GetMaxRscVal(XAie_DevInst *DevInst, XAie_RscType RscType,
-		XAie_LocType Loc, XAie_ModuleType Mod)
+static u32 _XAie_RscMgr_GetTileMaxRscVal(XAie_DevInst *DevInst,
+		XAie_RscType RscType, u8 TileType, XAie_ModuleType Mod)
 {
 	switch(RscType) {
 	case XAIE_PERFCNT_RSC:
 	{
 		const XAie_PerfMod *PerfMod;
-		u8 TileType;
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+
 		PerfMod = _XAie_GetPerfMod(DevInst, TileType, Mod);
 		return PerfMod->MaxCounterVal;
 	}
 	case XAIE_USER_EVENTS_RSC:
 	{
 		const XAie_EvntMod *EventMod;
-		u8 TileType;
 
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
 		EventMod = _XAie_GetEventMod(DevInst, TileType, Mod);
 		return EventMod->NumUserEvents;
 	}
 	case XAIE_PC_EVENTS_RSC:
 	{
 		const XAie_EvntMod *EventMod;
-		u8 TileType;
 
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
 		EventMod = _XAie_GetEventMod(DevInst, TileType, Mod);
 		return EventMod->NumPCEvents;
 	}
@@ -593,18 +614,14 @@ u32 _XAie_RscMgr_GetMaxRscVal(XAie_DevInst *DevInst, XAie_RscType RscType,
 	case XAIE_SS_EVENT_PORTS_RSC:
 	{
 		const XAie_EvntMod *EventMod;
-		u8 TileType;
 
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
 		EventMod = _XAie_GetEventMod(DevInst, TileType, Mod);
 		return EventMod->NumStrmPortSelectIds;
 	}
 	case XAIE_GROUP_EVENTS_RSC:
 	{
 		const XAie_EvntMod *EventMod;
-		u8 TileType;
 
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
 		EventMod = _XAie_GetEventMod(DevInst, TileType, Mod);
 		return EventMod->NumGroupEvents;
 	}
@@ -619,6 +636,31 @@ u32 _XAie_RscMgr_GetMaxRscVal(XAie_DevInst *DevInst, XAie_RscType RscType,
 	}
 }
 
+/*****************************************************************************/
+/**
+* This API returns the max resource value for a give location, resource type and
+* module.
+*
+* @param	DevInst: Device Instance
+* @param	RscType: Resource type
+* @param	Loc: Location of tile
+* @param	Mod: Module - MEM, CORE or PL.
+*
+* @return	Max number of resources.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+u32 _XAie_RscMgr_GetMaxRscVal(XAie_DevInst *DevInst, XAie_RscType RscType,
+		XAie_LocType Loc, XAie_ModuleType Mod)
+{
+	u8 TileType;
+
+	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+
+	return _XAie_RscMgr_GetTileMaxRscVal(DevInst, RscType, TileType, Mod);
+}
+
 /*****************************************************************************/
 /**
 * This API returns the bitmap offsets and max resource values for a given
@@ -644,16 +686,22 @@ void _XAie_RscMgr_GetBitmapOffsets(XAie_DevInst *DevInst, XAie_RscType RscType,
 	u32 MaxRscVal;
 	u8 TileType;
 
+	u32 BitmapNumRows;
+
+	/* Look up the tile type once, it is needed by all the offsets */
 	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-	MaxRscVal = _XAie_RscMgr_GetMaxRscVal(DevInst, RscType, Loc, Mod);
+	BitmapNumRows = _XAie_GetNumRows(DevInst, TileType);
+	MaxRscVal = _XAie_RscMgr_GetTileMaxRscVal(DevInst, RscType, TileType,
+			Mod);
 	if(Mod == XAIE_CORE_MOD)
 		BitmapOffset = _XAie_GetCoreBitmapOffset(DevInst,
-				_XAie_RscMgr_GetMaxRscVal(DevInst, RscType, Loc,
-					XAIE_MEM_MOD));
+				_XAie_RscMgr_GetTileMaxRscVal(DevInst, RscType,
+					TileType, XAIE_MEM_MOD));
 
-	StartBit = _XAie_GetStartBit(DevInst, Loc, MaxRscVal) + BitmapOffset;
-	StaticBitmapOffset = MaxRscVal * DevInst->NumCols *
-		_XAie_GetNumRows(DevInst, TileType);
+	StartBit = _XAie_GetTileRscStartBitPosFromLoc(BitmapNumRows, Loc,
+			MaxRscVal, _XAie_GetStartRow(DevInst, TileType)) +
+		BitmapOffset;
+	StaticBitmapOffset = MaxRscVal * DevInst->NumCols * BitmapNumRows;
 
 	Offsets->StaticBitmapOffset = StaticBitmapOffset;
 	Offsets->BitmapOffset = BitmapOffset;
@@ -1459,6 +1507,124 @@ AieRC XAie_GetAvailRscStat(XAie_DevInst *DevInst, u32 NumRscStat,
 			XAIE_BACKEND_RSC_STAT_AVAIL);
 }
 
+/*****************************************************************************/
+/**
+* This API checks if a module type exists in a tile type.
+*
+* @param	TileType: Type of tile
+* @param	Mod: Module - MEM, CORE or PL.
+*
+* @return	XAIE_ENABLE if the tile has the module, XAIE_DISABLE otherwise.
+*
+* @note		This function is internal to this file only.
+*
+*******************************************************************************/
+static u8 _XAie_RscMgr_IsModInTile(u8 TileType, XAie_ModuleType Mod)
+{
+	switch(TileType) {
+	case XAIEGBL_TILE_TYPE_AIETILE:
+		return (Mod == XAIE_CORE_MOD) || (Mod == XAIE_MEM_MOD);
+	case XAIEGBL_TILE_TYPE_MEMTILE:
+		return Mod == XAIE_MEM_MOD;
+	case XAIEGBL_TILE_TYPE_SHIMNOC:
+	case XAIEGBL_TILE_TYPE_SHIMPL:
+		return Mod == XAIE_PL_MOD;
+	default:
+		return XAIE_DISABLE;
+	}
+}
+
+/*****************************************************************************/
+/**
+* This API shall be used to request resources of a module in all the ungated
+* tiles of the partition with one call. The API grants resources based on
+* availibility and marks that resource status in relevant bitmap.
+*
+* @param	DevInst: Device Instance
+* @param	RscType: Resource type. Performance counters, user events,
+*			 trace controls and stream switch event port selects
+*			 are supported.
+* @param	Mod: Module - MEM, CORE or PL. Tiles without the module are
+*		     skipped.
+* @param	NumRscPerTile: Number of resources requested per tile
+* @param	UserRscNum: Size of Rscs array.
+* @param	Rscs: Contains parameters to return reource such as
+* 		      resource ids, Location, Module, resource type.
+* 		      It needs to be allocated from user application.
+*
+* @return	XAIE_OK on success.
+*
+* @note		If the request fails for any tile, the resources granted to
+* 		the previous tiles are freed and the API returns failure.
+* 		UserRscNum pointer is used to indicate the size of Rscs as input
+* 		when passed by the caller. The same pointer gets updated to
+* 		indicate the number of granted resources by this API.
+*
+*******************************************************************************/
+AieRC XAie_RequestRscAllTiles(XAie_DevInst *DevInst, XAie_RscType RscType,
+		XAie_ModuleType Mod, u32 NumRscPerTile, u32 *UserRscNum,
+		XAie_UserRsc *Rscs)
+{
+	AieRC RC;
+	u32 Index = 0U;
+
+	if((DevInst == XAIE_NULL) || (UserRscNum == NULL) || (Rscs == NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((NumRscPerTile == 0U) || ((RscType != XAIE_PERFCNT_RSC) &&
+			(RscType != XAIE_USER_EVENTS_RSC) &&
+			(RscType != XAIE_TRACE_CTRL_RSC) &&
+			(RscType != XAIE_SS_EVENT_PORTS_RSC))) {
+		XAIE_ERROR("Invalid resource request, RscType: %d\n", RscType);
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 Col = 0U; Col < DevInst->NumCols; Col++) {
+		u32 Rows = _XAie_RscMgr_GetUngatedRows(DevInst, Col);
+
+		while(Rows != 0U) {
+			XAie_UserRscReq RscReq;
+			u8 TileType;
+
+			RscReq.Loc = XAie_TileLoc(Col,
+					_XAie_CountTrailingZeros(Rows));
+			Rows &= Rows - 1U;
+
+			TileType = DevInst->DevOps->GetTTypefromLoc(DevInst,
+					RscReq.Loc);
+			if(!_XAie_RscMgr_IsModInTile(TileType, Mod))
+				continue;
+
+			if(Index + NumRscPerTile > *UserRscNum) {
+				XAIE_ERROR("Invalid UserRscNum: %d\n",
+						*UserRscNum);
+				_XAie_RscMgr_FreeRscs(DevInst, Index, Rscs,
+						RscType);
+				return XAIE_INVALID_ARGS;
+			}
+
+			RscReq.Mod = Mod;
+			RscReq.NumRscPerTile = NumRscPerTile;
+			RC = _XAie_RscMgr_RequestRsc(DevInst, 1U, &RscReq,
+					&Rscs[Index], RscType);
+			if(RC != XAIE_OK) {
+				_XAie_RscMgr_FreeRscs(DevInst, Index, Rscs,
+						RscType);
+				return RC;
+			}
+
+			Index += NumRscPerTile;
+		}
+	}
+
+	*UserRscNum = Index;
+
+	return XAIE_OK;
+}
+
 #endif /* XAIE_FEATURE_RSC_ENABLE */
 
 /** @} */
@@ -17,6 +17,7 @@
 * Ver   Who      Date        Changes
 * ----- ------   --------    --------------------------------------------------
 * 1.0   Dishita  01/11/2021  Initial creation
+* 1.1   dc       10/31/2021  Add partition wide resource request API
 * </pre>
 *
 ******************************************************************************/
@@ -342,6 +343,20 @@ static inline AieRC XAie_GetAvailRscStat(XAie_DevInst *DevInst, u32 NumRscStat,
 	(void)RscStats;
 	return XAIE_FEATURE_NOT_SUPPORTED;
 }
+
+/* Partition wide resource management API */
+static inline AieRC XAie_RequestRscAllTiles(XAie_DevInst *DevInst,
+		XAie_RscType RscType, XAie_ModuleType Mod, u32 NumRscPerTile,
+		u32 *UserRscNum, XAie_UserRsc *Rscs)
+{
+	(void)DevInst;
+	(void)RscType;
+	(void)Mod;
+	(void)NumRscPerTile;
+	(void)UserRscNum;
+	(void)Rscs;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
 #else /* !XAIE_FEATURE_RSC_ENABLE */
 
 /* Performance counter resource management APIs */
@@ -448,5 +463,10 @@ AieRC XAie_GetStaticRscStat(XAie_DevInst *DevInst, u32 NumRscStat,
 		XAie_UserRscStat *RscStats);
 AieRC XAie_GetAvailRscStat(XAie_DevInst *DevInst, u32 NumRscStat,
 		XAie_UserRscStat *RscStats);
+
+/* Partition wide resource management API */
+AieRC XAie_RequestRscAllTiles(XAie_DevInst *DevInst, XAie_RscType RscType,
+		XAie_ModuleType Mod, u32 NumRscPerTile, u32 *UserRscNum,
+		XAie_UserRsc *Rscs);
 #endif /* XAIE_FEATURE_RSC_ENABLE */
 #endif		/* end of protection macro */
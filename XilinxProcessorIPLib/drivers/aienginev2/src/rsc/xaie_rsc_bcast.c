@@ -17,6 +17,7 @@
 * Ver   Who     Date        Changes
 * ----- ------  --------    ---------------------------------------------------
 * 1.0   Dishita 03/10/2021  Initial creation
+* 1.1   dc      10/31/2021  Scan ungated tiles a column at a time
 *
 * </pre>
 *
@@ -24,7 +25,6 @@
 /***************************** Include Files *********************************/
 #include <stdlib.h>
 
-#include "xaie_clock.h"
 #include "xaie_feature_config.h"
 #include "xaie_helper.h"
 #include "xaie_io.h"
@@ -61,38 +61,43 @@ static AieRC _XAie_GetUngatedTilesInPartition(XAie_DevInst *DevInst,
 
 	/* Add clock enabled tiles of the partition to Rscs */
 	for(u32 Col = 0; Col < DevInst->NumCols; Col++) {
-		for(u32 Row = 0; Row < DevInst->NumRows; Row++) {
-			XAie_LocType Loc = XAie_TileLoc(Col, Row);
+		u32 Rows = _XAie_RscMgr_GetUngatedRows(DevInst, Col);
 
-			if(_XAie_PmIsTileRequested(DevInst, Loc)) {
-				if(Index >= *UserRscNum) {
-					XAIE_ERROR("Invalid UserRscNum: %d\n",
-						*UserRscNum);
-					return XAIE_INVALID_ARGS;
-				}
+		while(Rows != 0U) {
+			XAie_LocType Loc = XAie_TileLoc(Col,
+					_XAie_CountTrailingZeros(Rows));
+			u32 NumMods = 1U;
 
-				TileType = DevInst->DevOps->GetTTypefromLoc(
-						DevInst, Loc);
-				if((TileType == XAIEGBL_TILE_TYPE_SHIMNOC) ||
-					(TileType == XAIEGBL_TILE_TYPE_SHIMPL)) {
-					Rscs[Index].Mod = XAIE_PL_MOD;
+			Rows &= Rows - 1U;
+			TileType = DevInst->DevOps->GetTTypefromLoc(DevInst,
+					Loc);
+			if(TileType == XAIEGBL_TILE_TYPE_AIETILE)
+				NumMods = 2U;
 
-				} else if(TileType == XAIEGBL_TILE_TYPE_AIETILE) {
-					Rscs[Index].Loc = Loc;
-					Rscs[Index].Mod = XAIE_CORE_MOD;
-					Rscs[Index].RscType =
-						XAIE_BCAST_CHANNEL_RSC;
-					Index++;
-					Rscs[Index].Mod = XAIE_MEM_MOD;
+			if(Index + NumMods > *UserRscNum) {
+				XAIE_ERROR("Invalid UserRscNum: %d\n",
+					*UserRscNum);
+				return XAIE_INVALID_ARGS;
+			}
 
-				} else {
-					Rscs[Index].Mod = XAIE_MEM_MOD;
-				}
+			if((TileType == XAIEGBL_TILE_TYPE_SHIMNOC) ||
+				(TileType == XAIEGBL_TILE_TYPE_SHIMPL)) {
+				Rscs[Index].Mod = XAIE_PL_MOD;
 
+			} else if(TileType == XAIEGBL_TILE_TYPE_AIETILE) {
 				Rscs[Index].Loc = Loc;
+				Rscs[Index].Mod = XAIE_CORE_MOD;
 				Rscs[Index].RscType = XAIE_BCAST_CHANNEL_RSC;
 				Index++;
+				Rscs[Index].Mod = XAIE_MEM_MOD;
+
+			} else {
+				Rscs[Index].Mod = XAIE_MEM_MOD;
 			}
+
+			Rscs[Index].Loc = Loc;
+			Rscs[Index].RscType = XAIE_BCAST_CHANNEL_RSC;
+			Index++;
 		}
 	}
 
@@ -17,6 +17,7 @@
 * Ver   Who      Date        Changes
 * ----- ------   --------    --------------------------------------------------
 * 1.0   Dishita  01/11/2021  Initial creation
+* 1.1   dc       10/31/2021  Add _XAie_RscMgr_GetUngatedRows()
 * </pre>
 *
 ******************************************************************************/
@@ -161,6 +162,12 @@ static inline void _XAie_MarkChannelBitmapAndRscId(XAie_DevInst *DevInst,
 	(void)ChannelIndex;
 	return;
 }
+static inline u32 _XAie_RscMgr_GetUngatedRows(XAie_DevInst *DevInst,
+		u32 Col) {
+	(void)DevInst;
+	(void)Col;
+	return 0U;
+}
 #else /* !XAIE_RSC_DISABLE */
 /* Global resource management APIs */
 AieRC _XAie_RscMgrInit(XAie_DevInst *DevInst);
@@ -195,6 +202,7 @@ void _XAie_RscMgr_GetBitmapOffsets(XAie_DevInst *DevInst, XAie_RscType RscType,
 		XAie_BitmapOffsets *Offsets);
 void _XAie_MarkChannelBitmapAndRscId(XAie_DevInst *DevInst, u32 UserRscNum,
 		XAie_UserRsc *Rscs, u32 ChannelIndex);
+u32 _XAie_RscMgr_GetUngatedRows(XAie_DevInst *DevInst, u32 Col);
 #endif /* XAIE_RSC_DISABLE */
 
 /*****************************************************************************/
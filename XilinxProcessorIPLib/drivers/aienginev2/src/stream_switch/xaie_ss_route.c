@@ -0,0 +1,1204 @@
+/******************************************************************************
+* Copyright (C) 2021 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_ss_route.c
+* @{
+*
+* This file contains routines to compute multi hop routes over the AIE stream
+* switch network and configure them.
+*
+* The array is modelled as a graph of channels. A channel is a master port of
+* type SOUTH, WEST, NORTH or EAST of a tile, connected to the slave port of the
+* same number of the neighbouring tile. Routes are searched with A* from the
+* source slave port to the destination master port, only taking connections
+* accepted by the stream switch module of each tile. Congestion is resolved
+* by negotiation: routes are allowed to overuse channels, with a cost that
+* grows with the present overuse and with the overuse history of the channel,
+* and routes crossing overused channels are ripped up and routed again until
+* no channel is overused.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0   dc      10/31/2021  Initial creation
+* </pre>
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "xaie_events.h"
+#include "xaie_feature_config.h"
+#include "xaie_helper.h"
+#include "xaie_ss_route.h"
+
+#ifdef XAIE_FEATURE_SS_ENABLE
+
+/************************** Constant Definitions *****************************/
+#define XAIE_SS_ROUTE_NUM_DIRS		4U
+#define XAIE_SS_ROUTE_NUM_ARBITORS	6U
+#define XAIE_SS_ROUTE_NUM_MSELS		4U
+#define XAIE_SS_ROUTE_MAX_ITERS		64U
+#define XAIE_SS_ROUTE_BASE_COST		16U
+#define XAIE_SS_ROUTE_HIST_COST		8U
+#define XAIE_SS_ROUTE_MAX_PRES_FAC	4096U
+#define XAIE_SS_ROUTE_TIE_BITS		20U
+#define XAIE_SS_ROUTE_TIE_MASK		((1ULL << XAIE_SS_ROUTE_TIE_BITS) - 1U)
+#define XAIE_SS_ROUTE_PKT_MASK		0x1FU
+#define XAIE_SS_ROUTE_NONE		0xFFFFFFFFU
+#define XAIE_SS_ROUTE_UNASSIGNED	0xFFU
+
+/**************************** Type Definitions *******************************/
+/*
+ * Internal router state. Channels are indexed by tile, direction and port
+ * number. The capacity of a channel is the number of slave slots of the slave
+ * port it drives. A packet switched route takes one unit of capacity, which
+ * is one slave slot, and a circuit switched route takes all of it.
+ */
+typedef struct {
+	const XAie_StrmMod **Mods;	/* Stream switch module of each tile */
+	u32 NumCols;
+	u32 NumRows;
+	u32 MaxPorts;			/* Max port number of a direction + 1 */
+	u32 MaxAnyPorts;		/* Max port number of any type + 1 */
+	u32 NumChs;			/* Number of channel indices */
+	u8 *Cap;			/* Capacity, 0 if channel doesn't exist */
+	u16 *Occ;			/* Occupied capacity */
+	u32 *Hist;			/* Overuse history cost */
+	u64 *Dist;			/* Search cost from the route source */
+	u64 *Key;			/* Search cost plus estimate to target,
+					   with tie break */
+	u32 *Prev;			/* Previous channel of the search */
+	u32 *Stamp;			/* Search the Dist/Prev/Pos belong to */
+	u32 *Pos;			/* Position in the search heap */
+	u32 *Heap;			/* Search min heap of channels */
+	u32 HeapSize;
+	u32 Search;			/* Search counter */
+	u32 PresFac;			/* Present overuse cost factor */
+	u32 **Paths;			/* Channels of each route */
+	u32 *PathLen;			/* Number of channels of each route */
+} XAie_StrmRouter;
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API returns the index of a channel.
+*
+* @param	R: Router
+* @param	Col: Column of the tile driving the channel
+* @param	Row: Row of the tile driving the channel
+* @param	Dir: Direction, index of the master port type from SOUTH
+* @param	Port: Master port number
+*
+* @return	Channel index.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline u32 _XAie_StrmRouteCh(const XAie_StrmRouter *R, u32 Col,
+		u32 Row, u32 Dir, u32 Port)
+{
+	return ((Col * R->NumRows + Row) * XAIE_SS_ROUTE_NUM_DIRS + Dir) *
+		R->MaxPorts + Port;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API decodes a channel index.
+*
+* @param	R: Router
+* @param	Ch: Channel index
+* @param	Col: Pointer to store the column of the driving tile
+* @param	Row: Pointer to store the row of the driving tile
+* @param	Dir: Pointer to store the direction
+* @param	Port: Pointer to store the master port number
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline void _XAie_StrmRouteChDecode(const XAie_StrmRouter *R, u32 Ch,
+		u32 *Col, u32 *Row, u32 *Dir, u32 *Port)
+{
+	*Port = Ch % R->MaxPorts;
+	Ch /= R->MaxPorts;
+	*Dir = Ch % XAIE_SS_ROUTE_NUM_DIRS;
+	Ch /= XAIE_SS_ROUTE_NUM_DIRS;
+	*Row = Ch % R->NumRows;
+	*Col = Ch / R->NumRows;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the location of the neighbouring tile in a direction.
+*
+* @param	R: Router
+* @param	Col: Column of the tile
+* @param	Row: Row of the tile
+* @param	Dir: Direction, index of the port type from SOUTH
+* @param	NCol: Pointer to store the column of the neighbour
+* @param	NRow: Pointer to store the row of the neighbour
+*
+* @return	XAIE_ENABLE if the neighbour is in the partition, XAIE_DISABLE
+*		otherwise.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u8 _XAie_StrmRouteNeighbour(const XAie_StrmRouter *R, u32 Col, u32 Row,
+		u32 Dir, u32 *NCol, u32 *NRow)
+{
+	*NCol = Col;
+	*NRow = Row;
+
+	switch((StrmSwPortType)(SOUTH + Dir)) {
+	case SOUTH:
+		if(Row == 0U) {
+			return XAIE_DISABLE;
+		}
+		*NRow = Row - 1U;
+		break;
+	case WEST:
+		if(Col == 0U) {
+			return XAIE_DISABLE;
+		}
+		*NCol = Col - 1U;
+		break;
+	case NORTH:
+		if(Row + 1U >= R->NumRows) {
+			return XAIE_DISABLE;
+		}
+		*NRow = Row + 1U;
+		break;
+	default:
+		if(Col + 1U >= R->NumCols) {
+			return XAIE_DISABLE;
+		}
+		*NCol = Col + 1U;
+		break;
+	}
+
+	return XAIE_ENABLE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the channel driving a slave port or driven by a master port
+* of a tile, if the port is one of the ports connecting neighbouring tiles.
+*
+* @param	R: Router
+* @param	Loc: Location of the tile
+* @param	Port: XAIE_STRMSW_SLAVE/MASTER for Slave or Master port
+* @param	PortType: Port type
+* @param	PortNum: Port number
+*
+* @return	Channel index or XAIE_SS_ROUTE_NONE.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u32 _XAie_StrmRouteChOfPort(const XAie_StrmRouter *R, XAie_LocType Loc,
+		XAie_StrmPortIntf Port, StrmSwPortType PortType, u8 PortNum)
+{
+	u32 Dir, Col = Loc.Col, Row = Loc.Row, Ch;
+
+	if((PortType < SOUTH) || (PortType > EAST) ||
+			(PortNum >= R->MaxPorts)) {
+		return XAIE_SS_ROUTE_NONE;
+	}
+
+	Dir = (u32)(PortType - SOUTH);
+	if(Port == XAIE_STRMSW_SLAVE) {
+		/* The slave port is driven by the neighbour in its direction */
+		if(_XAie_StrmRouteNeighbour(R, Loc.Col, Loc.Row, Dir, &Col,
+					&Row) == XAIE_DISABLE) {
+			return XAIE_SS_ROUTE_NONE;
+		}
+		Dir ^= 2U;
+	}
+
+	Ch = _XAie_StrmRouteCh(R, Col, Row, Dir, PortNum);
+	return (R->Cap[Ch] != 0U) ? Ch : XAIE_SS_ROUTE_NONE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API moves a channel towards the top of the search heap.
+*
+* @param	R: Router
+* @param	i: Heap position of the channel
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_StrmRouteHeapUp(XAie_StrmRouter *R, u32 i)
+{
+	u32 Ch = R->Heap[i];
+
+	while(i > 0U) {
+		u32 P = (i - 1U) / 2U;
+
+		if(R->Key[R->Heap[P]] <= R->Key[Ch]) {
+			break;
+		}
+		R->Heap[i] = R->Heap[P];
+		R->Pos[R->Heap[i]] = i;
+		i = P;
+	}
+
+	R->Heap[i] = Ch;
+	R->Pos[Ch] = i;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API pops the channel with the lowest key from the search heap.
+*
+* @param	R: Router
+*
+* @return	Channel index.
+*
+* @note		Internal only. The heap must not be empty.
+*
+*******************************************************************************/
+static u32 _XAie_StrmRouteHeapPop(XAie_StrmRouter *R)
+{
+	u32 Top = R->Heap[0U], Ch, i = 0U;
+
+	R->Pos[Top] = XAIE_SS_ROUTE_NONE;
+	R->HeapSize--;
+	if(R->HeapSize == 0U) {
+		return Top;
+	}
+
+	Ch = R->Heap[R->HeapSize];
+	while(1) {
+		u32 C = 2U * i + 1U;
+
+		if(C >= R->HeapSize) {
+			break;
+		}
+		if((C + 1U < R->HeapSize) &&
+				(R->Key[R->Heap[C + 1U]] < R->Key[R->Heap[C]])) {
+			C++;
+		}
+		if(R->Key[R->Heap[C]] >= R->Key[Ch]) {
+			break;
+		}
+		R->Heap[i] = R->Heap[C];
+		R->Pos[R->Heap[i]] = i;
+		i = C;
+	}
+
+	R->Heap[i] = Ch;
+	R->Pos[Ch] = i;
+
+	return Top;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the capacity a route takes on a channel.
+*
+* @param	R: Router
+* @param	Req: Route request
+* @param	Ch: Channel index
+*
+* @return	Demand of the route.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline u32 _XAie_StrmRouteDemand(const XAie_StrmRouter *R,
+		const XAie_StrmRouteReq *Req, u32 Ch)
+{
+	return (Req->Mode == XAIE_SS_ROUTE_CIRCUIT) ? R->Cap[Ch] : 1U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API relaxes a channel of the route search. The cost of the channel is
+* its base cost plus its overuse history and present occupancy, multiplied by
+* the overuse the route would cause.
+*
+* @param	R: Router
+* @param	Req: Route request
+* @param	Ch: Channel index
+* @param	D: Search cost of the route up to the tile driving the channel
+* @param	Parent: Previous channel of the route or XAIE_SS_ROUTE_NONE
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_StrmRouteRelax(XAie_StrmRouter *R,
+		const XAie_StrmRouteReq *Req, u32 Ch, u64 D, u32 Parent)
+{
+	u32 Col, Row, Dir, Port, NCol, NRow, Over = 0U, Use;
+	u64 ND, H;
+
+	Use = R->Occ[Ch] + _XAie_StrmRouteDemand(R, Req, Ch);
+	if(Use > R->Cap[Ch]) {
+		Over = Use - R->Cap[Ch];
+	}
+	ND = D + (u64)(XAIE_SS_ROUTE_BASE_COST + R->Hist[Ch] + R->Occ[Ch]) *
+		(1U + R->PresFac * Over);
+
+	if(R->Stamp[Ch] != R->Search) {
+		R->Stamp[Ch] = R->Search;
+		R->Dist[Ch] = (u64)-1;
+		R->Pos[Ch] = XAIE_SS_ROUTE_NONE;
+	}
+	if(ND >= R->Dist[Ch]) {
+		return;
+	}
+
+	/* Every channel costs at least the base cost, estimate is admissible */
+	_XAie_StrmRouteChDecode(R, Ch, &Col, &Row, &Dir, &Port);
+	_XAie_StrmRouteNeighbour(R, Col, Row, Dir, &NCol, &NRow);
+	H = (u64)XAIE_SS_ROUTE_BASE_COST *
+		((NCol > Req->DstLoc.Col ? NCol - Req->DstLoc.Col :
+		  Req->DstLoc.Col - NCol) +
+		 (NRow > Req->DstLoc.Row ? NRow - Req->DstLoc.Row :
+		  Req->DstLoc.Row - NRow));
+
+	/*
+	 * Break ties of the estimated cost in favour of the longer partial
+	 * path, otherwise all the equivalent paths of the grid get expanded.
+	 */
+	R->Dist[Ch] = ND;
+	R->Key[Ch] = ((ND + H) << XAIE_SS_ROUTE_TIE_BITS) |
+		(XAIE_SS_ROUTE_TIE_MASK - (ND < XAIE_SS_ROUTE_TIE_MASK ?
+					   ND : XAIE_SS_ROUTE_TIE_MASK));
+	R->Prev[Ch] = Parent;
+	if(R->Pos[Ch] == XAIE_SS_ROUTE_NONE) {
+		R->Heap[R->HeapSize] = Ch;
+		R->Pos[Ch] = R->HeapSize;
+		R->HeapSize++;
+	}
+	_XAie_StrmRouteHeapUp(R, R->Pos[Ch]);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API relaxes all the channels a slave port of a tile can connect to.
+*
+* @param	R: Router
+* @param	Req: Route request
+* @param	Col: Column of the tile
+* @param	Row: Row of the tile
+* @param	Slave: Slave port type
+* @param	SlvPortNum: Slave port number
+* @param	D: Search cost of the route up to the tile
+* @param	Parent: Channel driving the slave port or XAIE_SS_ROUTE_NONE
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_StrmRouteExpand(XAie_StrmRouter *R,
+		const XAie_StrmRouteReq *Req, u32 Col, u32 Row,
+		StrmSwPortType Slave, u8 SlvPortNum, u64 D, u32 Parent)
+{
+	const XAie_StrmMod *StrmMod = R->Mods[Col * R->NumRows + Row];
+
+	for(u32 Dir = 0U; Dir < XAIE_SS_ROUTE_NUM_DIRS; Dir++) {
+		for(u32 Port = 0U; Port < R->MaxPorts; Port++) {
+			u32 Ch = _XAie_StrmRouteCh(R, Col, Row, Dir, Port);
+
+			if(R->Cap[Ch] == 0U) {
+				continue;
+			}
+
+			if(StrmMod->PortVerify(Slave, SlvPortNum,
+					(StrmSwPortType)(SOUTH + Dir),
+					(u8)Port) != XAIE_OK) {
+				continue;
+			}
+
+			_XAie_StrmRouteRelax(R, Req, Ch, D, Parent);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API searches the lowest cost path of a route with the present channel
+* costs and stores it as the path of the route.
+*
+* @param	R: Router
+* @param	Req: Route request
+* @param	Idx: Index of the route
+*
+* @return	XAIE_OK on success, XAIE_ERR_STREAM_PORT if there is no path.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_StrmRouteSearch(XAie_StrmRouter *R,
+		const XAie_StrmRouteReq *Req, u32 Idx)
+{
+	const XAie_StrmMod *StrmMod;
+
+	free(R->Paths[Idx]);
+	R->Paths[Idx] = XAIE_NULL;
+	R->PathLen[Idx] = 0U;
+
+	/* Route within the source tile, no channel needed */
+	StrmMod = R->Mods[Req->SrcLoc.Col * R->NumRows + Req->SrcLoc.Row];
+	if((Req->SrcLoc.Col == Req->DstLoc.Col) &&
+			(Req->SrcLoc.Row == Req->DstLoc.Row) &&
+			(StrmMod->PortVerify(Req->SrcPort, Req->SrcPortNum,
+				Req->DstPort, Req->DstPortNum) == XAIE_OK)) {
+		return XAIE_OK;
+	}
+
+	R->Search++;
+	R->HeapSize = 0U;
+	_XAie_StrmRouteExpand(R, Req, Req->SrcLoc.Col, Req->SrcLoc.Row,
+			Req->SrcPort, Req->SrcPortNum, 0U, XAIE_SS_ROUTE_NONE);
+
+	while(R->HeapSize > 0U) {
+		u32 Ch = _XAie_StrmRouteHeapPop(R);
+		u32 Col, Row, Dir, Port, NCol, NRow, Len = 0U;
+		StrmSwPortType Slave;
+
+		_XAie_StrmRouteChDecode(R, Ch, &Col, &Row, &Dir, &Port);
+		_XAie_StrmRouteNeighbour(R, Col, Row, Dir, &NCol, &NRow);
+		Slave = (StrmSwPortType)(SOUTH + (Dir ^ 2U));
+		StrmMod = R->Mods[NCol * R->NumRows + NRow];
+
+		if((NCol != Req->DstLoc.Col) || (NRow != Req->DstLoc.Row) ||
+				(StrmMod->PortVerify(Slave, (u8)Port,
+					Req->DstPort, Req->DstPortNum) !=
+				 XAIE_OK)) {
+			_XAie_StrmRouteExpand(R, Req, NCol, NRow, Slave,
+					(u8)Port, R->Dist[Ch], Ch);
+			continue;
+		}
+
+		/* Destination reached, back track the path */
+		for(u32 c = Ch; c != XAIE_SS_ROUTE_NONE; c = R->Prev[c]) {
+			Len++;
+		}
+
+		R->Paths[Idx] = (u32 *)malloc(Len * sizeof(u32));
+		if(R->Paths[Idx] == XAIE_NULL) {
+			XAIE_ERROR("Memory allocation failed\n");
+			return XAIE_ERR;
+		}
+
+		R->PathLen[Idx] = Len;
+		for(u32 c = Ch; c != XAIE_SS_ROUTE_NONE; c = R->Prev[c]) {
+			R->Paths[Idx][--Len] = c;
+		}
+
+		return XAIE_OK;
+	}
+
+	XAIE_ERROR("No path from tile (%d, %d) to tile (%d, %d)\n",
+			Req->SrcLoc.Col, Req->SrcLoc.Row, Req->DstLoc.Col,
+			Req->DstLoc.Row);
+	return XAIE_ERR_STREAM_PORT;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API adds or removes the occupancy of the path of a route.
+*
+* @param	R: Router
+* @param	Req: Route request
+* @param	Idx: Index of the route
+* @param	Add: XAIE_ENABLE to add, XAIE_DISABLE to remove
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_StrmRouteOccupy(XAie_StrmRouter *R,
+		const XAie_StrmRouteReq *Req, u32 Idx, u8 Add)
+{
+	for(u32 i = 0U; i < R->PathLen[Idx]; i++) {
+		u32 Ch = R->Paths[Idx][i];
+
+		if(Add == XAIE_ENABLE) {
+			R->Occ[Ch] += _XAie_StrmRouteDemand(R, Req, Ch);
+		} else {
+			R->Occ[Ch] -= _XAie_StrmRouteDemand(R, Req, Ch);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks if the path of a route crosses an overused channel.
+*
+* @param	R: Router
+* @param	Idx: Index of the route
+*
+* @return	XAIE_ENABLE if congested, XAIE_DISABLE otherwise.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u8 _XAie_StrmRouteIsCongested(const XAie_StrmRouter *R, u32 Idx)
+{
+	for(u32 i = 0U; i < R->PathLen[Idx]; i++) {
+		u32 Ch = R->Paths[Idx][i];
+
+		if(R->Occ[Ch] > R->Cap[Ch]) {
+			return XAIE_ENABLE;
+		}
+	}
+
+	return XAIE_DISABLE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API frees the router state.
+*
+* @param	R: Router
+* @param	NumReqs: Number of route requests
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_StrmRouterFinish(XAie_StrmRouter *R, u32 NumReqs)
+{
+	if(R->Paths != XAIE_NULL) {
+		for(u32 i = 0U; i < NumReqs; i++) {
+			free(R->Paths[i]);
+		}
+	}
+
+	free(R->Mods);
+	free(R->Cap);
+	free(R->Occ);
+	free(R->Hist);
+	free(R->Dist);
+	free(R->Key);
+	free(R->Prev);
+	free(R->Stamp);
+	free(R->Pos);
+	free(R->Heap);
+	free(R->Paths);
+	free(R->PathLen);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API builds the channel model of the partition.
+*
+* @param	DevInst: Device Instance
+* @param	R: Router
+* @param	NumReqs: Number of route requests
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_StrmRouterInit(XAie_DevInst *DevInst, XAie_StrmRouter *R,
+		u32 NumReqs)
+{
+	u32 NumTiles;
+
+	memset(R, 0, sizeof(*R));
+	R->NumCols = DevInst->NumCols;
+	R->NumRows = DevInst->NumRows;
+	NumTiles = R->NumCols * R->NumRows;
+
+	R->Mods = (const XAie_StrmMod **)calloc(NumTiles,
+			sizeof(const XAie_StrmMod *));
+	if(R->Mods == XAIE_NULL) {
+		XAIE_ERROR("Memory allocation failed\n");
+		return XAIE_ERR;
+	}
+
+	for(u32 Col = 0U; Col < R->NumCols; Col++) {
+		for(u32 Row = 0U; Row < R->NumRows; Row++) {
+			const XAie_StrmMod *StrmMod;
+			u8 TileType;
+
+			TileType = DevInst->DevOps->GetTTypefromLoc(DevInst,
+					XAie_TileLoc((u8)Col, (u8)Row));
+			if(TileType == XAIEGBL_TILE_TYPE_MAX) {
+				return XAIE_INVALID_TILE;
+			}
+
+			StrmMod = DevInst->DevProp.DevMod[TileType].StrmSw;
+			R->Mods[Col * R->NumRows + Row] = StrmMod;
+			for(u32 Type = 0U; Type < SS_PORT_TYPE_MAX; Type++) {
+				u32 N = StrmMod->MstrConfig[Type].NumPorts;
+
+				if(StrmMod->SlvConfig[Type].NumPorts > N) {
+					N = StrmMod->SlvConfig[Type].NumPorts;
+				}
+				if(N > R->MaxAnyPorts) {
+					R->MaxAnyPorts = N;
+				}
+				if((Type >= SOUTH) && (Type <= EAST) &&
+						(N > R->MaxPorts)) {
+					R->MaxPorts = N;
+				}
+			}
+		}
+	}
+
+	R->NumChs = NumTiles * XAIE_SS_ROUTE_NUM_DIRS * R->MaxPorts;
+	R->Cap = (u8 *)calloc(R->NumChs, sizeof(u8));
+	R->Occ = (u16 *)calloc(R->NumChs, sizeof(u16));
+	R->Hist = (u32 *)calloc(R->NumChs, sizeof(u32));
+	R->Dist = (u64 *)calloc(R->NumChs, sizeof(u64));
+	R->Key = (u64 *)calloc(R->NumChs, sizeof(u64));
+	R->Prev = (u32 *)calloc(R->NumChs, sizeof(u32));
+	R->Stamp = (u32 *)calloc(R->NumChs, sizeof(u32));
+	R->Pos = (u32 *)calloc(R->NumChs, sizeof(u32));
+	R->Heap = (u32 *)calloc(R->NumChs, sizeof(u32));
+	R->Paths = (u32 **)calloc(NumReqs, sizeof(u32 *));
+	R->PathLen = (u32 *)calloc(NumReqs, sizeof(u32));
+	if((R->Cap == XAIE_NULL) || (R->Occ == XAIE_NULL) ||
+			(R->Hist == XAIE_NULL) || (R->Dist == XAIE_NULL) ||
+			(R->Key == XAIE_NULL) || (R->Prev == XAIE_NULL) ||
+			(R->Stamp == XAIE_NULL) || (R->Pos == XAIE_NULL) ||
+			(R->Heap == XAIE_NULL) || (R->Paths == XAIE_NULL) ||
+			(R->PathLen == XAIE_NULL)) {
+		XAIE_ERROR("Memory allocation failed\n");
+		return XAIE_ERR;
+	}
+
+	for(u32 Col = 0U; Col < R->NumCols; Col++) {
+		for(u32 Row = 0U; Row < R->NumRows; Row++) {
+			const XAie_StrmMod *StrmMod;
+
+			StrmMod = R->Mods[Col * R->NumRows + Row];
+			for(u32 Dir = 0U; Dir < XAIE_SS_ROUTE_NUM_DIRS; Dir++) {
+				const XAie_StrmMod *NMod;
+				u32 NCol, NRow, NumPorts;
+
+				if(_XAie_StrmRouteNeighbour(R, Col, Row, Dir,
+						&NCol, &NRow) == XAIE_DISABLE) {
+					continue;
+				}
+
+				NMod = R->Mods[NCol * R->NumRows + NRow];
+				NumPorts = StrmMod->MstrConfig[SOUTH + Dir].NumPorts;
+				if(NMod->SlvConfig[SOUTH + (Dir ^ 2U)].NumPorts <
+						NumPorts) {
+					NumPorts = NMod->SlvConfig[SOUTH +
+						(Dir ^ 2U)].NumPorts;
+				}
+
+				for(u32 Port = 0U; Port < NumPorts; Port++) {
+					R->Cap[_XAie_StrmRouteCh(R, Col, Row,
+						Dir, Port)] =
+						NMod->NumSlaveSlots;
+				}
+			}
+		}
+	}
+
+	R->PresFac = 1U;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API validates the route requests.
+*
+* @param	R: Router
+* @param	Reqs: Route requests
+* @param	NumReqs: Number of route requests
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_StrmRouteValidate(const XAie_StrmRouter *R,
+		const XAie_StrmRouteReq *Reqs, u32 NumReqs)
+{
+	for(u32 i = 0U; i < NumReqs; i++) {
+		const XAie_StrmRouteReq *Req = &Reqs[i];
+		const XAie_StrmMod *SrcMod, *DstMod;
+
+		if((Req->SrcLoc.Col >= R->NumCols) ||
+				(Req->SrcLoc.Row >= R->NumRows) ||
+				(Req->DstLoc.Col >= R->NumCols) ||
+				(Req->DstLoc.Row >= R->NumRows)) {
+			XAIE_ERROR("Route %d: invalid tile location\n", i);
+			return XAIE_INVALID_TILE;
+		}
+
+		if((Req->SrcPort >= SS_PORT_TYPE_MAX) ||
+				(Req->DstPort >= SS_PORT_TYPE_MAX) ||
+				(Req->Mode >= XAIE_SS_ROUTE_MODE_MAX)) {
+			XAIE_ERROR("Route %d: invalid port type or mode\n", i);
+			return XAIE_INVALID_ARGS;
+		}
+
+		SrcMod = R->Mods[Req->SrcLoc.Col * R->NumRows +
+			Req->SrcLoc.Row];
+		DstMod = R->Mods[Req->DstLoc.Col * R->NumRows +
+			Req->DstLoc.Row];
+		if((Req->SrcPortNum >=
+				SrcMod->SlvConfig[Req->SrcPort].NumPorts) ||
+				(Req->DstPortNum >=
+				 DstMod->MstrConfig[Req->DstPort].NumPorts)) {
+			XAIE_ERROR("Route %d: invalid stream port\n", i);
+			return XAIE_ERR_STREAM_PORT;
+		}
+
+		if((_XAie_StrmRouteChOfPort(R, Req->SrcLoc, XAIE_STRMSW_SLAVE,
+					Req->SrcPort, Req->SrcPortNum) !=
+				XAIE_SS_ROUTE_NONE) ||
+				(_XAie_StrmRouteChOfPort(R, Req->DstLoc,
+					XAIE_STRMSW_MASTER, Req->DstPort,
+					Req->DstPortNum) !=
+				 XAIE_SS_ROUTE_NONE)) {
+			XAIE_ERROR("Route %d: end point connects tiles\n", i);
+			return XAIE_ERR_STREAM_PORT;
+		}
+
+		if((Req->Mode == XAIE_SS_ROUTE_PACKET) &&
+				((Req->Pkt.PktId > XAIE_PACKET_ID_MAX) ||
+				 (Req->Pkt.PktType > XAIE_PACKET_TYPE_MAX) ||
+				 (Req->DropHeader > XAIE_SS_PKT_DROP_HEADER))) {
+			XAIE_ERROR("Route %d: invalid packet\n", i);
+			return XAIE_INVALID_ARGS;
+		}
+
+		for(u32 j = 0U; j < i; j++) {
+			const XAie_StrmRouteReq *O = &Reqs[j];
+			u8 SameSrc, SameDst;
+
+			SameSrc = (O->SrcLoc.Col == Req->SrcLoc.Col) &&
+				(O->SrcLoc.Row == Req->SrcLoc.Row) &&
+				(O->SrcPort == Req->SrcPort) &&
+				(O->SrcPortNum == Req->SrcPortNum);
+			SameDst = (O->DstLoc.Col == Req->DstLoc.Col) &&
+				(O->DstLoc.Row == Req->DstLoc.Row) &&
+				(O->DstPort == Req->DstPort) &&
+				(O->DstPortNum == Req->DstPortNum);
+
+			if(((SameSrc || SameDst) &&
+					((O->Mode == XAIE_SS_ROUTE_CIRCUIT) ||
+					 (Req->Mode == XAIE_SS_ROUTE_CIRCUIT))) ||
+					((O->Mode == XAIE_SS_ROUTE_PACKET) &&
+					 (Req->Mode == XAIE_SS_ROUTE_PACKET) &&
+					 ((O->Pkt.PktId == Req->Pkt.PktId) ||
+					  (SameDst && (O->DropHeader !=
+						       Req->DropHeader))))) {
+				XAIE_ERROR("Route %d conflicts with route %d\n",
+						i, j);
+				return XAIE_INVALID_ARGS;
+			}
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API converts the paths of the routes to the per tile stream switch
+* configuration of the plan, and allocates the slave slots, arbitors and
+* master selects of the packet switched routes. The packet switched master
+* ports of a tile get their own arbitor as long as there are free arbitors,
+* further master ports share an arbitor through distinct master selects.
+*
+* @param	DevInst: Device Instance
+* @param	R: Router
+* @param	Plan: Route plan
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_StrmRouteBuildPlan(XAie_DevInst *DevInst,
+		const XAie_StrmRouter *R, XAie_StrmRoutePlan *Plan)
+{
+	AieRC RC = XAIE_OK;
+	u32 NumTiles = R->NumCols * R->NumRows;
+	u32 NumPorts = NumTiles * SS_PORT_TYPE_MAX * R->MaxAnyPorts;
+	u32 NumHops = 0U;
+	u8 *Slots, *Arbs, *NumMstrs;
+
+	for(u32 i = 0U; i < Plan->NumReqs; i++) {
+		NumHops += R->PathLen[i] + 1U;
+	}
+
+	Plan->Hops = (XAie_StrmRouteHop *)calloc(NumHops,
+			sizeof(XAie_StrmRouteHop));
+	Plan->HopStart = (u32 *)calloc(Plan->NumReqs + 1U, sizeof(u32));
+	Slots = (u8 *)calloc(NumPorts, sizeof(u8));
+	Arbs = (u8 *)malloc(NumPorts * sizeof(u8));
+	NumMstrs = (u8 *)calloc(NumTiles, sizeof(u8));
+	if((Plan->Hops == XAIE_NULL) || (Plan->HopStart == XAIE_NULL) ||
+			(Slots == XAIE_NULL) || (Arbs == XAIE_NULL) ||
+			(NumMstrs == XAIE_NULL)) {
+		XAIE_ERROR("Memory allocation failed\n");
+		RC = XAIE_ERR;
+		goto out;
+	}
+	memset(Arbs, XAIE_SS_ROUTE_UNASSIGNED, NumPorts);
+
+	Plan->NumHops = 0U;
+	for(u32 i = 0U; (i < Plan->NumReqs) && (RC == XAIE_OK); i++) {
+		const XAie_StrmRouteReq *Req = &Plan->Reqs[i];
+		const u32 *Path = R->Paths[i];
+
+		Plan->HopStart[i] = Plan->NumHops;
+		for(u32 h = 0U; h <= R->PathLen[i]; h++) {
+			XAie_StrmRouteHop *Hop = &Plan->Hops[Plan->NumHops++];
+			u32 Col, Row, Dir, Port, Tile, SlvIdx, MstrIdx;
+
+			if(h == 0U) {
+				Hop->Loc = Req->SrcLoc;
+				Hop->Slave = Req->SrcPort;
+				Hop->SlvPortNum = Req->SrcPortNum;
+			} else {
+				u32 NCol, NRow;
+
+				_XAie_StrmRouteChDecode(R, Path[h - 1U], &Col,
+						&Row, &Dir, &Port);
+				_XAie_StrmRouteNeighbour(R, Col, Row, Dir,
+						&NCol, &NRow);
+				Hop->Loc = XAie_TileLoc((u8)NCol, (u8)NRow);
+				Hop->Slave = (StrmSwPortType)(SOUTH +
+						(Dir ^ 2U));
+				Hop->SlvPortNum = (u8)Port;
+			}
+
+			if(h == R->PathLen[i]) {
+				Hop->Master = Req->DstPort;
+				Hop->MstrPortNum = Req->DstPortNum;
+			} else {
+				_XAie_StrmRouteChDecode(R, Path[h], &Col, &Row,
+						&Dir, &Port);
+				Hop->Master = (StrmSwPortType)(SOUTH + Dir);
+				Hop->MstrPortNum = (u8)Port;
+			}
+
+			RC = XAie_StrmSwLogicalToPhysicalPort(DevInst,
+					Hop->Loc, XAIE_STRMSW_SLAVE, Hop->Slave,
+					Hop->SlvPortNum, &Hop->SlvPhyPortId);
+			if(RC == XAIE_OK) {
+				RC = XAie_StrmSwLogicalToPhysicalPort(DevInst,
+					Hop->Loc, XAIE_STRMSW_MASTER,
+					Hop->Master, Hop->MstrPortNum,
+					&Hop->MstrPhyPortId);
+			}
+			if(RC != XAIE_OK) {
+				break;
+			}
+
+			if(Req->Mode != XAIE_SS_ROUTE_PACKET) {
+				continue;
+			}
+
+			Tile = Hop->Loc.Col * R->NumRows + Hop->Loc.Row;
+			SlvIdx = (Tile * SS_PORT_TYPE_MAX + Hop->Slave) *
+				R->MaxAnyPorts + Hop->SlvPortNum;
+			MstrIdx = (Tile * SS_PORT_TYPE_MAX + Hop->Master) *
+				R->MaxAnyPorts + Hop->MstrPortNum;
+
+			if(Slots[SlvIdx] >= R->Mods[Tile]->NumSlaveSlots) {
+				XAIE_ERROR("Route %d: no free slave slot in tile (%d, %d)\n",
+						i, Hop->Loc.Col, Hop->Loc.Row);
+				RC = XAIE_ERR_STREAM_PORT;
+				break;
+			}
+			Hop->Slot = Slots[SlvIdx]++;
+
+			if(Arbs[MstrIdx] == XAIE_SS_ROUTE_UNASSIGNED) {
+				if(NumMstrs[Tile] >= XAIE_SS_ROUTE_NUM_ARBITORS *
+						XAIE_SS_ROUTE_NUM_MSELS) {
+					XAIE_ERROR("Route %d: no free arbitor in tile (%d, %d)\n",
+							i, Hop->Loc.Col,
+							Hop->Loc.Row);
+					RC = XAIE_ERR_STREAM_PORT;
+					break;
+				}
+				Arbs[MstrIdx] = NumMstrs[Tile]++;
+			}
+			Hop->Arbitor = Arbs[MstrIdx] % XAIE_SS_ROUTE_NUM_ARBITORS;
+			Hop->MSel = Arbs[MstrIdx] / XAIE_SS_ROUTE_NUM_ARBITORS;
+		}
+	}
+	Plan->HopStart[Plan->NumReqs] = Plan->NumHops;
+
+out:
+	free(Slots);
+	free(Arbs);
+	free(NumMstrs);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API computes the routes of a set of route requests over the stream
+* switch network of the partition. Circuit switched routes get exclusive use
+* of the ports connecting neighbouring tiles, packet switched routes share
+* them, one slave slot per route. Congestion is resolved by negotiation,
+* routes crossing overused ports are routed again with increasing cost of
+* the overused ports until the routes fit.
+*
+* @param	DevInst: Device Instance
+* @param	Reqs: Route requests, referenced by the plan until it is freed.
+* @param	NumReqs: Number of route requests
+* @param	Plan: Pointer to the plan to store the routes.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The packet ids of packet switched routes must be unique, and
+*		packet switched routes merging into the same destination port
+*		must use the same header drop setting. A circuit switched route
+*		can't share its end points with other routes. The plan must be freed with XAie_StrmRouteFree().
+*
+*******************************************************************************/
+AieRC XAie_StrmRouteCompute(XAie_DevInst *DevInst,
+		const XAie_StrmRouteReq *Reqs, u32 NumReqs,
+		XAie_StrmRoutePlan *Plan)
+{
+	AieRC RC;
+	XAie_StrmRouter R;
+
+	if((DevInst == XAIE_NULL) || (Reqs == XAIE_NULL) ||
+			(Plan == XAIE_NULL) || (NumReqs == 0U) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	memset(Plan, 0, sizeof(*Plan));
+	Plan->Reqs = Reqs;
+	Plan->NumReqs = NumReqs;
+
+	RC = _XAie_StrmRouterInit(DevInst, &R, NumReqs);
+	if(RC == XAIE_OK) {
+		RC = _XAie_StrmRouteValidate(&R, Reqs, NumReqs);
+	}
+
+	for(u32 It = 0U; (RC == XAIE_OK) && (It < XAIE_SS_ROUTE_MAX_ITERS);
+			It++) {
+		u32 NumOver = 0U;
+
+		for(u32 i = 0U; i < NumReqs; i++) {
+			if(It > 0U) {
+				if(_XAie_StrmRouteIsCongested(&R, i) ==
+						XAIE_DISABLE) {
+					continue;
+				}
+				_XAie_StrmRouteOccupy(&R, &Reqs[i], i,
+						XAIE_DISABLE);
+			}
+
+			RC = _XAie_StrmRouteSearch(&R, &Reqs[i], i);
+			if(RC != XAIE_OK) {
+				break;
+			}
+			_XAie_StrmRouteOccupy(&R, &Reqs[i], i, XAIE_ENABLE);
+		}
+		if(RC != XAIE_OK) {
+			break;
+		}
+
+		for(u32 Ch = 0U; Ch < R.NumChs; Ch++) {
+			if(R.Occ[Ch] > R.Cap[Ch]) {
+				R.Hist[Ch] += XAIE_SS_ROUTE_HIST_COST *
+					(R.Occ[Ch] - R.Cap[Ch]);
+				NumOver++;
+			}
+		}
+
+		Plan->NumIters = It + 1U;
+		if(NumOver == 0U) {
+			break;
+		}
+
+		if(It + 1U == XAIE_SS_ROUTE_MAX_ITERS) {
+			XAIE_ERROR("Unable to resolve congestion, %d ports overused\n",
+					NumOver);
+			RC = XAIE_ERR_STREAM_PORT;
+			break;
+		}
+
+		if(R.PresFac < XAIE_SS_ROUTE_MAX_PRES_FAC) {
+			R.PresFac *= 2U;
+		}
+	}
+
+	if(RC == XAIE_OK) {
+		RC = _XAie_StrmRouteBuildPlan(DevInst, &R, Plan);
+	}
+
+	_XAie_StrmRouterFinish(&R, NumReqs);
+	if(RC != XAIE_OK) {
+		XAie_StrmRouteFree(Plan);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API configures the stream switches of all the routes of a plan. If the
+* backend supports transactions and no transaction is in progress, all the
+* register writes are submitted as one transaction.
+*
+* @param	DevInst: Device Instance
+* @param	Plan: Route plan computed by XAie_StrmRouteCompute().
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Packet switched routes match the full packet id.
+*
+*******************************************************************************/
+AieRC XAie_StrmRouteApply(XAie_DevInst *DevInst,
+		const XAie_StrmRoutePlan *Plan)
+{
+	AieRC RC = XAIE_OK;
+	u8 Txn = XAIE_DISABLE;
+
+	if((DevInst == XAIE_NULL) || (Plan == XAIE_NULL) ||
+			(Plan->Hops == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((DevInst->Backend->Ops.SubmitTxn != NULL) &&
+			(DevInst->TxnList.Next == NULL)) {
+		if(XAie_StartTransaction(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH) == XAIE_OK) {
+			Txn = XAIE_ENABLE;
+		}
+	}
+
+	for(u32 i = 0U; (i < Plan->NumReqs) && (RC == XAIE_OK); i++) {
+		const XAie_StrmRouteReq *Req = &Plan->Reqs[i];
+
+		for(u32 h = Plan->HopStart[i]; h < Plan->HopStart[i + 1U];
+				h++) {
+			const XAie_StrmRouteHop *Hop = &Plan->Hops[h];
+			XAie_StrmSwPktHeader DropHeader;
+
+			if(Req->Mode == XAIE_SS_ROUTE_CIRCUIT) {
+				RC = XAie_StrmConnCctEnable(DevInst, Hop->Loc,
+						Hop->Slave, Hop->SlvPortNum,
+						Hop->Master, Hop->MstrPortNum);
+				if(RC != XAIE_OK) {
+					break;
+				}
+				continue;
+			}
+
+			DropHeader = XAIE_SS_PKT_DONOT_DROP_HEADER;
+			if(h + 1U == Plan->HopStart[i + 1U]) {
+				DropHeader = Req->DropHeader;
+			}
+
+			RC = XAie_StrmPktSwSlavePortEnable(DevInst, Hop->Loc,
+					Hop->Slave, Hop->SlvPortNum);
+			if(RC == XAIE_OK) {
+				RC = XAie_StrmPktSwSlaveSlotEnable(DevInst,
+						Hop->Loc, Hop->Slave,
+						Hop->SlvPortNum, Hop->Slot,
+						Req->Pkt,
+						XAIE_SS_ROUTE_PKT_MASK,
+						Hop->MSel, Hop->Arbitor);
+			}
+			if(RC == XAIE_OK) {
+				RC = XAie_StrmPktSwMstrPortEnable(DevInst,
+						Hop->Loc, Hop->Master,
+						Hop->MstrPortNum, DropHeader,
+						Hop->Arbitor,
+						1U << Hop->MSel);
+			}
+			if(RC != XAIE_OK) {
+				break;
+			}
+		}
+
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to configure route %d\n", i);
+		}
+	}
+
+	if(Txn == XAIE_ENABLE) {
+		AieRC TxnRC = XAie_SubmitTransaction(DevInst, NULL);
+
+		if(RC == XAIE_OK) {
+			RC = TxnRC;
+		}
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API frees the memory of a route plan.
+*
+* @param	Plan: Route plan
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAie_StrmRouteFree(XAie_StrmRoutePlan *Plan)
+{
+	if(Plan == XAIE_NULL) {
+		return;
+	}
+
+	free(Plan->Hops);
+	free(Plan->HopStart);
+	Plan->Hops = XAIE_NULL;
+	Plan->HopStart = XAIE_NULL;
+	Plan->NumHops = 0U;
+}
+
+#endif /* XAIE_FEATURE_SS_ENABLE */
+/** @} */
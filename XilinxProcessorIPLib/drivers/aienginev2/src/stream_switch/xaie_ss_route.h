@@ -0,0 +1,95 @@
+/******************************************************************************
+* Copyright (C) 2021 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_ss_route.h
+* @{
+*
+* Header file for the stream switch route planner.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0   dc      10/31/2021  Initial creation
+* </pre>
+*
+******************************************************************************/
+#ifndef XAIESS_ROUTE_H
+#define XAIESS_ROUTE_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+#include "xaie_ss.h"
+
+/**************************** Type Definitions *******************************/
+/* Typedef to capture the stream switch mode of a route */
+typedef enum {
+	XAIE_SS_ROUTE_CIRCUIT,
+	XAIE_SS_ROUTE_PACKET,
+	XAIE_SS_ROUTE_MODE_MAX
+} XAie_StrmRouteMode;
+
+/*
+ * Typedef to capture a route request. The route starts at a slave port of the
+ * source tile stream switch, e.g. a DMA MM2S channel, and ends at a master
+ * port of the destination tile stream switch, e.g. a DMA S2MM channel. Ports
+ * connecting stream switches of neighbouring tiles are owned by the router
+ * and can't be used as route end points.
+ */
+typedef struct {
+	XAie_LocType SrcLoc;		/* Location of the source tile */
+	StrmSwPortType SrcPort;		/* Source slave port type */
+	u8 SrcPortNum;			/* Source slave port number */
+	XAie_LocType DstLoc;		/* Location of the destination tile */
+	StrmSwPortType DstPort;		/* Destination master port type */
+	u8 DstPortNum;			/* Destination master port number */
+	XAie_StrmRouteMode Mode;	/* Circuit or packet switched */
+	XAie_Packet Pkt;		/* Packet id and type, packet mode only */
+	XAie_StrmSwPktHeader DropHeader; /* Header drop at destination port,
+					    packet mode only */
+} XAie_StrmRouteReq;
+
+/* Typedef to capture the stream switch configuration of a route in a tile */
+typedef struct {
+	XAie_LocType Loc;		/* Location of the tile */
+	StrmSwPortType Slave;		/* Slave port type */
+	u8 SlvPortNum;			/* Slave port number */
+	u8 SlvPhyPortId;		/* Slave physical port id */
+	StrmSwPortType Master;		/* Master port type */
+	u8 MstrPortNum;			/* Master port number */
+	u8 MstrPhyPortId;		/* Master physical port id */
+	u8 Slot;			/* Slave slot, packet mode only */
+	u8 Arbitor;			/* Arbitor, packet mode only */
+	u8 MSel;			/* Master select, packet mode only */
+} XAie_StrmRouteHop;
+
+/*
+ * Typedef to capture a computed set of routes. The hops of route i are
+ * Hops[HopStart[i]] to Hops[HopStart[i + 1] - 1], ordered from the source
+ * tile to the destination tile.
+ */
+typedef struct {
+	const XAie_StrmRouteReq *Reqs;	/* Route requests */
+	u32 NumReqs;			/* Number of route requests */
+	XAie_StrmRouteHop *Hops;	/* Hops of all routes */
+	u32 *HopStart;			/* Index of first hop of each route */
+	u32 NumHops;			/* Total number of hops */
+	u32 NumIters;			/* Negotiation iterations used */
+} XAie_StrmRoutePlan;
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_StrmRouteCompute(XAie_DevInst *DevInst,
+		const XAie_StrmRouteReq *Reqs, u32 NumReqs,
+		XAie_StrmRoutePlan *Plan);
+AieRC XAie_StrmRouteApply(XAie_DevInst *DevInst,
+		const XAie_StrmRoutePlan *Plan);
+void XAie_StrmRouteFree(XAie_StrmRoutePlan *Plan);
+
+#endif		/* end of protection macro */
+/** @} */
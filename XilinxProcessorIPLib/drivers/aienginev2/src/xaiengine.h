@@ -9,6 +9,7 @@ extern "C" {
 #endif
 
 #include <xaiengine/xaie_clock.h>
+#include <xaiengine/xaie_context.h>
 #include <xaiengine/xaie_core.h>
 #include <xaiengine/xaie_dma.h>
 #include <xaiengine/xaie_elfloader.h>
@@ -21,6 +22,7 @@ extern "C" {
 #include <xaiengine/xaie_reset.h>
 #include <xaiengine/xaie_rsc.h>
 #include <xaiengine/xaie_ss.h>
+#include <xaiengine/xaie_ss_route.h>
 #include <xaiengine/xaie_timer.h>
 #include <xaiengine/xaie_trace.h>
 #include <xaiengine/xaiegbl.h>
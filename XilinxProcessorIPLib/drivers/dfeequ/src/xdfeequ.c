@@ -27,6 +27,7 @@
 *       dc     05/08/21 Update to common trigger
 * 1.1   dc     05/26/21 Update CFG_SHIFT calculation
 *       dc     07/13/21 Update to common latency requirements
+*       dc     10/31/21 Relaxed writes of the coefficient set buffer
 *
 * </pre>
 *
@@ -109,6 +110,25 @@ u32 XDfeEqu_ReadReg(const XDfeEqu *InstancePtr, u32 AddrOffset)
 	return metal_io_read32(InstancePtr->Io, (unsigned long)AddrOffset);
 }
 
+/****************************************************************************/
+/**
+*
+* Writes value to register in an Equalizer instance without ordering it
+* against the other register accesses. A metal_io_fence() is to be issued
+* after a batch of these writes.
+*
+* @param    InstancePtr is a pointer to the XDfeEqu instance.
+* @param    AddrOffset is address offset relative to instance base address.
+* @param    Data is value to be written.
+*
+****************************************************************************/
+static void XDfeEqu_WriteRegRelaxed(const XDfeEqu *InstancePtr, u32 AddrOffset,
+				    u32 Data)
+{
+	metal_io_write32_relaxed(InstancePtr->Io, (unsigned long)AddrOffset,
+				 Data);
+}
+
 /****************************************************************************/
 /**
 *
@@ -238,16 +258,19 @@ static void XDfeEqu_LoadRealCoefficients(const XDfeEqu *InstancePtr,
 	/* Write the co-efficient set buffer with the following information */
 	Offset = XDFEEQU_COEFFICIENT_SET;
 	for (Index = 0; Index < NumValues; Index++) {
-		XDfeEqu_WriteReg(InstancePtr, Offset,
-				 (u32)(EqCoeffs->Coefficients[Index]));
+		XDfeEqu_WriteRegRelaxed(InstancePtr, Offset,
+					(u32)(EqCoeffs->Coefficients[Index]));
 		Offset += (u32)sizeof(u32);
 	}
 	Offset = XDFEEQU_SET_TO_WRITE_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, EqCoeffs->Set);
+	XDfeEqu_WriteRegRelaxed(InstancePtr, Offset, EqCoeffs->Set);
 	Offset = XDFEEQU_NUMBER_OF_UNITS_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, EqCoeffs->NUnits);
+	XDfeEqu_WriteRegRelaxed(InstancePtr, Offset, EqCoeffs->NUnits);
 	Offset = XDFEEQU_SHIFT_VALUE_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, Shift);
+	XDfeEqu_WriteRegRelaxed(InstancePtr, Offset, Shift);
+
+	/* The relaxed writes complete before the load is triggered */
+	metal_io_fence();
 
 	/* Set the Channel_Field register (0x010C) with the value in
 	   Channel_Field. This initiates the write of the co-efficients. */
@@ -288,9 +311,9 @@ XDfeEqu_LoadComplexCoefficients(const XDfeEqu *InstancePtr, u32 ChannelField,
 	/* Write the co-efficient set buffer with the following information */
 	Offset = XDFEEQU_COEFFICIENT_SET;
 	for (Index = 0; Index < NumValues; Index++) {
-		XDfeEqu_WriteReg(InstancePtr, Offset,
-				 (u32)(EqCoeffs->Coefficients[Index]));
-		XDfeEqu_WriteReg(
+		XDfeEqu_WriteRegRelaxed(InstancePtr, Offset,
+					(u32)(EqCoeffs->Coefficients[Index]));
+		XDfeEqu_WriteRegRelaxed(
 			InstancePtr,
 			Offset + (XDFEEQU_IM_COEFFICIENT_SET_OFFSET *
 				  sizeof(u32)),
@@ -298,11 +321,14 @@ XDfeEqu_LoadComplexCoefficients(const XDfeEqu *InstancePtr, u32 ChannelField,
 		Offset += (u32)sizeof(u32);
 	}
 	Offset = XDFEEQU_SET_TO_WRITE_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, EqCoeffs->Set);
+	XDfeEqu_WriteRegRelaxed(InstancePtr, Offset, EqCoeffs->Set);
 	Offset = XDFEEQU_NUMBER_OF_UNITS_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, EqCoeffs->NUnits);
+	XDfeEqu_WriteRegRelaxed(InstancePtr, Offset, EqCoeffs->NUnits);
 	Offset = XDFEEQU_SHIFT_VALUE_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, Shift);
+	XDfeEqu_WriteRegRelaxed(InstancePtr, Offset, Shift);
+
+	/* The relaxed writes complete before the load is triggered */
+	metal_io_fence();
 
 	/* Set the Channel_Field register (0x010C) with the value in
 	   Channel_Field. This initiates the write of the co-efficients. */
@@ -327,21 +353,25 @@ XDfeEqu_LoadComplexCoefficients(const XDfeEqu *InstancePtr, u32 ChannelField,
 	/* Write the co-efficient set buffer with the following information */
 	Offset = XDFEEQU_COEFFICIENT_SET;
 	for (Index = 0; Index < NumValues; Index++) {
-		XDfeEqu_WriteReg(
+		XDfeEqu_WriteRegRelaxed(
 			InstancePtr, Offset,
 			(u32)(-EqCoeffs->Coefficients[Index + NumValues]));
-		XDfeEqu_WriteReg(InstancePtr,
-				 Offset + (XDFEEQU_IM_COEFFICIENT_SET_OFFSET *
-					   sizeof(u32)),
-				 (u32)(EqCoeffs->Coefficients[Index]));
+		XDfeEqu_WriteRegRelaxed(
+			InstancePtr,
+			Offset + (XDFEEQU_IM_COEFFICIENT_SET_OFFSET *
+				  sizeof(u32)),
+			(u32)(EqCoeffs->Coefficients[Index]));
 		Offset += (u32)sizeof(u32);
 	}
 	Offset = XDFEEQU_SET_TO_WRITE_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, EqCoeffs->Set + 1U);
+	XDfeEqu_WriteRegRelaxed(InstancePtr, Offset, EqCoeffs->Set + 1U);
 	Offset = XDFEEQU_NUMBER_OF_UNITS_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, EqCoeffs->NUnits);
+	XDfeEqu_WriteRegRelaxed(InstancePtr, Offset, EqCoeffs->NUnits);
 	Offset = XDFEEQU_SHIFT_VALUE_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, Shift);
+	XDfeEqu_WriteRegRelaxed(InstancePtr, Offset, Shift);
+
+	/* The relaxed writes complete before the load is triggered */
+	metal_io_fence();
 
 	/* Set the Channel_Field register (0x010C) with the value in
 	   Channel_Field. This initiates the write of the co-efficients. */
@@ -380,9 +410,9 @@ static void XDfeEqu_LoadMatrixCoefficients(const XDfeEqu *InstancePtr,
 	/* Write the co-efficient set buffer with the following information */
 	Offset = XDFEEQU_COEFFICIENT_SET;
 	for (Index = 0; Index < NumValues; Index++) {
-		XDfeEqu_WriteReg(InstancePtr, Offset,
-				 (u32)(EqCoeffs->Coefficients[Index]));
-		XDfeEqu_WriteReg(
+		XDfeEqu_WriteRegRelaxed(InstancePtr, Offset,
+					(u32)(EqCoeffs->Coefficients[Index]));
+		XDfeEqu_WriteRegRelaxed(
 			InstancePtr,
 			Offset + (XDFEEQU_IM_COEFFICIENT_SET_OFFSET *
 				  sizeof(u32)),
@@ -390,11 +420,14 @@ static void XDfeEqu_LoadMatrixCoefficients(const XDfeEqu *InstancePtr,
 		Offset += (u32)sizeof(u32);
 	}
 	Offset = XDFEEQU_SET_TO_WRITE_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, EqCoeffs->Set);
+	XDfeEqu_WriteRegRelaxed(InstancePtr, Offset, EqCoeffs->Set);
 	Offset = XDFEEQU_NUMBER_OF_UNITS_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, EqCoeffs->NUnits);
+	XDfeEqu_WriteRegRelaxed(InstancePtr, Offset, EqCoeffs->NUnits);
 	Offset = XDFEEQU_SHIFT_VALUE_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, Shift);
+	XDfeEqu_WriteRegRelaxed(InstancePtr, Offset, Shift);
+
+	/* The relaxed writes complete before the load is triggered */
+	metal_io_fence();
 
 	/* Set the Channel_Field register (0x010C) with the value in
 	   Channel_Field. This initiates the write of the co-efficients. */
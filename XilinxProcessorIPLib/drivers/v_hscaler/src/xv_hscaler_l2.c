@@ -30,6 +30,7 @@
 *       rco   02/09/17   Fix c++ compilation warnings
 *	jsr   09/07/18 Fix for 64-bit driver support
 * 3.3   vsa   04/07/20   Improve quality with better coefficient tables
+* 3.4   dc    10/25/21   Generate coefficients for the exact scaling ratio
 * </pre>
 *
 ******************************************************************************/
@@ -53,18 +54,6 @@
 static const int STEP_PRECISION_SHIFT = 16;
 static const u64 XHSC_MASK_LOW_32BITS = ((u64)1<<32)-1;
 
-extern const short XV_hscaler_Lanczos2_taps6[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_TAPS_6];
-extern const short XV_hscaler_fixedcoeff_taps6_ScalingRatio1p2[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_TAPS_6];
-extern const short XV_hscaler_fixedcoeff_taps6_ScalingRatio2[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_TAPS_6];
-extern const short XV_hscaler_fixedcoeff_taps6_ScalingRatio3[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_TAPS_6];
-extern const short XV_hscaler_fixedcoeff_taps6_ScalingRatio4[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_TAPS_6];
-extern const short XV_hscaler_fixedcoeff_taps8_ScalingRatio2[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_TAPS_8];
-extern const short XV_hscaler_fixedcoeff_taps8_ScalingRatio3[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_TAPS_8];
-extern const short XV_hscaler_fixedcoeff_taps8_ScalingRatio4[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_TAPS_8];
-extern const short XV_hscaler_fixedcoeff_taps10_ScalingRatio3[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_TAPS_10];
-extern const short XV_hscaler_fixedcoeff_taps10_ScalingRatio4[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_TAPS_10];
-extern const short XV_hscaler_fixedcoeff_taps12_ScalingRatio4[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_TAPS_12];
-
 /************************** Function Prototypes ******************************/
 static void XV_HScalerSelectCoeff(XV_Hscaler_l2 *InstancePtr,
                                   u32 WidthIn,
@@ -135,9 +124,9 @@ void XV_HScalerStop(XV_Hscaler_l2 *InstancePtr)
 
 /*****************************************************************************/
 /**
-* This function determines the internal coeffiecient table to be used based on
-* scaling ratio and loads the filter coefficients in the scaler coefficient
-* storage.
+* This function generates the filter coefficients for the scaling ratio and
+* loads them in the scaler coefficient storage. Generation is skipped when the
+* storage already holds the coefficients of the same ratio.
 *
 * @param  InstancePtr is a pointer to the core instance to be worked on.
 * @param  WidthIn is the input stream width
@@ -150,10 +139,8 @@ static void XV_HScalerSelectCoeff(XV_Hscaler_l2 *InstancePtr,
                                   u32 WidthIn,
                                   u32 WidthOut)
 {
-  const short *coeff;
+  short coeff[XV_HSCALER_MAX_H_PHASES*XV_HSCALER_MAX_H_TAPS];
   u16 numTaps, numPhases;
-  u16 ScalingRatio;
-  u16 IsScaleDown;
 
   /*
    * validate input arguments
@@ -161,90 +148,20 @@ static void XV_HScalerSelectCoeff(XV_Hscaler_l2 *InstancePtr,
   Xil_AssertVoid(InstancePtr != NULL);
 
   numPhases = (1<<InstancePtr->Hsc.Config.PhaseShift);
+  numTaps = InstancePtr->Hsc.Config.NumTaps;
 
-  IsScaleDown = (WidthOut < WidthIn);
-
-  /* Scale Down Mode will use dynamic filter selection logic
-   * Scale Up Mode (including 1:1) will always use 6 tap filter
-   */
-  if(IsScaleDown)
+  /* Coefficients depend on the ratio only */
+  if((InstancePtr->CoeffWidthIn != 0) &&
+     ((InstancePtr->CoeffWidthIn * WidthOut) ==
+      (InstancePtr->CoeffWidthOut * WidthIn)))
   {
-    ScalingRatio = ((WidthIn * 10)/WidthOut);
-
-    switch(InstancePtr->Hsc.Config.NumTaps)
-    {
-      case XV_HSCALER_TAPS_6:
-		if (ScalingRatio > 35) {// > 3.5
-			coeff = &XV_hscaler_fixedcoeff_taps6_ScalingRatio4[0][0];
-			numTaps = XV_HSCALER_TAPS_6;
-		} else if (ScalingRatio > 25) {//2.6 < Ratio <= 3.5
-			coeff = &XV_hscaler_fixedcoeff_taps6_ScalingRatio3[0][0];
-			numTaps = XV_HSCALER_TAPS_6;
-		} else if (ScalingRatio > 15) {//1.6 < Ratio <= 2.5
-			coeff = &XV_hscaler_fixedcoeff_taps6_ScalingRatio2[0][0];
-			numTaps = XV_HSCALER_TAPS_6;
-		} else {// <= 1.5
-			coeff = &XV_hscaler_fixedcoeff_taps6_ScalingRatio1p2[0][0];
-			numTaps = XV_HSCALER_TAPS_6;
-		}
-           break;
-
-      case XV_HSCALER_TAPS_8:
-		if (ScalingRatio > 35) {// > 3.5
-			coeff = &XV_hscaler_fixedcoeff_taps8_ScalingRatio4[0][0];
-			numTaps = XV_HSCALER_TAPS_8;
-		} else if (ScalingRatio > 25) {//2.6 < Ratio <= 3.5
-			coeff = &XV_hscaler_fixedcoeff_taps8_ScalingRatio3[0][0];
-			numTaps = XV_HSCALER_TAPS_8;
-		} else if (ScalingRatio > 15) {//1.6 < Ratio <= 2.5
-			coeff = &XV_hscaler_fixedcoeff_taps8_ScalingRatio2[0][0];
-			numTaps = XV_HSCALER_TAPS_8;
-		} else {// <= 1.5
-			coeff = &XV_hscaler_fixedcoeff_taps6_ScalingRatio1p2[0][0];
-			numTaps = XV_HSCALER_TAPS_6;
-		}
-           break;
-
-      case XV_HSCALER_TAPS_10:
-		if (ScalingRatio > 35) {// > 3.5
-			coeff = &XV_hscaler_fixedcoeff_taps10_ScalingRatio4[0][0];
-			numTaps = XV_HSCALER_TAPS_10;
-		} else if (ScalingRatio > 25) {//2.6 < Ratio <= 3.5
-			coeff = &XV_hscaler_fixedcoeff_taps10_ScalingRatio3[0][0];
-			numTaps = XV_HSCALER_TAPS_10;
-		} else if (ScalingRatio > 15) {//1.6 < Ratio <= 2.5
-			coeff = &XV_hscaler_fixedcoeff_taps8_ScalingRatio2[0][0];
-			numTaps = XV_HSCALER_TAPS_8;
-		} else {// <= 1.5
-			coeff = &XV_hscaler_fixedcoeff_taps6_ScalingRatio1p2[0][0];
-			numTaps = XV_HSCALER_TAPS_6;
-		}
-           break;
-
-      case XV_HSCALER_TAPS_12:
-		if (ScalingRatio > 35) {// > 3.5
-			coeff = &XV_hscaler_fixedcoeff_taps12_ScalingRatio4[0][0];
-			numTaps = XV_HSCALER_TAPS_12;
-		} else if (ScalingRatio > 25) {//2.6 < Ratio <= 3.5
-			coeff = &XV_hscaler_fixedcoeff_taps10_ScalingRatio3[0][0];
-			numTaps = XV_HSCALER_TAPS_10;
-		} else if (ScalingRatio > 15) {//1.6 < Ratio <= 2.5
-			coeff = &XV_hscaler_fixedcoeff_taps8_ScalingRatio2[0][0];
-			numTaps = XV_HSCALER_TAPS_8;
-		} else {// <= 1.5
-			coeff = &XV_hscaler_fixedcoeff_taps6_ScalingRatio1p2[0][0];
-			numTaps = XV_HSCALER_TAPS_6;
-		}
-           break;
-
-      default:
-          return;
-    }
+    return;
   }
-  else //Scale Up
+
+  if(XVidC_PolyphaseGenCoeff(WidthIn, WidthOut, numPhases, numTaps,
+                             coeff) != XST_SUCCESS)
   {
-	coeff = &XV_hscaler_Lanczos2_taps6[0][0];
-	numTaps = XV_HSCALER_TAPS_6;
+    return;
   }
 
   XV_HScalerLoadExtCoeff(InstancePtr,
@@ -254,6 +171,8 @@ static void XV_HScalerSelectCoeff(XV_Hscaler_l2 *InstancePtr,
 
   /* Disable use of external coefficients */
   InstancePtr->UseExtCoeff = FALSE;
+  InstancePtr->CoeffWidthIn = WidthIn;
+  InstancePtr->CoeffWidthOut = WidthOut;
 }
 
 /*****************************************************************************/
@@ -328,6 +247,8 @@ void XV_HScalerLoadExtCoeff(XV_Hscaler_l2 *InstancePtr,
 
   /* Enable use of external coefficients */
   InstancePtr->UseExtCoeff = TRUE;
+  InstancePtr->CoeffWidthIn = 0;
+  InstancePtr->CoeffWidthOut = 0;
 }
 
 /*****************************************************************************/
@@ -70,6 +70,7 @@
 *       dmc   12/17/15   Add macro to query the Is422Enabled flag that was
 *                        added to the XV_hscaler_Config structure
 * 3.0   mpe   04/28/16   Added optional color format conversion handling
+* 3.4   dc    10/25/21   Added ratio of generated coefficients to instance
 * </pre>
 *
 ******************************************************************************/
@@ -81,6 +82,7 @@ extern "C" {
 #endif
 
 #include "xvidc.h"
+#include "xvidc_polyphase.h"
 #include "xv_hscaler.h"
 
 /************************** Constant Definitions *****************************/
@@ -124,6 +126,8 @@ typedef struct
   XV_hscaler Hsc; /*<< Layer 1 instance */
   u8 UseExtCoeff;
   short coeff[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_MAX_H_TAPS];
+  u32 CoeffWidthIn;  /*<< Scaling ratio of generated coefficients */
+  u32 CoeffWidthOut;
   u64 phasesH[XV_HSCALER_MAX_LINE_WIDTH];
   u64 phasesH_H[XV_HSCALER_MAX_LINE_WIDTH];
 }XV_Hscaler_l2;
@@ -0,0 +1,239 @@
+/******************************************************************************
+* Copyright (C) 2021 Xilinx, Inc.	All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xv_multi_scaler_coeff_example.c
+*
+* This example reports the quality and the cost of the generated polyphase
+* filter coefficients.
+*
+*	1) For each supported tap count and a set of scaling ratios, the
+*	coefficients are generated and the frequency response of the filter
+*	is evaluated. The generation time, the passband gain at half the
+*	output Nyquist frequency and the worst stopband gain above 1.5 times
+*	the output Nyquist frequency are printed.
+*	2) All channels of the core are reconfigured with a rotating set of
+*	scaling ratios, first with an empty coefficient cache and then with a
+*	warm one, and the time per channel configuration and the cache
+*	statistics are printed.
+*
+* The core is only programmed, it is not started.
+*
+******************************************************************************/
+
+#include <math.h>
+#include <string.h>
+#include "xil_printf.h"
+#include "xparameters.h"
+#include "xtime_l.h"
+#include "xvidc_polyphase.h"
+#include "xv_multi_scaler_l2.h"
+
+#define XMS_COEFF_NUM_RATIOS 6
+#define XMS_COEFF_NUM_FREQS 256
+#define XMS_COEFF_ITERATIONS 16
+#define XMS_COEFF_SRC_BUF 0x10000000
+#define XMS_COEFF_DST_BUF 0x20000000
+
+typedef struct {
+	u32 In;
+	u32 Out;
+} XMS_Coeff_Ratio;
+
+static const XMS_Coeff_Ratio Ratios[XMS_COEFF_NUM_RATIOS] = {
+	{ 1, 1 }, { 2, 3 }, { 3, 2 }, { 2, 1 }, { 3, 1 }, { 4, 1 }
+};
+
+static XV_multi_scaler MultiScalerInst;
+static short Coeff[XV_MULTISCALER_MAX_V_PHASES * XV_MULTISCALER_MAX_V_TAPS];
+
+/*****************************************************************************/
+/**
+* This function evaluates the filter response and returns the passband and
+* stopband gains in tenths of a dB.
+*
+* @param	Coeff is the coefficient table, phase major.
+* @param	NumPhases is the number of phases.
+* @param	NumTaps is the number of taps.
+* @param	Cutoff is the output Nyquist frequency in cycles per input
+*		sample.
+* @param	Pass is a pointer to store the passband gain.
+* @param	Stop is a pointer to store the worst stopband gain.
+*
+* @return None
+*
+******************************************************************************/
+static void XMS_CoeffResponse(const short *Coeff, u32 NumPhases, u32 NumTaps,
+	double Cutoff, int *Pass, int *Stop)
+{
+	double Freq;
+	double Re;
+	double Im;
+	double X;
+	double Gain;
+	double Dc = 0;
+	double Worst = 0;
+	u32 p;
+	u32 k;
+	u32 f;
+
+	for (p = 0; p < NumPhases * NumTaps; p++)
+		Dc += Coeff[p];
+
+	for (f = 0; f <= XMS_COEFF_NUM_FREQS; f++) {
+		if (f == 0)
+			Freq = Cutoff * 0.5;
+		else
+			Freq = Cutoff * 1.5 + (f - 1) *
+				(NumPhases * 0.5 - Cutoff * 1.5) /
+				XMS_COEFF_NUM_FREQS;
+		Re = 0;
+		Im = 0;
+		for (p = 0; p < NumPhases; p++) {
+			for (k = 0; k < NumTaps; k++) {
+				X = (double)k - (NumTaps / 2 - 1) -
+					(double)p / NumPhases;
+				Re += Coeff[p * NumTaps + k] *
+					cos(2 * M_PI * Freq * X);
+				Im += Coeff[p * NumTaps + k] *
+					sin(2 * M_PI * Freq * X);
+			}
+		}
+		Gain = sqrt(Re * Re + Im * Im) / Dc;
+		if (f == 0)
+			*Pass = (int)(200 * log10(Gain));
+		else if (Gain > Worst)
+			Worst = Gain;
+	}
+
+	*Stop = (int)(200 * log10(Worst + 1e-9));
+}
+
+/*****************************************************************************/
+/**
+* This function prints the generation time and the response of the generated
+* coefficients for all supported tap counts and scaling ratios.
+*
+* @return None
+*
+******************************************************************************/
+static void XMS_CoeffQuality(void)
+{
+	XTime Start;
+	XTime End;
+	double Cutoff;
+	int Pass;
+	int Stop;
+	u32 Taps;
+	u32 r;
+	u32 n;
+
+	xil_printf("taps ratio   gen(us)  pass/stop(dB/10)\r\n");
+	for (Taps = 6; Taps <= 12; Taps += 2) {
+		for (r = 0; r < XMS_COEFF_NUM_RATIOS; r++) {
+			XTime_GetTime(&Start);
+			for (n = 0; n < XMS_COEFF_ITERATIONS; n++)
+				XVidC_PolyphaseGenCoeff(Ratios[r].In,
+					Ratios[r].Out,
+					XV_MULTISCALER_MAX_V_PHASES, Taps,
+					Coeff);
+			XTime_GetTime(&End);
+
+			Cutoff = (Ratios[r].Out < Ratios[r].In) ?
+				0.5 * Ratios[r].Out / Ratios[r].In : 0.5;
+			XMS_CoeffResponse(Coeff, XV_MULTISCALER_MAX_V_PHASES,
+				Taps, Cutoff, &Pass, &Stop);
+
+			xil_printf("%4d %2d:%-2d %8d  %5d/%-5d\r\n",
+				Taps, Ratios[r].In, Ratios[r].Out,
+				(u32)(((End - Start) * 1000000) /
+				(COUNTS_PER_SECOND * XMS_COEFF_ITERATIONS)),
+				Pass, Stop);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function reconfigures all channels of the core with a rotating set of
+* scaling ratios and returns the time per channel configuration.
+*
+* @param	MultiScalerPtr is a pointer to the core instance.
+*
+* @return	Time per channel configuration in microseconds.
+*
+******************************************************************************/
+static u32 XMS_CoeffReconfigure(XV_multi_scaler *MultiScalerPtr)
+{
+	XV_multi_scaler_Video_Config Cfg;
+	XTime Start;
+	XTime End;
+	u32 Base = MultiScalerPtr->MaxCols / 16;
+	u32 Rounds;
+	u32 Ch;
+	u32 r;
+
+	memset(&Cfg, 0, sizeof(Cfg));
+	Cfg.ColorFormatIn = XV_MULTI_SCALER_RGB8;
+	Cfg.ColorFormatOut = XV_MULTI_SCALER_RGB8;
+	Cfg.SrcImgBuf0 = XMS_COEFF_SRC_BUF;
+	Cfg.SrcImgBuf1 = XMS_COEFF_SRC_BUF;
+	Cfg.DstImgBuf0 = XMS_COEFF_DST_BUF;
+	Cfg.DstImgBuf1 = XMS_COEFF_DST_BUF;
+
+	XTime_GetTime(&Start);
+	for (Rounds = 0; Rounds < XMS_COEFF_ITERATIONS; Rounds++) {
+		for (Ch = 0; Ch < MultiScalerPtr->MaxOuts; Ch++) {
+			r = (Ch + Rounds) % XMS_COEFF_NUM_RATIOS;
+			Cfg.ChannelId = Ch;
+			Cfg.WidthIn = Base * 4 * Ratios[r].In;
+			Cfg.WidthOut = Base * 4 * Ratios[r].Out;
+			Cfg.HeightIn = Cfg.WidthIn / 4;
+			Cfg.HeightOut = Cfg.WidthOut / 4;
+			Cfg.InStride = Cfg.WidthIn * 3;
+			Cfg.OutStride = Cfg.WidthOut * 3;
+			XV_MultiScalerSetChannelConfig(MultiScalerPtr, &Cfg);
+		}
+	}
+	XTime_GetTime(&End);
+
+	return (u32)(((End - Start) * 1000000) / (COUNTS_PER_SECOND *
+		XMS_COEFF_ITERATIONS * MultiScalerPtr->MaxOuts));
+}
+
+int main(void)
+{
+	XV_multi_scaler *MultiScalerPtr = &MultiScalerInst;
+	u32 Hits;
+	u32 Misses;
+	u32 Us;
+
+	xil_printf("\r\n--- Multi Scaler coefficient example ---\r\n");
+
+	XMS_CoeffQuality();
+
+	if (XV_multi_scaler_Initialize(MultiScalerPtr,
+		XPAR_V_MULTI_SCALER_0_DEVICE_ID) != XST_SUCCESS) {
+		xil_printf("ERR:: Multi Scaler init failed\r\n");
+		return XST_FAILURE;
+	}
+
+	XV_MultiScalerFlushCoeffCache(MultiScalerPtr);
+	Us = XMS_CoeffReconfigure(MultiScalerPtr);
+	XV_MultiScalerGetCoeffCacheStats(MultiScalerPtr, &Hits, &Misses);
+	xil_printf("Cold cache: %d us per channel, %d hits, %d misses\r\n",
+		Us, Hits, Misses);
+
+	Us = XMS_CoeffReconfigure(MultiScalerPtr);
+	XV_MultiScalerGetCoeffCacheStats(MultiScalerPtr, &Hits, &Misses);
+	xil_printf("Warm cache: %d us per channel, %d hits, %d misses\r\n",
+		Us, Hits, Misses);
+
+	xil_printf("Successfully ran Multi Scaler coefficient example\r\n");
+
+	return XST_SUCCESS;
+}
@@ -25,6 +25,13 @@ int XV_multi_scaler_CfgInitialize(XV_multi_scaler *InstancePtr,
 	InstancePtr->ScaleMode = ConfigPtr->ScaleMode;
 	InstancePtr->NumTaps = ConfigPtr->NumTaps;
 	InstancePtr->MaxOuts = ConfigPtr->MaxOuts;
+	for (i = 0; i < XV_MULTISCALER_COEFF_CACHE_SIZE; i++) {
+		InstancePtr->CoeffCache.Entry[i].NumTaps = 0;
+		InstancePtr->CoeffCache.Entry[i].LastUse = 0;
+	}
+	InstancePtr->CoeffCache.UseCount = 0;
+	InstancePtr->CoeffCache.Hits = 0;
+	InstancePtr->CoeffCache.Misses = 0;
 	return XST_SUCCESS;
 }
 #endif
@@ -90,6 +90,37 @@ typedef struct {
 extern XV_multi_scaler_Config XV_multi_scaler_ConfigTable[];
 #endif
 
+#define XV_MULTISCALER_MAX_V_TAPS 12
+#define XV_MULTISCALER_MAX_V_PHASES 64
+/* Number of scaling ratios for which generated coefficients are kept */
+#ifndef XV_MULTISCALER_COEFF_CACHE_SIZE
+#define XV_MULTISCALER_COEFF_CACHE_SIZE 8
+#endif
+
+/*
+ * Generated coefficients for one scaling ratio, packed two taps per word in
+ * the order of the core coefficient memory.
+ */
+typedef struct {
+    u32 RatioIn;
+    u32 RatioOut;
+    u16 NumPhases;
+    u16 NumTaps;
+    u32 LastUse;
+    u32 Coeff[XV_MULTISCALER_MAX_V_PHASES * XV_MULTISCALER_MAX_V_TAPS / 2];
+} XV_multi_scaler_Coeff_Entry;
+
+/*
+ * Least recently used cache of generated coefficients shared by the channels
+ * of one instance.
+ */
+typedef struct {
+    XV_multi_scaler_Coeff_Entry Entry[XV_MULTISCALER_COEFF_CACHE_SIZE];
+    u32 UseCount;
+    u32 Hits;
+    u32 Misses;
+} XV_multi_scaler_Coeff_Cache;
+
 typedef void (*XVMultiScaler_Callback)(void *CallbackRef);
 typedef struct {
     u32 Ctrl_BaseAddress;
@@ -105,6 +136,7 @@ typedef struct {
     XVMultiScaler_Callback FrameDoneCallback;
     void *CallbackRef;
     u8 OutBitMask;
+    XV_multi_scaler_Coeff_Cache CoeffCache;
 } XV_multi_scaler;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -20,6 +20,7 @@
 /***************************** Include Files *********************************/
 #include "xv_multi_scaler_l2.h"
 #include "xvidc.h"
+#include "xvidc_polyphase.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -264,6 +265,11 @@ static const void (*XV_MS_Set_DstImgBuf1[XV_MAX_OUTS])(XV_multi_scaler
 /************************** Function Prototypes ******************************/
 static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
 				   XV_multi_scaler_Video_Config *MS_cfg);
+static const XV_multi_scaler_Coeff_Entry *XV_MultiScalerGetCoeff(
+	XV_multi_scaler_Coeff_Cache *Cache, u32 SizeIn, u32 SizeOut,
+	u16 NumPhases, u16 NumTaps);
+static void XV_MultiScalerWriteCoeff(u32 BaseAddr,
+	const XV_multi_scaler_Coeff_Entry *Entry);
 
 /*****************************************************************************/
 /**
@@ -344,11 +350,13 @@ void XV_MultiScalerSetNumOutputs(XV_multi_scaler *InstancePtr, u32 NumOuts)
 
 /*****************************************************************************/
 /**
-* This function programs the computed filter coefficients and phase data into
-* core registers
+* This function loads the vertical and horizontal filter coefficients of a
+* channel. Coefficients are generated for the exact scaling ratios and tap
+* count of the core and are taken from the coefficient cache when the ratio
+* was used before.
 *
 * @param	MscPtr is a pointer to the core instance to be worked on.
-* @param	NumOut is the output channel number.
+* @param	MS_cfg is a pointer to the channel configuration.
 *
 * @return None
 *
@@ -356,140 +364,171 @@ void XV_MultiScalerSetNumOutputs(XV_multi_scaler *InstancePtr, u32 NumOuts)
 static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
 		XV_multi_scaler_Video_Config *MS_cfg)
 {
-	u32 num_phases = 1<<MscPtr->PhaseShift;
-	u32 num_taps	= MscPtr->NumTaps/2;
-	u32 val;
-	u32 i;
-	u32 j;
-	u32 baseAddr;
-	short *coeff;
-	u32 vfltcoef_offset;
-	u32 hfltcoef_offset;
-	float scale;
-
-	scale = (float)MS_cfg->HeightIn / MS_cfg->HeightOut;
-	if ((scale >= 2) && (scale < 2.5))
-	{
-		if(MscPtr->NumTaps == 6)
-			coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-		else
-			coeff = &XV_multiscaler_fixedcoeff_taps8_12C[0][0];
-	}
-	if ((scale >= 2.5) && (scale < 3))
-	{
-		if(MscPtr->NumTaps >= 10)
-			coeff = &XV_multiscaler_fixedcoeff_taps10_12C[0][0];
-		else
-		{
-			if(MscPtr->NumTaps == 6)
-				coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-			else
-				coeff = &XV_multiscaler_fixedcoeff_taps8_8C[0][0];
-		}
-	}
+	const XV_multi_scaler_Coeff_Entry *Entry;
+	u16 NumPhases = 1 << MscPtr->PhaseShift;
+	u32 HeightIn = MS_cfg->HeightIn;
+	u32 WidthIn = MS_cfg->WidthIn;
+	u32 BaseAddr;
 
-	if ((scale >= 3) && (scale < 3.5))
-		if(MscPtr->NumTaps == 12)
-			coeff = &XV_multiscaler_fixedcoeff_taps12_12C[0][0];
-		else
-		{
-			if(MscPtr->NumTaps == 6)
-				coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-			if(MscPtr->NumTaps == 8)
-				coeff = &XV_multiscaler_fixedcoeff_taps8_8C[0][0];
-			if(MscPtr->NumTaps == 10)
-				coeff = &XV_multiscaler_fixedcoeff_taps10_10C[0][0];
-		}
-
-	if ((scale >= 3.5) || (scale < 2 && scale >= 1))
-	{
-		if(MscPtr->NumTaps == 6)
-			coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-		if(MscPtr->NumTaps == 8)
-			coeff = &XV_multiscaler_fixedcoeff_taps8_8C[0][0];
-		if(MscPtr->NumTaps == 10)
-			coeff = &XV_multiscaler_fixedcoeff_taps10_10C[0][0];
-		if(MscPtr->NumTaps == 12)
-			coeff = &XV_multiscaler_fixedcoeff_taps12_12C[0][0];
+	if (MS_cfg->CropWin.Crop) {
+		HeightIn = MS_cfg->CropWin.Height;
+		WidthIn = MS_cfg->CropWin.Width;
 	}
-	if(scale < 1)
-		coeff = &XV_multiscaler_fixedcoeff_taps6_12C[0][0];
 
-	vfltcoef_offset = XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_VFLTCOEFF_0_BASE +
-		MS_cfg->ChannelId *
+	BaseAddr = MscPtr->Ctrl_BaseAddress + MS_cfg->ChannelId *
 		XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_FLTCOEFF_OFFSET;
 
-	baseAddr = MscPtr->Ctrl_BaseAddress + vfltcoef_offset;
-	for (i = 0; i < num_phases; i++) {
-		for (j = 0; j < XV_MULTISCALER_TAPS_12; j = j + 2) {
-			val = (coeff[i * XV_MULTISCALER_TAPS_12 + (j + 1)] << 16) |
-				(coeff[i * XV_MULTISCALER_TAPS_12 + j] & 0x0000FFFF);
-			XV_multi_scaler_WriteReg(baseAddr,
-					((i * num_taps + j / 2) * 4), val);
-		}
-	}
+	Entry = XV_MultiScalerGetCoeff(&MscPtr->CoeffCache, HeightIn,
+		MS_cfg->HeightOut, NumPhases, MscPtr->NumTaps);
+	if (Entry != NULL)
+		XV_MultiScalerWriteCoeff(BaseAddr +
+			XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_VFLTCOEFF_0_BASE,
+			Entry);
+
+	Entry = XV_MultiScalerGetCoeff(&MscPtr->CoeffCache, WidthIn,
+		MS_cfg->WidthOut, NumPhases, MscPtr->NumTaps);
+	if (Entry != NULL)
+		XV_MultiScalerWriteCoeff(BaseAddr +
+			XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_HFLTCOEFF_0_BASE,
+			Entry);
+}
+
+/*****************************************************************************/
+/**
+* This function returns the coefficients for a scaling ratio from the
+* coefficient cache of an instance. On a miss, the least recently used entry
+* is replaced with newly generated coefficients.
+*
+* @param	Cache is a pointer to the coefficient cache of the instance.
+* @param	SizeIn is the input width or height.
+* @param	SizeOut is the output width or height.
+* @param	NumPhases is the number of phases of the core.
+* @param	NumTaps is the number of taps of the core.
+*
+* @return	Pointer to the cache entry, or NULL if a size is zero or the
+*		phase or tap count is not supported.
+*
+******************************************************************************/
+static const XV_multi_scaler_Coeff_Entry *XV_MultiScalerGetCoeff(
+	XV_multi_scaler_Coeff_Cache *Cache, u32 SizeIn, u32 SizeOut,
+	u16 NumPhases, u16 NumTaps)
+{
+	XV_multi_scaler_Coeff_Entry *Entry;
+	XV_multi_scaler_Coeff_Entry *Victim;
+	short Coeff[XV_MULTISCALER_MAX_V_PHASES * XV_MULTISCALER_MAX_V_TAPS];
+	u32 RatioIn = SizeIn;
+	u32 RatioOut = SizeOut;
+	u32 Rem;
+	u32 i;
+
+	if ((SizeIn == 0) || (SizeOut == 0) ||
+		(NumPhases > XV_MULTISCALER_MAX_V_PHASES) ||
+		(NumTaps > XV_MULTISCALER_MAX_V_TAPS))
+		return NULL;
 
-	scale = (float)MS_cfg->WidthIn / MS_cfg->WidthOut;
-	if ((scale >= 2) && (scale < 2.5))
-	{
-		if(MscPtr->NumTaps == 6)
-			coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-		else
-			coeff = &XV_multiscaler_fixedcoeff_taps8_12C[0][0];
+	/* Ratios which reduce to the same fraction share coefficients */
+	while (RatioOut != 0) {
+		Rem = RatioIn % RatioOut;
+		RatioIn = RatioOut;
+		RatioOut = Rem;
 	}
-	if ((scale >= 2.5) && (scale < 3))
-	{
-		if(MscPtr->NumTaps >= 10)
-			coeff = &XV_multiscaler_fixedcoeff_taps10_12C[0][0];
-		else
-		{
-			if(MscPtr->NumTaps == 6)
-				coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-			else
-				coeff = &XV_multiscaler_fixedcoeff_taps8_8C[0][0];
+	RatioOut = SizeOut / RatioIn;
+	RatioIn = SizeIn / RatioIn;
+
+	Cache->UseCount++;
+	Victim = &Cache->Entry[0];
+	for (i = 0; i < XV_MULTISCALER_COEFF_CACHE_SIZE; i++) {
+		Entry = &Cache->Entry[i];
+		if ((Entry->NumTaps == NumTaps) &&
+			(Entry->NumPhases == NumPhases) &&
+			(Entry->RatioIn == RatioIn) &&
+			(Entry->RatioOut == RatioOut)) {
+			Entry->LastUse = Cache->UseCount;
+			Cache->Hits++;
+			return Entry;
 		}
+		if (Entry->LastUse < Victim->LastUse)
+			Victim = Entry;
 	}
 
-	if ((scale >= 3) && (scale < 3.5))
-		if(MscPtr->NumTaps == 12)
-			coeff = &XV_multiscaler_fixedcoeff_taps12_12C[0][0];
-		else
-		{
-			if(MscPtr->NumTaps == 6)
-				coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-			if(MscPtr->NumTaps == 8)
-				coeff = &XV_multiscaler_fixedcoeff_taps8_8C[0][0];
-			if(MscPtr->NumTaps == 10)
-				coeff = &XV_multiscaler_fixedcoeff_taps10_10C[0][0];
-		}
+	if (XVidC_PolyphaseGenCoeff(RatioIn, RatioOut, NumPhases, NumTaps,
+		Coeff) != XST_SUCCESS)
+		return NULL;
 
-	if ((scale >= 3.5) || (scale < 2 && scale >= 1))
-	{
-		if(MscPtr->NumTaps == 6)
-			coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-		if(MscPtr->NumTaps == 8)
-			coeff = &XV_multiscaler_fixedcoeff_taps8_8C[0][0];
-		if(MscPtr->NumTaps == 10)
-			coeff = &XV_multiscaler_fixedcoeff_taps10_10C[0][0];
-		if(MscPtr->NumTaps == 12)
-			coeff = &XV_multiscaler_fixedcoeff_taps12_12C[0][0];
-	}
-	if(scale < 1)
-		coeff = &XV_multiscaler_fixedcoeff_taps6_12C[0][0];
+	for (i = 0; i < (u32)(NumPhases * NumTaps); i = i + 2)
+		Victim->Coeff[i / 2] = ((u32)(u16)Coeff[i + 1] << 16) |
+			(Coeff[i] & XVSC_MASK_LOW_16BITS);
 
-	hfltcoef_offset = XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_HFLTCOEFF_0_BASE +
-		MS_cfg->ChannelId *
-		XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_FLTCOEFF_OFFSET;
+	Victim->RatioIn = RatioIn;
+	Victim->RatioOut = RatioOut;
+	Victim->NumPhases = NumPhases;
+	Victim->NumTaps = NumTaps;
+	Victim->LastUse = Cache->UseCount;
+	Cache->Misses++;
 
-	baseAddr = MscPtr->Ctrl_BaseAddress + hfltcoef_offset;
-	for (i = 0; i < num_phases; i++) {
-		for (j = 0; j < XV_MULTISCALER_TAPS_12; j = j + 2) {
-			val = (coeff[i * XV_MULTISCALER_TAPS_12 + (j + 1)] << 16) |
-				(coeff[i * XV_MULTISCALER_TAPS_12 + j] & 0x0000FFFF);
-			XV_multi_scaler_WriteReg(baseAddr,
-					((i * num_taps + j / 2) * 4), val);
-		}
-	}
+	return Victim;
+}
+
+/*****************************************************************************/
+/**
+* This function copies a cache entry into a coefficient memory of the core.
+*
+* @param	BaseAddr is the address of the coefficient memory.
+* @param	Entry is the cache entry to write.
+*
+* @return None
+*
+******************************************************************************/
+static void XV_MultiScalerWriteCoeff(u32 BaseAddr,
+	const XV_multi_scaler_Coeff_Entry *Entry)
+{
+	u32 NumWords = (Entry->NumPhases * Entry->NumTaps) / 2;
+	const u32 *Src = Entry->Coeff;
+	u32 i;
+
+	for (i = 0; i < NumWords; i++)
+		XV_multi_scaler_WriteReg(BaseAddr, (i * 4), Src[i]);
+}
+
+/*****************************************************************************/
+/**
+* This function returns the hit and miss counts of the coefficient cache of an
+* instance.
+*
+* @param	InstancePtr is a pointer to the core instance to be worked on.
+* @param	Hits is a pointer to store the number of cache hits.
+* @param	Misses is a pointer to store the number of generated tables.
+*
+* @return None
+*
+******************************************************************************/
+void XV_MultiScalerGetCoeffCacheStats(XV_multi_scaler *InstancePtr,
+	u32 *Hits, u32 *Misses)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(Hits != NULL);
+	Xil_AssertVoid(Misses != NULL);
+
+	*Hits = InstancePtr->CoeffCache.Hits;
+	*Misses = InstancePtr->CoeffCache.Misses;
+}
+
+/*****************************************************************************/
+/**
+* This function empties the coefficient cache of an instance and clears its
+* statistics, so that the coefficients of the next configuration are generated
+* again.
+*
+* @param	InstancePtr is a pointer to the core instance to be worked on.
+*
+* @return None
+*
+******************************************************************************/
+void XV_MultiScalerFlushCoeffCache(XV_multi_scaler *InstancePtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	memset(&InstancePtr->CoeffCache, 0, sizeof(InstancePtr->CoeffCache));
 }
 
 /*****************************************************************************/
@@ -44,8 +44,6 @@ extern "C" {
 #include "xv_multi_scaler.h"
 
 /************************** Constant Definitions *****************************/
-#define XV_MULTISCALER_MAX_V_TAPS 12
-#define XV_MULTISCALER_MAX_V_PHASES 64
 #define XV_MULTISCALER_OUTPUT_MASK 0xFF
 #define XV_MAX_BYTES_PER_PIXEL 4
 #define XV_MAX_BUF_SIZE XPAR_XV_MULTI_SCALER_0_MAX_COLS * \
@@ -123,29 +121,6 @@ typedef struct {
 	XV_multi_scaler_Crop_Window CropWin;
 } XV_multi_scaler_Video_Config;
 
-/*extern const short XV_multiscaler_fixedcoeff_taps6[XV_MULTISCALER_MAX_V_PHASES]
-	[XV_MULTISCALER_TAPS_12];
-extern const short XV_multiscaler_fixedcoeff_taps8[XV_MULTISCALER_MAX_V_PHASES]
-	[XV_MULTISCALER_TAPS_12];
-extern const short XV_multiscaler_fixedcoeff_taps10[XV_MULTISCALER_MAX_V_PHASES]
-	[XV_MULTISCALER_TAPS_12];
-extern const short XV_multiscaler_fixedcoeff_taps12[XV_MULTISCALER_MAX_V_PHASES]
-	[XV_MULTISCALER_TAPS_12];*/
-extern const short XV_multiscaler_fixedcoeff_taps6_6C[XV_MULTISCALER_MAX_V_PHASES]
-	[XV_MULTISCALER_TAPS_6];
-extern const short XV_multiscaler_fixedcoeff_taps6_12C[XV_MULTISCALER_MAX_V_PHASES]
-	[XV_MULTISCALER_TAPS_12];
-extern const short XV_multiscaler_fixedcoeff_taps8_8C[XV_MULTISCALER_MAX_V_PHASES]
-	[XV_MULTISCALER_TAPS_8];
-extern const short XV_multiscaler_fixedcoeff_taps8_12C[XV_MULTISCALER_MAX_V_PHASES]
-	[XV_MULTISCALER_TAPS_12];
-extern const short XV_multiscaler_fixedcoeff_taps10_10C[XV_MULTISCALER_MAX_V_PHASES]
-	[XV_MULTISCALER_TAPS_10];
-extern const short XV_multiscaler_fixedcoeff_taps10_12C[XV_MULTISCALER_MAX_V_PHASES]
-	[XV_MULTISCALER_TAPS_12];
-extern const short XV_multiscaler_fixedcoeff_taps12_12C[XV_MULTISCALER_MAX_V_PHASES]
-	[XV_MULTISCALER_TAPS_12];
-
 /************************** Function Prototypes ******************************/
 void XV_MultiScalerStart(XV_multi_scaler *InstancePtr);
 void XV_MultiScalerStop(XV_multi_scaler *InstancePtr);
@@ -155,6 +130,9 @@ void XV_MultiScalerGetChannelConfig(XV_multi_scaler  *InstancePtr,
 	XV_multi_scaler_Video_Config *multi_scaler_cfg);
 void XV_MultiScalerSetChannelConfig(XV_multi_scaler  *InstancePtr,
 	XV_multi_scaler_Video_Config *multi_scaler_cfg);
+void XV_MultiScalerGetCoeffCacheStats(XV_multi_scaler *InstancePtr,
+	u32 *Hits, u32 *Misses);
+void XV_MultiScalerFlushCoeffCache(XV_multi_scaler *InstancePtr);
 
 #ifdef __cplusplus
 }
@@ -27,6 +27,7 @@
 *       rco   02/09/17   Fix c++ compilation warnings
 *	jsr   09/07/18 Fix for 64-bit driver support
 * 3.1   vsa   04/07/20   Improve quality with new coefficients
+* 3.2   dc    10/25/21   Generate coefficients for the exact scaling ratio
 *
 * </pre>
 *
@@ -46,17 +47,6 @@
 /**************************** Type Definitions *******************************/
 
 /**************************** Local Global *******************************/
-extern const short XV_vscaler_Lanczos2_taps6[XV_VSCALER_MAX_V_PHASES][XV_VSCALER_TAPS_6];
-extern const short XV_vscaler_fixedcoeff_taps6_ScalingRatio1p2[XV_VSCALER_MAX_V_PHASES][XV_VSCALER_TAPS_6];
-extern const short XV_vscaler_fixedcoeff_taps6_ScalingRatio2[XV_VSCALER_MAX_V_PHASES][XV_VSCALER_TAPS_6];
-extern const short XV_vscaler_fixedcoeff_taps6_ScalingRatio3[XV_VSCALER_MAX_V_PHASES][XV_VSCALER_TAPS_6];
-extern const short XV_vscaler_fixedcoeff_taps6_ScalingRatio4[XV_VSCALER_MAX_V_PHASES][XV_VSCALER_TAPS_6];
-extern const short XV_vscaler_fixedcoeff_taps8_ScalingRatio2[XV_VSCALER_MAX_V_PHASES][XV_VSCALER_TAPS_8];
-extern const short XV_vscaler_fixedcoeff_taps8_ScalingRatio3[XV_VSCALER_MAX_V_PHASES][XV_VSCALER_TAPS_8];
-extern const short XV_vscaler_fixedcoeff_taps8_ScalingRatio4[XV_VSCALER_MAX_V_PHASES][XV_VSCALER_TAPS_8];
-extern const short XV_vscaler_fixedcoeff_taps10_ScalingRatio3[XV_VSCALER_MAX_V_PHASES][XV_VSCALER_TAPS_10];
-extern const short XV_vscaler_fixedcoeff_taps10_ScalingRatio4[XV_VSCALER_MAX_V_PHASES][XV_VSCALER_TAPS_10];
-extern const short XV_vscaler_fixedcoeff_taps12_ScalingRatio4[XV_VSCALER_MAX_V_PHASES][XV_VSCALER_TAPS_12];
 
 /************************** Function Prototypes ******************************/
 static void XV_VScalerSelectCoeff(XV_Vscaler_l2 *InstancePtr,
@@ -123,12 +113,13 @@ void XV_VScalerStop(XV_Vscaler_l2 *InstancePtr)
 
 /*****************************************************************************/
 /**
-* This function loads default filter coefficients in the scaler coefficient
-* storage based on the selected TAP configuration
+* This function generates the filter coefficients for the scaling ratio and
+* loads them in the scaler coefficient storage. Generation is skipped when the
+* storage already holds the coefficients of the same ratio.
 *
 * @param  InstancePtr is a pointer to the core instance to be worked on.
-* @param  WidthIn is the input stream height
-* @param  Widthout is the output stream height
+* @param  HeightIn is the input stream height
+* @param  HeightOut is the output stream height
 
 * @return None
 *
@@ -137,100 +128,29 @@ static void XV_VScalerSelectCoeff(XV_Vscaler_l2 *InstancePtr,
 		                          u32 HeightIn,
 		                          u32 HeightOut)
 {
-  const short *coeff;
+  short coeff[XV_VSCALER_MAX_V_PHASES*XV_VSCALER_MAX_V_TAPS];
   u16 numTaps, numPhases;
-  u16 ScalingRatio;
-  u16 IsScaleDown;
 
   /*
-   * validates input arguments
+   * validate input arguments
    */
   Xil_AssertVoid(InstancePtr != NULL);
 
   numPhases = (1<<InstancePtr->Vsc.Config.PhaseShift);
+  numTaps = InstancePtr->Vsc.Config.NumTaps;
 
-  IsScaleDown = (HeightOut < HeightIn);
-  /* Scale Down Mode will use dynamic filter selection logic
-   * Scale Up Mode (including 1:1) will always use 6 tap filter
-   */
-  if(IsScaleDown)
+  /* Coefficients depend on the ratio only */
+  if((InstancePtr->CoeffHeightIn != 0) &&
+     ((InstancePtr->CoeffHeightIn * HeightOut) ==
+      (InstancePtr->CoeffHeightOut * HeightIn)))
   {
-    ScalingRatio = ((HeightIn * 10)/HeightOut);
-
-    switch(InstancePtr->Vsc.Config.NumTaps)
-    {
-	case XV_VSCALER_TAPS_6:
-		if (ScalingRatio > 35) {// > 3.5
-			coeff = &XV_vscaler_fixedcoeff_taps6_ScalingRatio4[0][0];
-			numTaps = XV_VSCALER_TAPS_6;
-		} else if (ScalingRatio > 25) {//2.6 < Ratio <= 3.5
-			coeff = &XV_vscaler_fixedcoeff_taps6_ScalingRatio3[0][0];
-			numTaps = XV_VSCALER_TAPS_6;
-		} else if (ScalingRatio > 15) {//1.6 < Ratio <= 2.5
-			coeff = &XV_vscaler_fixedcoeff_taps6_ScalingRatio2[0][0];
-			numTaps = XV_VSCALER_TAPS_6;
-		} else {// <= 1.5
-			coeff = &XV_vscaler_fixedcoeff_taps6_ScalingRatio1p2[0][0];
-			numTaps = XV_VSCALER_TAPS_6;
-		}
-	break;
-
-	case XV_VSCALER_TAPS_8:
-		if (ScalingRatio > 35) {// > 3.5
-			coeff = &XV_vscaler_fixedcoeff_taps8_ScalingRatio4[0][0];
-			numTaps = XV_VSCALER_TAPS_8;
-		} else if (ScalingRatio > 25) {//2.6 < Ratio <= 3.5
-			coeff = &XV_vscaler_fixedcoeff_taps8_ScalingRatio3[0][0];
-			numTaps = XV_VSCALER_TAPS_8;
-		} else if (ScalingRatio > 15) {//1.6 < Ratio <= 2.5
-			coeff = &XV_vscaler_fixedcoeff_taps8_ScalingRatio2[0][0];
-			numTaps = XV_VSCALER_TAPS_8;
-		} else {// <= 1.5
-			coeff = &XV_vscaler_fixedcoeff_taps6_ScalingRatio1p2[0][0];
-			numTaps = XV_VSCALER_TAPS_6;
-		}
-	break;
-
-	case XV_VSCALER_TAPS_10:
-		if (ScalingRatio > 35) {// > 3.5
-			coeff = &XV_vscaler_fixedcoeff_taps10_ScalingRatio4[0][0];
-			numTaps = XV_VSCALER_TAPS_10;
-		} else if (ScalingRatio > 25) {//2.6 < Ratio <= 3.5
-			coeff = &XV_vscaler_fixedcoeff_taps10_ScalingRatio3[0][0];
-			numTaps = XV_VSCALER_TAPS_10;
-		} else if (ScalingRatio > 15) {//1.6 < Ratio <= 2.5
-			coeff = &XV_vscaler_fixedcoeff_taps8_ScalingRatio2[0][0];
-			numTaps = XV_VSCALER_TAPS_8;
-		} else {// <= 1.5
-			coeff = &XV_vscaler_fixedcoeff_taps6_ScalingRatio1p2[0][0];
-			numTaps = XV_VSCALER_TAPS_6;
-		}
-	break;
-
-	case XV_VSCALER_TAPS_12:
-		if (ScalingRatio > 35) {// > 3.5
-			coeff = &XV_vscaler_fixedcoeff_taps12_ScalingRatio4[0][0];
-			numTaps = XV_VSCALER_TAPS_12;
-		} else if (ScalingRatio > 25) {//2.6 < Ratio <= 3.5
-			coeff = &XV_vscaler_fixedcoeff_taps10_ScalingRatio3[0][0];
-			numTaps = XV_VSCALER_TAPS_10;
-		} else if (ScalingRatio > 15) {//1.6 < Ratio <= 2.5
-			coeff = &XV_vscaler_fixedcoeff_taps8_ScalingRatio2[0][0];
-			numTaps = XV_VSCALER_TAPS_8;
-		} else {// <= 1.5
-			coeff = &XV_vscaler_fixedcoeff_taps6_ScalingRatio1p2[0][0];
-			numTaps = XV_VSCALER_TAPS_6;
-		}
-	break;
-
-	default:
-		return;
-	}
+    return;
   }
-  else //Scale Up
+
+  if(XVidC_PolyphaseGenCoeff(HeightIn, HeightOut, numPhases, numTaps,
+                             coeff) != XST_SUCCESS)
   {
-	coeff = &XV_vscaler_Lanczos2_taps6[0][0];
-	numTaps = XV_VSCALER_TAPS_6;
+    return;
   }
 
   XV_VScalerLoadExtCoeff(InstancePtr,
@@ -240,6 +160,8 @@ static void XV_VScalerSelectCoeff(XV_Vscaler_l2 *InstancePtr,
 
   /* Disable use of external coefficients */
   InstancePtr->UseExtCoeff = FALSE;
+  InstancePtr->CoeffHeightIn = HeightIn;
+  InstancePtr->CoeffHeightOut = HeightOut;
 }
 
 /*****************************************************************************/
@@ -314,6 +236,8 @@ void XV_VScalerLoadExtCoeff(XV_Vscaler_l2 *InstancePtr,
 
   /* Enable use of external coefficients */
   InstancePtr->UseExtCoeff = TRUE;
+  InstancePtr->CoeffHeightIn = 0;
+  InstancePtr->CoeffHeightOut = 0;
 }
 
 /*****************************************************************************/
@@ -69,6 +69,7 @@
 * 2.00  rco   11/05/15   Integrate layer-1 with layer-2
 * 3.0   mpe   04/28/16   Added optional color format conversion handling
 * 3.1   vsa   04/07/20   Improve quality with new coefficients
+* 3.2   dc    10/25/21   Added ratio of generated coefficients to instance
 *
 * </pre>
 *
@@ -81,6 +82,7 @@ extern "C" {
 #endif
 
 #include "xvidc.h"
+#include "xvidc_polyphase.h"
 #include "xv_vscaler.h"
 
 /************************** Constant Definitions *****************************/
@@ -124,6 +126,8 @@ typedef struct
   XV_vscaler Vsc; /*<< Layer 1 instance */
   u8 UseExtCoeff;
   short coeff[XV_VSCALER_MAX_V_PHASES][XV_VSCALER_MAX_V_TAPS];
+  u32 CoeffHeightIn;  /*<< Scaling ratio of generated coefficients */
+  u32 CoeffHeightOut;
 }XV_Vscaler_l2;
 
 /************************** Macros Definitions *******************************/
@@ -0,0 +1,203 @@
+/******************************************************************************
+* Copyright (C) 2021 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xwarp_desc_example.c
+*
+* This example measures the time taken to program the warp_init descriptors
+* of a frame for an arbitrary warp.
+*
+*	1) The descriptors are programmed one by one with
+*	XVWarpInit_ProgramDescriptor.
+*	2) All descriptors are programmed with one XVWarpInit_ProgramDescriptors
+*	call, each with its own copy of the configuration.
+*	3) All descriptors are programmed with one XVWarpInit_ProgramDescriptors
+*	call sharing a single configuration.
+*
+* The checksums of the programmed descriptors must be the same for all three
+* runs. The core is only programmed, it is not started.
+*
+* @note	Each arbitrary warp descriptor allocates its intermediate vectors
+*	from the heap, about 72KB for the 1280x720 mesh used here, so the heap
+*	of the application must be sized for
+*	3 x XWARP_DESC_NUM_DESC descriptors.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <string.h>
+#include "xil_printf.h"
+#include "xparameters.h"
+#include "xtime_l.h"
+#include "xv_warp_init_l2.h"
+
+/************************** Constant Definitions *****************************/
+#define XWARP_DESC_NUM_DESC		4
+#define XWARP_DESC_WIDTH		1280
+#define XWARP_DESC_HEIGHT		720
+#define XWARP_DESC_GRID_SIZE	8
+#define XWARP_DESC_NUM_PTS		(XWARP_DESC_GRID_SIZE + 1)
+
+/************************** Variable Definitions *****************************/
+static XV_warp_init WarpInitInst;
+static XVWarpInit_ArbParam_MeshInfo
+	Mesh[XWARP_DESC_NUM_PTS * XWARP_DESC_NUM_PTS];
+static XVWarpInit_InputConfigs Configs[XWARP_DESC_NUM_DESC];
+static XVWarpInit_InputConfigs *ConfigPtrs[XWARP_DESC_NUM_DESC];
+static u32 Checksum[XWARP_DESC_NUM_DESC];
+
+/*****************************************************************************/
+/**
+* This function fills the mesh with a pincushion like displacement of the
+* inner control points, within half of the distance between control points.
+*
+* @return None
+*
+******************************************************************************/
+static void XWarpDesc_FillMesh(void)
+{
+	XVWarpInit_ArbParam_MeshInfo *Pt;
+	s32 SegW = XWARP_DESC_WIDTH / XWARP_DESC_GRID_SIZE;
+	s32 SegH = XWARP_DESC_HEIGHT / XWARP_DESC_GRID_SIZE;
+	s32 Half = XWARP_DESC_GRID_SIZE / 2;
+	u32 x, y;
+
+	for (y = 0; y < XWARP_DESC_NUM_PTS; y++) {
+		for (x = 0; x < XWARP_DESC_NUM_PTS; x++) {
+			Pt = &Mesh[y * XWARP_DESC_NUM_PTS + x];
+			Pt->s_x = x * SegW;
+			Pt->s_y = y * SegH;
+			Pt->d_x = Pt->s_x;
+			Pt->d_y = Pt->s_y;
+			if (x && y && (x < XWARP_DESC_GRID_SIZE) &&
+					(y < XWARP_DESC_GRID_SIZE)) {
+				Pt->d_x += ((s32)x - Half) * SegW / (4 * Half);
+				Pt->d_y += ((s32)y - Half) * SegH / (4 * Half);
+			}
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function reads back the checksums of the programmed descriptors.
+*
+* @param	Match selects comparing against the saved checksums (1) or
+*		saving them (0).
+*
+* @return	XST_SUCCESS if the checksums were saved or match.
+*		XST_FAILURE otherwise.
+*
+******************************************************************************/
+static int XWarpDesc_Checksums(u8 Match)
+{
+	XVWarpInitVector_Hw_Aligned *DescPtr;
+	u32 i;
+
+	DescPtr = (XVWarpInitVector_Hw_Aligned *)
+		WarpInitInst.RemapVectorDesc_BaseAddr;
+	for (i = 0; i < XWARP_DESC_NUM_DESC; i++) {
+		if (Match && (Checksum[i] != DescPtr->driver_checksum))
+			return XST_FAILURE;
+		Checksum[i] = DescPtr->driver_checksum;
+		DescPtr = (XVWarpInitVector_Hw_Aligned *)DescPtr->remap_nextaddr;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function prints the time taken per descriptor.
+*
+* @param	Mode is the name of the run.
+* @param	Start is the timer value at the start of the run.
+* @param	End is the timer value at the end of the run.
+*
+* @return None
+*
+******************************************************************************/
+static void XWarpDesc_PrintTime(const char *Mode, XTime Start, XTime End)
+{
+	xil_printf("%s: %d us per descriptor\r\n", Mode,
+		(u32)(((End - Start) * 1000000) /
+		(COUNTS_PER_SECOND * XWARP_DESC_NUM_DESC)));
+}
+
+int main(void)
+{
+	XTime Start;
+	XTime End;
+	u32 i;
+
+	xil_printf("\r\n--- Warp init descriptor example ---\r\n");
+
+	if (XV_warp_init_Initialize(&WarpInitInst,
+			XPAR_V_WARP_INIT_0_DEVICE_ID) != XST_SUCCESS) {
+		xil_printf("Warp Initializer IP initialization failed.\r\n");
+		return XST_FAILURE;
+	}
+	if (XVWarpInit_SetNumOfDescriptors(&WarpInitInst,
+			XWARP_DESC_NUM_DESC) != XST_SUCCESS) {
+		xil_printf("Descriptor allocation failed.\r\n");
+		return XST_FAILURE;
+	}
+
+	XWarpDesc_FillMesh();
+	for (i = 0; i < XWARP_DESC_NUM_DESC; i++) {
+		memset(&Configs[i], 0, sizeof(Configs[i]));
+		Configs[i].width = XWARP_DESC_WIDTH;
+		Configs[i].height = XWARP_DESC_HEIGHT;
+		Configs[i].bytes_per_pixel = 3;
+		Configs[i].warp_type = DISTORTION_ARBITARY;
+		Configs[i].num_ctrl_pts = XWARP_DESC_GRID_SIZE;
+		Configs[i].ctr_pts = Mesh;
+		ConfigPtrs[i] = &Configs[i];
+	}
+
+	XTime_GetTime(&Start);
+	for (i = 0; i < XWARP_DESC_NUM_DESC; i++) {
+		if (XVWarpInit_ProgramDescriptor(&WarpInitInst, i,
+				&Configs[i]) != XST_SUCCESS)
+			goto FAIL;
+	}
+	XTime_GetTime(&End);
+	XWarpDesc_PrintTime("one by one  ", Start, End);
+	XWarpDesc_Checksums(0);
+
+	XTime_GetTime(&Start);
+	if (XVWarpInit_ProgramDescriptors(&WarpInitInst, 0,
+			XWARP_DESC_NUM_DESC, ConfigPtrs) != XST_SUCCESS)
+		goto FAIL;
+	XTime_GetTime(&End);
+	XWarpDesc_PrintTime("batch       ", Start, End);
+	if (XWarpDesc_Checksums(1) != XST_SUCCESS)
+		goto FAIL;
+
+	for (i = 0; i < XWARP_DESC_NUM_DESC; i++)
+		ConfigPtrs[i] = &Configs[0];
+
+	XTime_GetTime(&Start);
+	if (XVWarpInit_ProgramDescriptors(&WarpInitInst, 0,
+			XWARP_DESC_NUM_DESC, ConfigPtrs) != XST_SUCCESS)
+		goto FAIL;
+	XTime_GetTime(&End);
+	XWarpDesc_PrintTime("batch shared", Start, End);
+	if (XWarpDesc_Checksums(1) != XST_SUCCESS)
+		goto FAIL;
+
+	XVWarpInit_ClearNumOfDescriptors(&WarpInitInst);
+	xil_printf("Successfully ran warp init descriptor example\r\n");
+
+	return XST_SUCCESS;
+
+FAIL:
+	XVWarpInit_ClearNumOfDescriptors(&WarpInitInst);
+	xil_printf("Warp init descriptor example failed\r\n");
+
+	return XST_FAILURE;
+}
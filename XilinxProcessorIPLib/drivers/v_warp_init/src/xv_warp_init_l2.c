@@ -34,11 +34,14 @@ static void XVWarpInit_SetDescriptor(XVWarpInitVector_Hw_Aligned *descptr,
 		XVWarpInitVector_Hw *initvector_hw);
 static void XVWarpInit_AllocArbMem(XVWarpInit_ArbParam *arbitrary_param,
 		int grid_size, u16 fr_width, u16 fr_height);
+static void XVWarpInit_FreeArbMem(XVWarpInit_ArbParam *arbitrary_param);
 static int XVWarpInit_ParseMeshInfo(XVWarpInit_ArbParam *arbitrary_param,
 		XVWarpInit_ArbParam_MeshInfo *ctrl_pts,
 		short fr_width, short fr_height);
 static int XVWarpInit_ValidateInputConfigs(XV_warp_init *InstancePtr,
 		XVWarpInit_InputConfigs *ConfigPtr);
+static int XVWarpInit_CalcDescriptor(XV_warp_init *InstancePtr,
+		XVWarpInitVector_Hw *desc, XVWarpInit_InputConfigs *ConfigPtr);
 
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
@@ -146,58 +149,117 @@ void XVWarpInit_ClearNumOfDescriptors(XV_warp_init *InstancePtr)
 ******************************************************************************/
 int XVWarpInit_ProgramDescriptor(XV_warp_init *InstancePtr,
 		u32 Descnum, XVWarpInit_InputConfigs *ConfigPtr)
+{
+	return XVWarpInit_ProgramDescriptors(InstancePtr, Descnum, 1, &ConfigPtr);
+}
+
+/*****************************************************************************/
+/**
+* This function programs a range of consecutive descriptors in one call. The
+* descriptor list is walked once for the whole range, and consecutive entries
+* which point to the same input configuration share the calculated
+* descriptor, including the arbitrary warp buffers.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Descnum is the first descriptor number to be configured
+* @param  NumDesc is the number of descriptors to be configured
+* @param  ConfigPtr is the array of NumDesc input configuration pointers,
+* 					one per descriptor
+*
+* @return XST_SUCCESS if programming all descriptors is successful
+*         XST_FAILURE if the range or an input configuration is not valid.
+*         Descriptors before the failing one are left programmed.
+*
+******************************************************************************/
+int XVWarpInit_ProgramDescriptors(XV_warp_init *InstancePtr,
+		u32 Descnum, u32 NumDesc, XVWarpInit_InputConfigs **ConfigPtr)
 {
 	XVWarpInitVector_Hw desc;
-	XVWarpInit_ArbParam arbit_param;
 	XVWarpInitVector_Hw_Aligned *descptr;
+	u32 i;
 
 	Xil_AssertNonvoid(InstancePtr);
+	Xil_AssertNonvoid(ConfigPtr);
 
-	if (Descnum >= InstancePtr->NumDescriptors) {
+	if ((NumDesc == 0) || (Descnum >= InstancePtr->NumDescriptors) ||
+		(NumDesc > (InstancePtr->NumDescriptors - Descnum))) {
 		xil_printf("Wrong descriptor\n\r");
 		return XST_FAILURE;
 	}
 
-	if (XVWarpInit_ValidateInputConfigs(InstancePtr, ConfigPtr) != XST_SUCCESS)
-		return XST_FAILURE;
-
 	descptr = (XVWarpInitVector_Hw_Aligned *)InstancePtr->RemapVectorDesc_BaseAddr;
-	for (u32 i = 0; i < Descnum; i++) {
+	for (i = 0; i < Descnum; i++) {
 		descptr = (XVWarpInitVector_Hw_Aligned *)descptr->remap_nextaddr;
 	}
 
-	desc.width	= ConfigPtr->width;
-	desc.height	= ConfigPtr->height;
-	desc.bytes_per_pixel = ConfigPtr->bytes_per_pixel;
-	desc.warp_type = ConfigPtr->warp_type;
-	desc.filter_table_addr_0 = ConfigPtr->filter_table_addr_0;
-	desc.filter_table_addr_1 = ConfigPtr->filter_table_addr_1;
-	desc.width_Q4 = desc.width << REMAP_FIX_ACC;
-	desc.height_Q4 = desc.height << REMAP_FIX_ACC;
+	for (i = 0; i < NumDesc; i++) {
+		if ((i == 0) || (ConfigPtr[i] != ConfigPtr[i - 1])) {
+			if (XVWarpInit_CalcDescriptor(InstancePtr, &desc,
+					ConfigPtr[i]) != XST_SUCCESS)
+				return XST_FAILURE;
+		}
+
+		XVWarpInit_SetDescriptor(descptr, &desc);
+		descptr = (XVWarpInitVector_Hw_Aligned *)descptr->remap_nextaddr;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function calculates the descriptor contents for the given input
+* configurations.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  desc is the pointer to the descriptor data to be calculated
+* @param  ConfigPtr is the input configuration pointer
+*
+* @return XST_SUCCESS if the calculation is successful
+*         XST_FAILURE if input configurations are not valid.
+*
+******************************************************************************/
+static int XVWarpInit_CalcDescriptor(XV_warp_init *InstancePtr,
+		XVWarpInitVector_Hw *desc, XVWarpInit_InputConfigs *ConfigPtr)
+{
+	XVWarpInit_ArbParam arbit_param;
+
+	if (XVWarpInit_ValidateInputConfigs(InstancePtr, ConfigPtr) != XST_SUCCESS)
+		return XST_FAILURE;
 
-	if (desc.warp_type == DISTORTION_ARBITARY) {
+	desc->width	= ConfigPtr->width;
+	desc->height	= ConfigPtr->height;
+	desc->bytes_per_pixel = ConfigPtr->bytes_per_pixel;
+	desc->warp_type = ConfigPtr->warp_type;
+	desc->filter_table_addr_0 = ConfigPtr->filter_table_addr_0;
+	desc->filter_table_addr_1 = ConfigPtr->filter_table_addr_1;
+	desc->width_Q4 = desc->width << REMAP_FIX_ACC;
+	desc->height_Q4 = desc->height << REMAP_FIX_ACC;
+
+	if (desc->warp_type == DISTORTION_ARBITARY) {
 		XVWarpInit_AllocArbMem(&arbit_param, ConfigPtr->num_ctrl_pts,
-				desc.width, desc.height);
-		XVWarpInit_ParseMeshInfo(&arbit_param, ConfigPtr->ctr_pts,
-				desc.width, desc.height);
-		desc.src_ctrl_x_pts	= ((u64)arbit_param.src_ctrl_x_pts)/4;
-		desc.src_ctrl_y_pts	= ((u64)arbit_param.src_ctrl_y_pts)/4;
-		desc.src_tangents_x	= ((u64)arbit_param.src_tangents_x)/4;
-		desc.src_tangents_y	= ((u64)arbit_param.src_tangents_y)/4;
-		desc.interm_x			= ((u64)arbit_param.interm_x)/4;
-		desc.interm_y 		= ((u64)arbit_param.interm_y)/4;
-		desc.num_ctrl_pts 	= ConfigPtr->num_ctrl_pts;
+				desc->width, desc->height);
+		if (XVWarpInit_ParseMeshInfo(&arbit_param, ConfigPtr->ctr_pts,
+				desc->width, desc->height) != XST_SUCCESS) {
+			XVWarpInit_FreeArbMem(&arbit_param);
+			return XST_FAILURE;
+		}
+		desc->src_ctrl_x_pts	= ((u64)arbit_param.src_ctrl_x_pts)/4;
+		desc->src_ctrl_y_pts	= ((u64)arbit_param.src_ctrl_y_pts)/4;
+		desc->src_tangents_x	= ((u64)arbit_param.src_tangents_x)/4;
+		desc->src_tangents_y	= ((u64)arbit_param.src_tangents_y)/4;
+		desc->interm_x			= ((u64)arbit_param.interm_x)/4;
+		desc->interm_y 		= ((u64)arbit_param.interm_y)/4;
+		desc->num_ctrl_pts 	= ConfigPtr->num_ctrl_pts;
 
 		XVWarpInit_OnetimeCalcsArbt(&arbit_param,
-				desc.width, desc.height);
+				desc->width, desc->height);
 	} else {
-		desc.k_pre	= ConfigPtr->k_pre;
-		desc.k_post	= ConfigPtr->k_post;
-		XVWarpInit_OneTimeCalcs(&desc, ConfigPtr->h);
+		desc->k_pre	= ConfigPtr->k_pre;
+		desc->k_post	= ConfigPtr->k_post;
+		XVWarpInit_OneTimeCalcs(desc, ConfigPtr->h);
 	}
 
-	XVWarpInit_SetDescriptor(descptr, &desc);
-
 	return XST_SUCCESS;
 }
 
@@ -606,21 +668,28 @@ static void XVWarpInit_OneTimeCalcs(XVWarpInitVector_Hw *initvector_hw,
 /**
 * This function calculates remap vectors of a row vector.
 *
+* The cubic coefficients of a segment are calculated once when the segment is
+* entered, and all pixels of the segment are then evaluated in a loop without
+* segment tests so that the compiler can pipeline or vectorize it. A segment
+* is entered on the first pixel past the end of the previous one, at most one
+* segment per pixel, and the last segment is used up to the end of the line.
+*
 * @param	knots_x, Grid control points in x direction.
 * @param	knots_y, Grid control points in y direction.
 * @param	grid_pts, Number of gird control points.
 * @param	len, length of row vector.
+* @param	stride, distance in words between two remap vectors in remap_row.
 *
 * @return	remap_row, remap vectors of the row vector
 *
 ******************************************************************************/
 static void apply_arbt_warp_line(short *knots_x, short *knots_y,
-		int grid_pts, int len, int *remap_row)
+		int grid_pts, int len, int *remap_row, int stride)
 {
-	int i, j, j1, j2;
+	int i, j, j1, j2, end;
 	short x;
-	int p1 = 0, p2, p3;
-	int a0 = 0, a1 = 0, a2 = 0, a3 = 0;
+	int p1, p3;
+	int a0, a1, a2, a3;
 	unsigned short diff;
 	char n_bits, diff_bits, x0_bits;
 	unsigned char integerbits;
@@ -629,70 +698,73 @@ static void apply_arbt_warp_line(short *knots_x, short *knots_y,
 	long long ll_tmp;
 	int a1x1, a2x2, a3x3;
 
-	p3 = -1;
-	j = 1;
-	for (i = 0; i < len; i++) {
-		p2 = i;
-		if ((p2 > p3) && (j <= grid_pts)) {
-			p1 = knots_x[j];
-			p3 = knots_x[j + 1];
+	i = 0;
+	for (j = 1; (j <= grid_pts) && (i < len); j++) {
+		p1 = knots_x[j];
+		p3 = knots_x[j + 1];
 
-			j1 = j - 1;
-			j2 = j + 2;
-
-			diff = (unsigned short)(p3 - p1);
-			integerbits = XVWarpInit_DominantBit(diff);
-			diff_bits = 16 - integerbits;
-			diff <<= diff_bits;
-			dx0 = XVWarpInit_Inverse(diff, integerbits, &x0_bits);
-			dy0 = knots_y[j + 1] - knots_y[j];
-			dy0 *= dx0;
-			dy0 >>= (x0_bits - 16);
-
-			diff = (unsigned short)(p3 - knots_x[j1]);
-			integerbits = XVWarpInit_DominantBit(diff);
-			diff_bits = 16 - integerbits;
-			diff <<= diff_bits;
-			dx1 = XVWarpInit_Inverse(diff, integerbits, &n_bits);
-			dy1 = knots_y[j + 1] - knots_y[j1];
-			dy1 *= dx1;
-			dy1 >>= (n_bits - 16);
-
-			diff = (unsigned short)(knots_x[j2] - p1);
-			integerbits = XVWarpInit_DominantBit(diff);
-			diff_bits = 16 - integerbits;
-			diff <<= diff_bits;
-			dx2 = XVWarpInit_Inverse(diff, integerbits, &n_bits);
-			dy2 = knots_y[j2] - knots_y[j];
-			dy2 *= dx2;
-			dy2 >>= (n_bits - 16);
+		j1 = j - 1;
+		j2 = j + 2;
 
-			a0 = ((int)knots_y[j]) * 65536;
-
-			a1 = dy1;
-
-			a2 = (3 * dy0 - 2 * dy1 - dy2) >> 4;
-			a2 *= dx0;
-			a2 >>= (x0_bits - 12);
-
-			t = (-2 * dy0 + dy1 + dy2) >> 4;
-			ll_tmp = dx0;
-			ll_tmp *= dx0;
-			a3 = (ll_tmp * t) >> (2 * x0_bits - 24);
-
-			j++;
+		diff = (unsigned short)(p3 - p1);
+		integerbits = XVWarpInit_DominantBit(diff);
+		diff_bits = 16 - integerbits;
+		diff <<= diff_bits;
+		dx0 = XVWarpInit_Inverse(diff, integerbits, &x0_bits);
+		dy0 = knots_y[j + 1] - knots_y[j];
+		dy0 *= dx0;
+		dy0 >>= (x0_bits - 16);
+
+		diff = (unsigned short)(p3 - knots_x[j1]);
+		integerbits = XVWarpInit_DominantBit(diff);
+		diff_bits = 16 - integerbits;
+		diff <<= diff_bits;
+		dx1 = XVWarpInit_Inverse(diff, integerbits, &n_bits);
+		dy1 = knots_y[j + 1] - knots_y[j1];
+		dy1 *= dx1;
+		dy1 >>= (n_bits - 16);
+
+		diff = (unsigned short)(knots_x[j2] - p1);
+		integerbits = XVWarpInit_DominantBit(diff);
+		diff_bits = 16 - integerbits;
+		diff <<= diff_bits;
+		dx2 = XVWarpInit_Inverse(diff, integerbits, &n_bits);
+		dy2 = knots_y[j2] - knots_y[j];
+		dy2 *= dx2;
+		dy2 >>= (n_bits - 16);
+
+		a0 = ((int)knots_y[j]) * 65536;
+
+		a1 = dy1;
+
+		a2 = (3 * dy0 - 2 * dy1 - dy2) >> 4;
+		a2 *= dx0;
+		a2 >>= (x0_bits - 12);
+
+		t = (-2 * dy0 + dy1 + dy2) >> 4;
+		ll_tmp = dx0;
+		ll_tmp *= dx0;
+		a3 = (ll_tmp * t) >> (2 * x0_bits - 24);
+
+		end = len;
+		if (j < grid_pts) {
+			end = (p3 >= i) ? (p3 + 1) : (i + 1);
+			if (end > len)
+				end = len;
 		}
 
-		x = p2 - p1;
-		a1x1 = a1 * x;
-		x2 = x * x;
-		ll_tmp = a2;
-		a2x2 = (ll_tmp * x2) >> 8;
-		ll_tmp = a3;
-		ll_tmp *= x;
-		a3x3 = (ll_tmp * x2) >> 20;
-
-		remap_row[i] = (a3x3 + a2x2 + a1x1 + a0) >> 12;
+		for (; i < end; i++) {
+			x = i - p1;
+			a1x1 = a1 * x;
+			x2 = x * x;
+			ll_tmp = a2;
+			a2x2 = (ll_tmp * x2) >> 8;
+			ll_tmp = a3;
+			ll_tmp *= x;
+			a3x3 = (ll_tmp * x2) >> 20;
+
+			remap_row[i * stride] = (a3x3 + a2x2 + a1x1 + a0) >> 12;
+		}
 	}
 }
 
@@ -841,7 +913,6 @@ static void XVWarpInit_OnetimeCalcsArbt(XVWarpInit_ArbParam *arbitrary_param,
 	unsigned short fr_width, unsigned short fr_height) {
 	u32 i, j, l;
 	short *knots_x, *knots_y;
-	int *t_data, *int_ptr;
 	u32 grid_size;
 	unsigned short *sh_ptr_x, *sh_ptr_y, num_pts;
 
@@ -866,16 +937,8 @@ static void XVWarpInit_OnetimeCalcsArbt(XVWarpInit_ArbParam *arbitrary_param,
 		knots_x[l] = knots_x[l - 1];
 		knots_y[l] = knots_y[l - 1];
 
-		apply_arbt_warp_line(knots_y, knots_x, grid_size,
-				fr_height, arbitrary_param->temp_row);
-
-		t_data = arbitrary_param->interm_y + j;
-		int_ptr = arbitrary_param->temp_row;
-		for (i = 0; i < fr_height; i++) {
-			*t_data = *int_ptr;
-			t_data += num_pts;
-			int_ptr++;
-		}
+		apply_arbt_warp_line(knots_y, knots_x, grid_size, fr_height,
+				arbitrary_param->interm_y + j, num_pts);
 	}
 
 	//Row wise applying splines
@@ -893,16 +956,8 @@ static void XVWarpInit_OnetimeCalcsArbt(XVWarpInit_ArbParam *arbitrary_param,
 		knots_x[l] = knots_x[l - 1];
 		knots_y[l] = knots_y[l - 1];
 
-		apply_arbt_warp_line(knots_x, knots_y, grid_size,
-				fr_width, arbitrary_param->temp_row);
-
-		t_data = arbitrary_param->interm_x + j;
-		int_ptr = arbitrary_param->temp_row;
-		for (i = 0; i < fr_width; i++) {
-			*t_data = *int_ptr;
-			t_data += num_pts;
-			int_ptr++;
-		}
+		apply_arbt_warp_line(knots_x, knots_y, grid_size, fr_width,
+				arbitrary_param->interm_x + j, num_pts);
 	}
 
 	creat_src_tangents(arbitrary_param->src_ctrl_x_pts,
@@ -948,7 +1003,30 @@ static void XVWarpInit_AllocArbMem(XVWarpInit_ArbParam *arbitrary_param,
 	arbitrary_param->knots_y = (short *)malloc(sizeof(short) * (n_pts+2));
 	arbitrary_param->interm_x = (int *)malloc(sizeof(int) * fr_width * n_pts);
 	arbitrary_param->interm_y = (int *)malloc(sizeof(int) * fr_height * n_pts);
-	arbitrary_param->temp_row = (int *)malloc(sizeof(int) * fr_width);
+}
+
+/*****************************************************************************/
+/**
+* This function frees the memory allocated for the arbitrary distortion
+* variables by XVWarpInit_AllocArbMem().
+*
+* @param	arbitrary_param is the pointer to input Arbitary parameters.
+*
+* @return	None
+*
+******************************************************************************/
+static void XVWarpInit_FreeArbMem(XVWarpInit_ArbParam *arbitrary_param)
+{
+	free(arbitrary_param->dst_ctrl_x_pts);
+	free(arbitrary_param->dst_ctrl_y_pts);
+	free(arbitrary_param->src_ctrl_x_pts);
+	free(arbitrary_param->src_ctrl_y_pts);
+	free(arbitrary_param->src_tangents_x);
+	free(arbitrary_param->src_tangents_y);
+	free(arbitrary_param->knots_x);
+	free(arbitrary_param->knots_y);
+	free(arbitrary_param->interm_x);
+	free(arbitrary_param->interm_y);
 }
 
 /*****************************************************************************/
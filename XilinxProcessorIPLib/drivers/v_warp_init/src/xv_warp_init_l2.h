@@ -116,7 +116,6 @@ typedef struct {
 	s32 *src_tangents_y;
 	s16 *knots_x;
 	s16 *knots_y;
-	s32 *temp_row;
 	s32 *interm_x;
 	s32 *interm_y;
 } XVWarpInit_ArbParam;
@@ -146,6 +145,8 @@ int XVWarpInit_SetNumOfDescriptors(XV_warp_init *InstancePtr,
 void XVWarpInit_ClearNumOfDescriptors(XV_warp_init *InstancePtr);
 int XVWarpInit_ProgramDescriptor(XV_warp_init *InstancePtr,
 		u32 Descnum, XVWarpInit_InputConfigs *ConfigPtr);
+int XVWarpInit_ProgramDescriptors(XV_warp_init *InstancePtr,
+		u32 Descnum, u32 NumDesc, XVWarpInit_InputConfigs **ConfigPtr);
 int XVWarpInit_start_with_desc(XV_warp_init *InstancePtr,
 		u32 descnum);
 void XVWarpInit_Stop(XV_warp_init *InstancePtr);
@@ -0,0 +1,248 @@
+/*******************************************************************************
+* Copyright (C) 2021 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_edid_caps_example.c
+ *
+ * Contains an example that decodes a two block HDMI sink EDID once with
+ * XVidC_EdidParseCaps, prints the decoded capabilities and checks every entry
+ * of the video timing table against XVidC_EdidIsVideoTimingSupported. The
+ * average time to answer a mode query from the raw EDID and from the decoded
+ * capabilities is reported.
+ *
+ * @note	The query time is only reported on ARM processors, where the
+ *		global timer is available through xtime_l.h.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.12  dc   10/22/21 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+/******************************* Include Files ********************************/
+
+#include "xil_printf.h"
+#include "xstatus.h"
+#include "xvidc.h"
+#include "xvidc_edid.h"
+#if defined(__arm__) || defined(__aarch64__)
+#include "xtime_l.h"
+#define XVIDC_EXAMPLE_HAS_TIMER 1
+#endif
+
+/************************** Constant Definitions ******************************/
+
+#define XVIDC_EXAMPLE_ITERATIONS 100
+
+/**************************** Function Prototypes *****************************/
+
+static u32 XVidC_ExampleCheckAll(const XVidC_EdidCaps *Caps, u8 UseCaps);
+static void XVidC_ExamplePrintCaps(const XVidC_EdidCaps *Caps);
+
+/************************** Variable Definitions ******************************/
+
+/* 3840x2160@60Hz preferred, HDMI 2.0 sink with HDR and YCbCr 4:2:0. */
+static const u8 XVidC_ExampleEdid[] = {
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x10, 0xAC, 0x34, 0x12, 0x00, 0x00, 0x00, 0x00,
+	0x1E, 0x1C, 0x01, 0x04, 0xB5, 0x3C, 0x22, 0x78,
+	0x3A, 0xEE, 0x95, 0xA3, 0x54, 0x4C, 0x99, 0x26,
+	0x0F, 0x50, 0x54, 0x21, 0x08, 0x00, 0xD1, 0xC0,
+	0x81, 0xC0, 0x81, 0x80, 0x95, 0x00, 0xB3, 0x00,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0xE8,
+	0x00, 0x30, 0xF2, 0x70, 0x5A, 0x80, 0xB0, 0x58,
+	0x8A, 0x00, 0x56, 0x50, 0x21, 0x00, 0x00, 0x1E,
+	0x00, 0x00, 0x00, 0xFD, 0x00, 0x18, 0x4B, 0x1E,
+	0x87, 0x3C, 0x00, 0x0A, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x58,
+	0x4C, 0x4E, 0x58, 0x20, 0x53, 0x49, 0x4E, 0x4B,
+	0x0A, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8A,
+	0x02, 0x03, 0x38, 0xF1, 0x4C, 0x90, 0x04, 0x03,
+	0x02, 0x10, 0x1F, 0x13, 0x5F, 0x60, 0x61, 0x65,
+	0x66, 0x23, 0x09, 0x07, 0x07, 0x83, 0x01, 0x00,
+	0x00, 0x67, 0x03, 0x0C, 0x00, 0x10, 0x00, 0x38,
+	0x3C, 0x67, 0xD8, 0x5D, 0xC4, 0x01, 0x78, 0x80,
+	0x03, 0xE3, 0x05, 0xC0, 0x00, 0xE6, 0x06, 0x0D,
+	0x01, 0x73, 0x5D, 0x1E, 0xE3, 0x0F, 0x00, 0x0E,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C
+};
+
+static XVidC_EdidCaps Caps;
+
+/*************************** Function Definitions *****************************/
+
+/******************************************************************************/
+/**
+ * This function is the main entry point of the EDID capabilities example.
+ *
+ * @return
+ *		- XST_SUCCESS if the decoded capabilities agree with the raw
+ *		  EDID for every video mode.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+int main(void)
+{
+	u32 Status;
+	u8 UseCaps;
+#ifdef XVIDC_EXAMPLE_HAS_TIMER
+	XTime Start;
+	XTime End;
+	u32 Iteration;
+	u64 Ns;
+#endif
+
+	xil_printf("\r\n--- EDID capabilities example ---\r\n");
+
+	Status = XVidC_EdidParseCaps(XVidC_ExampleEdid,
+				sizeof(XVidC_ExampleEdid), &Caps);
+	if (Status != XST_SUCCESS) {
+		xil_printf("EDID header is not valid\r\n");
+		return XST_FAILURE;
+	}
+	XVidC_ExamplePrintCaps(&Caps);
+
+	Status = XVidC_ExampleCheckAll(&Caps, 1);
+	if (Status != XST_SUCCESS) {
+		xil_printf("EDID capabilities example failed\r\n");
+		return XST_FAILURE;
+	}
+
+#ifdef XVIDC_EXAMPLE_HAS_TIMER
+	for (UseCaps = 0; UseCaps < 2; UseCaps++) {
+		XTime_GetTime(&Start);
+		for (Iteration = 0; Iteration < XVIDC_EXAMPLE_ITERATIONS;
+								Iteration++) {
+			(void)XVidC_ExampleCheckAll(&Caps, UseCaps);
+		}
+		XTime_GetTime(&End);
+
+		Ns = ((u64)(End - Start) * 1000000000U) / COUNTS_PER_SECOND;
+		Ns /= ((u64)XVIDC_EXAMPLE_ITERATIONS * XVIDC_VM_NUM_SUPPORTED);
+		xil_printf("%s query: %d ns per mode\r\n",
+			UseCaps ? "Decoded" : "Raw EDID", (u32)Ns);
+	}
+
+	XTime_GetTime(&Start);
+	for (Iteration = 0; Iteration < XVIDC_EXAMPLE_ITERATIONS; Iteration++) {
+		(void)XVidC_EdidParseCaps(XVidC_ExampleEdid,
+					sizeof(XVidC_ExampleEdid), &Caps);
+	}
+	XTime_GetTime(&End);
+
+	Ns = ((u64)(End - Start) * 1000000000U) / COUNTS_PER_SECOND;
+	Ns /= XVIDC_EXAMPLE_ITERATIONS;
+	xil_printf("Decode: %d ns per EDID\r\n", (u32)Ns);
+#else
+	(void)UseCaps;
+#endif
+
+	xil_printf("Successfully ran EDID capabilities example\r\n");
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function queries every entry of the video timing table. When UseCaps
+ * is set, the decoded result is compared with the raw EDID query.
+ *
+ * @param	Caps is the decoded capability structure.
+ * @param	UseCaps selects the raw EDID (0) or decoded (1) query.
+ *
+ * @return
+ *		- XST_SUCCESS if both queries agree for all entries.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XVidC_ExampleCheckAll(const XVidC_EdidCaps *Caps, u8 UseCaps)
+{
+	const XVidC_VideoTimingMode *Mode;
+	u32 Supported;
+	u32 Id;
+
+	for (Id = 0; Id < XVIDC_VM_NUM_SUPPORTED; Id++) {
+		Mode = XVidC_GetVideoModeData((XVidC_VideoMode)Id);
+		Supported = XVidC_EdidIsVideoTimingSupported(XVidC_ExampleEdid,
+									Mode);
+		if (UseCaps && (Supported !=
+			XVidC_EdidCapsIsVideoTimingSupported(Caps, Mode))) {
+			xil_printf("Mismatch for %s\r\n", Mode->Name);
+			return XST_FAILURE;
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function prints the decoded capabilities.
+ *
+ * @param	Caps is the decoded capability structure.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void XVidC_ExamplePrintCaps(const XVidC_EdidCaps *Caps)
+{
+	u32 Id;
+	u32 Vic;
+
+	xil_printf("Preferred timing: %dx%d%s\r\n", Caps->PtmHActive,
+		Caps->PtmVActive, Caps->PtmIsInterlaced ? "i" : "p");
+	xil_printf("Extension blocks: %d (%d CTA-861), checksum errors: %d\r\n",
+		Caps->NumExtBlocks, Caps->NumCeaBlocks,
+		Caps->NumChecksumErrors);
+	xil_printf("HDMI: %d, HDMI Forum: %d, SCDC: %d, max TMDS: %d MHz\r\n",
+		Caps->IsHdmi, Caps->IsHdmiForum, Caps->IsScdcPresent,
+		Caps->MaxTmdsMhz);
+	xil_printf("YCbCr 4:4:4: %d, YCbCr 4:2:2: %d\r\n",
+		Caps->IsYCbCr444Supp, Caps->IsYCbCr422Supp);
+	xil_printf("Colorimetry: 0x%02x, HDR EOTF: 0x%02x\r\n",
+		Caps->Colorimetry, Caps->HdrEotf);
+
+	xil_printf("VICs:");
+	for (Vic = 1; Vic < 256; Vic++) {
+		if (XVidC_EdidCapsIsVicSupported(Caps, Vic)) {
+			xil_printf(" %d%s%s", Vic,
+				XVidC_EdidCapsIsVicNative(Caps, Vic) ?
+								"*" : "",
+				XVidC_EdidCapsIsVicYCbCr420(Caps, Vic) ?
+								"(420)" : "");
+		}
+	}
+	xil_printf("\r\n");
+
+	xil_printf("Supported video modes:\r\n");
+	for (Id = 0; Id < XVIDC_VM_NUM_SUPPORTED; Id++) {
+		if (XVidC_EdidCapsIsVmSupported(Caps, Id)) {
+			xil_printf("  %s\r\n",
+				XVidC_GetVideoModeStr((XVidC_VideoMode)Id));
+		}
+	}
+}
@@ -0,0 +1,153 @@
+/*******************************************************************************
+* Copyright (C) 2021 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_mode_lookup_example.c
+ *
+ * Contains an example that resolves every entry of the video timing table
+ * back to its video mode ID with XVidC_GetVideoModeId and
+ * XVidC_GetVideoModeIdExtensive, as the HDMI and DisplayPort receivers do on
+ * a stream-up event, and reports the average time per lookup.
+ *
+ * @note	The lookup time is only reported on ARM processors, where the
+ *		global timer is available through xtime_l.h.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.12  dc   10/20/21 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+/******************************* Include Files ********************************/
+
+#include "xil_printf.h"
+#include "xstatus.h"
+#include "xvidc.h"
+#if defined(__arm__) || defined(__aarch64__)
+#include "xtime_l.h"
+#define XVIDC_EXAMPLE_HAS_TIMER 1
+#endif
+
+/************************** Constant Definitions ******************************/
+
+#define XVIDC_EXAMPLE_ITERATIONS 100
+
+/**************************** Function Prototypes *****************************/
+
+static u32 XVidC_ExampleLookupAll(u8 IsExtensive);
+
+/*************************** Function Definitions *****************************/
+
+/******************************************************************************/
+/**
+ * This function is the main entry point of the video mode lookup example.
+ *
+ * @return
+ *		- XST_SUCCESS if every table entry resolved to a mode with the
+ *		  same timing.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+int main(void)
+{
+	u32 Status;
+	u8 IsExtensive;
+#ifdef XVIDC_EXAMPLE_HAS_TIMER
+	XTime Start;
+	XTime End;
+	u32 Iteration;
+	u64 Ns;
+#endif
+
+	xil_printf("\r\n--- Video mode lookup example ---\r\n");
+
+	for (IsExtensive = 0; IsExtensive < 2; IsExtensive++) {
+		Status = XVidC_ExampleLookupAll(IsExtensive);
+		if (Status != XST_SUCCESS) {
+			xil_printf("Video mode lookup example failed\r\n");
+			return XST_FAILURE;
+		}
+
+#ifdef XVIDC_EXAMPLE_HAS_TIMER
+		XTime_GetTime(&Start);
+		for (Iteration = 0; Iteration < XVIDC_EXAMPLE_ITERATIONS;
+								Iteration++) {
+			(void)XVidC_ExampleLookupAll(IsExtensive);
+		}
+		XTime_GetTime(&End);
+
+		Ns = ((u64)(End - Start) * 1000000000U) / COUNTS_PER_SECOND;
+		Ns /= ((u64)XVIDC_EXAMPLE_ITERATIONS * XVIDC_VM_NUM_SUPPORTED);
+		xil_printf("%s lookup: %d ns per mode\r\n",
+			IsExtensive ? "Extensive" : "Basic", (u32)Ns);
+#endif
+	}
+
+	xil_printf("Successfully ran video mode lookup example\r\n");
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function looks up the video mode ID of every entry in the video timing
+ * table and checks that the returned mode has the looked up timing.
+ *
+ * @param	IsExtensive selects basic (0) or extensive (1) matching.
+ *
+ * @return
+ *		- XST_SUCCESS if all entries resolved.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	Several modes share active size and frame rate, so basic
+ *		matching may return an earlier mode than the one looked up.
+ *
+*******************************************************************************/
+static u32 XVidC_ExampleLookupAll(u8 IsExtensive)
+{
+	const XVidC_VideoTimingMode *Mode;
+	const XVidC_VideoTimingMode *Found;
+	XVidC_VideoTiming Timing;
+	XVidC_VideoMode VmId;
+	u32 Id;
+
+	for (Id = 0; Id < XVIDC_VM_NUM_SUPPORTED; Id++) {
+		Mode = XVidC_GetVideoModeData((XVidC_VideoMode)Id);
+		Timing = Mode->Timing;
+
+		if (IsExtensive) {
+			VmId = XVidC_GetVideoModeIdExtensive(&Timing,
+					Mode->FrameRate,
+					XVidC_IsInterlaced((XVidC_VideoMode)Id),
+					1);
+		}
+		else {
+			VmId = XVidC_GetVideoModeId(Timing.HActive,
+					Timing.VActive, Mode->FrameRate,
+					XVidC_IsInterlaced((XVidC_VideoMode)Id));
+		}
+
+		Found = XVidC_GetVideoModeData(VmId);
+		if ((Found == NULL) ||
+			(Found->Timing.HActive != Timing.HActive) ||
+			(Found->Timing.VActive != Timing.VActive) ||
+			(Found->FrameRate != Mode->FrameRate) ||
+			(IsExtensive &&
+			(Found->Timing.HTotal != Timing.HTotal))) {
+			xil_printf("Lookup of %s failed\r\n", Mode->Name);
+			return XST_FAILURE;
+		}
+	}
+
+	return XST_SUCCESS;
+}
@@ -41,6 +41,8 @@
  * 4.3   eb   26/01/18 Added API XVidC_GetVideoModeIdExtensive
  *       jsr  02/22/18 Added XVIDC_CSF_YCBCR_420 color space format
  *       vyc  04/04/18 Added BGR8 memory format
+ * 4.12  dc   10/20/21 Added a hashed index over the video timing tables for
+ *                     XVidC_GetVideoModeId and XVidC_GetVideoModeIdExtensive
  * </pre>
  *
 *******************************************************************************/
@@ -51,17 +53,62 @@
 #include "xstatus.h"
 #include "xvidc.h"
 
+/************************** Constant Definitions ******************************/
+
+/* Number of hash buckets of the video mode index. Must be a power of 2. */
+#define XVIDC_MODE_INDEX_BUCKETS	512
+/* Number of custom video modes which can be placed in the index. Custom
+ * tables with more entries are searched linearly. */
+#define XVIDC_MODE_INDEX_MAX_CUSTOM	64
+/* Each custom mode is indexed as progressive and as interlaced since the
+ * custom table does not partition modes by scan type. */
+#define XVIDC_MODE_INDEX_ENTRIES	(XVIDC_VM_NUM_SUPPORTED + \
+					(2 * XVIDC_MODE_INDEX_MAX_CUSTOM))
+#define XVIDC_MODE_INDEX_NONE		0xFFFF
+
 /*************************** Variable Declarations ****************************/
 extern const XVidC_VideoTimingMode XVidC_VideoTimingModes[XVIDC_VM_NUM_SUPPORTED];
 
 const XVidC_VideoTimingMode *XVidC_CustomTimingModes = NULL;
 int XVidC_NumCustomModes = 0;
 
+/**
+ * Hashed index over the standard and custom video timing tables keyed by
+ * (HActive, VActive, FrameRate, IsInterlaced). Entries sharing a bucket are
+ * chained in table order, custom modes first, so that the first match is the
+ * same mode found by a search of the tables. The index takes about 7 KB of
+ * .bss on 64-bit targets. It is rebuilt when the custom table is registered
+ * or unregistered, otherwise it is built by the first lookup. The build is
+ * not reentrant, see XVidC_GetVideoModeId().
+ */
+typedef struct {
+	u16 Head[XVIDC_MODE_INDEX_BUCKETS];
+	u16 Next[XVIDC_MODE_INDEX_ENTRIES];
+	u16 Tail[XVIDC_MODE_INDEX_BUCKETS];
+	const XVidC_VideoTimingMode *Mode[XVIDC_MODE_INDEX_ENTRIES];
+	XVidC_VideoMode VmId[XVIDC_MODE_INDEX_ENTRIES];
+	u8 IsInterlaced[XVIDC_MODE_INDEX_ENTRIES];
+	u16 NumEntries;
+	u8 IsCustomIndexed;
+	u8 IsValid;
+} XVidC_ModeIndex;
+
+static XVidC_ModeIndex XVidC_VmIndex;
+
 /**************************** Function Prototypes *****************************/
 
 static const XVidC_VideoTimingMode *XVidC_GetCustomVideoModeData(
 		XVidC_VideoMode VmId);
 static u8 XVidC_IsVtmRb(const char *VideoModeStr, u8 RbN);
+static u32 XVidC_ModeIndexHash(u32 Width, u32 Height, u32 FrameRate,
+		u8 IsInterlaced);
+static void XVidC_ModeIndexAdd(const XVidC_VideoTimingMode *Mode,
+		XVidC_VideoMode VmId, u8 IsInterlaced);
+static void XVidC_ModeIndexBuild(void);
+static u8 XVidC_IsTimingMatch(const XVidC_VideoTiming *StdTiming,
+		const XVidC_VideoTiming *Timing, u8 IsInterlaced, u8 IsExtensive);
+static XVidC_VideoMode XVidC_ModeIndexLookup(const XVidC_VideoTiming *Timing,
+		u32 FrameRate, u8 IsInterlaced, u8 IsExtensive);
 
 /*************************** Function Definitions *****************************/
 
@@ -104,6 +151,7 @@ u32 XVidC_RegisterCustomTimingModes(const XVidC_VideoTimingMode *CustomTable,
 
 	XVidC_CustomTimingModes = CustomTable;
 	XVidC_NumCustomModes    = NumElems;
+	XVidC_ModeIndexBuild();
 
 	return XST_SUCCESS;
 }
@@ -122,6 +170,7 @@ void XVidC_UnregisterCustomTimingModes(void)
 {
 	XVidC_CustomTimingModes = NULL;
 	XVidC_NumCustomModes    = 0;
+	XVidC_ModeIndexBuild();
 }
 
 /******************************************************************************/
@@ -311,112 +360,28 @@ XVidC_VideoMode XVidC_GetVideoModeIdWBlanking(const XVidC_VideoTiming *Timing,
  *
  * @return	Id of a supported video mode.
  *
- * @note	None.
+ * @note	Unless XVidC_RegisterCustomTimingModes() was called, the first
+ *		call of this function or XVidC_GetVideoModeIdExtensive() builds
+ *		the video mode index. The build is not reentrant, so the first
+ *		call must not be made from interrupt context. Drivers which
+ *		look up modes in interrupt handlers should make one lookup at
+ *		initialization.
  *
 *******************************************************************************/
 XVidC_VideoMode XVidC_GetVideoModeId(u32 Width, u32 Height, u32 FrameRate,
 					u8 IsInterlaced)
 {
-	u32 Low;
-	u32 High;
-	u32 Mid;
-	u32 HActive;
-	u32 VActive;
-	u32 Rate;
-	u32 ResFound = (FALSE);
-	XVidC_VideoMode Mode;
-	u16 Index;
-
-	/* First, attempt a linear search on the custom video timing table. */
-	if(XVidC_CustomTimingModes) {
-	  for (Index = 0; Index < XVidC_NumCustomModes; Index++) {
-		HActive = XVidC_CustomTimingModes[Index].Timing.HActive;
-		VActive = XVidC_CustomTimingModes[Index].Timing.VActive;
-		Rate = XVidC_CustomTimingModes[Index].FrameRate;
-		if ((Width  == HActive) &&
-			(Height == VActive) &&
-			(FrameRate == Rate)) {
-			   return XVidC_CustomTimingModes[Index].VmId;
-		}
-	  }
-	}
-
-	if (IsInterlaced) {
-		Low = (XVIDC_VM_INTL_START);
-		High = (XVIDC_VM_INTL_END);
-	}
-	else {
-		Low = (XVIDC_VM_PROG_START);
-		High = (XVIDC_VM_PROG_END);
-	}
-
-	HActive = VActive = Rate = 0;
-
-	/* Binary search finds item in sorted array.
-	 * And returns index (zero based) of item
-	 * If item is not found returns flag remains
-	 * FALSE. Search key is "width or HActive"
-	 */
-	while (Low <= High) {
-		Mid = (Low + High) / 2;
-		HActive = XVidC_VideoTimingModes[Mid].Timing.HActive;
-		if (Width == HActive) {
-			ResFound = (TRUE);
-			break;
-		}
-		else if (Width < HActive) {
-			if (Mid == 0) {
-				break;
-			}
-			else {
-				High = Mid - 1;
-			}
-		}
-		else {
-			Low = Mid + 1;
-		}
-	}
+	XVidC_VideoTiming Timing;
 
-	 /* HActive matched at middle */
-	if (ResFound) {
-		/* Rewind to start index of mode with matching width */
-		while ((Mid > 0) &&
-			(XVidC_VideoTimingModes[Mid - 1].Timing.HActive ==
-								Width)) {
-			--Mid;
-		}
+	Timing.HActive = (u16)Width;
+	Timing.VActive = (u16)Height;
 
-		ResFound = (FALSE);
-		VActive = XVidC_VideoTimingModes[Mid].Timing.VActive;
-		Rate = XVidC_VideoTimingModes[Mid].FrameRate;
-
-		/* Now do a linear search for matching VActive and Frame
-		 * Rate
-		 */
-		while (HActive == Width) {
-			/* check current entry */
-			if ((VActive == Height) && (Rate == FrameRate)) {
-				ResFound = (TRUE);
-				break;
-			}
-			/* Check next entry */
-			else {
-				Mid = Mid + 1;
-				HActive =
-				XVidC_VideoTimingModes[Mid].Timing.HActive;
-				VActive =
-				XVidC_VideoTimingModes[Mid].Timing.VActive;
-				Rate = XVidC_VideoTimingModes[Mid].FrameRate;
-			}
-		}
-		Mode =
-		(ResFound) ? (XVidC_VideoMode)Mid : (XVIDC_VM_NOT_SUPPORTED);
-	}
-	else {
-		Mode = (XVIDC_VM_NOT_SUPPORTED);
+	/* Dimensions which do not fit the timing fields cannot match. */
+	if ((Timing.HActive != Width) || (Timing.VActive != Height)) {
+		return (XVIDC_VM_NOT_SUPPORTED);
 	}
 
-	return (Mode);
+	return XVidC_ModeIndexLookup(&Timing, FrameRate, IsInterlaced, 0);
 }
 
 /******************************************************************************/
@@ -436,7 +401,9 @@ XVidC_VideoMode XVidC_GetVideoModeId(u32 Width, u32 Height, u32 FrameRate,
  * @return	Id of a supported video mode.
  *
  * @note	This function attempts to search for reduced blanking entries, if
- *          any.
+ *          any. Custom modes are matched irrespective of IsInterlaced.
+ *		The first call must not be made from interrupt context, see
+ *		XVidC_GetVideoModeId().
  *
 *******************************************************************************/
 XVidC_VideoMode XVidC_GetVideoModeIdExtensive(XVidC_VideoTiming *Timing,
@@ -444,156 +411,8 @@ XVidC_VideoMode XVidC_GetVideoModeIdExtensive(XVidC_VideoTiming *Timing,
 											  u8 IsInterlaced,
 											  u8 IsExtensive)
 {
-	u32 Low;
-	u32 High;
-	u32 Mid;
-	u32 HActive;
-	u32 VActive;
-	u32 Rate;
-	u32 ResFound = (FALSE);
-	XVidC_VideoMode Mode;
-	u16 Index;
-
-	/* First, attempt a linear search on the custom video timing table. */
-	if(XVidC_CustomTimingModes) {
-	  for (Index = 0; Index < XVidC_NumCustomModes; Index++) {
-		HActive = XVidC_CustomTimingModes[Index].Timing.HActive;
-		VActive = XVidC_CustomTimingModes[Index].Timing.VActive;
-		Rate = XVidC_CustomTimingModes[Index].FrameRate;
-		if ((HActive == Timing->HActive) && (VActive == Timing->VActive) &&
-				(Rate == FrameRate) && (IsExtensive == 0 || (
-			XVidC_CustomTimingModes[Index].Timing.HTotal == Timing->HTotal &&
-			XVidC_CustomTimingModes[Index].Timing.F0PVTotal ==
-					Timing->F0PVTotal &&
-			XVidC_CustomTimingModes[Index].Timing.HFrontPorch ==
-					Timing->HFrontPorch &&
-			XVidC_CustomTimingModes[Index].Timing.F0PVFrontPorch ==
-					Timing->F0PVFrontPorch &&
-			XVidC_CustomTimingModes[Index].Timing.HSyncWidth ==
-					Timing->HSyncWidth &&
-			XVidC_CustomTimingModes[Index].Timing.F0PVSyncWidth ==
-					Timing->F0PVSyncWidth &&
-			XVidC_CustomTimingModes[Index].Timing.VSyncPolarity ==
-					Timing->VSyncPolarity))) {
-				if (!IsInterlaced || IsExtensive == 0 || (
-						XVidC_CustomTimingModes[Index].Timing.F1VTotal ==
-						Timing->F1VTotal &&
-						XVidC_CustomTimingModes[Index].Timing.F1VFrontPorch ==
-								Timing->F1VFrontPorch &&
-						XVidC_CustomTimingModes[Index].Timing.F1VSyncWidth ==
-								Timing->F1VSyncWidth)) {
-					return XVidC_CustomTimingModes[Index].VmId;
-				}
-		}
-	  }
-	}
-
-	if (IsInterlaced) {
-		Low = (XVIDC_VM_INTL_START);
-		High = (XVIDC_VM_INTL_END);
-	}
-	else {
-		Low = (XVIDC_VM_PROG_START);
-		High = (XVIDC_VM_PROG_END);
-	}
-
-	HActive = VActive = Rate = 0;
-
-	/* Binary search finds item in sorted array.
-	 * And returns index (zero based) of item
-	 * If item is not found returns flag remains
-	 * FALSE. Search key is "Timing->HActive or HActive"
-	 */
-	while (Low <= High) {
-		Mid = (Low + High) / 2;
-		HActive = XVidC_VideoTimingModes[Mid].Timing.HActive;
-		if (Timing->HActive == HActive) {
-			ResFound = (TRUE);
-			break;
-		}
-		else if (Timing->HActive < HActive) {
-			if (Mid == 0) {
-				break;
-			}
-			else {
-				High = Mid - 1;
-			}
-		}
-		else {
-			Low = Mid + 1;
-		}
-	}
-
-	 /* HActive matched at middle */
-	if (ResFound) {
-		/* Rewind to start index of mode with matching Timing->HActive */
-		while ((Mid > 0) &&
-			(XVidC_VideoTimingModes[Mid - 1].Timing.HActive ==
-								Timing->HActive)) {
-			--Mid;
-		}
-
-		ResFound = (FALSE);
-		VActive = XVidC_VideoTimingModes[Mid].Timing.VActive;
-		Rate = XVidC_VideoTimingModes[Mid].FrameRate;
-
-		/* Now do a linear search for matching VActive and Frame
-		 * Rate
-		 */
-		while (HActive == Timing->HActive) {
-			/* check current entry */
-			if ((VActive == Timing->VActive) && (Rate == FrameRate) &&
-					(IsExtensive == 0 ||
-					(XVidC_VideoTimingModes[Mid].Timing.HTotal ==
-							Timing->HTotal &&
-					XVidC_VideoTimingModes[Mid].Timing.F0PVTotal ==
-							Timing->F0PVTotal &&
-					XVidC_VideoTimingModes[Mid].Timing.HFrontPorch ==
-							Timing->HFrontPorch &&
-					XVidC_VideoTimingModes[Mid].Timing.F0PVFrontPorch ==
-							Timing->F0PVFrontPorch &&
-					XVidC_VideoTimingModes[Mid].Timing.HSyncWidth ==
-							Timing->HSyncWidth &&
-					XVidC_VideoTimingModes[Mid].Timing.F0PVSyncWidth ==
-							Timing->F0PVSyncWidth &&
-					XVidC_VideoTimingModes[Mid].Timing.VSyncPolarity ==
-							Timing->VSyncPolarity))) {
-				if (!IsInterlaced || IsExtensive == 0 || (
-						XVidC_VideoTimingModes[Mid].Timing.F1VTotal ==
-								Timing->F1VTotal &&
-						XVidC_VideoTimingModes[Mid].Timing.F1VFrontPorch ==
-								Timing->F1VFrontPorch &&
-						XVidC_VideoTimingModes[Mid].Timing.F1VSyncWidth ==
-								Timing->F1VSyncWidth)) {
-					ResFound = (TRUE);
-					break;
-				} else {
-					Mid = Mid + 1;
-					HActive =
-					XVidC_VideoTimingModes[Mid].Timing.HActive;
-					VActive =
-					XVidC_VideoTimingModes[Mid].Timing.VActive;
-					Rate = XVidC_VideoTimingModes[Mid].FrameRate;
-				}
-			}
-			/* Check next entry */
-			else {
-				Mid = Mid + 1;
-				HActive =
-				XVidC_VideoTimingModes[Mid].Timing.HActive;
-				VActive =
-				XVidC_VideoTimingModes[Mid].Timing.VActive;
-				Rate = XVidC_VideoTimingModes[Mid].FrameRate;
-			}
-		}
-		Mode =
-		(ResFound) ? (XVidC_VideoMode)Mid : (XVIDC_VM_NOT_SUPPORTED);
-	}
-	else {
-		Mode = (XVIDC_VM_NOT_SUPPORTED);
-	}
-
-	return (Mode);
+	return XVidC_ModeIndexLookup(Timing, FrameRate, IsInterlaced,
+			IsExtensive);
 }
 
 /******************************************************************************/
@@ -1171,6 +990,224 @@ static const XVidC_VideoTimingMode *XVidC_GetCustomVideoModeData(
 	return NULL;
 }
 
+/******************************************************************************/
+/**
+ * This function returns the hash bucket of a video mode index key.
+ *
+ * @param	Width specifies the number pixels per scanline.
+ * @param	Height specifies the number of scanline's.
+ * @param	FrameRate specifies refresh rate in HZ
+ * @param	IsInterlaced specifies interlaced (1) or progressive (0).
+ *
+ * @return	Bucket number in the range 0 to XVIDC_MODE_INDEX_BUCKETS - 1.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XVidC_ModeIndexHash(u32 Width, u32 Height, u32 FrameRate,
+		u8 IsInterlaced)
+{
+	u32 Hash;
+
+	Hash = (Width * 0x9E3779B1U) ^ (Height * 0x85EBCA77U) ^
+		(FrameRate * 0xC2B2AE3DU) ^ (IsInterlaced ? 0x27D4EB2FU : 0U);
+	Hash ^= Hash >> 15;
+	Hash *= 0x2C1B3C6DU;
+	Hash ^= Hash >> 13;
+
+	return Hash & (XVIDC_MODE_INDEX_BUCKETS - 1);
+}
+
+/******************************************************************************/
+/**
+ * This function appends a video mode to the tail of its bucket chain in the
+ * video mode index.
+ *
+ * @param	Mode is a pointer to the video timing mode to add.
+ * @param	VmId is the ID returned when the mode matches.
+ * @param	IsInterlaced is the scan type the mode is indexed under.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void XVidC_ModeIndexAdd(const XVidC_VideoTimingMode *Mode,
+		XVidC_VideoMode VmId, u8 IsInterlaced)
+{
+	XVidC_ModeIndex *Index = &XVidC_VmIndex;
+	u16 Entry = Index->NumEntries;
+	u32 Bucket;
+
+	Bucket = XVidC_ModeIndexHash(Mode->Timing.HActive, Mode->Timing.VActive,
+			Mode->FrameRate, IsInterlaced);
+
+	Index->Mode[Entry] = Mode;
+	Index->VmId[Entry] = VmId;
+	Index->IsInterlaced[Entry] = IsInterlaced;
+	Index->Next[Entry] = XVIDC_MODE_INDEX_NONE;
+
+	if (Index->Head[Bucket] == XVIDC_MODE_INDEX_NONE) {
+		Index->Head[Bucket] = Entry;
+	}
+	else {
+		Index->Next[Index->Tail[Bucket]] = Entry;
+	}
+	Index->Tail[Bucket] = Entry;
+	Index->NumEntries++;
+}
+
+/******************************************************************************/
+/**
+ * This function builds the video mode index from the registered custom video
+ * timing table and the standard video timing table.
+ *
+ * @return	None.
+ *
+ * @note	Custom modes are added first so that they take precedence over
+ *		standard modes, as in a linear search of both tables.
+ *
+*******************************************************************************/
+static void XVidC_ModeIndexBuild(void)
+{
+	XVidC_ModeIndex *Index = &XVidC_VmIndex;
+	u32 Bucket;
+	u16 Id;
+
+	for (Bucket = 0; Bucket < XVIDC_MODE_INDEX_BUCKETS; Bucket++) {
+		Index->Head[Bucket] = XVIDC_MODE_INDEX_NONE;
+	}
+	Index->NumEntries = 0;
+	Index->IsCustomIndexed = (FALSE);
+
+	if (XVidC_CustomTimingModes &&
+		(XVidC_NumCustomModes <= XVIDC_MODE_INDEX_MAX_CUSTOM)) {
+		for (Id = 0; Id < XVidC_NumCustomModes; Id++) {
+			XVidC_ModeIndexAdd(&XVidC_CustomTimingModes[Id],
+					XVidC_CustomTimingModes[Id].VmId, 0);
+			XVidC_ModeIndexAdd(&XVidC_CustomTimingModes[Id],
+					XVidC_CustomTimingModes[Id].VmId, 1);
+		}
+		Index->IsCustomIndexed = (TRUE);
+	}
+
+	for (Id = XVIDC_VM_INTL_START; Id <= XVIDC_VM_INTL_END; Id++) {
+		XVidC_ModeIndexAdd(&XVidC_VideoTimingModes[Id],
+				(XVidC_VideoMode)Id, 1);
+	}
+	for (Id = XVIDC_VM_PROG_START; Id <= XVIDC_VM_PROG_END; Id++) {
+		XVidC_ModeIndexAdd(&XVidC_VideoTimingModes[Id],
+				(XVidC_VideoMode)Id, 0);
+	}
+
+	Index->IsValid = (TRUE);
+}
+
+/******************************************************************************/
+/**
+ * This function compares the blanking of a table entry with the detected
+ * timing.
+ *
+ * @param	StdTiming is the timing of the table entry.
+ * @param	Timing is the detected timing.
+ * @param	IsInterlaced specifies interlaced (1) or progressive (0).
+ * @param	IsExtensive selects basic (0) or extensive (1) matching.
+ *
+ * @return	1 if the timings match, 0 otherwise.
+ *
+ * @note	Active size and frame rate are compared by the caller.
+ *
+*******************************************************************************/
+static u8 XVidC_IsTimingMatch(const XVidC_VideoTiming *StdTiming,
+		const XVidC_VideoTiming *Timing, u8 IsInterlaced, u8 IsExtensive)
+{
+	if (IsExtensive == 0) {
+		return 1;
+	}
+
+	if ((StdTiming->HTotal != Timing->HTotal) ||
+		(StdTiming->F0PVTotal != Timing->F0PVTotal) ||
+		(StdTiming->HFrontPorch != Timing->HFrontPorch) ||
+		(StdTiming->F0PVFrontPorch != Timing->F0PVFrontPorch) ||
+		(StdTiming->HSyncWidth != Timing->HSyncWidth) ||
+		(StdTiming->F0PVSyncWidth != Timing->F0PVSyncWidth) ||
+		(StdTiming->VSyncPolarity != Timing->VSyncPolarity)) {
+		return 0;
+	}
+
+	if (IsInterlaced &&
+		((StdTiming->F1VTotal != Timing->F1VTotal) ||
+		(StdTiming->F1VFrontPorch != Timing->F1VFrontPorch) ||
+		(StdTiming->F1VSyncWidth != Timing->F1VSyncWidth))) {
+		return 0;
+	}
+
+	return 1;
+}
+
+/******************************************************************************/
+/**
+ * This function looks up the video mode index for the first mode that matches
+ * the detected timing, frame rate and I/P flag.
+ *
+ * @param	Timing is the pointer to timing parameters to match. Only
+ *		HActive and VActive are used unless IsExtensive is set.
+ * @param	FrameRate specifies refresh rate in HZ
+ * @param	IsInterlaced specifies interlaced (1) or progressive (0).
+ * @param	IsExtensive selects basic (0) or extensive (1) matching.
+ *
+ * @return	Id of a supported video mode or XVIDC_VM_NOT_SUPPORTED.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static XVidC_VideoMode XVidC_ModeIndexLookup(const XVidC_VideoTiming *Timing,
+		u32 FrameRate, u8 IsInterlaced, u8 IsExtensive)
+{
+	XVidC_ModeIndex *Index = &XVidC_VmIndex;
+	const XVidC_VideoTimingMode *Mode;
+	u16 Entry;
+	u16 Id;
+
+	IsInterlaced = IsInterlaced ? 1 : 0;
+
+	if (!Index->IsValid) {
+		XVidC_ModeIndexBuild();
+	}
+
+	/* Custom tables too large for the index are searched linearly. */
+	if (XVidC_CustomTimingModes && !Index->IsCustomIndexed) {
+		for (Id = 0; Id < XVidC_NumCustomModes; Id++) {
+			Mode = &XVidC_CustomTimingModes[Id];
+			if ((Mode->Timing.HActive == Timing->HActive) &&
+				(Mode->Timing.VActive == Timing->VActive) &&
+				(Mode->FrameRate == FrameRate) &&
+				XVidC_IsTimingMatch(&Mode->Timing, Timing,
+					IsInterlaced, IsExtensive)) {
+				return Mode->VmId;
+			}
+		}
+	}
+
+	Entry = Index->Head[XVidC_ModeIndexHash(Timing->HActive,
+			Timing->VActive, FrameRate, IsInterlaced)];
+
+	while (Entry != XVIDC_MODE_INDEX_NONE) {
+		Mode = Index->Mode[Entry];
+		if ((Index->IsInterlaced[Entry] == IsInterlaced) &&
+			(Mode->Timing.HActive == Timing->HActive) &&
+			(Mode->Timing.VActive == Timing->VActive) &&
+			(Mode->FrameRate == FrameRate) &&
+			XVidC_IsTimingMatch(&Mode->Timing, Timing,
+				IsInterlaced, IsExtensive)) {
+			return Index->VmId[Entry];
+		}
+		Entry = Index->Next[Entry];
+	}
+
+	return (XVIDC_VM_NOT_SUPPORTED);
+}
+
 /******************************************************************************/
 /**
  * This function returns whether or not the video timing mode is a reduced
@@ -26,13 +26,95 @@
  *                     contents now const.
  * 4.0   aad  10/26/16 Added API for colormetry which returns fixed point
  *		       in Q0.10 format instead of float.
+ * 4.12  dc   10/22/21 Added XVidC_EdidParseCaps and
+ *                     XVidC_EdidCapsIsVideoTimingSupported.
+ *                     Established timings are checked from a table, which
+ *                     fixes the 800x600@56Hz lookup.
  * </pre>
  *
 *******************************************************************************/
 
 /******************************* Include Files ********************************/
 
+#include "string.h"
 #include "xvidc_edid.h"
+#include "xvidc_cea861.h"
+
+/************************** Constant Definitions ******************************/
+
+#define XVIDC_EDID_BLK_SIZE			128
+
+/* CTA-861 extension block layout. */
+#define XVIDC_EDID_CEA_TAG			0x02
+#define XVIDC_EDID_CEA_DTD_OFFSET		0x02
+#define XVIDC_EDID_CEA_FEATURES			0x03
+#define XVIDC_EDID_CEA_FEATURES_YCBCR444_MASK	(0x1 << 5)
+#define XVIDC_EDID_CEA_FEATURES_YCBCR422_MASK	(0x1 << 4)
+#define XVIDC_EDID_CEA_DATA_BLOCKS		0x04
+#define XVIDC_EDID_CEA_DB_TAG_SHIFT		5
+#define XVIDC_EDID_CEA_DB_LEN_MASK		0x1F
+#define XVIDC_EDID_CEA_DB_VIDEO			2
+#define XVIDC_EDID_CEA_DB_VENDOR		3
+#define XVIDC_EDID_CEA_DB_EXTENDED		7
+#define XVIDC_EDID_CEA_EXT_COLORIMETRY		5
+#define XVIDC_EDID_CEA_EXT_HDR_STATIC		6
+#define XVIDC_EDID_CEA_EXT_Y420_VIDEO		14
+#define XVIDC_EDID_CEA_EXT_Y420_CAP_MAP		15
+/* Maximum number of short video descriptors tracked for the YCbCr 4:2:0
+ * capability map. */
+#define XVIDC_EDID_CEA_MAX_SVDS			64
+
+/**************************** Type Definitions ********************************/
+
+/**
+ * Established timing entry. Mask selects the bit in the 24 bit word formed by
+ * established timings I, II and manufacturer's timings, MSB first.
+ */
+typedef struct {
+	u16 HActive;
+	u16 VActive;
+	u8 FrameRate;
+	u32 Mask;
+} XVidC_EdidEstTiming;
+
+/**************************** Variable Definitions ****************************/
+
+static const XVidC_EdidEstTiming XVidC_EdidEstTimings[] = {
+	{720,  400,  XVIDC_FR_70HZ,
+		XVIDC_EDID_EST_TIMINGS_I_720x400_70_MASK << 16},
+	{720,  400,  XVIDC_FR_88HZ,
+		XVIDC_EDID_EST_TIMINGS_I_720x400_88_MASK << 16},
+	{640,  480,  XVIDC_FR_60HZ,
+		XVIDC_EDID_EST_TIMINGS_I_640x480_60_MASK << 16},
+	{640,  480,  XVIDC_FR_67HZ,
+		XVIDC_EDID_EST_TIMINGS_I_640x480_67_MASK << 16},
+	{640,  480,  XVIDC_FR_72HZ,
+		XVIDC_EDID_EST_TIMINGS_I_640x480_72_MASK << 16},
+	{640,  480,  XVIDC_FR_75HZ,
+		XVIDC_EDID_EST_TIMINGS_I_640x480_75_MASK << 16},
+	{800,  600,  XVIDC_FR_56HZ,
+		XVIDC_EDID_EST_TIMINGS_I_800x600_56_MASK << 16},
+	{800,  600,  XVIDC_FR_60HZ,
+		XVIDC_EDID_EST_TIMINGS_I_800x600_60_MASK << 16},
+	{800,  600,  XVIDC_FR_72HZ,
+		XVIDC_EDID_EST_TIMINGS_II_800x600_72_MASK << 8},
+	{800,  600,  XVIDC_FR_75HZ,
+		XVIDC_EDID_EST_TIMINGS_II_800x600_75_MASK << 8},
+	{832,  624,  XVIDC_FR_75HZ,
+		XVIDC_EDID_EST_TIMINGS_II_832x624_75_MASK << 8},
+	{1024, 768,  XVIDC_FR_87HZ,
+		XVIDC_EDID_EST_TIMINGS_II_1024x768_87_MASK << 8},
+	{1024, 768,  XVIDC_FR_60HZ,
+		XVIDC_EDID_EST_TIMINGS_II_1024x768_60_MASK << 8},
+	{1024, 768,  XVIDC_FR_70HZ,
+		XVIDC_EDID_EST_TIMINGS_II_1024x768_70_MASK << 8},
+	{1024, 768,  XVIDC_FR_75HZ,
+		XVIDC_EDID_EST_TIMINGS_II_1024x768_75_MASK << 8},
+	{1280, 1024, XVIDC_FR_75HZ,
+		XVIDC_EDID_EST_TIMINGS_II_1280x1024_75_MASK << 8},
+	{1152, 870,  XVIDC_FR_75HZ,
+		XVIDC_EDID_EST_TIMINGS_MAN_1152x870_75_MASK},
+};
 
 /**************************** Function Prototypes *****************************/
 
@@ -44,6 +126,16 @@ static u32 XVidC_EdidIsVideoTimingSupportedStandardTimings(const u8 *EdidRaw,
 		const XVidC_VideoTimingMode *VtMode);
 static int XVidC_CalculatePower(u8 Base, u8 Power);
 static int XVidC_CalculateBinaryFraction_QFormat(u16 Val, u8 DecPtIndex);
+static u32 XVidC_EdidGetEstTimings(const u8 *EdidRaw);
+static u32 XVidC_EdidIsEstTimingSupported(u32 EstTimings,
+		const XVidC_VideoTimingMode *VtMode);
+static u32 XVidC_EdidCapsMatch(const XVidC_EdidCaps *Caps,
+		const XVidC_VideoTimingMode *VtMode);
+static void XVidC_EdidParseCeaBlock(const u8 *Block, XVidC_EdidCaps *Caps,
+		u8 *Svds, u8 *NumSvds, u8 *Y420Map, u8 *Y420MapLen);
+static void XVidC_EdidParseCeaExtended(const u8 *Payload, u8 Len,
+		XVidC_EdidCaps *Caps, u8 *Y420Map, u8 *Y420MapLen);
+static void XVidC_EdidSetVic(u32 *Bitmap, u8 Vic);
 
 /**************************** Function Definitions ****************************/
 
@@ -473,113 +565,9 @@ static u32 XVidC_EdidIsVideoTimingSupportedPreferredTiming(const u8 *EdidRaw,
 static u32 XVidC_EdidIsVideoTimingSupportedEstablishedTimings(const u8 *EdidRaw,
 		const XVidC_VideoTimingMode *VtMode)
 {
-	u32 Status = XST_FAILURE;
-
 	/* Check established timings I, II, and III. */
-	if ((VtMode->Timing.HActive == 800) &&
-			(VtMode->Timing.VActive == 640) &&
-			(VtMode->FrameRate == XVIDC_FR_56HZ) &&
-			XVidC_EdidSuppEstTimings800x600_56(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 640) &&
-			(VtMode->Timing.VActive == 480) &&
-			(VtMode->FrameRate == XVIDC_FR_60HZ) &&
-			XVidC_EdidSuppEstTimings640x480_60(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 800) &&
-			(VtMode->Timing.VActive == 600) &&
-			(VtMode->FrameRate == XVIDC_FR_60HZ) &&
-			XVidC_EdidSuppEstTimings800x600_60(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 1024) &&
-			(VtMode->Timing.VActive == 768) &&
-			(VtMode->FrameRate == XVIDC_FR_60HZ) &&
-			XVidC_EdidSuppEstTimings1024x768_60(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 640) &&
-			(VtMode->Timing.VActive == 480) &&
-			(VtMode->FrameRate == XVIDC_FR_67HZ) &&
-			XVidC_EdidSuppEstTimings640x480_67(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 720) &&
-			(VtMode->Timing.VActive == 400) &&
-			(VtMode->FrameRate == XVIDC_FR_70HZ) &&
-			XVidC_EdidSuppEstTimings720x400_70(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 1024) &&
-			(VtMode->Timing.VActive == 768) &&
-			(VtMode->FrameRate == XVIDC_FR_70HZ) &&
-			XVidC_EdidSuppEstTimings1024x768_70(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 640) &&
-			(VtMode->Timing.VActive == 480) &&
-			(VtMode->FrameRate == XVIDC_FR_72HZ) &&
-			XVidC_EdidSuppEstTimings640x480_72(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 800) &&
-			(VtMode->Timing.VActive == 600) &&
-			(VtMode->FrameRate == XVIDC_FR_72HZ) &&
-			XVidC_EdidSuppEstTimings800x600_72(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 640) &&
-			(VtMode->Timing.VActive == 480) &&
-			(VtMode->FrameRate == XVIDC_FR_75HZ) &&
-			XVidC_EdidSuppEstTimings640x480_75(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 800) &&
-			(VtMode->Timing.VActive == 600) &&
-			(VtMode->FrameRate == XVIDC_FR_75HZ) &&
-			XVidC_EdidSuppEstTimings800x600_75(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 832) &&
-			(VtMode->Timing.VActive == 624) &&
-			(VtMode->FrameRate == XVIDC_FR_75HZ) &&
-			XVidC_EdidSuppEstTimings832x624_75(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 1024) &&
-			(VtMode->Timing.VActive == 768) &&
-			(VtMode->FrameRate == XVIDC_FR_75HZ) &&
-			XVidC_EdidSuppEstTimings1024x768_75(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 1152) &&
-			(VtMode->Timing.VActive == 870) &&
-			(VtMode->FrameRate == XVIDC_FR_75HZ) &&
-			XVidC_EdidSuppEstTimings1152x870_75(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 1280) &&
-			(VtMode->Timing.VActive == 1024) &&
-			(VtMode->FrameRate == XVIDC_FR_75HZ) &&
-			XVidC_EdidSuppEstTimings1280x1024_75(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 1024) &&
-			(VtMode->Timing.VActive == 768) &&
-			(VtMode->FrameRate == XVIDC_FR_87HZ) &&
-			XVidC_EdidSuppEstTimings1024x768_87(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-	else if ((VtMode->Timing.HActive == 720) &&
-			(VtMode->Timing.VActive == 400) &&
-			(VtMode->FrameRate == XVIDC_FR_88HZ) &&
-			XVidC_EdidSuppEstTimings720x400_88(EdidRaw)) {
-		Status = XST_SUCCESS;
-	}
-
-	return Status;
+	return XVidC_EdidIsEstTimingSupported(XVidC_EdidGetEstTimings(EdidRaw),
+									VtMode);
 }
 
 /******************************************************************************/
@@ -678,4 +666,459 @@ static int XVidC_CalculateBinaryFraction_QFormat(u16 Val, u8 DecPtIndex)
 
 	return Res;
 }
+/******************************************************************************/
+/**
+ * Decodes the supplied Extended Display Identification Data (EDID), the base
+ * block followed by its CTA-861 extension blocks, into a capability structure.
+ * The raw EDID is walked once; video mode, VIC, colorimetry and HDR queries
+ * can then be answered from the structure in constant time.
+ *
+ * @param	EdidRaw is the supplied EDID, base block first.
+ * @param	Size is the number of valid bytes at EdidRaw. Extension blocks
+ *		beyond Size are ignored.
+ * @param	Caps is the capability structure to fill.
+ *
+ * @return
+ *		- XST_SUCCESS if the base block has a valid EDID header.
+ *		- XST_FAILURE otherwise. Caps is cleared.
+ *
+ * @note	Blocks with a bad checksum are decoded and counted in
+ *		NumChecksumErrors. Malformed data blocks are skipped.
+ *
+*******************************************************************************/
+u32 XVidC_EdidParseCaps(const u8 *EdidRaw, u32 Size, XVidC_EdidCaps *Caps)
+{
+	const XVidC_VideoTimingMode *VtMode;
+	const u8 *Block;
+	u8 Svds[XVIDC_EDID_CEA_MAX_SVDS];
+	u8 NumSvds = 0;
+	u8 Y420Map[XVIDC_EDID_CEA_DB_LEN_MASK];
+	u8 Y420MapLen = 0;
+	u8 HasY420Map = 0;
+	u8 Sum;
+	u32 Index;
+	u32 Offset;
+	u32 NumBlocks;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(EdidRaw != NULL);
+	Xil_AssertNonvoid(Caps != NULL);
+
+	(void)memset((void *)Caps, 0, sizeof(XVidC_EdidCaps));
+
+	if ((Size < XVIDC_EDID_BLK_SIZE) || !XVidC_EdidIsHeaderValid(EdidRaw)) {
+		return XST_FAILURE;
+	}
+
+	/* Base block. */
+	Caps->PtmHActive = (((EdidRaw[XVIDC_EDID_PTM +
+			XVIDC_EDID_DTD_PTM_HRES_HBLANK_U4] &
+			XVIDC_EDID_DTD_PTM_XRES_XBLANK_U4_XRES_MASK) >>
+			XVIDC_EDID_DTD_PTM_XRES_XBLANK_U4_XRES_SHIFT) << 8) |
+			EdidRaw[XVIDC_EDID_PTM + XVIDC_EDID_DTD_PTM_HRES_LSB];
+	Caps->PtmVActive = (((EdidRaw[XVIDC_EDID_PTM +
+			XVIDC_EDID_DTD_PTM_VRES_VBLANK_U4] &
+			XVIDC_EDID_DTD_PTM_XRES_XBLANK_U4_XRES_MASK) >>
+			XVIDC_EDID_DTD_PTM_XRES_XBLANK_U4_XRES_SHIFT) << 8) |
+			EdidRaw[XVIDC_EDID_PTM + XVIDC_EDID_DTD_PTM_VRES_LSB];
+	Caps->PtmIsInterlaced = XVidC_EdidIsDtdPtmInterlaced(EdidRaw);
+	Caps->EstTimings = XVidC_EdidGetEstTimings(EdidRaw);
+	Caps->ColorDepth = XVidC_EdidGetColorDepth(EdidRaw);
+
+	for (Index = 1; Index <= 8; Index++) {
+		/* Unused standard timing slots are coded as 01h 01h. */
+		if ((EdidRaw[XVIDC_EDID_STD_TIMINGS_H(Index)] == 0x01) &&
+			(EdidRaw[XVIDC_EDID_STD_TIMINGS_AR_FRR(Index)] == 0x01)) {
+			continue;
+		}
+		Caps->StdTimings[Caps->NumStdTimings].HActive =
+				XVidC_EdidGetStdTimingsH(EdidRaw, Index);
+		Caps->StdTimings[Caps->NumStdTimings].VActive =
+				XVidC_EdidGetStdTimingsV(EdidRaw, Index);
+		Caps->StdTimings[Caps->NumStdTimings].FrameRate =
+				(u8)XVidC_EdidGetStdTimingsFrr(EdidRaw, Index);
+		Caps->NumStdTimings++;
+	}
+
+	for (Index = 0; Index < XVIDC_VM_NUM_SUPPORTED; Index++) {
+		VtMode = XVidC_GetVideoModeData((XVidC_VideoMode)Index);
+		if (XVidC_EdidCapsMatch(Caps, VtMode) == XST_SUCCESS) {
+			Caps->VmSupported[Index >> 5] |= (u32)1 << (Index & 0x1F);
+		}
+	}
+
+	/* Extension blocks. */
+	Caps->NumExtBlocks = XVidC_EdidGetExtBlkCount(EdidRaw);
+	NumBlocks = 1 + Caps->NumExtBlocks;
+	if (NumBlocks > (Size / XVIDC_EDID_BLK_SIZE)) {
+		NumBlocks = Size / XVIDC_EDID_BLK_SIZE;
+	}
+
+	for (Index = 0; Index < NumBlocks; Index++) {
+		Block = &EdidRaw[Index * XVIDC_EDID_BLK_SIZE];
+
+		Sum = 0;
+		for (Offset = 0; Offset < XVIDC_EDID_BLK_SIZE; Offset++) {
+			Sum += Block[Offset];
+		}
+		if (Sum != 0) {
+			Caps->NumChecksumErrors++;
+		}
+
+		if ((Index > 0) && (Block[0] == XVIDC_EDID_CEA_TAG)) {
+			XVidC_EdidParseCeaBlock(Block, Caps, Svds, &NumSvds,
+					Y420Map, &Y420MapLen);
+			Caps->NumCeaBlocks++;
+			HasY420Map |= (Y420MapLen != 0);
+		}
+	}
+
+	/* Apply the YCbCr 4:2:0 capability map to the video data blocks. An
+	 * empty map means all listed VICs support YCbCr 4:2:0. */
+	if (HasY420Map) {
+		for (Index = 0; Index < NumSvds; Index++) {
+			if ((Y420MapLen == 0xFF) || ((Index / 8 < Y420MapLen) &&
+				((Y420Map[Index / 8] >> (Index % 8)) & 0x1))) {
+				XVidC_EdidSetVic(Caps->VicYCbCr420, Svds[Index]);
+			}
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * Checks whether or not a specified video timing mode is supported by a sink
+ * whose EDID was decoded with XVidC_EdidParseCaps. The result is the same as
+ * XVidC_EdidIsVideoTimingSupported on the raw base EDID.
+ *
+ * @param	Caps is the decoded capability structure.
+ * @param	VtMode is the video timing mode to check for support.
+ *
+ * @return
+ *		- XST_SUCCESS if the video timing mode is supported.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	Modes of the video timing table are a single bit lookup.
+ *
+*******************************************************************************/
+u32 XVidC_EdidCapsIsVideoTimingSupported(const XVidC_EdidCaps *Caps,
+		const XVidC_VideoTimingMode *VtMode)
+{
+	/* Verify arguments. */
+	Xil_AssertNonvoid(Caps != NULL);
+	Xil_AssertNonvoid(VtMode != NULL);
+
+	if ((VtMode->VmId < XVIDC_VM_NUM_SUPPORTED) &&
+		(XVidC_GetVideoModeData(VtMode->VmId) == VtMode)) {
+		return XVidC_EdidCapsIsVmSupported(Caps, VtMode->VmId) ?
+						XST_SUCCESS : XST_FAILURE;
+	}
+
+	return XVidC_EdidCapsMatch(Caps, VtMode);
+}
+
+/******************************************************************************/
+/**
+ * Returns the established timings I, II and manufacturer's timings bytes of
+ * the supplied base EDID as one word, MSB first.
+ *
+ * @param	EdidRaw is the supplied base EDID.
+ *
+ * @return	The established timings word.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XVidC_EdidGetEstTimings(const u8 *EdidRaw)
+{
+	return ((u32)EdidRaw[XVIDC_EDID_EST_TIMINGS_I] << 16) |
+		((u32)EdidRaw[XVIDC_EDID_EST_TIMINGS_II] << 8) |
+		EdidRaw[XVIDC_EDID_EST_TIMINGS_MAN];
+}
+
+/******************************************************************************/
+/**
+ * Checks whether or not a specified video timing mode is set in the supplied
+ * established timings word.
+ *
+ * @param	EstTimings is the word returned by XVidC_EdidGetEstTimings.
+ * @param	VtMode is the video timing mode to check for support.
+ *
+ * @return
+ *		- XST_SUCCESS if the video timing mode is an established
+ *		  timing flagged as supported.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XVidC_EdidIsEstTimingSupported(u32 EstTimings,
+		const XVidC_VideoTimingMode *VtMode)
+{
+	u8 Index;
+
+	for (Index = 0; Index < (sizeof(XVidC_EdidEstTimings) /
+			sizeof(XVidC_EdidEstTimings[0])); Index++) {
+		if ((VtMode->Timing.HActive ==
+				XVidC_EdidEstTimings[Index].HActive) &&
+			(VtMode->Timing.VActive ==
+				XVidC_EdidEstTimings[Index].VActive) &&
+			(VtMode->FrameRate ==
+				XVidC_EdidEstTimings[Index].FrameRate)) {
+			return (EstTimings & XVidC_EdidEstTimings[Index].Mask) ?
+						XST_SUCCESS : XST_FAILURE;
+		}
+	}
+
+	return XST_FAILURE;
+}
+
+/******************************************************************************/
+/**
+ * Checks a video timing mode against the preferred, established and standard
+ * timings of a decoded base EDID.
+ *
+ * @param	Caps is the decoded capability structure.
+ * @param	VtMode is the video timing mode to check for support.
+ *
+ * @return
+ *		- XST_SUCCESS if the video timing mode is supported.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	Mirrors XVidC_EdidIsVideoTimingSupported.
+ *
+*******************************************************************************/
+static u32 XVidC_EdidCapsMatch(const XVidC_EdidCaps *Caps,
+		const XVidC_VideoTimingMode *VtMode)
+{
+	u8 Index;
+
+	/* Preferred timing. */
+	if ((VtMode->Timing.F1VTotal == Caps->PtmIsInterlaced) &&
+		(VtMode->Timing.HActive == Caps->PtmHActive) &&
+		(VtMode->Timing.VActive == Caps->PtmVActive)) {
+		return XST_SUCCESS;
+	}
+
+	/* Established timings I, II, and III. */
+	if (XVidC_EdidIsEstTimingSupported(Caps->EstTimings, VtMode) ==
+								XST_SUCCESS) {
+		return XST_SUCCESS;
+	}
+
+	/* Standard timings. */
+	for (Index = 0; Index < Caps->NumStdTimings; Index++) {
+		if ((VtMode->Timing.HActive == Caps->StdTimings[Index].HActive) &&
+			(VtMode->Timing.VActive ==
+				Caps->StdTimings[Index].VActive) &&
+			(VtMode->FrameRate ==
+				Caps->StdTimings[Index].FrameRate)) {
+			return XST_SUCCESS;
+		}
+	}
+
+	return XST_FAILURE;
+}
+
+/******************************************************************************/
+/**
+ * Decodes the data block collection of a CTA-861 extension block.
+ *
+ * @param	Block is the 128 byte extension block.
+ * @param	Caps is the capability structure to update.
+ * @param	Svds collects the VICs of the video data blocks in order.
+ * @param	NumSvds is the number of entries in Svds.
+ * @param	Y420Map collects the YCbCr 4:2:0 capability map.
+ * @param	Y420MapLen is the length of Y420Map; 0xFF when the map applies
+ *		to all VICs.
+ *
+ * @return	None.
+ *
+ * @note	Data blocks which run past the detailed timing offset are
+ *		ignored.
+ *
+*******************************************************************************/
+static void XVidC_EdidParseCeaBlock(const u8 *Block, XVidC_EdidCaps *Caps,
+		u8 *Svds, u8 *NumSvds, u8 *Y420Map, u8 *Y420MapLen)
+{
+	const u8 *Payload;
+	u32 Offset = XVIDC_EDID_CEA_DATA_BLOCKS;
+	u32 End = Block[XVIDC_EDID_CEA_DTD_OFFSET];
+	u8 Tag;
+	u8 Len;
+	u8 Index;
+	u8 Vic;
+
+	if (Block[XVIDC_EDID_CEA_FEATURES] & XVIDC_EDID_CEA_FEATURES_YCBCR444_MASK) {
+		Caps->IsYCbCr444Supp = 1;
+	}
+	if (Block[XVIDC_EDID_CEA_FEATURES] & XVIDC_EDID_CEA_FEATURES_YCBCR422_MASK) {
+		Caps->IsYCbCr422Supp = 1;
+	}
+
+	/* No data block collection, or a corrupt offset. */
+	if ((End <= XVIDC_EDID_CEA_DATA_BLOCKS) ||
+		(End >= XVIDC_EDID_BLK_SIZE)) {
+		return;
+	}
+
+	while (Offset < End) {
+		Tag = Block[Offset] >> XVIDC_EDID_CEA_DB_TAG_SHIFT;
+		Len = Block[Offset] & XVIDC_EDID_CEA_DB_LEN_MASK;
+		Payload = &Block[Offset + 1];
+		if ((Offset + 1 + Len) > End) {
+			break;
+		}
+
+		switch (Tag) {
+			case XVIDC_EDID_CEA_DB_VIDEO:
+				for (Index = 0; Index < Len; Index++) {
+					/* VICs 1-64 may be flagged native. */
+					Vic = Payload[Index];
+					if ((Vic >= 129) && (Vic <= 192)) {
+						Vic &= 0x7F;
+						XVidC_EdidSetVic(Caps->VicNative,
+									Vic);
+					}
+					XVidC_EdidSetVic(Caps->VicSupported,
+									Vic);
+					if (*NumSvds < XVIDC_EDID_CEA_MAX_SVDS) {
+						Svds[(*NumSvds)++] = Vic;
+					}
+				}
+				break;
+
+			case XVIDC_EDID_CEA_DB_VENDOR:
+				if (Len < 3) {
+					break;
+				}
+				/* IEEE OUI is stored LSB first. */
+				if ((Payload[0] == HDMI_OUI[2]) &&
+					(Payload[1] == HDMI_OUI[1]) &&
+					(Payload[2] == HDMI_OUI[0])) {
+					Caps->IsHdmi = 1;
+					if ((Len >= 7) && (Payload[6] * 5 >
+							Caps->MaxTmdsMhz)) {
+						Caps->MaxTmdsMhz =
+							Payload[6] * 5;
+					}
+				}
+				else if ((Payload[0] == HDMI_OUI_HF[2]) &&
+					(Payload[1] == HDMI_OUI_HF[1]) &&
+					(Payload[2] == HDMI_OUI_HF[0])) {
+					Caps->IsHdmiForum = 1;
+					if ((Len >= 5) && (Payload[4] * 5 >
+							Caps->MaxTmdsMhz)) {
+						Caps->MaxTmdsMhz =
+							Payload[4] * 5;
+					}
+					if ((Len >= 6) && (Payload[5] & 0x80)) {
+						Caps->IsScdcPresent = 1;
+					}
+				}
+				break;
+
+			case XVIDC_EDID_CEA_DB_EXTENDED:
+				if (Len >= 1) {
+					XVidC_EdidParseCeaExtended(Payload, Len,
+						Caps, Y420Map, Y420MapLen);
+				}
+				break;
+
+			default:
+				break;
+		}
+
+		Offset += 1 + Len;
+	}
+}
+
+/******************************************************************************/
+/**
+ * Decodes a CTA-861 extended tag data block.
+ *
+ * @param	Payload is the data block payload, starting with the extended
+ *		tag code.
+ * @param	Len is the payload length in bytes, at least 1.
+ * @param	Caps is the capability structure to update.
+ * @param	Y420Map collects the YCbCr 4:2:0 capability map.
+ * @param	Y420MapLen is the length of Y420Map.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void XVidC_EdidParseCeaExtended(const u8 *Payload, u8 Len,
+		XVidC_EdidCaps *Caps, u8 *Y420Map, u8 *Y420MapLen)
+{
+	u8 Index;
+
+	switch (Payload[0]) {
+		case XVIDC_EDID_CEA_EXT_COLORIMETRY:
+			if (Len >= 2) {
+				Caps->Colorimetry |= Payload[1];
+			}
+			break;
+
+		case XVIDC_EDID_CEA_EXT_HDR_STATIC:
+			if (Len >= 3) {
+				Caps->HdrEotf |= Payload[1] & 0x3F;
+				Caps->HdrMetadataType |= Payload[2];
+			}
+			if (Len >= 4) {
+				Caps->HdrMaxLuminance = Payload[3];
+			}
+			if (Len >= 5) {
+				Caps->HdrMaxFrameAvgLuminance = Payload[4];
+			}
+			if (Len >= 6) {
+				Caps->HdrMinLuminance = Payload[5];
+			}
+			break;
+
+		case XVIDC_EDID_CEA_EXT_Y420_VIDEO:
+			for (Index = 1; Index < Len; Index++) {
+				XVidC_EdidSetVic(Caps->VicSupported,
+								Payload[Index]);
+				XVidC_EdidSetVic(Caps->VicYCbCr420,
+								Payload[Index]);
+			}
+			break;
+
+		case XVIDC_EDID_CEA_EXT_Y420_CAP_MAP:
+			if (Len == 1) {
+				*Y420MapLen = 0xFF;
+			}
+			else if (*Y420MapLen != 0xFF) {
+				for (Index = 1; Index < Len; Index++) {
+					Y420Map[Index - 1] = Payload[Index];
+				}
+				*Y420MapLen = Len - 1;
+			}
+			break;
+
+		default:
+			break;
+	}
+}
+
+/******************************************************************************/
+/**
+ * Sets the bit of a VIC in a 256 bit VIC bitmap.
+ *
+ * @param	Bitmap is the VIC bitmap of 8 words.
+ * @param	Vic is the video identification code.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void XVidC_EdidSetVic(u32 *Bitmap, u8 Vic)
+{
+	Bitmap[Vic >> 5] |= (u32)1 << (Vic & 0x1F);
+}
 /** @} */
@@ -27,6 +27,8 @@
  *                     contents now const.
  * 4.0   aad  10/26/16 Functions which return fixed point values instead of
  *		       float
+ * 4.12  dc   10/22/21 Added XVidC_EdidCaps and XVidC_EdidParseCaps to decode
+ *                     the base block and CTA-861 extensions once
  * </pre>
  *
 *******************************************************************************/
@@ -426,6 +428,83 @@ extern "C" {
 /* Checksum. */
 #define XVidC_EdidGetChecksum(E)	(E[XVIDC_EDID_CHECKSUM])
 
+/* Parsed capabilities. */
+#define XVidC_EdidCapsIsVmSupported(C, VmId) \
+	(((u32)(VmId) < XVIDC_VM_NUM_SUPPORTED) && \
+	(((C)->VmSupported[(u32)(VmId) >> 5] >> ((u32)(VmId) & 0x1F)) & 0x1))
+#define XVidC_EdidCapsIsVicSupported(C, Vic) \
+	((((C)->VicSupported[(u8)(Vic) >> 5]) >> ((u8)(Vic) & 0x1F)) & 0x1)
+#define XVidC_EdidCapsIsVicNative(C, Vic) \
+	((((C)->VicNative[(u8)(Vic) >> 5]) >> ((u8)(Vic) & 0x1F)) & 0x1)
+#define XVidC_EdidCapsIsVicYCbCr420(C, Vic) \
+	((((C)->VicYCbCr420[(u8)(Vic) >> 5]) >> ((u8)(Vic) & 0x1F)) & 0x1)
+
+/****************************** Type Definitions ******************************/
+
+/** @name CTA-861 extension: Colorimetry and HDR static metadata bits.
+ * @{
+ */
+#define XVIDC_EDID_CAPS_COLORIMETRY_XVYCC601		(0x1 << 0)
+#define XVIDC_EDID_CAPS_COLORIMETRY_XVYCC709		(0x1 << 1)
+#define XVIDC_EDID_CAPS_COLORIMETRY_SYCC601		(0x1 << 2)
+#define XVIDC_EDID_CAPS_COLORIMETRY_OPYCC601		(0x1 << 3)
+#define XVIDC_EDID_CAPS_COLORIMETRY_OPRGB		(0x1 << 4)
+#define XVIDC_EDID_CAPS_COLORIMETRY_BT2020CYCC		(0x1 << 5)
+#define XVIDC_EDID_CAPS_COLORIMETRY_BT2020YCC		(0x1 << 6)
+#define XVIDC_EDID_CAPS_COLORIMETRY_BT2020RGB		(0x1 << 7)
+#define XVIDC_EDID_CAPS_EOTF_TG_SDR			(0x1 << XVIDC_EOTF_TG_SDR)
+#define XVIDC_EDID_CAPS_EOTF_TG_HDR			(0x1 << XVIDC_EOTF_TG_HDR)
+#define XVIDC_EDID_CAPS_EOTF_SMPTE2084			(0x1 << XVIDC_EOTF_SMPTE2084)
+#define XVIDC_EDID_CAPS_EOTF_HLG			(0x1 << XVIDC_EOTF_HLG)
+/* @} */
+
+/**
+ * Capabilities of a sink decoded from its EDID by XVidC_EdidParseCaps. Once
+ * filled, all queries are constant time and the raw EDID is not read again.
+ */
+typedef struct {
+	/* Base block. */
+	u32 VmSupported[(XVIDC_VM_NUM_SUPPORTED + 31) / 32];
+				/**< One bit per XVidC_VideoMode; set when
+				  *  XVidC_EdidIsVideoTimingSupported would
+				  *  report the mode as supported. */
+	u32 EstTimings;		/**< Established timings I, II and
+				  *  manufacturer's timings, MSB first. */
+	u16 PtmHActive;		/**< Preferred timing horizontal active. */
+	u16 PtmVActive;		/**< Preferred timing vertical active. */
+	u8 PtmIsInterlaced;	/**< Preferred timing is interlaced. */
+	u8 NumStdTimings;	/**< Number of entries in StdTimings. */
+	struct {
+		u16 HActive;
+		u16 VActive;
+		u8 FrameRate;
+	} StdTimings[8];	/**< Decoded standard timings. */
+	XVidC_ColorDepth ColorDepth;	/**< Color bit depth. */
+
+	/* CTA-861 extension blocks. */
+	u32 VicSupported[8];	/**< Bit per VIC listed in a video data block
+				  *  or a YCbCr 4:2:0 video data block. */
+	u32 VicNative[8];	/**< Bit per VIC flagged as native. */
+	u32 VicYCbCr420[8];	/**< Bit per VIC which can be sent as YCbCr
+				  *  4:2:0. */
+	u8 NumExtBlocks;	/**< Extension blocks present. */
+	u8 NumCeaBlocks;	/**< CTA-861 extension blocks decoded. */
+	u8 NumChecksumErrors;	/**< Blocks with an invalid checksum. */
+	u8 IsHdmi;		/**< HDMI vendor specific data block present. */
+	u8 IsHdmiForum;		/**< HDMI Forum VSDB present. */
+	u8 IsScdcPresent;	/**< SCDC supported (HDMI Forum VSDB). */
+	u8 IsYCbCr444Supp;	/**< YCbCr 4:4:4 supported. */
+	u8 IsYCbCr422Supp;	/**< YCbCr 4:2:2 supported. */
+	u16 MaxTmdsMhz;		/**< Max TMDS clock/character rate in MHz. */
+	u8 Colorimetry;		/**< XVIDC_EDID_CAPS_COLORIMETRY_* bits. */
+	u8 HdrEotf;		/**< XVIDC_EDID_CAPS_EOTF_* bits. */
+	u8 HdrMetadataType;	/**< Static metadata descriptor bits. */
+	u8 HdrMaxLuminance;	/**< Desired content max luminance (coded). */
+	u8 HdrMaxFrameAvgLuminance;	/**< Desired content max frame average
+					  *  luminance (coded). */
+	u8 HdrMinLuminance;	/**< Desired content min luminance (coded). */
+} XVidC_EdidCaps;
+
 /**************************** Function Prototypes *****************************/
 
 /* Vendor and product identification: ID manufacturer name. */
@@ -451,6 +530,11 @@ u16 XVidC_EdidGetStdTimingsV(const u8 *EdidRaw, u8 StdTimingsNum);
 u32 XVidC_EdidIsVideoTimingSupported(const u8 *EdidRaw,
 		const XVidC_VideoTimingMode *VtMode);
 
+/* Parsed capabilities. */
+u32 XVidC_EdidParseCaps(const u8 *EdidRaw, u32 Size, XVidC_EdidCaps *Caps);
+u32 XVidC_EdidCapsIsVideoTimingSupported(const XVidC_EdidCaps *Caps,
+		const XVidC_VideoTimingMode *VtMode);
+
 #ifdef __cplusplus
 }
 #endif
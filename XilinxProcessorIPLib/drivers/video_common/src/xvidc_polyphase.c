@@ -0,0 +1,176 @@
+/*******************************************************************************
+* Copyright (C) 2021 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_polyphase.c
+ * @addtogroup video_common_v4_12
+ * @{
+ *
+ * Contains the implementation of the polyphase filter coefficient generator.
+ * Refer to xvidc_polyphase.h for a description.
+ *
+ * @note	None.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.12  dc   10/25/21 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+/******************************* Include Files ********************************/
+
+#include "xil_assert.h"
+#include "xvidc_polyphase.h"
+
+/************************** Constant Definitions ******************************/
+
+#define XVIDC_POLYPHASE_PI	3.14159265f
+
+/**************************** Function Prototypes *****************************/
+
+static float XVidC_PolyphaseSinPi(float X);
+static float XVidC_PolyphaseSinc(float X);
+
+/*************************** Function Definitions *****************************/
+
+/******************************************************************************/
+/**
+ * This function generates the polyphase filter coefficients for scaling
+ * SizeIn samples to SizeOut samples.
+ *
+ * Phase P of the table interpolates at P / NumPhases input samples past tap
+ * (NumTaps / 2 - 1). Tap K is weighted by
+ *	sinc(Fc * X) * sinc(X / (NumTaps / 2)),  X = K - (NumTaps / 2 - 1) - P / NumPhases
+ * where the cut-off Fc is 1 when up scaling and SizeOut / SizeIn when down
+ * scaling. The weights of each phase are normalized and rounded so that they
+ * sum to XVIDC_POLYPHASE_UNITY exactly.
+ *
+ * @param	SizeIn is the input width or height.
+ * @param	SizeOut is the output width or height.
+ * @param	NumPhases is the number of phases, at most
+ *		XVIDC_POLYPHASE_MAX_PHASES.
+ * @param	NumTaps is the number of taps, an even number of at most
+ *		XVIDC_POLYPHASE_MAX_TAPS.
+ * @param	Coeff is the table of NumPhases x NumTaps coefficients to fill,
+ *		phase major.
+ *
+ * @return
+ *		- XST_SUCCESS if the table was generated.
+ *		- XST_INVALID_PARAM if a size is 0 or the phase or tap count is
+ *		  not supported.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+u32 XVidC_PolyphaseGenCoeff(u32 SizeIn, u32 SizeOut, u16 NumPhases,
+		u16 NumTaps, s16 *Coeff)
+{
+	float Weight[XVIDC_POLYPHASE_MAX_TAPS];
+	float Cutoff;
+	float Half;
+	float Sum;
+	float X;
+	s32 Value;
+	s32 Total;
+	u16 Phase;
+	u16 Tap;
+	u16 Peak;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(Coeff != NULL);
+
+	if ((SizeIn == 0) || (SizeOut == 0) || (NumPhases == 0) ||
+		(NumPhases > XVIDC_POLYPHASE_MAX_PHASES) || (NumTaps < 2) ||
+		(NumTaps > XVIDC_POLYPHASE_MAX_TAPS) || (NumTaps & 0x1)) {
+		return XST_INVALID_PARAM;
+	}
+
+	Cutoff = (SizeOut < SizeIn) ? ((float)SizeOut / (float)SizeIn) : 1.0f;
+	Half = (float)(NumTaps / 2);
+
+	for (Phase = 0; Phase < NumPhases; Phase++) {
+		Sum = 0.0f;
+		for (Tap = 0; Tap < NumTaps; Tap++) {
+			X = (float)Tap - (Half - 1.0f) -
+					((float)Phase / (float)NumPhases);
+			Weight[Tap] = XVidC_PolyphaseSinc(Cutoff * X) *
+					XVidC_PolyphaseSinc(X / Half);
+			Sum += Weight[Tap];
+		}
+
+		/* Normalize to unity gain and put the rounding error on the
+		 * largest tap. */
+		Total = 0;
+		Peak = 0;
+		for (Tap = 0; Tap < NumTaps; Tap++) {
+			X = (Weight[Tap] / Sum) * (float)XVIDC_POLYPHASE_UNITY;
+			Value = (X >= 0.0f) ? (s32)(X + 0.5f) : -(s32)(0.5f - X);
+			Coeff[(Phase * NumTaps) + Tap] = (s16)Value;
+			Total += Value;
+			if (Weight[Tap] > Weight[Peak]) {
+				Peak = Tap;
+			}
+		}
+		Coeff[(Phase * NumTaps) + Peak] += (s16)(XVIDC_POLYPHASE_UNITY -
+									Total);
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function calculates sin(pi * X) without the math library.
+ *
+ * @param	X is the argument in half turns.
+ *
+ * @return	sin(pi * X).
+ *
+ * @note	The argument is reduced to [-0.5, 0.5] and evaluated with a
+ *		Taylor series, accurate to better than 1e-6.
+ *
+*******************************************************************************/
+static float XVidC_PolyphaseSinPi(float X)
+{
+	float Y;
+	float Y2;
+	s32 Turns;
+
+	Turns = (X >= 0.0f) ? (s32)(X + 0.5f) : -(s32)(0.5f - X);
+	Y = (X - (float)Turns) * XVIDC_POLYPHASE_PI;
+	Y2 = Y * Y;
+
+	Y = Y * (1.0f - Y2 / 6.0f * (1.0f - Y2 / 20.0f * (1.0f - Y2 / 42.0f *
+		(1.0f - Y2 / 72.0f * (1.0f - Y2 / 110.0f)))));
+
+	return (Turns & 0x1) ? -Y : Y;
+}
+
+/******************************************************************************/
+/**
+ * This function calculates the normalized sinc, sin(pi * X) / (pi * X).
+ *
+ * @param	X is the argument.
+ *
+ * @return	sinc(X).
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static float XVidC_PolyphaseSinc(float X)
+{
+	if ((X < 1e-6f) && (X > -1e-6f)) {
+		return 1.0f;
+	}
+
+	return XVidC_PolyphaseSinPi(X) / (XVIDC_POLYPHASE_PI * X);
+}
+/** @} */
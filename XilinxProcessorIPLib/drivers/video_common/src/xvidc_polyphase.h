@@ -0,0 +1,68 @@
+/*******************************************************************************
+* Copyright (C) 2021 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_polyphase.h
+ * @addtogroup video_common_v4_12
+ * @{
+ * @details
+ *
+ * Contains the polyphase filter coefficient generator shared by the video
+ * scaler drivers. Coefficients are computed at run time for the exact scaling
+ * ratio from a Lanczos windowed sinc. When down scaling, the sinc cut-off is
+ * lowered to the output sampling rate to limit aliasing.
+ *
+ * Each phase of the generated table sums to XVIDC_POLYPHASE_UNITY, which is
+ * the fixed point format used by the scaler cores.
+ *
+ * @note	The generator does not depend on the math library.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.12  dc   10/25/21 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+#ifndef XVIDC_POLYPHASE_H_  /* Prevent circular inclusions by using protection
+			     * macros. */
+#define XVIDC_POLYPHASE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************* Include Files ********************************/
+
+#include "xil_types.h"
+#include "xstatus.h"
+
+/************************** Constant Definitions ******************************/
+
+/** @name Polyphase coefficient format.
+ * @{
+ */
+#define XVIDC_POLYPHASE_PRECISION	12
+#define XVIDC_POLYPHASE_UNITY		(1 << XVIDC_POLYPHASE_PRECISION)
+#define XVIDC_POLYPHASE_MAX_TAPS	12
+#define XVIDC_POLYPHASE_MAX_PHASES	64
+/* @} */
+
+/**************************** Function Prototypes *****************************/
+
+u32 XVidC_PolyphaseGenCoeff(u32 SizeIn, u32 SizeOut, u16 NumPhases,
+		u16 NumTaps, s16 *Coeff);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XVIDC_POLYPHASE_H_ */
+/** @} */
@@ -25,6 +25,7 @@
 *                     It fixes CR#1089129.
 * 7.6   mus  07/29/21 Updated Xil_TestMem8 to fix issues reported by static
 *                     analysis tool. It fixes CR#1105956.
+* 7.7   dc   10/30/21 Added Xil_TestMemBlock block oriented memory test
 * </pre>
 *
 *****************************************************************************/
@@ -35,9 +36,31 @@
 #include "xil_assert.h"
 
 /************************** Constant Definitions ****************************/
+
+/* Block test passes */
+#define TESTMEM_BLOCK_WRITE		0U	/* Write the pattern */
+#define TESTMEM_BLOCK_VERIFY		1U	/* Verify the pattern */
+#define TESTMEM_BLOCK_VERIFY_INVERT	2U	/* Verify, write the inverse */
+
+/* Block test patterns used internally, next to XIL_TESTMEM_BLOCK_* */
+#define TESTMEM_BLOCK_FIXED		0xFFU
+
+#define TESTMEM_BLOCK_SEED		0x2545F4914F6CDD1DULL
+#define TESTMEM_BLOCK_GOLDEN		0x9E3779B97F4A7C15ULL
+#define TESTMEM_BLOCK_CHECKERBOARD	0x5555555555555555ULL
+
+/*
+ * Keeps the compiler from forwarding the values written in one pass to the
+ * reads of the next pass
+ */
+#define TESTMEM_BARRIER()	__asm__ __volatile__("" : : : "memory")
+
 /************************** Function Prototypes *****************************/
 
 static u32 RotateLeft(u32 Input, u8 Width);
+static s32 TestMemBlockPass(u64 *Addr, UINTPTR Blocks, u8 Pattern, u64 Seed,
+			    u64 Invert, u8 Op, u8 Descending,
+			    Xil_TestMemBlockResult *Result);
 
 /* define ROTATE_RIGHT to give access to this functionality */
 /* #define ROTATE_RIGHT */
@@ -1470,6 +1493,308 @@ End_Label:
 }
 #endif
 
+/*****************************************************************************/
+/**
+*
+* @brief    Perform a destructive block oriented memory test.
+*
+* @param    Addr: pointer to the region of memory to be tested, 64-bit
+*           aligned.
+* @param    Len: length of the region in bytes, a multiple of
+*           XIL_TESTMEM_BLOCK_SIZE.
+* @param    Seed: seed of the random block test, if 0, a fixed seed is used.
+* @param    Subtest: type of test selected. See xil_testmem.h for possible
+*           values.
+* @param    Result: filled with the failing address and data on a failure,
+*           may be NULL.
+*
+* @return
+*           - -1 is returned for a failure
+*           - 0 is returned for a pass
+*
+* @note
+* The region is tested XIL_TESTMEM_BLOCK_SIZE bytes at a time, all the
+* words of a block are compared at once and only a mismatching block is
+* looked at word by word. With the data cache enabled, the region has to be
+* much larger than the cache to test the memory instead of the cache.
+*
+*****************************************************************************/
+s32 Xil_TestMemBlock(u64 *Addr, UINTPTR Len, u64 Seed, u8 Subtest,
+		     Xil_TestMemBlockResult *Result)
+{
+	UINTPTR Blocks;
+	u64 Pattern;
+	u32 I;
+	u8 Current = Subtest;
+	s32 Status = 0;
+
+	Xil_AssertNonvoid(((UINTPTR)Addr % sizeof(u64)) == 0U);
+	Xil_AssertNonvoid((Len != 0U) && ((Len % XIL_TESTMEM_BLOCK_SIZE) == 0U));
+	Xil_AssertNonvoid(Subtest <= (u8)XIL_TESTMEM_BLOCK_MAXTEST);
+
+	Blocks = Len / XIL_TESTMEM_BLOCK_SIZE;
+	if (Seed == 0U) {
+		Seed = TESTMEM_BLOCK_SEED;
+	}
+
+	if ((Subtest == XIL_TESTMEM_BLOCK_ALLTESTS) ||
+	    (Subtest == XIL_TESTMEM_BLOCK_WALKONES)) {
+		Current = XIL_TESTMEM_BLOCK_WALKONES;
+		Status = TestMemBlockPass(Addr, Blocks,
+				XIL_TESTMEM_BLOCK_WALKONES, 0U, 0U,
+				TESTMEM_BLOCK_WRITE, 0U, Result);
+		if (Status == 0) {
+			Status = TestMemBlockPass(Addr, Blocks,
+					XIL_TESTMEM_BLOCK_WALKONES, 0U, 0U,
+					TESTMEM_BLOCK_VERIFY, 0U, Result);
+		}
+		if (Status != 0) {
+			goto End_Label;
+		}
+	}
+
+	if ((Subtest == XIL_TESTMEM_BLOCK_ALLTESTS) ||
+	    (Subtest == XIL_TESTMEM_BLOCK_WALKZEROS)) {
+		Current = XIL_TESTMEM_BLOCK_WALKZEROS;
+		Status = TestMemBlockPass(Addr, Blocks,
+				XIL_TESTMEM_BLOCK_WALKZEROS, 0U, 0U,
+				TESTMEM_BLOCK_WRITE, 0U, Result);
+		if (Status == 0) {
+			Status = TestMemBlockPass(Addr, Blocks,
+					XIL_TESTMEM_BLOCK_WALKZEROS, 0U, 0U,
+					TESTMEM_BLOCK_VERIFY, 0U, Result);
+		}
+		if (Status != 0) {
+			goto End_Label;
+		}
+	}
+
+	if ((Subtest == XIL_TESTMEM_BLOCK_ALLTESTS) ||
+	    (Subtest == XIL_TESTMEM_BLOCK_ADDRESS)) {
+		Current = XIL_TESTMEM_BLOCK_ADDRESS;
+		/* Address, then inverse address */
+		Status = TestMemBlockPass(Addr, Blocks,
+				XIL_TESTMEM_BLOCK_ADDRESS, 0U, 0U,
+				TESTMEM_BLOCK_WRITE, 0U, Result);
+		if (Status == 0) {
+			Status = TestMemBlockPass(Addr, Blocks,
+					XIL_TESTMEM_BLOCK_ADDRESS, 0U, 0U,
+					TESTMEM_BLOCK_VERIFY_INVERT, 0U, Result);
+		}
+		if (Status == 0) {
+			Status = TestMemBlockPass(Addr, Blocks,
+					XIL_TESTMEM_BLOCK_ADDRESS, 0U, ~0ULL,
+					TESTMEM_BLOCK_VERIFY, 0U, Result);
+		}
+		if (Status != 0) {
+			goto End_Label;
+		}
+	}
+
+	if ((Subtest == XIL_TESTMEM_BLOCK_ALLTESTS) ||
+	    (Subtest == XIL_TESTMEM_BLOCK_MOVINV)) {
+		Current = XIL_TESTMEM_BLOCK_MOVINV;
+		for (I = 0U; I < 2U; I++) {
+			Pattern = (I == 0U) ? 0U : TESTMEM_BLOCK_CHECKERBOARD;
+
+			/* Fill, invert going up, invert back going down */
+			Status = TestMemBlockPass(Addr, Blocks,
+					TESTMEM_BLOCK_FIXED, Pattern, 0U,
+					TESTMEM_BLOCK_WRITE, 0U, Result);
+			if (Status == 0) {
+				Status = TestMemBlockPass(Addr, Blocks,
+						TESTMEM_BLOCK_FIXED, Pattern, 0U,
+						TESTMEM_BLOCK_VERIFY_INVERT, 0U,
+						Result);
+			}
+			if (Status == 0) {
+				Status = TestMemBlockPass(Addr, Blocks,
+						TESTMEM_BLOCK_FIXED, Pattern,
+						~0ULL, TESTMEM_BLOCK_VERIFY_INVERT,
+						1U, Result);
+			}
+			if (Status == 0) {
+				Status = TestMemBlockPass(Addr, Blocks,
+						TESTMEM_BLOCK_FIXED, Pattern, 0U,
+						TESTMEM_BLOCK_VERIFY, 0U, Result);
+			}
+			if (Status != 0) {
+				goto End_Label;
+			}
+		}
+	}
+
+	if ((Subtest == XIL_TESTMEM_BLOCK_ALLTESTS) ||
+	    (Subtest == XIL_TESTMEM_BLOCK_RANDOM)) {
+		Current = XIL_TESTMEM_BLOCK_RANDOM;
+		Status = TestMemBlockPass(Addr, Blocks,
+				XIL_TESTMEM_BLOCK_RANDOM, Seed, 0U,
+				TESTMEM_BLOCK_WRITE, 0U, Result);
+		if (Status == 0) {
+			Status = TestMemBlockPass(Addr, Blocks,
+					XIL_TESTMEM_BLOCK_RANDOM, Seed, 0U,
+					TESTMEM_BLOCK_VERIFY_INVERT, 0U, Result);
+		}
+		if (Status == 0) {
+			Status = TestMemBlockPass(Addr, Blocks,
+					XIL_TESTMEM_BLOCK_RANDOM, Seed, ~0ULL,
+					TESTMEM_BLOCK_VERIFY, 0U, Result);
+		}
+	}
+
+End_Label:
+	if ((Status != 0) && (Result != NULL)) {
+		Result->Subtest = Current;
+	}
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief    Generate the expected contents of one block.
+*
+* @param    Pattern is one of XIL_TESTMEM_BLOCK_* or TESTMEM_BLOCK_FIXED
+* @param    Index is the index of the block in the region
+* @param    Block is the address of the block
+* @param    Seed is the fixed pattern or the random seed
+* @param    Invert is XORed into the generated values
+* @param    Exp is filled with the XIL_TESTMEM_BLOCK_WORDS expected values
+*
+* @return   None
+*
+* @note     Each block is generated from its index only, so that the
+*           blocks can be visited in any order.
+*
+*****************************************************************************/
+static INLINE void TestMemBlockGen(u8 Pattern, UINTPTR Index,
+				   const u64 *Block, u64 Seed, u64 Invert,
+				   u64 *Exp)
+{
+	u64 Val;
+	u32 I;
+
+	switch (Pattern) {
+	case XIL_TESTMEM_BLOCK_WALKONES:
+	case XIL_TESTMEM_BLOCK_WALKZEROS:
+		Val = (u64)1U << ((Index * XIL_TESTMEM_BLOCK_WORDS) & 63U);
+		for (I = 0U; I < XIL_TESTMEM_BLOCK_WORDS; I++) {
+			Exp[I] = Val << I;
+		}
+		if (Pattern == XIL_TESTMEM_BLOCK_WALKZEROS) {
+			Invert = ~Invert;
+		}
+		break;
+	case XIL_TESTMEM_BLOCK_ADDRESS:
+		for (I = 0U; I < XIL_TESTMEM_BLOCK_WORDS; I++) {
+			Exp[I] = (u64)(UINTPTR)&Block[I];
+		}
+		break;
+	case XIL_TESTMEM_BLOCK_RANDOM:
+		Val = Seed ^ ((u64)Index * TESTMEM_BLOCK_GOLDEN);
+		if (Val == 0U) {
+			Val = TESTMEM_BLOCK_GOLDEN;
+		}
+		for (I = 0U; I < XIL_TESTMEM_BLOCK_WORDS; I++) {
+			/* xorshift64 */
+			Val ^= Val << 13U;
+			Val ^= Val >> 7U;
+			Val ^= Val << 17U;
+			Exp[I] = Val;
+		}
+		break;
+	default:
+		for (I = 0U; I < XIL_TESTMEM_BLOCK_WORDS; I++) {
+			Exp[I] = Seed;
+		}
+		break;
+	}
+
+	for (I = 0U; I < XIL_TESTMEM_BLOCK_WORDS; I++) {
+		Exp[I] ^= Invert;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief    Run one pass of the block test over the region.
+*
+* @param    Addr is the start of the region
+* @param    Blocks is the number of blocks in the region
+* @param    Pattern is one of XIL_TESTMEM_BLOCK_* or TESTMEM_BLOCK_FIXED
+* @param    Seed is the fixed pattern or the random seed
+* @param    Invert is XORed into the pattern before it is verified
+* @param    Op is one of TESTMEM_BLOCK_WRITE, TESTMEM_BLOCK_VERIFY or
+*           TESTMEM_BLOCK_VERIFY_INVERT
+* @param    Descending is non zero to visit the blocks from the top down
+* @param    Result is filled on a failure, may be NULL
+*
+* @return
+*           - -1 is returned for a failure
+*           - 0 is returned for a pass
+*
+*****************************************************************************/
+static s32 TestMemBlockPass(u64 *Addr, UINTPTR Blocks, u8 Pattern, u64 Seed,
+			    u64 Invert, u8 Op, u8 Descending,
+			    Xil_TestMemBlockResult *Result)
+{
+	u64 Exp[XIL_TESTMEM_BLOCK_WORDS];
+	u64 Diff;
+	u64 *Block;
+	UINTPTR Index;
+	UINTPTR Step;
+	u32 I;
+	s32 Status = 0;
+
+	TESTMEM_BARRIER();
+
+	for (Step = 0U; Step < Blocks; Step++) {
+		Index = (Descending != 0U) ? (Blocks - 1U - Step) : Step;
+		Block = &Addr[Index * XIL_TESTMEM_BLOCK_WORDS];
+		TestMemBlockGen(Pattern, Index, Block, Seed, Invert, Exp);
+
+		if (Op != TESTMEM_BLOCK_WRITE) {
+			/* Compare the whole block, then find the failing word */
+			Diff = 0U;
+			for (I = 0U; I < XIL_TESTMEM_BLOCK_WORDS; I++) {
+				Diff |= Block[I] ^ Exp[I];
+			}
+			if (Diff != 0U) {
+				for (I = 0U; I < XIL_TESTMEM_BLOCK_WORDS; I++) {
+					if (Block[I] != Exp[I]) {
+						break;
+					}
+				}
+				if (Result != NULL) {
+					I = (I < XIL_TESTMEM_BLOCK_WORDS) ? I : 0U;
+					Result->FailAddr = (UINTPTR)&Block[I];
+					Result->Expected = Exp[I];
+					Result->Actual = Block[I];
+				}
+				Status = -1;
+				goto End_Label;
+			}
+		}
+
+		if (Op == TESTMEM_BLOCK_WRITE) {
+			for (I = 0U; I < XIL_TESTMEM_BLOCK_WORDS; I++) {
+				Block[I] = Exp[I];
+			}
+		} else if (Op == TESTMEM_BLOCK_VERIFY_INVERT) {
+			for (I = 0U; I < XIL_TESTMEM_BLOCK_WORDS; I++) {
+				Block[I] = ~Exp[I];
+			}
+		} else {
+			/* Verify only */
+		}
+	}
+
+End_Label:
+	TESTMEM_BARRIER();
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 *
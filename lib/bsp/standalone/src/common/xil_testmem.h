@@ -55,6 +55,29 @@
 * This test uses the provided patters as the test value for memory.
 * If zero is provided as the pattern the test uses '0xDEADBEEF".
 *
+* Xil_TestMemBlock is a block oriented memory test meant for large regions
+* such as the whole DDR. It works on XIL_TESTMEM_BLOCK_SIZE bytes at a time
+* with 64-bit accesses and compares a whole block at once. The subtests are:
+*
+*  - XIL_TESTMEM_BLOCK_ALLTESTS: This test runs all of the block subtests.
+*
+*  - XIL_TESTMEM_BLOCK_WALKONES: Each 64-bit word holds a single '1', which
+* moves by one bit from word to word.
+*
+*  - XIL_TESTMEM_BLOCK_WALKZEROS: The inverse of the walking ones block test.
+*
+*  - XIL_TESTMEM_BLOCK_ADDRESS: Each 64-bit word holds its own address, then
+* the inverse of its address. This finds address line faults over the whole
+* region instead of only within 2 ** width words.
+*
+*  - XIL_TESTMEM_BLOCK_MOVINV: Moving inversions. The region is filled with a
+* pattern, then each block is verified and inverted going up, and verified
+* and inverted back going down. This is done with all zeros and with a
+* checkerboard pattern.
+*
+*  - XIL_TESTMEM_BLOCK_RANDOM: The region is filled with xorshift random
+* values generated from the seed, verified and inverted, and verified again.
+*
 * @warning
 * The tests are <b>DESTRUCTIVE</b>. Run before any initialized memory spaces
 * have been set up.
@@ -86,6 +109,7 @@
 *                     compiled only for 32 bit Microblaze processor, if
 *                     XPAR_MICROBLAZE_ADDR_SIZE is greater than 32.
 *                     It fixes CR#1089129.
+* 7.7   dc   10/30/21 Added Xil_TestMemBlock block oriented memory test
 * </pre>
 *
 ******************************************************************************/
@@ -129,6 +153,33 @@ extern "C" {
 #define XIL_TESTMEM_MAXTEST         XIL_TESTMEM_FIXEDPATTERN
 /* @} */
 
+/** @name Block memory subtests
+ * @{
+ */
+/**
+ * See the detailed description of the subtests in the file description.
+ */
+#define XIL_TESTMEM_BLOCK_ALLTESTS  0x00U
+#define XIL_TESTMEM_BLOCK_WALKONES  0x01U
+#define XIL_TESTMEM_BLOCK_WALKZEROS 0x02U
+#define XIL_TESTMEM_BLOCK_ADDRESS   0x03U
+#define XIL_TESTMEM_BLOCK_MOVINV    0x04U
+#define XIL_TESTMEM_BLOCK_RANDOM    0x05U
+#define XIL_TESTMEM_BLOCK_MAXTEST   XIL_TESTMEM_BLOCK_RANDOM
+/* @} */
+
+/* Bytes processed at a time by Xil_TestMemBlock, a cache line */
+#define XIL_TESTMEM_BLOCK_SIZE      64U
+#define XIL_TESTMEM_BLOCK_WORDS     (XIL_TESTMEM_BLOCK_SIZE / 8U)
+
+/* Failure details of Xil_TestMemBlock */
+typedef struct {
+	UINTPTR FailAddr;	/* Address of the first mismatching word */
+	u64 Expected;		/* Value written to FailAddr */
+	u64 Actual;		/* Value read back from FailAddr */
+	u8 Subtest;		/* Subtest which failed */
+} Xil_TestMemBlockResult;
+
 #if !defined(__aarch64__) && !defined(__arch64__)
 #define	NUM_OF_BITS_IN_BYTE	8U
 #define	NUM_OF_BYTES_IN_HW	2U
@@ -154,6 +205,8 @@ extern s32 Xil_TestMem32(u32 *Addr, u32 Words, u32 Pattern, u8 Subtest);
 extern s32 Xil_TestMem16(u16 *Addr, u32 Words, u16 Pattern, u8 Subtest);
 extern s32 Xil_TestMem8(u8 *Addr, u32 Words, u8 Pattern, u8 Subtest);
 #endif
+extern s32 Xil_TestMemBlock(u64 *Addr, UINTPTR Len, u64 Seed, u8 Subtest,
+			    Xil_TestMemBlockResult *Result);
 
 #ifdef __cplusplus
 }
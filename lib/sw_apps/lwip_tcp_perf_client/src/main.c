@@ -77,6 +77,31 @@ int IicPhyReset(void);
 
 struct netif server_netif;
 
+/* ms of the idle main loop measured before the test */
+#define IDLE_CALIBRATION_TIME	1000
+
+/* main loop polls that found no received frame, for the CPU load */
+u64_t idle_polls;
+/* idle polls per ms of the main loop without traffic */
+double idle_polls_per_ms;
+
+/*
+ * Count the idle polls of the main loop for one second before any traffic.
+ * The loop reads the time on every poll, as transfer_data() does.
+ */
+static void calibrate_idle(struct netif *netif)
+{
+	u64_t start = get_time_ms(), now;
+
+	idle_polls = 0;
+	do {
+		if (xemacif_input(netif) == 0)
+			idle_polls++;
+		now = get_time_ms();
+	} while (now - start < IDLE_CALIBRATION_TIME);
+	idle_polls_per_ms = (double)idle_polls / (now - start);
+}
+
 #if LWIP_IPV6==1
 static void print_ipv6(char *msg, ip_addr_t *ip)
 {
@@ -198,6 +223,10 @@ int main(void)
 #endif /* LWIP_IPV6 */
 	xil_printf("\r\n");
 
+	/* measure the idle main loop, the reference for the CPU load */
+	calibrate_idle(netif);
+	idle_polls = 0;
+
 	/* print app header */
 	print_app_header();
 
@@ -214,7 +243,8 @@ int main(void)
 			tcp_slowtmr();
 			TcpSlowTmrFlag = 0;
 		}
-		xemacif_input(netif);
+		if (xemacif_input(netif) == 0)
+			idle_polls++;
 		transfer_data();
 	}
 
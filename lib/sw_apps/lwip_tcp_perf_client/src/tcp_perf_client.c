@@ -30,9 +30,11 @@
 
 #include "tcp_perf_client.h"
 
-static struct tcp_pcb *c_pcb;
 static char send_buf[TCP_SEND_BUFSIZE];
-static struct perf_stats client;
+static struct perf_stats client[TCP_NUM_STREAMS];
+/* aggregate of all streams, reported as [SUM] */
+static struct perf_stats total;
+static u8_t client_id;
 
 void print_app_header()
 {
@@ -47,25 +49,31 @@ void print_app_header()
 	xil_printf("On Host: Run $iperf -s -i %d -w 2M\r\n",
 			INTERIM_REPORT_INTERVAL);
 #endif /* LWIP_IPV6 */
+	xil_printf("%d stream(s), %d byte messages, %s send\r\n",
+			TCP_NUM_STREAMS, TCP_SEND_BUFSIZE,
+			TCP_SEND_ZERO_COPY ? "zero-copy" : "copy");
 }
 
-static void print_tcp_conn_stats()
+static void print_tcp_conn_stats(struct perf_stats *stream)
 {
-#if LWIP_IPv6==1
+	struct tcp_pcb *pcb = stream->pcb;
+
+#if LWIP_IPV6==1
 	xil_printf("[%3d] local %s port %d connected with ",
-			client.client_id, inet6_ntoa(c_pcb->local_ip),
-			c_pcb->local_port);
-	xil_printf("%s port %d\r\n",inet6_ntoa(c_pcb->remote_ip),
-			c_pcb->remote_port);
+			stream->client_id, inet6_ntoa(pcb->local_ip),
+			pcb->local_port);
+	xil_printf("%s port %d\r\n",inet6_ntoa(pcb->remote_ip),
+			pcb->remote_port);
 #else
 	xil_printf("[%3d] local %s port %d connected with ",
-			client.client_id, inet_ntoa(c_pcb->local_ip),
-			c_pcb->local_port);
-	xil_printf("%s port %d\r\n",inet_ntoa(c_pcb->remote_ip),
-			c_pcb->remote_port);
+			stream->client_id, inet_ntoa(pcb->local_ip),
+			pcb->local_port);
+	xil_printf("%s port %d\r\n",inet_ntoa(pcb->remote_ip),
+			pcb->remote_port);
 #endif /* LWIP_IPV6 */
 
-	xil_printf("[ ID] Interval\t\tTransfer   Bandwidth\n\r");
+	if (stream->client_id == 1)
+		xil_printf("[ ID] Interval\t\tTransfer   Bandwidth      CPU\n\r");
 }
 
 static void stats_buffer(char* outString,
@@ -94,20 +102,44 @@ static void stats_buffer(char* outString,
 	sprintf(outString, format, data, kLabel[conv]);
 }
 
+static void stats_id(char *outString, struct perf_stats *stats)
+{
+	if (stats == &total)
+		sprintf(outString, "SUM");
+	else
+		sprintf(outString, "%3d", stats->client_id);
+}
+
+/* CPU load over diff ms, from the idle polls of the main loop in it */
+static void stats_cpu(char *outString, u64_t polls, u64_t diff)
+{
+	double load;
+
+	if (!idle_polls_per_ms || !diff) {
+		sprintf(outString, "  -");
+		return;
+	}
+	load = 100.0 * (1.0 - polls / (idle_polls_per_ms * diff));
+	if (load < 0)
+		load = 0;
+	sprintf(outString, "%3.0f%%", load);
+}
 
 /** The report function of a TCP client session */
-static void tcp_conn_report(u64_t diff,
+static void tcp_conn_report(struct perf_stats *stats, u64_t diff,
 		enum report_type report_type)
 {
-	u64_t total_len;
+	u64_t total_len, polls;
 	double duration, bandwidth = 0;
-	char data[16], perf[16], time[64];
+	char id[8], data[16], perf[16], time[64], cpu[8];
 
 	if (report_type == INTER_REPORT) {
-		total_len = client.i_report.total_bytes;
+		total_len = stats->i_report.total_bytes;
+		polls = idle_polls - total.i_report.idle_polls;
 	} else {
-		client.i_report.last_report_time = 0;
-		total_len = client.total_bytes;
+		stats->i_report.last_report_time = 0;
+		total_len = stats->total_bytes;
+		polls = idle_polls - stats->idle_polls;
 	}
 
 	/* Converting duration from milliseconds to secs,
@@ -117,20 +149,49 @@ static void tcp_conn_report(u64_t diff,
 	if (duration)
 		bandwidth = (total_len / duration) * 8.0;
 
+	stats_id(id, stats);
 	stats_buffer(data, total_len, BYTES);
 	stats_buffer(perf, bandwidth, SPEED);
+	stats_cpu(cpu, polls, diff);
 	/* On 32-bit platforms, xil_printf is not able to print
 	 * u64_t values, so converting these values in strings and
 	 * displaying results
 	 */
 	sprintf(time, "%4.1f-%4.1f sec",
-			(double)client.i_report.last_report_time,
-			(double)(client.i_report.last_report_time + duration));
-	xil_printf("[%3d] %s  %sBytes  %sbits/sec\n\r", client.client_id,
-			time, data, perf);
+			(double)stats->i_report.last_report_time,
+			(double)(stats->i_report.last_report_time + duration));
+	xil_printf("[%s] %s  %sBytes  %sbits/sec  %s\n\r", id,
+			time, data, perf, cpu);
 
-	if (report_type == INTER_REPORT)
-		client.i_report.last_report_time += duration;
+	if (report_type == INTER_REPORT) {
+		stats->i_report.last_report_time += duration;
+		if (!stats->max_bw || bandwidth < stats->min_bw)
+			stats->min_bw = bandwidth;
+		if (bandwidth > stats->max_bw)
+			stats->max_bw = bandwidth;
+	} else if (stats->max_bw) {
+		/* spread of the interim reports of this session */
+		stats_buffer(data, stats->min_bw, SPEED);
+		stats_buffer(perf, stats->max_bw, SPEED);
+		xil_printf("[%s] interval min %sbits/sec  max %sbits/sec\n\r",
+				id, data, perf);
+	}
+}
+
+static void tcp_stats_init(struct perf_stats *stats, u64_t now)
+{
+	stats->start_time = now;
+	stats->end_time = TCP_TIME_INTERVAL * 1000; /* ms */
+	stats->total_bytes = 0;
+	stats->min_bw = 0;
+	stats->max_bw = 0;
+	stats->idle_polls = idle_polls;
+
+	/* report interval time in ms */
+	stats->i_report.report_interval_time = INTERIM_REPORT_INTERVAL * 1000;
+	stats->i_report.last_report_time = 0;
+	stats->i_report.start_time = 0;
+	stats->i_report.total_bytes = 0;
 }
 
 /** Close a tcp session */
@@ -153,116 +214,137 @@ static void tcp_client_close(struct tcp_pcb *pcb)
 static void tcp_client_err(void *arg, err_t err)
 {
 	LWIP_UNUSED_ARG(err);
+	struct perf_stats *stream = arg;
 	u64_t now = get_time_ms();
-	u64_t diff_ms = now - client.start_time;
+	u64_t diff_ms = now - stream->start_time;
 
-	tcp_client_close(c_pcb);
-	c_pcb = NULL;
-	tcp_conn_report(diff_ms, TCP_ABORTED_REMOTE);
+	/* lwIP has already freed the pcb */
+	stream->pcb = NULL;
+	tcp_conn_report(stream, diff_ms, TCP_ABORTED_REMOTE);
 	xil_printf("TCP connection aborted\n\r");
 }
 
-static err_t tcp_send_perf_traffic(void)
+static err_t tcp_send_perf_traffic(struct perf_stats *stream)
 {
 	err_t err;
 	u8_t apiflags = TCP_WRITE_FLAG_COPY | TCP_WRITE_FLAG_MORE;
+	struct tcp_pcb *pcb = stream->pcb;
 
-	if (c_pcb == NULL) {
+	if (pcb == NULL) {
 		return ERR_CONN;
 	}
 
-#ifdef __MICROBLAZE__
-	/* Zero-copy pbufs is used to get maximum performance for Microblaze.
-	 * For Zynq A9, ZynqMP A53 and R5 zero-copy pbufs does not give
-	 * significant improvement hense not used. */
+#if TCP_SEND_ZERO_COPY
 	apiflags = 0;
 #endif
 
-	while (tcp_sndbuf(c_pcb) > TCP_SEND_BUFSIZE) {
-		err = tcp_write(c_pcb, send_buf, TCP_SEND_BUFSIZE, apiflags);
+	while (tcp_sndbuf(pcb) > TCP_SEND_BUFSIZE) {
+		err = tcp_write(pcb, send_buf, TCP_SEND_BUFSIZE, apiflags);
 		if (err != ERR_OK) {
 			xil_printf("TCP client: Error on tcp_write: %d\r\n",
 					err);
 			return err;
 		}
 
-		err = tcp_output(c_pcb);
+		err = tcp_output(pcb);
 		if (err != ERR_OK) {
 			xil_printf("TCP client: Error on tcp_output: %d\r\n",
 					err);
 			return err;
 		}
-		client.total_bytes += TCP_SEND_BUFSIZE;
-		client.i_report.total_bytes += TCP_SEND_BUFSIZE;
+		stream->total_bytes += TCP_SEND_BUFSIZE;
+		stream->i_report.total_bytes += TCP_SEND_BUFSIZE;
+		total.total_bytes += TCP_SEND_BUFSIZE;
+		total.i_report.total_bytes += TCP_SEND_BUFSIZE;
 	}
 
-	if (client.end_time || client.i_report.report_interval_time) {
-		u64_t now = get_time_ms();
-		if (client.i_report.report_interval_time) {
-			if (client.i_report.start_time) {
-				u64_t diff_ms = now - client.i_report.start_time;
-				u64_t rtime_ms = client.i_report.report_interval_time;
-				if (diff_ms >= rtime_ms) {
-					tcp_conn_report(diff_ms, INTER_REPORT);
-					client.i_report.start_time = 0;
-					client.i_report.total_bytes = 0;
-				}
-			} else {
-				client.i_report.start_time = now;
+	return ERR_OK;
+}
+
+/** Interim and final reports of all streams, on common intervals */
+static void tcp_perf_report(void)
+{
+	u64_t now = get_time_ms();
+	u64_t diff_ms;
+	u8_t i, active = 0;
+
+	if (total.i_report.start_time) {
+		diff_ms = now - total.i_report.start_time;
+		if (diff_ms >= total.i_report.report_interval_time) {
+			for (i = 0; i < TCP_NUM_STREAMS; i++) {
+				if (client[i].pcb == NULL)
+					continue;
+				tcp_conn_report(&client[i], diff_ms,
+						INTER_REPORT);
+				client[i].i_report.total_bytes = 0;
 			}
+			if (TCP_NUM_STREAMS > 1)
+				tcp_conn_report(&total, diff_ms, INTER_REPORT);
+			total.i_report.start_time = now;
+			total.i_report.total_bytes = 0;
+			total.i_report.idle_polls = idle_polls;
 		}
+	} else {
+		total.i_report.start_time = now;
+		total.i_report.idle_polls = idle_polls;
+	}
 
-		if (client.end_time) {
-			/* this session is time-limited */
-			u64_t diff_ms = now - client.start_time;
-			if (diff_ms >= client.end_time) {
-				/* time specified is over,
-				 * close the connection */
-				tcp_conn_report(diff_ms, TCP_DONE_CLIENT);
-				xil_printf("TCP test passed Successfully\n\r");
-				tcp_client_close(c_pcb);
-				c_pcb = NULL;
-				return ERR_OK;
-			}
+	/* this session is time-limited */
+	diff_ms = now - total.start_time;
+	for (i = 0; i < TCP_NUM_STREAMS; i++) {
+		if (client[i].pcb == NULL)
+			continue;
+		if (diff_ms < total.end_time) {
+			active++;
+			continue;
 		}
+		/* time specified is over, close the connection */
+		tcp_conn_report(&client[i], now - client[i].start_time,
+				TCP_DONE_CLIENT);
+		tcp_client_close(client[i].pcb);
+		client[i].pcb = NULL;
+	}
+
+	if (active == 0) {
+		if (TCP_NUM_STREAMS > 1)
+			tcp_conn_report(&total, diff_ms, TCP_DONE_CLIENT);
+		if (diff_ms >= total.end_time)
+			xil_printf("TCP test passed Successfully\n\r");
+		total.start_time = 0;
 	}
-	return ERR_OK;
 }
 
 /** TCP sent callback, try to send more data */
 static err_t tcp_client_sent(void *arg, struct tcp_pcb *tpcb, u16_t len)
 {
-	return tcp_send_perf_traffic();
+	return tcp_send_perf_traffic(arg);
 }
 
 /** TCP connected callback (active connection), send data now */
 static err_t tcp_client_connected(void *arg, struct tcp_pcb *tpcb, err_t err)
 {
+	struct perf_stats *stream = arg;
+	u64_t now = get_time_ms();
+
 	if (err != ERR_OK) {
 		tcp_client_close(tpcb);
 		xil_printf("Connection error\n\r");
 		return err;
 	}
 	/* store state */
-	c_pcb = tpcb;
-
-	client.start_time = get_time_ms();
-	client.end_time = TCP_TIME_INTERVAL * 1000; /* ms */
-	client.client_id++;
-	client.total_bytes = 0;
+	stream->pcb = tpcb;
+	stream->client_id = ++client_id;
+	tcp_stats_init(stream, now);
 
-	/* report interval time in ms */
-	client.i_report.report_interval_time = INTERIM_REPORT_INTERVAL * 1000;
-	client.i_report.last_report_time = 0;
-	client.i_report.start_time = 0;
-	client.i_report.total_bytes = 0;
+	/* the first stream to connect starts the session */
+	if (!total.start_time)
+		tcp_stats_init(&total, now);
 
-	print_tcp_conn_stats();
+	print_tcp_conn_stats(stream);
 
 	/* set callback values & functions */
-	tcp_arg(c_pcb, NULL);
-	tcp_sent(c_pcb, tcp_client_sent);
-	tcp_err(c_pcb, tcp_client_err);
+	tcp_sent(tpcb, tcp_client_sent);
+	tcp_err(tpcb, tcp_client_err);
 
 	/* initiate data transfer */
 	return ERR_OK;
@@ -270,8 +352,15 @@ static err_t tcp_client_connected(void *arg, struct tcp_pcb *tpcb, err_t err)
 
 void transfer_data(void)
 {
-	if (client.client_id)
-		tcp_send_perf_traffic();
+	u8_t i;
+
+	if (!total.start_time)
+		return;
+
+	for (i = 0; i < TCP_NUM_STREAMS; i++)
+		tcp_send_perf_traffic(&client[i]);
+
+	tcp_perf_report();
 }
 
 void start_application(void)
@@ -293,25 +382,30 @@ void start_application(void)
 		return;
 	}
 
-	/* Create Client PCB */
-	pcb = tcp_new_ip_type(IPADDR_TYPE_ANY);
-	if (!pcb) {
-		xil_printf("Error in PCB creation. out of memory\r\n");
-		return;
-	}
-
-	err = tcp_connect(pcb, &remote_addr, TCP_CONN_PORT,
-			tcp_client_connected);
-	if (err) {
-		xil_printf("Error on tcp_connect: %d\r\n", err);
-		tcp_client_close(pcb);
-		return;
-	}
-	client.client_id = 0;
+	client_id = 0;
 
 	/* initialize data buffer being sent with same as used in iperf */
 	for (i = 0; i < TCP_SEND_BUFSIZE; i++)
 		send_buf[i] = (i % 10) + '0';
 
+	for (i = 0; i < TCP_NUM_STREAMS; i++) {
+		/* Create Client PCB */
+		pcb = tcp_new_ip_type(IPADDR_TYPE_ANY);
+		if (!pcb) {
+			xil_printf("Error in PCB creation. out of memory\r\n");
+			return;
+		}
+
+		/* each stream keeps its own statistics */
+		tcp_arg(pcb, &client[i]);
+		err = tcp_connect(pcb, &remote_addr, TCP_CONN_PORT,
+				tcp_client_connected);
+		if (err) {
+			xil_printf("Error on tcp_connect: %d\r\n", err);
+			tcp_client_close(pcb);
+			return;
+		}
+	}
+
 	return;
 }
@@ -75,16 +75,28 @@ struct interim_report {
 	u64_t last_report_time;
 	u32_t total_bytes;
 	u32_t report_interval_time;
+	/* idle main loop polls at the start of the interval */
+	u64_t idle_polls;
 };
 
 struct perf_stats {
 	u8_t client_id;
+	struct tcp_pcb *pcb;
 	u64_t start_time;
 	u64_t end_time;
 	u64_t total_bytes;
 	struct interim_report i_report;
+	/* lowest and highest interim bandwidth in bits/sec */
+	double min_bw;
+	double max_bw;
+	/* idle main loop polls at the start of the session */
+	u64_t idle_polls;
 };
 
+/* idle polls of the main loop and their rate without traffic (main.c) */
+extern u64_t idle_polls;
+extern double idle_polls_per_ms;
+
 /* seconds between periodic bandwidth reports */
 #define INTERIM_REPORT_INTERVAL 5
 
@@ -102,6 +114,22 @@ struct perf_stats {
 #define TCP_SERVER_IP_ADDRESS "192.168.1.100"
 #endif
 
+/* number of parallel TCP streams, same as iperf -P.
+ * MEMP_NUM_TCP_PCB must be at least this value */
+#define TCP_NUM_STREAMS 1
+
+/* size of each message passed to tcp_write */
 #define TCP_SEND_BUFSIZE (5*TCP_MSS)
 
+/* Reference send_buf from the pbufs instead of copying it into the
+ * TCP send buffer. send_buf is never modified while the test runs.
+ * Zero-copy gives the best performance on Microblaze, for Zynq A9,
+ * ZynqMP A53 and R5 it does not give significant improvement.
+ */
+#ifdef __MICROBLAZE__
+#define TCP_SEND_ZERO_COPY 1
+#else
+#define TCP_SEND_ZERO_COPY 0
+#endif
+
 #endif /* __TCP_PERF_CLIENT_H_ */
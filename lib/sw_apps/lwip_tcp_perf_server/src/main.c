@@ -76,6 +76,34 @@ int IicPhyReset(void);
 
 struct netif server_netif;
 
+/* ms of the idle main loop measured before the test */
+#define IDLE_CALIBRATION_TIME	1000
+
+/* main loop polls that found no received frame, for the CPU load */
+u64_t idle_polls;
+/* idle polls per ms of the main loop without traffic */
+double idle_polls_per_ms;
+
+/*
+ * Count the idle polls of the main loop for one second before any traffic.
+ * The time is read every 1024 polls only, the main loop does not read it.
+ */
+static void calibrate_idle(struct netif *netif)
+{
+	u64_t start = get_time_ms(), now;
+	u32_t i;
+
+	idle_polls = 0;
+	do {
+		for (i = 0; i < 1024; i++) {
+			if (xemacif_input(netif) == 0)
+				idle_polls++;
+		}
+		now = get_time_ms();
+	} while (now - start < IDLE_CALIBRATION_TIME);
+	idle_polls_per_ms = (double)idle_polls / (now - start);
+}
+
 #if LWIP_IPV6==1
 static void print_ipv6(char *msg, ip_addr_t *ip)
 {
@@ -199,6 +227,10 @@ int main(void)
 
 	xil_printf("\r\n");
 
+	/* measure the idle main loop, the reference for the CPU load */
+	calibrate_idle(netif);
+	idle_polls = 0;
+
 	/* print app header */
 	print_app_header();
 
@@ -215,7 +247,8 @@ int main(void)
 			tcp_slowtmr();
 			TcpSlowTmrFlag = 0;
 		}
-		xemacif_input(netif);
+		if (xemacif_input(netif) == 0)
+			idle_polls++;
 	}
 
 	/* never reached */
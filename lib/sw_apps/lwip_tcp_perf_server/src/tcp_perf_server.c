@@ -31,8 +31,13 @@
 #include "tcp_perf_server.h"
 
 extern struct netif server_netif;
-static struct tcp_pcb *c_pcb;
-static struct perf_stats server;
+static struct perf_stats server[TCP_MAX_STREAMS];
+/* aggregate of the streams of a session, reported as [SUM] */
+static struct perf_stats total;
+static u8_t client_id;
+/* streams connected now and since the session started */
+static u8_t active_streams;
+static u8_t session_streams;
 
 void print_app_header(void)
 {
@@ -47,25 +52,30 @@ void print_app_header(void)
 			inet_ntoa(server_netif.ip_addr),
 			INTERIM_REPORT_INTERVAL);
 #endif /* LWIP_IPV6 */
+	xil_printf("Up to %d parallel streams (-P %d)\r\n",
+			TCP_MAX_STREAMS, TCP_MAX_STREAMS);
 }
 
-static void print_tcp_conn_stats(void)
+static void print_tcp_conn_stats(struct perf_stats *stream)
 {
+	struct tcp_pcb *pcb = stream->pcb;
+
 #if LWIP_IPV6==1
 	xil_printf("[%3d] local %s port %d connected with ",
-			server.client_id, inet6_ntoa(c_pcb->local_ip),
-			c_pcb->local_port);
-	xil_printf("%s port %d\r\n",inet6_ntoa(c_pcb->remote_ip),
-			c_pcb->remote_port);
+			stream->client_id, inet6_ntoa(pcb->local_ip),
+			pcb->local_port);
+	xil_printf("%s port %d\r\n",inet6_ntoa(pcb->remote_ip),
+			pcb->remote_port);
 #else
 	xil_printf("[%3d] local %s port %d connected with ",
-			server.client_id, inet_ntoa(c_pcb->local_ip),
-			c_pcb->local_port);
-	xil_printf("%s port %d\r\n",inet_ntoa(c_pcb->remote_ip),
-			c_pcb->remote_port);
+			stream->client_id, inet_ntoa(pcb->local_ip),
+			pcb->local_port);
+	xil_printf("%s port %d\r\n",inet_ntoa(pcb->remote_ip),
+			pcb->remote_port);
 #endif /* LWIP_IPV6 */
 
-	xil_printf("[ ID] Interval\t\tTransfer   Bandwidth\n\r");
+	if (session_streams == 1)
+		xil_printf("[ ID] Interval\t\tTransfer   Bandwidth      CPU\n\r");
 }
 
 static void stats_buffer(char* outString,
@@ -94,20 +104,44 @@ static void stats_buffer(char* outString,
 	sprintf(outString, format, data, kLabel[conv]);
 }
 
+static void stats_id(char *outString, struct perf_stats *stats)
+{
+	if (stats == &total)
+		sprintf(outString, "SUM");
+	else
+		sprintf(outString, "%3d", stats->client_id);
+}
+
+/* CPU load over diff ms, from the idle polls of the main loop in it */
+static void stats_cpu(char *outString, u64_t polls, u64_t diff)
+{
+	double load;
+
+	if (!idle_polls_per_ms || !diff) {
+		sprintf(outString, "  -");
+		return;
+	}
+	load = 100.0 * (1.0 - polls / (idle_polls_per_ms * diff));
+	if (load < 0)
+		load = 0;
+	sprintf(outString, "%3.0f%%", load);
+}
 
 /** The report function of a TCP server session */
-static void tcp_conn_report(u64_t diff,
+static void tcp_conn_report(struct perf_stats *stats, u64_t diff,
 		enum report_type report_type)
 {
-	u64_t total_len;
+	u64_t total_len, polls;
 	double duration, bandwidth = 0;
-	char data[16], perf[16], time[64];
+	char id[8], data[16], perf[16], time[64], cpu[8];
 
 	if (report_type == INTER_REPORT) {
-		total_len = server.i_report.total_bytes;
+		total_len = stats->i_report.total_bytes;
+		polls = idle_polls - stats->i_report.idle_polls;
 	} else {
-		server.i_report.last_report_time = 0;
-		total_len = server.total_bytes;
+		stats->i_report.last_report_time = 0;
+		total_len = stats->total_bytes;
+		polls = idle_polls - stats->idle_polls;
 	}
 
 	/* Converting duration from milliseconds to secs,
@@ -117,20 +151,93 @@ static void tcp_conn_report(u64_t diff,
 	if (duration)
 		bandwidth = (total_len / duration) * 8.0;
 
+	stats_id(id, stats);
 	stats_buffer(data, total_len, BYTES);
 	stats_buffer(perf, bandwidth, SPEED);
+	stats_cpu(cpu, polls, diff);
 	/* On 32-bit platforms, xil_printf is not able to print
 	 * u64_t values, so converting these values in strings and
 	 * displaying results
 	 */
 	sprintf(time, "%4.1f-%4.1f sec",
-			(double)server.i_report.last_report_time,
-			(double)(server.i_report.last_report_time + duration));
-	xil_printf("[%3d] %s  %sBytes  %sbits/sec\n\r", server.client_id,
-			time, data, perf);
+			(double)stats->i_report.last_report_time,
+			(double)(stats->i_report.last_report_time + duration));
+	xil_printf("[%s] %s  %sBytes  %sbits/sec  %s\n\r", id,
+			time, data, perf, cpu);
+
+	if (report_type == INTER_REPORT) {
+		stats->i_report.last_report_time += duration;
+		if (!stats->max_bw || bandwidth < stats->min_bw)
+			stats->min_bw = bandwidth;
+		if (bandwidth > stats->max_bw)
+			stats->max_bw = bandwidth;
+	} else if (stats->max_bw) {
+		/* spread of the interim reports of this session */
+		stats_buffer(data, stats->min_bw, SPEED);
+		stats_buffer(perf, stats->max_bw, SPEED);
+		xil_printf("[%s] interval min %sbits/sec  max %sbits/sec\n\r",
+				id, data, perf);
+	}
+}
+
+static void tcp_stats_init(struct perf_stats *stats, u64_t now)
+{
+	/* Save start time for final report */
+	stats->start_time = now;
+	stats->end_time = 0; /* ms */
+	stats->total_bytes = 0;
+	stats->min_bw = 0;
+	stats->max_bw = 0;
+	stats->idle_polls = idle_polls;
+
+	/* Initialize Interim report parameters */
+	stats->i_report.report_interval_time =
+		INTERIM_REPORT_INTERVAL * 1000; /* ms */
+	stats->i_report.last_report_time = 0;
+	stats->i_report.start_time = 0;
+	stats->i_report.total_bytes = 0;
+}
+
+/** Account received bytes, report the interval when it is over */
+static void tcp_stats_update(struct perf_stats *stats, u16_t len)
+{
+	/* Record total bytes for final report */
+	stats->total_bytes += len;
+
+	if (stats->i_report.report_interval_time) {
+		u64_t now = get_time_ms();
+		/* Record total bytes for interim report */
+		stats->i_report.total_bytes += len;
+		if (stats->i_report.start_time) {
+			u64_t diff_ms = now - stats->i_report.start_time;
+
+			if (diff_ms >= stats->i_report.report_interval_time) {
+				/* [SUM] only adds up parallel streams */
+				if (stats != &total || session_streams > 1)
+					tcp_conn_report(stats, diff_ms,
+							INTER_REPORT);
+				/* Reset Interim report counters */
+				stats->i_report.start_time = 0;
+				stats->i_report.total_bytes = 0;
+			}
+		} else {
+			/* Save start time for interim report */
+			stats->i_report.start_time = now;
+			stats->i_report.idle_polls = idle_polls;
+		}
+	}
+}
+
+/** A stream of the session is over, report the session once all are */
+static void tcp_stream_done(void)
+{
+	u64_t diff_ms;
 
-	if (report_type == INTER_REPORT)
-		server.i_report.last_report_time += duration;
+	active_streams--;
+	if (active_streams == 0 && session_streams > 1) {
+		diff_ms = get_time_ms() - total.start_time;
+		tcp_conn_report(&total, diff_ms, TCP_DONE_SERVER);
+	}
 }
 
 /** Close a tcp session */
@@ -153,12 +260,15 @@ static void tcp_server_close(struct tcp_pcb *pcb)
 static void tcp_server_err(void *arg, err_t err)
 {
 	LWIP_UNUSED_ARG(err);
+	struct perf_stats *stream = arg;
 	u64_t now = get_time_ms();
-	u64_t diff_ms = now - server.start_time;
-	tcp_server_close(c_pcb);
-	c_pcb = NULL;
-	tcp_conn_report(diff_ms, TCP_ABORTED_REMOTE);
+	u64_t diff_ms = now - stream->start_time;
+
+	/* lwIP has already freed the pcb */
+	stream->pcb = NULL;
+	tcp_conn_report(stream, diff_ms, TCP_ABORTED_REMOTE);
 	xil_printf("TCP connection aborted\n\r");
+	tcp_stream_done();
 }
 
 
@@ -166,37 +276,26 @@ static void tcp_server_err(void *arg, err_t err)
 static err_t tcp_recv_perf_traffic(void *arg, struct tcp_pcb *tpcb,
 		struct pbuf *p, err_t err)
 {
+	struct perf_stats *stream = arg;
+
 	if (p == NULL) {
 		u64_t now = get_time_ms();
-		u64_t diff_ms = now - server.start_time;
+		u64_t diff_ms = now - stream->start_time;
 		tcp_server_close(tpcb);
-		tcp_conn_report(diff_ms, TCP_DONE_SERVER);
+		stream->pcb = NULL;
+		tcp_conn_report(stream, diff_ms, TCP_DONE_SERVER);
 		xil_printf("TCP test passed Successfully\n\r");
+		tcp_stream_done();
 		return ERR_OK;
 	}
 
-	/* Record total bytes for final report */
-	server.total_bytes += p->tot_len;
-
-	if (server.i_report.report_interval_time) {
-		u64_t now = get_time_ms();
-		/* Record total bytes for interim report */
-		server.i_report.total_bytes += p->tot_len;
-		if (server.i_report.start_time) {
-			u64_t diff_ms = now - server.i_report.start_time;
-
-			if (diff_ms >= server.i_report.report_interval_time) {
-				tcp_conn_report(diff_ms, INTER_REPORT);
-				/* Reset Interim report counters */
-				server.i_report.start_time = 0;
-				server.i_report.total_bytes = 0;
-			}
-		} else {
-			/* Save start time for interim report */
-			server.i_report.start_time = now;
-		}
-	}
+	tcp_stats_update(stream, p->tot_len);
+	tcp_stats_update(&total, p->tot_len);
 
+	/* Open the window by the whole chain and free it in one go,
+	 * lwIP only sends a window update once it has grown by
+	 * TCP_WND_UPDATE_THRESHOLD.
+	 */
 	tcp_recved(tpcb, p->tot_len);
 
 	pbuf_free(p);
@@ -205,32 +304,46 @@ static err_t tcp_recv_perf_traffic(void *arg, struct tcp_pcb *tpcb,
 
 static err_t tcp_server_accept(void *arg, struct tcp_pcb *newpcb, err_t err)
 {
+	struct perf_stats *stream = NULL;
+	u64_t now = get_time_ms();
+	u8_t i;
+
 	if ((err != ERR_OK) || (newpcb == NULL)) {
 		return ERR_VAL;
 	}
-	/* Save connected client PCB */
-	c_pcb = newpcb;
 
-	/* Save start time for final report */
-	server.start_time = get_time_ms();
-	server.end_time = 0; /* ms */
-	/* Update connected client ID */
-	server.client_id++;
-	server.total_bytes = 0;
+	for (i = 0; i < TCP_MAX_STREAMS; i++) {
+		if (server[i].pcb == NULL) {
+			stream = &server[i];
+			break;
+		}
+	}
+	if (stream == NULL) {
+		xil_printf("TCP server: More than %d streams\r\n",
+				TCP_MAX_STREAMS);
+		return ERR_MEM;
+	}
 
-	/* Initialize Interim report parameters */
-	server.i_report.report_interval_time =
-		INTERIM_REPORT_INTERVAL * 1000; /* ms */
-	server.i_report.last_report_time = 0;
-	server.i_report.start_time = 0;
-	server.i_report.total_bytes = 0;
+	/* the first stream to connect starts a new session */
+	if (active_streams == 0) {
+		session_streams = 0;
+		tcp_stats_init(&total, now);
+	}
+	active_streams++;
+	session_streams++;
+
+	/* Save connected client PCB */
+	stream->pcb = newpcb;
+	/* Update connected client ID */
+	stream->client_id = ++client_id;
+	tcp_stats_init(stream, now);
 
-	print_tcp_conn_stats();
+	print_tcp_conn_stats(stream);
 
 	/* setup callbacks for tcp rx connection */
-	tcp_arg(c_pcb, NULL);
-	tcp_recv(c_pcb, tcp_recv_perf_traffic);
-	tcp_err(c_pcb, tcp_server_err);
+	tcp_arg(newpcb, stream);
+	tcp_recv(newpcb, tcp_recv_perf_traffic);
+	tcp_err(newpcb, tcp_server_err);
 
 	return ERR_OK;
 }
@@ -255,10 +368,10 @@ void start_application(void)
 		return;
 	}
 
-	/* Set connection queue limit to 1 to serve
-	 * one client at a time
+	/* Set connection queue limit to serve the parallel
+	 * streams of one client at a time
 	 */
-	lpcb = tcp_listen_with_backlog(pcb, 1);
+	lpcb = tcp_listen_with_backlog(pcb, TCP_MAX_STREAMS);
 	if (!lpcb) {
 		xil_printf("TCP server: Out of memory while tcp_listen\r\n");
 		tcp_close(pcb);
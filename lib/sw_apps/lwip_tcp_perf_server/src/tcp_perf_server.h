@@ -75,20 +75,36 @@ struct interim_report {
 	u64_t last_report_time;
 	u32_t total_bytes;
 	u32_t report_interval_time;
+	/* idle main loop polls at the start of the interval */
+	u64_t idle_polls;
 };
 
 struct perf_stats {
 	u8_t client_id;
+	struct tcp_pcb *pcb;
 	u64_t start_time;
 	u64_t end_time;
 	u64_t total_bytes;
 	struct interim_report i_report;
+	/* lowest and highest interim bandwidth in bits/sec */
+	double min_bw;
+	double max_bw;
+	/* idle main loop polls at the start of the session */
+	u64_t idle_polls;
 };
 
+/* idle polls of the main loop and their rate without traffic (main.c) */
+extern u64_t idle_polls;
+extern double idle_polls_per_ms;
+
 /* seconds between periodic bandwidth reports */
 #define INTERIM_REPORT_INTERVAL 5
 
 /* server port to listen on/connect to */
 #define TCP_CONN_PORT 5001
 
+/* maximum number of concurrent client streams (iperf -P on the host).
+ * MEMP_NUM_TCP_PCB must be larger than this value */
+#define TCP_MAX_STREAMS 8
+
 #endif /* __TCP_PERF_SERVER_H_ */
@@ -8,6 +8,9 @@
 #include "xil_types.h"
 #include "xstatus.h"
 #include "xil_testmem.h"
+#if defined (__arm__) || defined (__aarch64__)
+#include "xtime_l.h"
+#endif
 
 #include "platform.h"
 #include "memory_config.h"
@@ -26,6 +29,46 @@
 
 void putnum(unsigned int num);
 
+/*
+ * Runs the block oriented memory test over the whole range and reports the
+ * test throughput, where a timer is available.
+ */
+void test_memory_block(struct memory_range_s *range) {
+    Xil_TestMemBlockResult result;
+    UINTPTR len = range->size - (range->size % XIL_TESTMEM_BLOCK_SIZE);
+    s32 status;
+#if defined (__arm__) || defined (__aarch64__)
+    XTime start, end;
+    u64 mbps = 0;
+
+    XTime_GetTime(&start);
+#endif
+
+    status = Xil_TestMemBlock((u64 *)(UINTPTR)range->base, len, 0,
+                              XIL_TESTMEM_BLOCK_ALLTESTS, &result);
+
+#if defined (__arm__) || defined (__aarch64__)
+    XTime_GetTime(&end);
+    if (end != start) {
+        mbps = ((u64)len * COUNTS_PER_SECOND) / (end - start) / (1024 * 1024);
+    }
+#endif
+
+    print("           Block test: "); print(status == XST_SUCCESS? "PASSED!":"FAILED!");
+    if (status != XST_SUCCESS) {
+        xil_printf(" subtest %d at 0x%lx, expected 0x%08x%08x, read 0x%08x%08x",
+                   result.Subtest, result.FailAddr,
+                   (u32)(result.Expected >> 32), (u32)result.Expected,
+                   (u32)(result.Actual >> 32), (u32)result.Actual);
+    }
+#if defined (__arm__) || defined (__aarch64__)
+    else {
+        xil_printf(" %d MB/s", (u32)mbps);
+    }
+#endif
+    print("\n\r");
+}
+
 void test_memory_range(struct memory_range_s *range) {
     XStatus status;
 
@@ -71,6 +114,8 @@ void test_memory_range(struct memory_range_s *range) {
 
     status = Xil_TestMem8((u8*)range->base, 4096, 0xA5, XIL_TESTMEM_ALLMEMTESTS);
     print("           8-bit test: "); print(status == XST_SUCCESS? "PASSED!":"FAILED!"); print("\n\r");
+
+    test_memory_block(range);
 #endif
 
 }
@@ -29,6 +29,7 @@
  *       mn   04/30/21 Fixed rank selection logic for multi rank DDR
  *       mn   05/24/21 Fixed Eye Test issue with higher rank
  * 1.3   mn   09/08/21 Removed illegal write to DXnGTR0.WDQSL register field
+ * 1.4   dc   10/30/21 Added performance tests to the help menu
  *
  * </pre>
  *
@@ -929,6 +930,10 @@ void XMt_PrintHelp(void)
 	xil_printf("   | 'm' | Test user specified size in MB of DDR                        |\r\n");
 	xil_printf("   | 'g' | Test user specified size in GB of DDR                        |\r\n");
 	xil_printf("   +-----+--------------------------------------------------------------+\r\n");
+	xil_printf("   |  Performance Tests                                                 |\r\n");
+	xil_printf("   +-----+--------------------------------------------------------------+\r\n");
+	xil_printf("   | 'p' | Measure bandwidth/latency of user specified size in MB       |\r\n");
+	xil_printf("   +-----+--------------------------------------------------------------+\r\n");
 	xil_printf("   |  Eye Tests                                                         |\r\n");
 	xil_printf("   +-----+--------------------------------------------------------------+\r\n");
 	xil_printf("   | 'r' | Perform a read eye analysis test                             |\r\n");
@@ -24,6 +24,7 @@
  *       mn   05/24/21 Fixed Eye Test issue with higher rank
  *       mn   05/27/21 Get the PS Ref Clk from design
  * 1.3   mn   09/08/21 Removed illegal write to DXnGTR0.WDQSL register field
+ * 1.4   dc   10/30/21 Added memory performance tests
  *
  * </pre>
  *
@@ -246,6 +247,55 @@ extern "C" {
 #define XMT_DDR_CONFIG_32BIT_WIDTH			32U
 #define XMT_DDR_CONFIG_16BIT_WIDTH			16U
 
+/* DDR regions */
+#ifdef XPAR_PSU_DDR_0_S_AXI_BASEADDR
+#define XMT_DDR_0_SIZE			((XPAR_PSU_DDR_0_S_AXI_HIGHADDR -\
+					XPAR_PSU_DDR_0_S_AXI_BASEADDR) + 1U)
+#define XMT_DDR_0_BASEADDR		XPAR_PSU_DDR_0_S_AXI_BASEADDR
+#define XMT_DDR_0_HIGHADDR		XPAR_PSU_DDR_0_S_AXI_HIGHADDR
+#else
+#define XMT_DDR_0_SIZE			0U
+#define XMT_DDR_0_BASEADDR		0U
+#define XMT_DDR_0_HIGHADDR		0U
+#endif
+
+#ifdef XPAR_PSU_DDR_1_S_AXI_BASEADDR
+#define XMT_DDR_1_SIZE			((XPAR_PSU_DDR_1_S_AXI_HIGHADDR -\
+					XPAR_PSU_DDR_1_S_AXI_BASEADDR) + 1U)
+#define XMT_DDR_1_BASEADDR		XPAR_PSU_DDR_1_S_AXI_BASEADDR
+#define XMT_DDR_1_HIGHADDR		XPAR_PSU_DDR_1_S_AXI_HIGHADDR
+#else
+#define XMT_DDR_1_SIZE			0U
+#define XMT_DDR_1_BASEADDR		0U
+#define XMT_DDR_1_HIGHADDR		0U
+#endif
+
+#if (defined(XPAR_PSU_DDR_0_S_AXI_BASEADDR))
+#define XMT_DDR_BASEADDR		XPAR_PSU_DDR_0_S_AXI_BASEADDR
+#elif (defined(XPAR_PSU_DDR_1_S_AXI_BASEADDR))
+#define XMT_DDR_BASEADDR		XPAR_PSU_DDR_1_S_AXI_BASEADDR
+#endif
+#define XMT_DDR_MAX_SIZE		(XMT_DDR_0_SIZE + XMT_DDR_1_SIZE)
+
+/* APU core power, reset and reset vector registers */
+#define XMT_PMU_GLOBAL_PWR_STATE		0xFFD80100U
+#define XMT_PMU_GLOBAL_REQ_PWRUP_STATUS		0xFFD80110U
+#define XMT_PMU_GLOBAL_REQ_PWRUP_INT_EN		0xFFD80118U
+#define XMT_PMU_GLOBAL_REQ_PWRUP_TRIG		0xFFD80120U
+#define XMT_PMU_GLOBAL_PWR_STATE_ACPU0_MASK	0x00000001U
+#define XMT_PMU_GLOBAL_PWR_STATE_L2_BANK0_MASK	0x00000080U
+#define XMT_PMU_GLOBAL_PWR_STATE_FP_MASK	0x00400000U
+
+#define XMT_CRF_APB_RST_FPD_APU			0xFD1A0104U
+#define XMT_CRF_APB_RST_FPD_APU_ACPU0_RESET_MASK	0x00000001U
+#define XMT_CRF_APB_RST_FPD_APU_ACPU0_PWRON_RESET_MASK	0x00000400U
+
+#define XMT_APU_CONFIG_0			0xFD5C0020U
+#define XMT_APU_CONFIG_0_AA64N32_CPU0_MASK	0x00000001U
+#define XMT_APU_RVBARADDR0L			0xFD5C0040U
+#define XMT_APU_RVBARADDR0H			0xFD5C0044U
+#define XMT_APU_RVBARADDR_OFFSET		0x8U
+
 #define XMT_DDR_TYPE_DDR3			0x01U
 #define XMT_DDR_TYPE_LPDDR2			0x04U
 #define XMT_DDR_TYPE_LPDDR3			0x08U
@@ -413,6 +463,7 @@ void XMt_ResetWrVref(XMt_CfgData *XMtPtr);
 void XMt_Print2DEyeResults(XMt_CfgData *XMtPtr, u32 VRef);
 u32 XMt_GetVRefAutoMin(XMt_CfgData *XMtPtr);
 u32 XMt_GetVRefAutoMax(XMt_CfgData *XMtPtr);
+void XMt_RunPerfTests(XMt_CfgData *XMtPtr, u64 StartAddr, u64 TestSize);
 
 #ifdef __cplusplus
 }
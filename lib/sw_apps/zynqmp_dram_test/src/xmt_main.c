@@ -10,7 +10,8 @@
  * @file xmt_main.c
  *
  * This is the main file for ZynqMP DRAM test. This includes various DRAM tests
- * like Memory Tests of different sizes, Read Eye test and Write Eye test.
+ * like Memory Tests of different sizes, Read Eye test, Write Eye test and
+ * memory performance tests.
  *
  * <pre>
  * MODIFICATION HISTORY:
@@ -29,6 +30,7 @@
  *       mn   04/30/21 Fixed rank selection logic for multi rank DDR
  *       mn   05/24/21 Fixed Eye Test issue with higher rank
  *       mn   05/26/21 Modify code to run 2D eye tests only for DDR4/LPDDR4
+ * 1.3   dc   10/30/21 Added memory bandwidth and latency tests
  *
  * </pre>
  *
@@ -45,35 +47,6 @@
 #define XMT_DEFAULT_TEST_PATTERN	0U
 #define XMT_MAX_MODE_NUM		15U
 
-#ifdef XPAR_PSU_DDR_0_S_AXI_BASEADDR
-#define XMT_DDR_0_SIZE			((XPAR_PSU_DDR_0_S_AXI_HIGHADDR -\
-					XPAR_PSU_DDR_0_S_AXI_BASEADDR) + 1U)
-#define XMT_DDR_0_BASEADDR		XPAR_PSU_DDR_0_S_AXI_BASEADDR
-#define XMT_DDR_0_HIGHADDR		XPAR_PSU_DDR_0_S_AXI_HIGHADDR
-#else
-#define XMT_DDR_0_SIZE			0U
-#define XMT_DDR_0_BASEADDR		0U
-#define XMT_DDR_0_HIGHADDR		0U
-#endif
-
-#ifdef XPAR_PSU_DDR_1_S_AXI_BASEADDR
-#define XMT_DDR_1_SIZE			((XPAR_PSU_DDR_1_S_AXI_HIGHADDR -\
-					XPAR_PSU_DDR_1_S_AXI_BASEADDR) + 1U)
-#define XMT_DDR_1_BASEADDR		XPAR_PSU_DDR_1_S_AXI_BASEADDR
-#define XMT_DDR_1_HIGHADDR		XPAR_PSU_DDR_1_S_AXI_HIGHADDR
-#else
-#define XMT_DDR_1_SIZE			0U
-#define XMT_DDR_1_BASEADDR		0U
-#define XMT_DDR_1_HIGHADDR		0U
-#endif
-
-#if (defined(XPAR_PSU_DDR_0_S_AXI_BASEADDR))
-#define XMT_DDR_BASEADDR		XPAR_PSU_DDR_0_S_AXI_BASEADDR
-#elif (defined(XPAR_PSU_DDR_1_S_AXI_BASEADDR))
-#define XMT_DDR_BASEADDR		XPAR_PSU_DDR_1_S_AXI_BASEADDR
-#endif
-#define XMT_DDR_MAX_SIZE		(XMT_DDR_0_SIZE + XMT_DDR_1_SIZE)
-
 
 /**************************** Type Definitions *******************************/
 
@@ -859,6 +832,26 @@ int main(void)
 				xil_printf("\r\nPlease select the address within DDR range\r\n");
 			}
 
+		} else if ((Ch == 'p') || (Ch == 'P')) {
+			xil_printf("\r\n Enter the size in MB : ");
+			TestSize = 0;
+			do {
+				SizeChar = inbyte();
+				xil_printf("%c", SizeChar);
+				if ((SizeChar >= '0') && (SizeChar <= '9')) {
+					TestSize = (TestSize * 10) + (SizeChar - '0');
+				} else if ((SizeChar != '\r') && (SizeChar != '\n')) {
+					TestSize = 0;
+					xil_printf("\r\nPlease enter numeric value : ");
+				} else {
+					outbyte('\n');
+				}
+			} while ((SizeChar != '\n') && (SizeChar != '\r'));
+
+			for (Index = 0; Index < Iter; Index++) {
+				XMt_RunPerfTests(&XMt, StartAddr, TestSize);
+			}
+
 		} else if ((Ch == 'r') || (Ch == 'R')) {
 			for (Index = 0; Index < Iter; Index++) {
 				Status = XMt_MeasureRdEye(&XMt, StartAddr,
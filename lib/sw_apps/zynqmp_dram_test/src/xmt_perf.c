@@ -0,0 +1,994 @@
+/******************************************************************************
+* Copyright (c) 2021 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+ *
+ * @file xmt_perf.c
+ *
+ * This is the file containing code for DDR performance tests. This measures
+ * STREAM style Copy, Scale, Add and Triad bandwidth on one and on all the
+ * available APU cores, the load to use latency with a random pointer chase
+ * and the random access update rate (GUPS) of each DDR region.
+ *
+ * The bandwidth kernels move full cache lines with NEON LDP/STP pairs, the
+ * Copy (NT) kernel uses the non-temporal LDNP/STNP pairs. Toggle the D-cache
+ * with the 'o' option to measure with the caches bypassed.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   dc   10/30/21 Initial release
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xmt_common.h"
+#include "bspconfig.h"
+#include "sleep.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XMT_PERF_ITER			4U	/* Runs per kernel, best is reported */
+#define XMT_PERF_LINE_SIZE		64U
+#define XMT_PERF_DBL_PER_LINE		(XMT_PERF_LINE_SIZE / sizeof(double))
+#define XMT_PERF_SCALAR			3.0
+
+#define XMT_PERF_CHASE_STEPS		(1U << 22U)
+#define XMT_PERF_GUPS_MAX_UPDATES	(1U << 24U)
+#define XMT_PERF_GUPS_POLY		0x0000000000000007U
+
+#define XMT_PERF_MAX_CORES		4U
+#define XMT_PERF_STACK_SIZE		0x1000U
+#define XMT_PERF_CORE_UP_TIMEOUT_US	100000U
+#define XMT_PERF_CORE_DOWN_DELAY_US	1000U
+#define XMT_PERF_CORE_IDLE		0xFFFFFFFFU
+
+#define XMT_CPUECTLR_SMPEN		(1U << 6U)
+
+/* STREAM kernels */
+#define XMT_PERF_COPY			0U
+#define XMT_PERF_COPY_NT		1U
+#define XMT_PERF_SCALE			2U
+#define XMT_PERF_ADD			3U
+#define XMT_PERF_TRIAD			4U
+#define XMT_PERF_NUM_KERNELS		5U
+#define XMT_PERF_EXIT			XMT_PERF_NUM_KERNELS
+
+/**************************** Type Definitions *******************************/
+
+/* Context handed to the secondary cores, read with the MMU disabled */
+typedef struct {
+	u64 Vbar;
+	u64 Mair;
+	u64 Tcr;
+	u64 Ttbr0;
+	u64 Sctlr;
+	u64 Stack[XMT_PERF_MAX_CORES];
+} XMt_PerfBootData;
+
+/* Job shared by all the cores taking part in a multi-core run */
+typedef struct {
+	volatile u32 Seq;
+	volatile u32 Kernel;
+	volatile u32 NumCores;
+	volatile u32 Slot[XMT_PERF_MAX_CORES];
+	volatile u32 Done[XMT_PERF_MAX_CORES];
+	double * volatile A;
+	double * volatile B;
+	double * volatile C;
+	volatile u64 Count;
+} XMt_PerfJob;
+
+/* STREAM kernel name and the number of bytes moved per element */
+typedef struct {
+	const char *Name;
+	u32 Bytes;
+} XMt_PerfKernelInfo;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+void XMt_PerfSecondaryMain(u64 Core);
+
+/************************** Variable Definitions *****************************/
+
+static const XMt_PerfKernelInfo XMt_PerfKernels[XMT_PERF_NUM_KERNELS] = {
+	{"Copy", 2U * sizeof(double)},
+	{"Copy (NT)", 2U * sizeof(double)},
+	{"Scale", 2U * sizeof(double)},
+	{"Add", 3U * sizeof(double)},
+	{"Triad", 3U * sizeof(double)},
+};
+
+static const double XMt_PerfScalar = XMT_PERF_SCALAR;
+
+XMt_PerfBootData XMt_PerfBoot __attribute__ ((aligned(XMT_PERF_LINE_SIZE)));
+static XMt_PerfJob XMt_PerfSync __attribute__ ((aligned(XMT_PERF_LINE_SIZE)));
+static u8 XMt_PerfStack[XMT_PERF_MAX_CORES][XMT_PERF_STACK_SIZE]
+		__attribute__ ((aligned(16)));
+
+/* Keeps the result of the pointer chase alive */
+volatile u64 XMt_PerfSink;
+
+#if (EL3 == 1)
+/*
+ * Reset entry of the secondary cores. It enables the FP/SIMD unit, joins the
+ * core to the SMP coherency domain, enables the MMU with the translation
+ * tables of the primary core and calls XMt_PerfSecondaryMain on its own stack.
+ */
+__asm__(
+"	.pushsection .text.XMt_PerfSecondaryEntry, \"ax\"\n"
+"	.align	3\n"
+"	.global	XMt_PerfSecondaryEntry\n"
+"XMt_PerfSecondaryEntry:\n"
+"	mrs	x19, MPIDR_EL1\n"
+"	and	x19, x19, #0xFF\n"
+"	ldr	x20, =XMt_PerfBoot\n"
+"	msr	CPTR_EL3, xzr\n"
+"	mrs	x0, S3_1_C15_C2_1\n"
+"	orr	x0, x0, #(1 << 6)\n"
+"	msr	S3_1_C15_C2_1, x0\n"
+"	isb\n"
+"	ldr	x0, [x20, #0]\n"
+"	msr	VBAR_EL3, x0\n"
+"	ldr	x0, [x20, #8]\n"
+"	msr	MAIR_EL3, x0\n"
+"	ldr	x0, [x20, #16]\n"
+"	msr	TCR_EL3, x0\n"
+"	ldr	x0, [x20, #24]\n"
+"	msr	TTBR0_EL3, x0\n"
+"	add	x1, x20, #40\n"
+"	ldr	x0, [x1, x19, lsl #3]\n"
+"	mov	sp, x0\n"
+"	tlbi	alle3\n"
+"	dsb	sy\n"
+"	isb\n"
+"	ldr	x0, [x20, #32]\n"
+"	msr	SCTLR_EL3, x0\n"
+"	isb\n"
+"	mov	x0, x19\n"
+"	bl	XMt_PerfSecondaryMain\n"
+"1:	wfi\n"
+"	b	1b\n"
+"	.ltorg\n"
+"	.popsection\n");
+
+extern void XMt_PerfSecondaryEntry(void);
+#endif
+
+/*****************************************************************************/
+/**
+ * This function copies Count doubles from Src to Dst.
+ *
+ * @param Dst is the destination array
+ * @param Src is the source array
+ * @param Count is the number of doubles, a multiple of a cache line
+ *
+ * @return none
+ *
+ * @note none
+ *****************************************************************************/
+static void XMt_PerfCopy(double *Dst, const double *Src, u64 Count)
+{
+	u64 Loops = Count / XMT_PERF_DBL_PER_LINE;
+
+	__asm__ __volatile__(
+		"1:	ldp	q0, q1, [%[src]], #32\n"
+		"	ldp	q2, q3, [%[src]], #32\n"
+		"	stp	q0, q1, [%[dst]], #32\n"
+		"	stp	q2, q3, [%[dst]], #32\n"
+		"	subs	%[n], %[n], #1\n"
+		"	b.ne	1b\n"
+		: [dst] "+r" (Dst), [src] "+r" (Src), [n] "+r" (Loops)
+		:
+		: "v0", "v1", "v2", "v3", "cc", "memory");
+}
+
+/*****************************************************************************/
+/**
+ * This function copies Count doubles from Src to Dst with non-temporal
+ * loads and stores, which hint the core not to allocate the lines.
+ *
+ * @param Dst is the destination array
+ * @param Src is the source array
+ * @param Count is the number of doubles, a multiple of a cache line
+ *
+ * @return none
+ *
+ * @note none
+ *****************************************************************************/
+static void XMt_PerfCopyNt(double *Dst, const double *Src, u64 Count)
+{
+	u64 Loops = Count / XMT_PERF_DBL_PER_LINE;
+
+	__asm__ __volatile__(
+		"1:	ldnp	q0, q1, [%[src]]\n"
+		"	ldnp	q2, q3, [%[src], #32]\n"
+		"	stnp	q0, q1, [%[dst]]\n"
+		"	stnp	q2, q3, [%[dst], #32]\n"
+		"	add	%[src], %[src], #64\n"
+		"	add	%[dst], %[dst], #64\n"
+		"	subs	%[n], %[n], #1\n"
+		"	b.ne	1b\n"
+		: [dst] "+r" (Dst), [src] "+r" (Src), [n] "+r" (Loops)
+		:
+		: "v0", "v1", "v2", "v3", "cc", "memory");
+}
+
+/*****************************************************************************/
+/**
+ * This function computes Dst = Scalar * Src.
+ *
+ * @param Dst is the destination array
+ * @param Src is the source array
+ * @param Count is the number of doubles, a multiple of a cache line
+ *
+ * @return none
+ *
+ * @note none
+ *****************************************************************************/
+static void XMt_PerfScale(double *Dst, const double *Src, u64 Count)
+{
+	u64 Loops = Count / XMT_PERF_DBL_PER_LINE;
+
+	__asm__ __volatile__(
+		"	ld1r	{v16.2d}, [%[s]]\n"
+		"1:	ldp	q0, q1, [%[src]], #32\n"
+		"	ldp	q2, q3, [%[src]], #32\n"
+		"	fmul	v0.2d, v0.2d, v16.2d\n"
+		"	fmul	v1.2d, v1.2d, v16.2d\n"
+		"	fmul	v2.2d, v2.2d, v16.2d\n"
+		"	fmul	v3.2d, v3.2d, v16.2d\n"
+		"	stp	q0, q1, [%[dst]], #32\n"
+		"	stp	q2, q3, [%[dst]], #32\n"
+		"	subs	%[n], %[n], #1\n"
+		"	b.ne	1b\n"
+		: [dst] "+r" (Dst), [src] "+r" (Src), [n] "+r" (Loops)
+		: [s] "r" (&XMt_PerfScalar)
+		: "v0", "v1", "v2", "v3", "v16", "cc", "memory");
+}
+
+/*****************************************************************************/
+/**
+ * This function computes Dst = Src1 + Src2.
+ *
+ * @param Dst is the destination array
+ * @param Src1 is the first source array
+ * @param Src2 is the second source array
+ * @param Count is the number of doubles, a multiple of a cache line
+ *
+ * @return none
+ *
+ * @note none
+ *****************************************************************************/
+static void XMt_PerfAdd(double *Dst, const double *Src1, const double *Src2,
+			u64 Count)
+{
+	u64 Loops = Count / XMT_PERF_DBL_PER_LINE;
+
+	__asm__ __volatile__(
+		"1:	ldp	q0, q1, [%[src1]], #32\n"
+		"	ldp	q2, q3, [%[src1]], #32\n"
+		"	ldp	q4, q5, [%[src2]], #32\n"
+		"	ldp	q6, q7, [%[src2]], #32\n"
+		"	fadd	v0.2d, v0.2d, v4.2d\n"
+		"	fadd	v1.2d, v1.2d, v5.2d\n"
+		"	fadd	v2.2d, v2.2d, v6.2d\n"
+		"	fadd	v3.2d, v3.2d, v7.2d\n"
+		"	stp	q0, q1, [%[dst]], #32\n"
+		"	stp	q2, q3, [%[dst]], #32\n"
+		"	subs	%[n], %[n], #1\n"
+		"	b.ne	1b\n"
+		: [dst] "+r" (Dst), [src1] "+r" (Src1), [src2] "+r" (Src2),
+		  [n] "+r" (Loops)
+		:
+		: "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7", "cc",
+		  "memory");
+}
+
+/*****************************************************************************/
+/**
+ * This function computes Dst = Src1 + Scalar * Src2.
+ *
+ * @param Dst is the destination array
+ * @param Src1 is the first source array
+ * @param Src2 is the second source array
+ * @param Count is the number of doubles, a multiple of a cache line
+ *
+ * @return none
+ *
+ * @note none
+ *****************************************************************************/
+static void XMt_PerfTriad(double *Dst, const double *Src1, const double *Src2,
+			  u64 Count)
+{
+	u64 Loops = Count / XMT_PERF_DBL_PER_LINE;
+
+	__asm__ __volatile__(
+		"	ld1r	{v16.2d}, [%[s]]\n"
+		"1:	ldp	q0, q1, [%[src1]], #32\n"
+		"	ldp	q2, q3, [%[src1]], #32\n"
+		"	ldp	q4, q5, [%[src2]], #32\n"
+		"	ldp	q6, q7, [%[src2]], #32\n"
+		"	fmla	v0.2d, v4.2d, v16.2d\n"
+		"	fmla	v1.2d, v5.2d, v16.2d\n"
+		"	fmla	v2.2d, v6.2d, v16.2d\n"
+		"	fmla	v3.2d, v7.2d, v16.2d\n"
+		"	stp	q0, q1, [%[dst]], #32\n"
+		"	stp	q2, q3, [%[dst]], #32\n"
+		"	subs	%[n], %[n], #1\n"
+		"	b.ne	1b\n"
+		: [dst] "+r" (Dst), [src1] "+r" (Src1), [src2] "+r" (Src2),
+		  [n] "+r" (Loops)
+		: [s] "r" (&XMt_PerfScalar)
+		: "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7", "v16", "cc",
+		  "memory");
+}
+
+/*****************************************************************************/
+/**
+ * This function runs one STREAM kernel on a slice of the arrays.
+ *
+ * @param Kernel is one of XMT_PERF_COPY ... XMT_PERF_TRIAD
+ * @param A, B, C are the start of the STREAM arrays
+ * @param Count is the number of doubles in each array, a multiple of a
+ *	  cache line
+ * @param Slot is the index of the slice to work on
+ * @param NumCores is the number of slices
+ *
+ * @return none
+ *
+ * @note none
+ *****************************************************************************/
+static void XMt_PerfRunKernel(u32 Kernel, double *A, double *B, double *C,
+			      u64 Count, u32 Slot, u32 NumCores)
+{
+	u64 Len = Count / NumCores;
+	u64 Offset;
+
+	/* Whole cache lines per slice, the last slice takes the remainder */
+	Len -= Len % XMT_PERF_DBL_PER_LINE;
+	Offset = Len * Slot;
+	if (Slot == (NumCores - 1U)) {
+		Len = Count - Offset;
+	}
+
+	if (Len == 0U) {
+		return;
+	}
+
+	switch (Kernel) {
+	case XMT_PERF_COPY:
+		XMt_PerfCopy(&C[Offset], &A[Offset], Len);
+		break;
+	case XMT_PERF_COPY_NT:
+		XMt_PerfCopyNt(&C[Offset], &A[Offset], Len);
+		break;
+	case XMT_PERF_SCALE:
+		XMt_PerfScale(&B[Offset], &C[Offset], Len);
+		break;
+	case XMT_PERF_ADD:
+		XMt_PerfAdd(&C[Offset], &A[Offset], &B[Offset], Len);
+		break;
+	default:
+		XMt_PerfTriad(&A[Offset], &B[Offset], &C[Offset], Len);
+		break;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * This function returns the time in seconds since Start.
+ *
+ * @param Start is the start time
+ *
+ * @return Elapsed time in seconds
+ *
+ * @note none
+ *****************************************************************************/
+static double XMt_PerfElapsed(XTime Start)
+{
+	XTime End;
+
+	XTime_GetTime(&End);
+
+	return (double)(End - Start) / (double)COUNTS_PER_SECOND;
+}
+
+/*****************************************************************************/
+/**
+ * This function returns the next value of a xorshift random generator.
+ *
+ * @param Seed is the state of the generator
+ *
+ * @return Random value
+ *
+ * @note none
+ *****************************************************************************/
+static u64 XMt_PerfRand(u64 *Seed)
+{
+	u64 Val = *Seed;
+
+	Val ^= Val << 13U;
+	Val ^= Val >> 7U;
+	Val ^= Val << 17U;
+	*Seed = Val;
+
+	return Val;
+}
+
+/*****************************************************************************/
+/**
+ * This function prints one line of the performance report.
+ *
+ * @param Name is the name of the test
+ * @param Cores is the number of cores which ran the test
+ * @param Val is the measured value
+ * @param Unit is the unit of the value
+ *
+ * @return none
+ *
+ * @note none
+ *****************************************************************************/
+static void XMt_PerfPrint(const char *Name, u32 Cores, double Val,
+			  const char *Unit)
+{
+	xil_printf("  %-12s |   %d   | %6d.%03d %s\r\n", Name, Cores, (u32)Val,
+		   (u32)((Val - (u32)Val) * 1000.0), Unit);
+}
+
+#if (EL3 == 1)
+/*****************************************************************************/
+/**
+ * This function is the main loop of the secondary cores. It runs the slice of
+ * each published STREAM job and leaves the coherency domain on exit.
+ *
+ * @param Core is the APU core number
+ *
+ * @return none
+ *
+ * @note Called from XMt_PerfSecondaryEntry, not to be called directly
+ *****************************************************************************/
+void XMt_PerfSecondaryMain(u64 Core)
+{
+	u32 Seq = XMt_PerfSync.Seq;
+
+	/* Tell the primary core that this core is up */
+	XMt_PerfSync.Done[Core] = Seq;
+	dsb();
+	__asm__ __volatile__("sev");
+
+	while (1) {
+		while (XMt_PerfSync.Seq == Seq) {
+			__asm__ __volatile__("wfe");
+		}
+		Seq = XMt_PerfSync.Seq;
+		dmb();
+
+		if (XMt_PerfSync.Kernel == XMT_PERF_EXIT) {
+			break;
+		}
+
+		XMt_PerfRunKernel(XMt_PerfSync.Kernel, XMt_PerfSync.A,
+				  XMt_PerfSync.B, XMt_PerfSync.C,
+				  XMt_PerfSync.Count, XMt_PerfSync.Slot[Core],
+				  XMt_PerfSync.NumCores);
+		dsb();
+		XMt_PerfSync.Done[Core] = Seq;
+		dsb();
+		__asm__ __volatile__("sev");
+	}
+
+	XMt_PerfSync.Done[Core] = Seq;
+	dsb();
+
+	/* Write back the data of this core and leave the coherency domain */
+	Xil_DCacheFlush();
+	mtcp(SCTLR_EL3, mfcp(SCTLR_EL3) & ~(u64)XREG_CONTROL_DCACHE_BIT);
+	isb();
+	mtcp(S3_1_C15_C2_1, mfcp(S3_1_C15_C2_1) & ~(u64)XMT_CPUECTLR_SMPEN);
+	isb();
+	dsb();
+}
+
+/*****************************************************************************/
+/**
+ * This function waits until all the started secondary cores finished Seq.
+ *
+ * @param CoreMask is the mask of the started secondary cores
+ * @param Seq is the sequence number to wait for
+ * @param TimeoutUs is the timeout in micro seconds, 0 to wait forever
+ *
+ * @return Mask of the cores which did not finish
+ *
+ * @note none
+ *****************************************************************************/
+static u32 XMt_PerfWaitCores(u32 CoreMask, u32 Seq, u32 TimeoutUs)
+{
+	XTime Start;
+	u32 Pending = CoreMask;
+	u32 Core;
+
+	XTime_GetTime(&Start);
+	while (Pending != 0U) {
+		for (Core = 1U; Core < XMT_PERF_MAX_CORES; Core++) {
+			if (((Pending & (1U << Core)) != 0U) &&
+			    (XMt_PerfSync.Done[Core] == Seq)) {
+				Pending &= ~(1U << Core);
+			}
+		}
+		if ((TimeoutUs != 0U) &&
+		    (XMt_PerfElapsed(Start) * 1000000.0 > TimeoutUs)) {
+			break;
+		}
+	}
+	dmb();
+
+	return Pending;
+}
+
+/*****************************************************************************/
+/**
+ * This function powers up and releases the idle secondary APU cores into
+ * XMt_PerfSecondaryEntry. Cores which are already out of reset are used by
+ * other software and are left alone.
+ *
+ * @return Mask of the started secondary cores
+ *
+ * @note The caller has to keep the D-cache enabled while the cores run
+ *****************************************************************************/
+static u32 XMt_PerfStartCores(void)
+{
+	u32 CoreMask = 0U;
+	u32 Core;
+	u32 PwrMask;
+	u32 RstMask;
+	u32 RegVal;
+	u32 Pending;
+
+	XMt_PerfBoot.Vbar = mfcp(VBAR_EL3);
+	XMt_PerfBoot.Mair = mfcp(MAIR_EL3);
+	XMt_PerfBoot.Tcr = mfcp(TCR_EL3);
+	XMt_PerfBoot.Ttbr0 = mfcp(TTBR0_EL3);
+	XMt_PerfBoot.Sctlr = mfcp(SCTLR_EL3);
+	for (Core = 0U; Core < XMT_PERF_MAX_CORES; Core++) {
+		XMt_PerfBoot.Stack[Core] = (u64)(UINTPTR)
+				&XMt_PerfStack[Core][XMT_PERF_STACK_SIZE];
+	}
+	/* The secondary cores read the boot data with the MMU disabled */
+	Xil_DCacheFlushRange((INTPTR)&XMt_PerfBoot, sizeof(XMt_PerfBoot));
+
+	for (Core = 1U; Core < XMT_PERF_MAX_CORES; Core++) {
+		RstMask = XMT_CRF_APB_RST_FPD_APU_ACPU0_RESET_MASK << Core;
+		if ((Xil_In32(XMT_CRF_APB_RST_FPD_APU) & RstMask) == 0U) {
+			continue;
+		}
+
+		PwrMask = (XMT_PMU_GLOBAL_PWR_STATE_ACPU0_MASK << Core) |
+			  XMT_PMU_GLOBAL_PWR_STATE_FP_MASK |
+			  XMT_PMU_GLOBAL_PWR_STATE_L2_BANK0_MASK;
+		if ((Xil_In32(XMT_PMU_GLOBAL_PWR_STATE) & PwrMask) != PwrMask) {
+			Xil_Out32(XMT_PMU_GLOBAL_REQ_PWRUP_INT_EN, PwrMask);
+			Xil_Out32(XMT_PMU_GLOBAL_REQ_PWRUP_TRIG, PwrMask);
+			while ((Xil_In32(XMT_PMU_GLOBAL_REQ_PWRUP_STATUS) &
+				PwrMask) != 0U) {
+				;
+			}
+		}
+
+		RegVal = Xil_In32(XMT_APU_CONFIG_0);
+		Xil_Out32(XMT_APU_CONFIG_0, RegVal |
+			  (XMT_APU_CONFIG_0_AA64N32_CPU0_MASK << Core));
+		Xil_Out32(XMT_APU_RVBARADDR0L +
+			  (Core * XMT_APU_RVBARADDR_OFFSET),
+			  (u32)(UINTPTR)XMt_PerfSecondaryEntry);
+		Xil_Out32(XMT_APU_RVBARADDR0H +
+			  (Core * XMT_APU_RVBARADDR_OFFSET),
+			  (u32)((u64)(UINTPTR)XMt_PerfSecondaryEntry >> 32U));
+
+		XMt_PerfSync.Done[Core] = XMT_PERF_CORE_IDLE;
+		dsb();
+
+		RegVal = Xil_In32(XMT_CRF_APB_RST_FPD_APU);
+		RegVal &= ~(RstMask |
+			(XMT_CRF_APB_RST_FPD_APU_ACPU0_PWRON_RESET_MASK << Core));
+		Xil_Out32(XMT_CRF_APB_RST_FPD_APU, RegVal);
+
+		CoreMask |= (1U << Core);
+	}
+
+	/* Put the cores which did not come up back into reset */
+	Pending = XMt_PerfWaitCores(CoreMask, XMt_PerfSync.Seq,
+				    XMT_PERF_CORE_UP_TIMEOUT_US);
+	if (Pending != 0U) {
+		RegVal = Xil_In32(XMT_CRF_APB_RST_FPD_APU);
+		Xil_Out32(XMT_CRF_APB_RST_FPD_APU, RegVal |
+			  (Pending * XMT_CRF_APB_RST_FPD_APU_ACPU0_RESET_MASK));
+		CoreMask &= ~Pending;
+	}
+
+	return CoreMask;
+}
+
+/*****************************************************************************/
+/**
+ * This function stops the secondary cores and puts them back into reset.
+ *
+ * @param CoreMask is the mask of the started secondary cores
+ *
+ * @return none
+ *
+ * @note none
+ *****************************************************************************/
+static void XMt_PerfStopCores(u32 CoreMask)
+{
+	u32 RegVal;
+
+	if (CoreMask == 0U) {
+		return;
+	}
+
+	XMt_PerfSync.Kernel = XMT_PERF_EXIT;
+	dmb();
+	XMt_PerfSync.Seq++;
+	dsb();
+	__asm__ __volatile__("sev");
+
+	(void)XMt_PerfWaitCores(CoreMask, XMt_PerfSync.Seq, 0U);
+
+	/* Give the cores time to write back their caches */
+	usleep(XMT_PERF_CORE_DOWN_DELAY_US);
+
+	RegVal = Xil_In32(XMT_CRF_APB_RST_FPD_APU);
+	Xil_Out32(XMT_CRF_APB_RST_FPD_APU, RegVal |
+		  (CoreMask * XMT_CRF_APB_RST_FPD_APU_ACPU0_RESET_MASK));
+}
+#endif
+
+/*****************************************************************************/
+/**
+ * This function runs one STREAM kernel on the primary core and on the
+ * started secondary cores, each core working on its own slice of the arrays.
+ *
+ * @param CoreMask is the mask of the started secondary cores
+ * @param Kernel is one of XMT_PERF_COPY ... XMT_PERF_TRIAD
+ * @param A, B, C are the STREAM arrays
+ * @param Count is the number of doubles in each array
+ *
+ * @return Time taken in seconds
+ *
+ * @note none
+ *****************************************************************************/
+static double XMt_PerfRunStream(u32 CoreMask, u32 Kernel, double *A,
+				double *B, double *C, u64 Count)
+{
+	XTime Start;
+	u32 NumCores = 1U;
+	u32 Core;
+
+	for (Core = 1U; Core < XMT_PERF_MAX_CORES; Core++) {
+		if ((CoreMask & (1U << Core)) != 0U) {
+			XMt_PerfSync.Slot[Core] = NumCores;
+			NumCores++;
+		}
+	}
+
+	XMt_PerfSync.Kernel = Kernel;
+	XMt_PerfSync.NumCores = NumCores;
+	XMt_PerfSync.A = A;
+	XMt_PerfSync.B = B;
+	XMt_PerfSync.C = C;
+	XMt_PerfSync.Count = Count;
+	dmb();
+
+	XTime_GetTime(&Start);
+	if (CoreMask != 0U) {
+		XMt_PerfSync.Seq++;
+		dsb();
+		__asm__ __volatile__("sev");
+	}
+
+	XMt_PerfRunKernel(Kernel, A, B, C, Count, 0U, NumCores);
+
+#if (EL3 == 1)
+	(void)XMt_PerfWaitCores(CoreMask, XMt_PerfSync.Seq, 0U);
+#endif
+
+	return XMt_PerfElapsed(Start);
+}
+
+/*****************************************************************************/
+/**
+ * This function measures the STREAM bandwidth of a DDR region.
+ *
+ * @param Base is the start address of the region
+ * @param Size is the size of the region in bytes
+ * @param CoreMask is the mask of the started secondary cores
+ *
+ * @return none
+ *
+ * @note none
+ *****************************************************************************/
+static void XMt_PerfStream(u64 Base, u64 Size, u32 CoreMask)
+{
+	double *A;
+	double *B;
+	double *C;
+	double Time;
+	double Best;
+	u64 ArrSize;
+	u64 Count;
+	u64 Index;
+	u32 Kernel;
+	u32 Iter;
+	u32 NumCores = 1U;
+	u32 Core;
+
+	for (Core = 1U; Core < XMT_PERF_MAX_CORES; Core++) {
+		if ((CoreMask & (1U << Core)) != 0U) {
+			NumCores++;
+		}
+	}
+
+	/* Three arrays of a whole number of cache lines */
+	ArrSize = Size / 3U;
+	ArrSize -= ArrSize % XMT_PERF_LINE_SIZE;
+	Count = ArrSize / sizeof(double);
+	if (Count == 0U) {
+		xil_printf("  Region too small for the bandwidth tests\r\n");
+		return;
+	}
+
+	A = (double *)(UINTPTR)Base;
+	B = (double *)(UINTPTR)(Base + ArrSize);
+	C = (double *)(UINTPTR)(Base + (2U * ArrSize));
+
+	for (Index = 0U; Index < Count; Index++) {
+		A[Index] = 1.0;
+		B[Index] = 2.0;
+		C[Index] = 0.0;
+	}
+
+	for (Kernel = 0U; Kernel < XMT_PERF_NUM_KERNELS; Kernel++) {
+		Best = 0.0;
+		for (Iter = 0U; Iter < XMT_PERF_ITER; Iter++) {
+			Time = XMt_PerfRunStream(CoreMask, Kernel, A, B, C,
+						 Count);
+			if ((Best == 0.0) || (Time < Best)) {
+				Best = Time;
+			}
+		}
+		XMt_PerfPrint(XMt_PerfKernels[Kernel].Name, NumCores,
+			      ((double)Count * XMt_PerfKernels[Kernel].Bytes) /
+			      Best / 1e9, "GB/s");
+	}
+}
+
+/*****************************************************************************/
+/**
+ * This function measures the load to use latency of a DDR region by chasing
+ * pointers through a single random cycle of cache lines.
+ *
+ * @param Base is the start address of the region
+ * @param Size is the size of the region in bytes
+ *
+ * @return none
+ *
+ * @note none
+ *****************************************************************************/
+static void XMt_PerfLatency(u64 Base, u64 Size)
+{
+	XTime Start;
+	double Time;
+	u64 Nodes = Size / XMT_PERF_LINE_SIZE;
+	u64 Seed = 0x2545F4914F6CDD1DU;
+	u64 *Node;
+	u64 *Next;
+	u64 Index;
+	u64 Swap;
+	u64 Val;
+	u32 Step;
+
+	if (Nodes < 2U) {
+		xil_printf("  Region too small for the latency test\r\n");
+		return;
+	}
+
+	/* Sattolo's shuffle gives a single cycle through all the lines */
+	for (Index = 0U; Index < Nodes; Index++) {
+		*(u64 *)(UINTPTR)(Base + (Index * XMT_PERF_LINE_SIZE)) = Index;
+	}
+	for (Index = Nodes - 1U; Index > 0U; Index--) {
+		Swap = XMt_PerfRand(&Seed) % Index;
+		Node = (u64 *)(UINTPTR)(Base + (Index * XMT_PERF_LINE_SIZE));
+		Next = (u64 *)(UINTPTR)(Base + (Swap * XMT_PERF_LINE_SIZE));
+		Val = *Node;
+		*Node = *Next;
+		*Next = Val;
+	}
+	for (Index = 0U; Index < Nodes; Index++) {
+		Node = (u64 *)(UINTPTR)(Base + (Index * XMT_PERF_LINE_SIZE));
+		*Node = Base + (*Node * XMT_PERF_LINE_SIZE);
+	}
+
+	Node = (u64 *)(UINTPTR)Base;
+	XTime_GetTime(&Start);
+	for (Step = 0U; Step < XMT_PERF_CHASE_STEPS; Step += 8U) {
+		Node = (u64 *)(UINTPTR)*Node;
+		Node = (u64 *)(UINTPTR)*Node;
+		Node = (u64 *)(UINTPTR)*Node;
+		Node = (u64 *)(UINTPTR)*Node;
+		Node = (u64 *)(UINTPTR)*Node;
+		Node = (u64 *)(UINTPTR)*Node;
+		Node = (u64 *)(UINTPTR)*Node;
+		Node = (u64 *)(UINTPTR)*Node;
+	}
+	Time = XMt_PerfElapsed(Start);
+	XMt_PerfSink = (u64)(UINTPTR)Node;
+
+	XMt_PerfPrint("Latency", 1U, (Time * 1e9) / XMT_PERF_CHASE_STEPS,
+		      "ns");
+}
+
+/*****************************************************************************/
+/**
+ * This function measures the random access update rate of a DDR region with
+ * the HPCC RandomAccess update stream.
+ *
+ * @param Base is the start address of the region
+ * @param Size is the size of the region in bytes
+ *
+ * @return none
+ *
+ * @note none
+ *****************************************************************************/
+static void XMt_PerfGups(u64 Base, u64 Size)
+{
+	XTime Start;
+	double Time;
+	u64 *Table = (u64 *)(UINTPTR)Base;
+	u64 Words = 1U;
+	u64 Updates;
+	u64 Index;
+	u64 Ran = 1U;
+
+	/* The table is the largest power of two words fitting the region */
+	while ((Words * 2U * sizeof(u64)) <= Size) {
+		Words *= 2U;
+	}
+	if (Words < 2U) {
+		xil_printf("  Region too small for the random access test\r\n");
+		return;
+	}
+
+	Updates = 4U * Words;
+	if (Updates > XMT_PERF_GUPS_MAX_UPDATES) {
+		Updates = XMT_PERF_GUPS_MAX_UPDATES;
+	}
+
+	for (Index = 0U; Index < Words; Index++) {
+		Table[Index] = Index;
+	}
+
+	XTime_GetTime(&Start);
+	for (Index = 0U; Index < Updates; Index++) {
+		Ran = (Ran << 1U) ^ (((s64)Ran < 0) ? XMT_PERF_GUPS_POLY : 0U);
+		Table[Ran & (Words - 1U)] ^= Ran;
+	}
+	Time = XMt_PerfElapsed(Start);
+
+	XMt_PerfPrint("Random RMW", 1U, (double)Updates / Time / 1e6, "MUP/s");
+	XMt_PerfPrint("Random RMW", 1U, (Time * 1e9) / (double)Updates, "ns");
+}
+
+/*****************************************************************************/
+/**
+ * This function runs all the performance tests on one DDR region.
+ *
+ * @param XMtPtr is the pointer to the Memtest Data Structure
+ * @param Name is the name of the region
+ * @param Base is the start address of the region
+ * @param Size is the size of the region in bytes
+ *
+ * @return none
+ *
+ * @note none
+ *****************************************************************************/
+static void XMt_PerfRegion(XMt_CfgData *XMtPtr, const char *Name, u64 Base,
+			   u64 Size)
+{
+	u32 CoreMask = 0U;
+
+	xil_printf("\r\n%s: Address 0x%08x%08x, %dMB, D-cache %s\r\n", Name,
+		   (u32)(Base >> 32U), (u32)Base, (u32)(Size / XMT_MB2BYTE),
+		   (XMtPtr->DCacheEnable != 0U) ? "enabled" : "disabled");
+	xil_printf("---------------+-------+-------------------\r\n");
+	xil_printf("  TEST         | CORES |  RESULT\r\n");
+	xil_printf("---------------+-------+-------------------\r\n");
+
+	XMt_PerfStream(Base, Size, 0U);
+
+	/* The cores synchronize through the caches */
+	if (XMtPtr->DCacheEnable != 0U) {
+#if (EL3 == 1)
+		CoreMask = XMt_PerfStartCores();
+#endif
+		if (CoreMask != 0U) {
+			XMt_PerfStream(Base, Size, CoreMask);
+		}
+#if (EL3 == 1)
+		XMt_PerfStopCores(CoreMask);
+#endif
+	}
+
+	XMt_PerfLatency(Base, Size);
+	XMt_PerfGups(Base, Size);
+	xil_printf("---------------+-------+-------------------\r\n");
+
+	if (CoreMask == 0U) {
+		xil_printf("  Multi-core tests need the D-cache enabled, EL3 "
+			   "and idle APU cores\r\n");
+	}
+}
+
+/*****************************************************************************/
+/**
+ * This function runs the memory performance tests on each DDR region
+ *
+ * @param XMtPtr is the pointer to the Memtest Data Structure
+ * @param StartAddr is the starting Address
+ * @param TestSize is the Size (MegaBytes) of the memory to be Tested in
+ *        each DDR region
+ *
+ * @return none
+ *
+ * @note The contents of the tested memory are overwritten
+ *****************************************************************************/
+void XMt_RunPerfTests(XMt_CfgData *XMtPtr, u64 StartAddr, u64 TestSize)
+{
+	u64 Size = TestSize * XMT_MB2BYTE;
+	u64 Offset;
+
+	if (Size == 0U) {
+		xil_printf("\r\nPlease enter a non-zero size\r\n");
+		return;
+	}
+
+	xil_printf("\r\nStarting Memory Performance Test...\r\n");
+
+	/* The start address is an offset in DDR_0 followed by DDR_1 */
+	if (StartAddr < XMT_DDR_0_SIZE) {
+		if ((StartAddr + Size) <= XMT_DDR_0_SIZE) {
+			XMt_PerfRegion(XMtPtr, "DDR_0",
+				       XMT_DDR_0_BASEADDR + StartAddr, Size);
+		} else {
+			xil_printf("\r\nDDR_0: size exceeds the region, "
+				   "skipped\r\n");
+		}
+		Offset = 0U;
+	} else {
+		Offset = StartAddr - XMT_DDR_0_SIZE;
+	}
+
+	if (XMT_DDR_1_SIZE != 0U) {
+		if ((Offset + Size) <= XMT_DDR_1_SIZE) {
+			XMt_PerfRegion(XMtPtr, "DDR_1",
+				       XMT_DDR_1_BASEADDR + Offset, Size);
+		} else {
+			xil_printf("\r\nDDR_1: size exceeds the region, "
+				   "skipped\r\n");
+		}
+	}
+}
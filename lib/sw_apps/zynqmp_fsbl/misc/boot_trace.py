@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+###############################################################################
+# Copyright (c) 2021 Xilinx, Inc.  All rights reserved.
+# SPDX-License-Identifier: MIT
+###############################################################################
+"""Decode the ZynqMP FSBL and PMU firmware boot timestamp trace.
+
+The trace is the 256 byte OCM region at 0xFFFE9F00 described in
+src/xfsbl_boot_trace.h. Dump it after boot, for example
+
+  from Linux:  dd if=/dev/mem of=trace.bin bs=256 count=1 skip=$((0xFFFE9F))
+  from xsdb:   mrd -bin -file trace.bin 0xFFFE9F00 64
+
+and decode it with
+
+  boot_trace.py trace.bin                      table of the boot milestones
+  boot_trace.py trace.bin --folded out.txt     collapsed stacks for
+                                               flamegraph.pl
+  boot_trace.py trace.bin --chrome out.json    trace events for
+                                               chrome://tracing or Perfetto
+
+Each milestone closes the segment that started at the previous milestone of
+the same log, the segment is named after the milestone.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+TRACE_SIZE = 0x100
+
+# (name, offset, magic, maximum number of events)
+LOGS = (
+    ("FSBL", 0x00, 0x31465442, 18),
+    ("PMUFW", 0xA0, 0x31505442, 10),
+)
+
+# Milestone ID -> (group, segment name), keep in sync with
+# src/xfsbl_boot_trace.h and zynqmp_pmufw/src/xpfw_boot_trace.h
+EVENTS = {
+    "FSBL": {
+        0x01: (None, "start"),
+        0x02: ("Initialization", "psu_init"),
+        0x03: ("Initialization", "processor init"),
+        0x04: ("Initialization", "ECC init"),
+        0x05: ("Initialization", "other init"),
+        0x06: ("Boot device", "boot device init"),
+        0x07: ("Partition load", "partition {arg}"),
+        0x08: ("Handoff", "PM init"),
+        0x09: ("Handoff", "exit"),
+    },
+    "PMUFW": {
+        0x01: (None, "start"),
+        0x02: ("Initialization", "core init"),
+        0x03: ("Initialization", "user startup"),
+        0x04: ("Initialization", "core configure"),
+        0x05: ("Initialization", "system start"),
+        0x06: ("Runtime", "wait for PM configuration"),
+    },
+}
+
+DEFAULT_FREQ = 100000000
+
+
+def parse_log(data, offset, magic, max_events):
+    """Return (freq, dropped, [(id, arg, count)]) or None if not valid."""
+    hdr_magic, count, freq, dropped = struct.unpack_from("<4I", data, offset)
+    if hdr_magic != magic:
+        return None
+    events = []
+    for index in range(min(count, max_events)):
+        word0, word1 = struct.unpack_from("<2I", data,
+                                          offset + 16 + 8 * index)
+        events.append((word0 >> 24, (word0 >> 16) & 0xFF,
+                       ((word0 & 0xFFFF) << 32) | word1))
+    return freq, dropped, events
+
+
+def segments(name, events, base, freq):
+    """Turn milestones into (group, segment, start_us, duration_us)."""
+    result = []
+    prev = None
+    for event_id, arg, count in events:
+        group, label = EVENTS[name].get(event_id,
+                                        (None, "event 0x%02x" % event_id))
+        label = label.format(arg=arg)
+        if prev is not None and label != "start":
+            start = (prev - base) * 1e6 / freq
+            result.append((group, label, start, (count - prev) * 1e6 / freq))
+        prev = count
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Decode the ZynqMP boot timestamp trace.")
+    parser.add_argument("dump", help="binary dump of the trace region")
+    parser.add_argument("--freq", type=int, default=0,
+                        help="counter frequency in Hz, overrides the value "
+                        "recorded in the trace")
+    parser.add_argument("--folded", metavar="FILE",
+                        help="write collapsed stacks for flamegraph.pl")
+    parser.add_argument("--chrome", metavar="FILE",
+                        help="write Chrome trace event JSON")
+    args = parser.parse_args()
+
+    with open(args.dump, "rb") as dump:
+        data = dump.read(TRACE_SIZE)
+    if len(data) < TRACE_SIZE:
+        sys.exit("%s: expected %d bytes" % (args.dump, TRACE_SIZE))
+
+    logs = {}
+    for name, offset, magic, max_events in LOGS:
+        log = parse_log(data, offset, magic, max_events)
+        if log is None:
+            print("%s: no trace" % name)
+            continue
+        logs[name] = log
+
+    if not logs:
+        return 1
+
+    # logs without events give an empty trace
+    base = min((events[0][2] for _, _, events in logs.values() if events),
+               default=0)
+    folded = []
+    chrome = []
+    for tid, (name, (freq, dropped, events)) in enumerate(sorted(
+            logs.items()), 1):
+        freq = args.freq or freq or DEFAULT_FREQ
+        print("%s: %d events, %d dropped, counter %d Hz" %
+              (name, len(events), dropped, freq))
+        print("  %12s %12s  %s" % ("start (us)", "time (us)", "stage"))
+        for group, label, start, duration in segments(name, events, base,
+                                                      freq):
+            stack = [name] + ([group] if group else []) + [label]
+            print("  %12.1f %12.1f  %s" % (start, duration,
+                                           " / ".join(stack[1:])))
+            folded.append("%s %d" % (";".join(stack), round(duration)))
+            chrome.append({"name": label, "cat": group or name, "ph": "X",
+                           "pid": 1, "tid": tid, "ts": start,
+                           "dur": duration})
+        chrome.append({"name": "thread_name", "ph": "M", "pid": 1,
+                       "tid": tid, "args": {"name": name}})
+
+    if args.folded:
+        with open(args.folded, "w") as out:
+            out.writelines(line + "\n" for line in folded)
+    if args.chrome:
+        with open(args.chrome, "w") as out:
+            json.dump({"traceEvents": chrome, "displayTimeUnit": "ms"}, out)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
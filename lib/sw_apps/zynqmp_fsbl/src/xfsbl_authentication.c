@@ -39,6 +39,7 @@
 *       bsv  05/03/21 Add provision to load bitstream from OCM with DDR
 *                     present in design
 * 8.0   bsv  07/13/21 Remove unwanted CsuDma initializations
+*       dc   10/27/21 Account RSA time to the boot time report
 *
 * </pre>
 *
@@ -53,6 +54,7 @@
 
 u32 XFsbl_SpkVer(u64 AcOffset, u32 HashLen);
 u32 XFsbl_PpkVer(u64 AcOffset, u32 HashLen);
+static s32 XFsbl_RsaPublicEncrypt(u8 *Input, u32 Size, u8 *Result);
 void XFsbl_ReadPpkHash(u32 *PpkHash, u8 PpkSelect);
 #endif
 /*****************************************************************************/
@@ -153,8 +155,7 @@ u32 XFsbl_SpkVer(u64 AcOffset, u32 HashLen)
 		goto END;
 	}
 	/* Decrypt SPK Signature */
-	if(XFSBL_SUCCESS != XSecure_RsaPublicEncrypt(&SecureRsa,
-		AcPtr + XFSBL_AUTH_CERT_SPK_SIG_OFFSET,
+	if(XFSBL_SUCCESS != XFsbl_RsaPublicEncrypt(AcPtr + XFSBL_AUTH_CERT_SPK_SIG_OFFSET,
 		XSECURE_RSA_4096_KEY_SIZE, XFsbl_RsaSha3Array))
 	{
 		XFsbl_Printf(DEBUG_GENERAL,
@@ -345,7 +346,7 @@ static u32 XFsbl_PartitionSignVer(const XFsblPs *FsblInstancePtr, u64 PartitionO
 	}
 	/* Decrypt Partition Signature. */
 	if(XFSBL_SUCCESS !=
-		XSecure_RsaPublicEncrypt(&SecureRsa, AcPtr, XSECURE_RSA_4096_KEY_SIZE,
+		XFsbl_RsaPublicEncrypt(AcPtr, XSECURE_RSA_4096_KEY_SIZE,
 				XFsbl_RsaSha3Array))
 	{
 		XFsbl_Printf(DEBUG_GENERAL,
@@ -669,7 +670,7 @@ u32 XFsbl_BhAuthentication(const XFsblPs * FsblInstancePtr, u8 *Data,
 	}
 	/* Decrypt SPK Signature */
 	if(XFSBL_SUCCESS !=
-		XSecure_RsaPublicEncrypt(&SecureRsa, AcPtr, XSECURE_RSA_4096_KEY_SIZE,
+		XFsbl_RsaPublicEncrypt(AcPtr, XSECURE_RSA_4096_KEY_SIZE,
 				XFsbl_RsaSha3Array))
 	{
 		XFsbl_Printf(DEBUG_GENERAL,"XFsbl_BhAuthentication:"
@@ -695,6 +696,37 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * This function performs the RSA public key operation with the key
+ * initialized in SecureRsa and accounts its time to the RSA stage of the
+ * boot time report.
+ *
+ * @param	Input is the signature to be processed.
+ * @param	Size is the key size in bytes.
+ * @param	Result is the buffer to store the result.
+ *
+ * @return	Status returned by XSecure_RsaPublicEncrypt.
+ *
+ *****************************************************************************/
+static s32 XFsbl_RsaPublicEncrypt(u8 *Input, u32 Size, u8 *Result)
+{
+	s32 Status;
+#ifdef XFSBL_PERF
+	XTime tCur = 0;
+
+	XTime_GetTime(&tCur);
+#endif
+
+	Status = XSecure_RsaPublicEncrypt(&SecureRsa, Input, Size, Result);
+
+#ifdef XFSBL_PERF
+	XFsbl_PerfStageAdd(XFSBL_PERF_STAGE_RSA, tCur);
+#endif
+
+	return Status;
+}
+
 #endif /* end of XFSBL_SECURE */
 #ifdef XFSBL_PL_LOAD_FROM_OCM
 #ifdef XFSBL_BS
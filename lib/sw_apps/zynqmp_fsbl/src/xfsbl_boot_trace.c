@@ -0,0 +1,134 @@
+/******************************************************************************
+* Copyright (c) 2021 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+*
+* @file xfsbl_boot_trace.c
+*
+* This is the file which contains the FSBL boot timestamp trace. Refer to
+* xfsbl_boot_trace.h for the layout of the trace.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  dc   10/28/21 Initial release
+*
+* </pre>
+*
+* @note
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xfsbl_hw.h"
+#include "xfsbl_boot_trace.h"
+#include "xil_cache.h"
+
+#ifdef XFSBL_BOOT_TRACE
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static u64 XFsbl_BootTraceGetCount(void);
+
+/************************** Variable Definitions *****************************/
+static XFsblPs_BootTrace * const BootTracePtr =
+		(XFsblPs_BootTrace *)(UINTPTR)XFSBL_BOOT_TRACE_ADDR;
+
+/*****************************************************************************/
+/**
+ * This function starts the system timestamp counter if it is not running yet
+ * and clears the FSBL log. It is called once at the start of the FSBL.
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_BootTraceInit(void)
+{
+	if ((XFsbl_In32(XFSBL_IOU_SCNTRS_CNT_CNTRL) &
+			XFSBL_IOU_SCNTRS_CNT_CNTRL_EN) == 0U) {
+#ifdef XPAR_CPU_CORTEXA53_0_TIMESTAMP_CLK_FREQ
+		XFsbl_Out32(XFSBL_IOU_SCNTRS_FREQ,
+				XPAR_CPU_CORTEXA53_0_TIMESTAMP_CLK_FREQ);
+#endif
+		XFsbl_Out32(XFSBL_IOU_SCNTRS_CNT_CNTRL,
+				XFSBL_IOU_SCNTRS_CNT_CNTRL_EN);
+	}
+
+	BootTracePtr->Magic = 0U;
+	BootTracePtr->Count = 0U;
+	BootTracePtr->Dropped = 0U;
+	BootTracePtr->Freq = XFsbl_In32(XFSBL_IOU_SCNTRS_FREQ);
+	BootTracePtr->Magic = XFSBL_BOOT_TRACE_MAGIC;
+
+	Xil_DCacheFlushRange((INTPTR)BootTracePtr, sizeof(XFsblPs_BootTrace));
+}
+
+/*****************************************************************************/
+/**
+ * This function records a boot milestone in the FSBL log.
+ *
+ * @param	Id is one of XFSBL_BOOT_TRACE_*
+ * @param	Arg is an 8 bit argument of the milestone
+ *
+ * @return	None
+ *
+ * @note	The log is flushed from the data cache on every event, so that
+ *		it is valid whenever the FSBL stops.
+ *
+ *****************************************************************************/
+void XFsbl_BootTraceEvent(u32 Id, u32 Arg)
+{
+	u64 Count = XFsbl_BootTraceGetCount();
+	u32 Index = BootTracePtr->Count;
+
+	if (Index >= XFSBL_BOOT_TRACE_MAX_EVENTS) {
+		BootTracePtr->Dropped += 1U;
+	}
+	else {
+		BootTracePtr->Event[Index][0U] = ((Id & 0xFFU) << 24U) |
+				((Arg & 0xFFU) << 16U) | ((u32)(Count >> 32U) & 0xFFFFU);
+		BootTracePtr->Event[Index][1U] = (u32)Count;
+		BootTracePtr->Count = Index + 1U;
+	}
+
+	/* The counter frequency may be programmed after the first events */
+	BootTracePtr->Freq = XFsbl_In32(XFSBL_IOU_SCNTRS_FREQ);
+
+	Xil_DCacheFlushRange((INTPTR)BootTracePtr, sizeof(XFsblPs_BootTrace));
+}
+
+/*****************************************************************************/
+/**
+ * This function reads the 64 bit system timestamp counter.
+ *
+ * @param	None
+ *
+ * @return	Counter value
+ *
+ *****************************************************************************/
+static u64 XFsbl_BootTraceGetCount(void)
+{
+	u32 Upper;
+	u32 Lower;
+
+	/* Read the upper word again if the lower word wrapped in between */
+	do {
+		Upper = XFsbl_In32(XFSBL_IOU_SCNTRS_CNT_UPPER);
+		Lower = XFsbl_In32(XFSBL_IOU_SCNTRS_CNT_LOWER);
+	} while (Upper != XFsbl_In32(XFSBL_IOU_SCNTRS_CNT_UPPER));
+
+	return ((u64)Upper << 32U) | Lower;
+}
+#endif
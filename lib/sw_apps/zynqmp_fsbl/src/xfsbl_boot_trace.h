@@ -0,0 +1,119 @@
+/******************************************************************************
+* Copyright (c) 2021 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+*
+* @file xfsbl_boot_trace.h
+*
+* This is the header file which contains definitions for the FSBL boot
+* timestamp trace.
+*
+* Boot milestones are recorded with the 64 bit IOU system timestamp counter
+* into a reserved region at the top of the OCM handoff area, so that they
+* survive the handoff and can be read from Linux or over JTAG. The region
+* holds one log for the FSBL and one for the PMU firmware, the PMU firmware
+* log is defined in xpfw_boot_trace.h with the same layout.
+*
+* Each event is two words:
+*   - Word 0: Id [31:24], Arg [23:16], counter bits [47:32]
+*   - Word 1: counter bits [31:0]
+*
+* misc/boot_trace.py decodes a dump of the region.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  dc   10/28/21 Initial release
+*
+* </pre>
+*
+* @note
+*
+******************************************************************************/
+#ifndef XFSBL_BOOT_TRACE_H
+#define XFSBL_BOOT_TRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+#include "xfsbl_hw.h"
+
+/************************** Constant Definitions *****************************/
+/**
+ * Reserved OCM region, the upper 256 bytes of the 512 byte region holding
+ * the ATF handoff parameters
+ */
+#define XFSBL_BOOT_TRACE_ADDR		(0xFFFE9F00U)
+#define XFSBL_BOOT_TRACE_SIZE		(0x100U)
+
+/**
+ * FSBL log, the PMU firmware log follows it up to the end of the region
+ */
+#define XFSBL_BOOT_TRACE_MAGIC		(0x31465442U) /**< "BTF1" */
+#define XFSBL_BOOT_TRACE_MAX_EVENTS	(18U)
+
+/**
+ * IOU system timestamp counter
+ */
+#define XFSBL_IOU_SCNTRS_BASEADDR		(0xFF260000U)
+#define XFSBL_IOU_SCNTRS_CNT_CNTRL		(XFSBL_IOU_SCNTRS_BASEADDR + 0x0U)
+#define XFSBL_IOU_SCNTRS_CNT_LOWER		(XFSBL_IOU_SCNTRS_BASEADDR + 0x8U)
+#define XFSBL_IOU_SCNTRS_CNT_UPPER		(XFSBL_IOU_SCNTRS_BASEADDR + 0xCU)
+#define XFSBL_IOU_SCNTRS_FREQ			(XFSBL_IOU_SCNTRS_BASEADDR + 0x20U)
+#define XFSBL_IOU_SCNTRS_CNT_CNTRL_EN	(0x1U)
+
+/**
+ * FSBL boot milestones, Arg is 0 unless noted
+ */
+#define XFSBL_BOOT_TRACE_START		(0x01U) /**< Entry to main */
+#define XFSBL_BOOT_TRACE_PSU_INIT	(0x02U) /**< psu_init and DDR init done */
+#define XFSBL_BOOT_TRACE_PROC_INIT	(0x03U) /**< Processor init done */
+#define XFSBL_BOOT_TRACE_ECC_INIT	(0x04U) /**< TCM and DDR ECC init done */
+#define XFSBL_BOOT_TRACE_INIT_DONE	(0x05U) /**< Stage 1 done */
+#define XFSBL_BOOT_TRACE_BOOT_DEV	(0x06U) /**< Boot device init and image
+						  header validation done */
+#define XFSBL_BOOT_TRACE_PARTITION	(0x07U) /**< Partition Arg loaded */
+#define XFSBL_BOOT_TRACE_PM_INIT	(0x08U) /**< PM configuration object
+						  loaded by the PMU firmware */
+#define XFSBL_BOOT_TRACE_EXIT		(0x09U) /**< Exit from FSBL */
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Layout of a boot trace log
+ */
+typedef struct {
+	u32 Magic; /**< XFSBL_BOOT_TRACE_MAGIC when valid */
+	u32 Count; /**< Number of recorded events */
+	u32 Freq; /**< Counter frequency in Hz, 0 if not programmed */
+	u32 Dropped; /**< Number of events dropped for lack of space */
+	u32 Event[XFSBL_BOOT_TRACE_MAX_EVENTS][2U]; /**< Recorded events */
+} XFsblPs_BootTrace;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+#ifdef XFSBL_BOOT_TRACE
+void XFsbl_BootTraceInit(void);
+void XFsbl_BootTraceEvent(u32 Id, u32 Arg);
+#else
+#define XFsbl_BootTraceInit()
+#define XFsbl_BootTraceEvent(Id, Arg)
+#endif
+
+/************************** Variable Definitions *****************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* XFSBL_BOOT_TRACE_H */
@@ -21,6 +21,8 @@
  *                     section
  * 3.0   bsv  05/03/21 Add provision to load bitstream from OCM with DDR
  *                     present in design
+ *       dc   10/27/21 Overlap boot device reads with PCAP transfers in
+ *                     chunked bitstream load
  *
  * </pre>
  *
@@ -32,6 +34,7 @@
 #include "xfsbl_hw.h"
 #ifdef XFSBL_BS
 #include "xfsbl_bs.h"
+#include "xfsbl_usb.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -167,8 +170,37 @@ u32 XFsbl_PcapWaitForDone(void) {
  *
  *****************************************************************************/
 u32 XFsbl_WriteToPcap(u32 WrSize, u8 *WrAddr) {
-	u32 RegVal;
 	u32 Status;
+#ifdef XFSBL_PERF
+	XTime tCur = 0;
+
+	XTime_GetTime(&tCur);
+#endif
+
+	XFsbl_StartPcapWrite(WrSize, WrAddr);
+	Status = XFsbl_WaitForPcapWrite();
+
+#ifdef XFSBL_PERF
+	XFsbl_PerfStageAdd(XFSBL_PERF_STAGE_PCAP, tCur);
+#endif
+
+	return Status;
+}
+
+/*****************************************************************************/
+/** This function starts a CSU DMA transfer to the PCAP interface and returns
+ * without waiting for it to complete.
+ *
+ * @param	WrSize: Number of 32bit words that the DMA should write to
+ *          the PCAP interface
+ * @param   WrAddr: Linear memory space from where CSUDMA will read
+ *	        the data to be written to PCAP interface
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_StartPcapWrite(u32 WrSize, u8 *WrAddr) {
+	u32 RegVal;
 
 	/*
 	 * Setup the  SSS, setup the PCAP to receive from DMA source
@@ -180,6 +212,19 @@ u32 XFsbl_WriteToPcap(u32 WrSize, u8 *WrAddr) {
 
 	/* Setup the source DMA channel */
 	XCsuDma_Transfer(&CsuDma, XCSUDMA_SRC_CHANNEL, (PTRSIZE) WrAddr, WrSize, 0);
+}
+
+/*****************************************************************************/
+/** This function waits for the transfer started by XFsbl_StartPcapWrite to
+ * complete.
+ *
+ * @param	None
+ *
+ * @return	error status based on implemented functionality (SUCCESS by default)
+ *
+ *****************************************************************************/
+u32 XFsbl_WaitForPcapWrite(void) {
+	u32 Status;
 
 	/* wait for the SRC_DMA to complete and the pcap to be IDLE */
 	XCsuDma_WaitForDone(&CsuDma, XCSUDMA_SRC_CHANNEL){}
@@ -189,11 +234,8 @@ u32 XFsbl_WriteToPcap(u32 WrSize, u8 *WrAddr) {
 
 	XFsbl_Printf(DEBUG_INFO, "DMA transfer done \r\n");
 	Status = XFsbl_PcapWaitForDone();
-	if (Status != XFSBL_SUCCESS) {
-		goto END;
-	}
 
-	END: return Status;
+	return Status;
 }
 
 /*****************************************************************************/
@@ -248,7 +290,13 @@ u32 XFsbl_PLWaitForDone(void) {
 /*****************************************************************************/
 /** This is the function to download nonsebitstream to PL using chunking.
  *
- * @param	None
+ * ReadBuffer is used as two halves. While CSU DMA writes one half to PCAP,
+ * the next chunk is read from the boot device into the other half. With USB
+ * boot the boot device copy itself uses CSU DMA, so the chunks are then
+ * transferred one after the other through the whole ReadBuffer.
+ *
+ * @param	FsblInstancePtr is pointer to the XFsbl Instance
+ * @param	PartitionNum is the partition number of the bitstream
  *
  * @return	error status based on implemented functionality(SUCCESS by default)
  *
@@ -258,13 +306,19 @@ u32 XFsbl_ChunkedBSTxfer(XFsblPs *FsblInstancePtr, u32 PartitionNum)
 {
 	u32 Status = XFSBL_SUCCESS;
 	XFsblPs_PartitionHeader *PartitionHeader;
-	u32 NumChunks = 0U;
 	u32 RemainingBytes = 0U;
-	u32 Index = 0U;
+	u32 ChunkSize = READ_BUFFER_SIZE / 2U;
+	u32 ChunkLen;
+	u32 BufOffset = 0U;
+	u32 IsOverlapped = TRUE;
+	u32 IsPcapBusy = FALSE;
+	u32 PcapStatus;
 	u32 BitStreamSizeWord = 0U;
-	u32 BitStreamSizeByte = 0U;
 	u32 ImageOffset = 0U;
 	u32 StartAddrByte = 0U;
+#ifdef XFSBL_PERF
+	XTime tCur = 0;
+#endif
 
 	XFsbl_Printf(DEBUG_GENERAL,
 		"Nonsecure Bitstream transfer in chunks to begin now\r\n");
@@ -284,48 +338,96 @@ u32 XFsbl_ChunkedBSTxfer(XFsblPs *FsblInstancePtr, u32 PartitionNum)
 			"Nonsecure Bitstream to be copied from %0x \r\n",
 			StartAddrByte);
 
-	/* Converting size in words to bytes */
-	BitStreamSizeByte = BitStreamSizeWord*4;
+#ifdef XFSBL_USB
+	if (FsblInstancePtr->DeviceOps.DeviceCopy == XFsbl_UsbCopy) {
+		IsOverlapped = FALSE;
+		ChunkSize = READ_BUFFER_SIZE;
+	}
+#endif
 
-	NumChunks = BitStreamSizeByte / READ_BUFFER_SIZE;
-	RemainingBytes = BitStreamSizeByte % READ_BUFFER_SIZE;
+	/* Converting size in words to bytes */
+	RemainingBytes = BitStreamSizeWord*4;
 
-	for(Index = 0; Index < NumChunks; Index++)
+	while (RemainingBytes != 0U)
 	{
-		Status = FsblInstancePtr->DeviceOps.DeviceCopy(StartAddrByte,
-				(PTRSIZE)ReadBuffer, READ_BUFFER_SIZE);
+		ChunkLen = (RemainingBytes > ChunkSize) ?
+				ChunkSize : RemainingBytes;
 
+#ifdef XFSBL_PERF
+		XTime_GetTime(&tCur);
+#endif
+		Status = FsblInstancePtr->DeviceOps.DeviceCopy(StartAddrByte,
+				(PTRSIZE)&ReadBuffer[BufOffset], ChunkLen);
+#ifdef XFSBL_PERF
+		XFsbl_PerfStageAdd(XFSBL_PERF_STAGE_READ, tCur);
+#endif
 		if (XFSBL_SUCCESS != Status)
 		{
 			XFsbl_Printf(DEBUG_GENERAL,
 				"Copy of chunk from flash to OCM failed \r\n");
-			goto END;
+			break;
 		}
 
-		Status = XFsbl_WriteToPcap((READ_BUFFER_SIZE/4), &ReadBuffer[0]);
-		if (XFSBL_SUCCESS != Status)
+		/* Let the previous chunk reach PCAP before queuing this one */
+		if (IsPcapBusy == TRUE)
 		{
-			goto END;
+			IsPcapBusy = FALSE;
+#ifdef XFSBL_PERF
+			XTime_GetTime(&tCur);
+#endif
+			Status = XFsbl_WaitForPcapWrite();
+#ifdef XFSBL_PERF
+			XFsbl_PerfStageAdd(XFSBL_PERF_STAGE_PCAP, tCur);
+#endif
+			if (XFSBL_SUCCESS != Status)
+			{
+				break;
+			}
 		}
 
-		StartAddrByte += READ_BUFFER_SIZE;
+		XFsbl_StartPcapWrite((ChunkLen/4), &ReadBuffer[BufOffset]);
+		IsPcapBusy = TRUE;
+
+		if (IsOverlapped == FALSE)
+		{
+			IsPcapBusy = FALSE;
+#ifdef XFSBL_PERF
+			XTime_GetTime(&tCur);
+#endif
+			Status = XFsbl_WaitForPcapWrite();
+#ifdef XFSBL_PERF
+			XFsbl_PerfStageAdd(XFSBL_PERF_STAGE_PCAP, tCur);
+#endif
+			if (XFSBL_SUCCESS != Status)
+			{
+				break;
+			}
+		}
+		else
+		{
+			BufOffset = (BufOffset == 0U) ? ChunkSize : 0U;
+		}
+
+		StartAddrByte += ChunkLen;
+		RemainingBytes -= ChunkLen;
 	}
 
-	if(RemainingBytes != 0U)
+	/* Never leave CSU DMA running on an error, keep the first error */
+	if (IsPcapBusy == TRUE)
 	{
-		Status = FsblInstancePtr->DeviceOps.DeviceCopy(StartAddrByte,
-					(PTRSIZE)ReadBuffer, RemainingBytes);
-		if (XFSBL_SUCCESS != Status)
+#ifdef XFSBL_PERF
+		XTime_GetTime(&tCur);
+#endif
+		PcapStatus = XFsbl_WaitForPcapWrite();
+#ifdef XFSBL_PERF
+		XFsbl_PerfStageAdd(XFSBL_PERF_STAGE_PCAP, tCur);
+#endif
+		if (XFSBL_SUCCESS == Status)
 		{
-			XFsbl_Printf(DEBUG_GENERAL,
-				"Copy of chunk from flash to OCM failed \r\n");
-			goto END;
+			Status = PcapStatus;
 		}
-
-		Status = XFsbl_WriteToPcap((RemainingBytes/4), &ReadBuffer[0]);
 	}
 
-END:
 	return Status;
 }
 #endif
@@ -30,6 +30,7 @@
 *       bsv  05/15/21 Support to ensure authenticated images boot as
 *                     non-secure when RSA_EN is not programmed is disabled by
 *                     default
+*       dc   10/28/21 Added FSBL_BOOT_TRACE_EXCLUDE_VAL configuration
 *
 *</pre>
 *
@@ -138,6 +139,7 @@ extern "C" {
  *     - FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE_VAL Code to "load authenticated
  *       partitions as non secure when EFUSEs are not programmed and when boot
  *       header is not authenticated" is excluded
+ *     - FSBL_BOOT_TRACE_EXCLUDE_VAL Boot timestamp trace in OCM is excluded
  */
 #ifndef FSBL_NAND_EXCLUDE_VAL
 #define FSBL_NAND_EXCLUDE_VAL			(0U)
@@ -211,6 +213,10 @@ extern "C" {
 #define FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE_VAL	(1U)
 #endif
 
+#ifndef FSBL_BOOT_TRACE_EXCLUDE_VAL
+#define FSBL_BOOT_TRACE_EXCLUDE_VAL	(1U)
+#endif
+
 #if (FSBL_NAND_EXCLUDE_VAL) && (!defined(FSBL_NAND_EXCLUDE))
 #define FSBL_NAND_EXCLUDE
 #endif
@@ -286,6 +292,11 @@ extern "C" {
 #define FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE
 #endif
 
+#if (FSBL_BOOT_TRACE_EXCLUDE_VAL == 1U) && \
+	(!defined(FSBL_BOOT_TRACE_EXCLUDE))
+#define FSBL_BOOT_TRACE_EXCLUDE
+#endif
+
 /************************** Function Prototypes ******************************/
 
 /************************** Variable Definitions *****************************/
@@ -27,6 +27,8 @@
  * 3.0   ma   09/09/19 Update FSBL proc info reporting to PMU
  * 4.0   bsv  03/05/19 Restore value of SD_CDN_CTRL register before
  *                     handoff in FSBL
+ *       dc   10/28/21 Record PM init and FSBL exit in the boot timestamp
+ *                     trace
  *
  * </pre>
  *
@@ -41,6 +43,7 @@
 #include "xfsbl_main.h"
 #include "xfsbl_image_header.h"
 #include "xfsbl_bs.h"
+#include "xfsbl_boot_trace.h"
 
 /************************** Constant Definitions *****************************/
 #define XFSBL_CPU_POWER_UP		(0x1U)
@@ -551,6 +554,7 @@ void XFsbl_HandoffExit(u64 HandoffAddress, u32 Flags)
 	XFsbl_Out32(PMU_GLOBAL_GLOB_GEN_STORAGE5, RegVal);
 
 	XFsbl_Printf(DEBUG_GENERAL,"Exit from FSBL \n\r");
+	XFsbl_BootTraceEvent(XFSBL_BOOT_TRACE_EXIT, 0U);
 
 	/**
 	 * Exit to handoff address
@@ -747,6 +751,7 @@ u32 XFsbl_Handoff (const XFsblPs * FsblInstancePtr, u32 PartitionNum, u32 EarlyH
 		XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_PM_INIT\r\n");
 		goto END;
 	}
+	XFsbl_BootTraceEvent(XFSBL_BOOT_TRACE_PM_INIT, 0U);
 
 
 	Status = XFsbl_ProtectionConfig();
@@ -27,6 +27,7 @@
 * 5.0   bsv  04/01/21 Added TPM support
 *       bsv  05/03/21 Add provision to load bitstream from OCM with DDR
 *                     present in design
+*       dc   10/28/21 Added XFSBL_BOOT_TRACE definition
 *
 * </pre>
 *
@@ -883,6 +884,11 @@ extern "C" {
 #define XFSBL_PERF
 #endif
 
+/* Definition for boot timestamp trace to be included */
+#if !defined(FSBL_BOOT_TRACE_EXCLUDE)
+#define XFSBL_BOOT_TRACE
+#endif
+
 /* Definition for TCM ECC Enable for A53 to be included */
 #if !defined(FSBL_A53_TCM_ECC_EXCLUDE)
 #define XFSBL_A53_TCM_ECC
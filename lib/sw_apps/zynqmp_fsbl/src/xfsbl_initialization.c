@@ -52,6 +52,8 @@
 *                     avoid speculative accesses
 *       bsv  07/07/21 Assign correct values to SecondaryBootDevice in Fsbl
 *                     instance pointer
+*       dc   10/28/21 Record initialization milestones in the boot timestamp
+*                     trace
 *
 * </pre>
 *
@@ -73,6 +75,7 @@
 #include "xfsbl_usb.h"
 #include "xfsbl_authentication.h"
 #include "xfsbl_ddr_init.h"
+#include "xfsbl_boot_trace.h"
 #include "xfsbl_tpm.h"
 
 /************************** Constant Definitions *****************************/
@@ -306,6 +309,7 @@ u32 XFsbl_Initialize(XFsblPs * FsblInstancePtr)
 		if (XFSBL_SUCCESS != Status) {
 			goto END;
 		}
+		XFsbl_BootTraceEvent(XFSBL_BOOT_TRACE_PSU_INIT, 0U);
 	}
 
 	/**
@@ -325,6 +329,7 @@ u32 XFsbl_Initialize(XFsblPs * FsblInstancePtr)
 	if (XFSBL_SUCCESS != Status) {
 		goto END;
 	}
+	XFsbl_BootTraceEvent(XFSBL_BOOT_TRACE_PROC_INIT, 0U);
 
 	if (XFSBL_MASTER_ONLY_RESET == FsblInstancePtr->ResetReason) {
 
@@ -373,6 +378,7 @@ u32 XFsbl_Initialize(XFsblPs * FsblInstancePtr)
 	}
 	XFsbl_MarkDdrAsReserved(FALSE);
 #endif
+	XFsbl_BootTraceEvent(XFSBL_BOOT_TRACE_ECC_INIT, 0U);
 
 #if defined(XFSBL_PL_CLEAR) && defined(XFSBL_BS)
 		/* In case of PS only reset and APU only reset skipping PCAP initialization*/
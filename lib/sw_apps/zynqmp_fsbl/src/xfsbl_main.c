@@ -23,6 +23,9 @@
 * 3.0   bv   03/03/21 Print multiboot offset in FSBL banner
 *       bsv  04/28/21 Added support to ensure authenticated images boot as
 *                     non-secure when RSA_EN is not programmed
+*       dc   10/27/21 Print per stage boot time when all partitions are
+*                     loaded
+*       dc   10/28/21 Record boot milestones in the boot timestamp trace
 *
 * </pre>
 *
@@ -33,6 +36,7 @@
 /***************************** Include Files *********************************/
 #include "xfsbl_hw.h"
 #include "xfsbl_main.h"
+#include "xfsbl_boot_trace.h"
 #include "bspconfig.h"
 
 /************************** Constant Definitions *****************************/
@@ -45,6 +49,9 @@
 static void XFsbl_UpdateMultiBoot(u32 MultiBootValue);
 static void XFsbl_FallBack(void);
 static void XFsbl_MarkUsedRPUCores(XFsblPs *FsblInstPtr, u32 PartitionNum);
+#ifdef XFSBL_PERF
+static void XFsbl_PrintPerfTime(XTime tDiff);
+#endif
 
 /************************** Variable Definitions *****************************/
 XFsblPs FsblInstance = {0x3U, XFSBL_SUCCESS, 0U, 0U, 0U, 0U};
@@ -82,6 +89,9 @@ int main(void )
 #error "FSBL should be generated using only EL3 BSP"
 #endif
 
+	XFsbl_BootTraceInit();
+	XFsbl_BootTraceEvent(XFSBL_BOOT_TRACE_START, 0U);
+
 	/**
 	 * Initialize globals.
 	 */
@@ -109,6 +119,7 @@ int main(void )
 					 * Initialize the global timer and get the value
 					 */
 
+					XFsbl_BootTraceEvent(XFSBL_BOOT_TRACE_INIT_DONE, 0U);
 					FsblStage = XFSBL_STAGE2;
 				}
 			}break;
@@ -157,6 +168,7 @@ int main(void )
 					FsblStage = XFSBL_STAGE4;
 				} else {
 					XFsbl_Printf(DEBUG_INFO,"Initialization Success \n\r");
+					XFsbl_BootTraceEvent(XFSBL_BOOT_TRACE_BOOT_DEV, 0U);
 
 					/**
 					 * Start the partition loading from 1
@@ -205,6 +217,8 @@ int main(void )
 				} else {
 					XFsbl_Printf(DEBUG_INFO,"Partition %d Load Success \n\r",
 									PartitionNum);
+					XFsbl_BootTraceEvent(XFSBL_BOOT_TRACE_PARTITION,
+							PartitionNum);
 
 					XFsbl_MarkUsedRPUCores(&FsblInstance,
 							       PartitionNum);
@@ -238,6 +252,7 @@ int main(void )
 						XFsbl_MeasurePerfTime(FsblInstance.PerfTime.tFsblStart);
 						XFsbl_Printf(DEBUG_PRINT_ALWAYS, ": Total Time \n\r");
 						XFsbl_Printf(DEBUG_PRINT_ALWAYS, "Note: Total execution time includes print times \n\r");
+						XFsbl_PrintPerfStages();
 #endif
 						FsblStage = XFSBL_STAGE4;
 						EarlyHandoff = FsblStatus;
@@ -565,14 +580,72 @@ static void XFsbl_UpdateMultiBoot(u32 MultiBootValue)
 void XFsbl_MeasurePerfTime(XTime tCur)
 {
 	XTime tEnd = 0;
-	XTime tDiff = 0;
+
+	XTime_GetTime(&tEnd);
+	XFsbl_PrintPerfTime(tEnd - tCur);
+}
+
+/*****************************************************************************/
+/**
+ * This function adds the time elapsed since tCur to a boot stage.
+ *
+ * @param Stage is one of XFSBL_PERF_STAGE_*
+ * @param tCur is the start time of the stage
+ *
+ * @return none
+ *
+ * @note none
+ *****************************************************************************/
+void XFsbl_PerfStageAdd(u32 Stage, XTime tCur)
+{
+	XTime tEnd = 0;
+
+	XTime_GetTime(&tEnd);
+	if (Stage < XFSBL_PERF_STAGE_MAX) {
+		FsblInstance.PerfTime.tStage[Stage] += tEnd - tCur;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * This function prints the time accumulated in each boot stage.
+ *
+ * @param none
+ *
+ * @return none
+ *
+ * @note none
+ *****************************************************************************/
+void XFsbl_PrintPerfStages(void)
+{
+	static const char *StageName[XFSBL_PERF_STAGE_MAX] = {
+		"Read", "Hash", "RSA", "Decrypt", "PCAP"
+	};
+	u32 Stage;
+
+	for (Stage = 0U; Stage < XFSBL_PERF_STAGE_MAX; Stage++) {
+		XFsbl_PrintPerfTime(FsblInstance.PerfTime.tStage[Stage]);
+		XFsbl_Printf(DEBUG_PRINT_ALWAYS, ": %s Time \n\r",
+				StageName[Stage]);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * This function prints a timer difference in milliseconds.
+ *
+ * @param tDiff is the timer difference
+ *
+ * @return none
+ *
+ * @note none
+ *****************************************************************************/
+static void XFsbl_PrintPerfTime(XTime tDiff)
+{
 	u64 tPerfNs;
 	u64 tPerfMs = 0;
 	u64 tPerfMsFrac = 0;
 
-	XTime_GetTime(&tEnd);
-	tDiff = tEnd - tCur;
-
 	/* Convert tPerf into nanoseconds */
 	tPerfNs = ((double)tDiff / (double)COUNTS_PER_SECOND) * 1e9;
 
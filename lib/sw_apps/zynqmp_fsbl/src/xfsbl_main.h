@@ -21,6 +21,7 @@
 *                     Made compliance to MISRAC 2012 guidelines
 * 3.00  bsv  04/28/21 Added support to ensure authenticated images boot as
 *                     non-secure when RSA_EN is not programmed
+*       dc   10/27/21 Added per stage boot time accumulation
 *
 * </pre>
 *
@@ -54,11 +55,23 @@ typedef struct {
 } XFsblPs_HandoffValues;
 
 #if defined XFSBL_PERF
+/**
+ * Boot stages whose time is accumulated over all partitions
+ */
+#define XFSBL_PERF_STAGE_READ		(0U) /**< Boot device reads */
+#define XFSBL_PERF_STAGE_HASH		(1U) /**< SHA3 calculation */
+#define XFSBL_PERF_STAGE_RSA		(2U) /**< RSA signature verification */
+#define XFSBL_PERF_STAGE_DECRYPT	(3U) /**< AES decryption */
+#define XFSBL_PERF_STAGE_PCAP		(4U) /**< PCAP transfers not hidden
+						  behind boot device reads */
+#define XFSBL_PERF_STAGE_MAX		(5U)
+
 /**
  * This stores the timer values for measuring FSBL execution time.
  */
 typedef struct {
 	XTime  tFsblStart;
+	XTime  tStage[XFSBL_PERF_STAGE_MAX]; /**< Time spent in each stage */
 } XFsblPs_Perf;
 #endif /* XFSBL_PERF */
 
@@ -179,6 +192,8 @@ void XFsbl_ErrorLockDown(u32 ErrorStatus);
 
 #if defined(XFSBL_PERF)
 void XFsbl_MeasurePerfTime(XTime tCur);
+void XFsbl_PerfStageAdd(u32 Stage, XTime tCur);
+void XFsbl_PrintPerfStages(void);
 #endif
 
 /**
@@ -50,6 +50,9 @@
 *       bsv  05/15/21 Support to ensure authenticated images boot as
 *                     non-secure when RSA_EN is not programmed and boot header
 *                     is not authenticated is disabled by default
+*       dc   10/27/21 Account partition copy and decryption time to the boot
+*                     time report
+*       dc   10/31/21 Exclude the bitstream hash time from the decryption time
 *
 * </pre>
 *
@@ -90,6 +93,11 @@
 #define XFSBL_EL2_VAL		(4U)
 #define XFSBL_EL3_VAL		(6U)
 #endif
+#if defined(XFSBL_PERF) && defined(XFSBL_TPM) && defined(XFSBL_BS) && \
+	defined(XFSBL_SECURE) && !defined(XFSBL_PL_LOAD_FROM_OCM)
+/* The bitstream is measured by a hash callback of the decryption */
+#define XFSBL_PERF_DEC_HASH
+#endif
 
 /************************** Function Prototypes ******************************/
 static u32 XFsbl_PartitionHeaderValidation(XFsblPs * FsblInstancePtr,
@@ -124,6 +132,9 @@ static void XFsbl_SetR5ExcepVectorLoVec(void);
 #ifdef XFSBL_TPM
 static u8 XFsbl_GetPcrIndex(const XFsblPs * FsblInstancePtr, u32 PartitionNum);
 #endif
+#ifdef XFSBL_PERF_DEC_HASH
+static void XFsbl_DecShaUpdate(void * Ctx, u8 * Data, u32 Size, u32 HashLen);
+#endif
 
 /************************** Variable Definitions *****************************/
 #ifdef ARMR5
@@ -150,6 +161,11 @@ u8 HashsOfChunks[HASH_BUFFER_SIZE] __attribute__((section (".bitstream_buffer"))
 #if defined(XFSBL_BS)
 extern u8 ReadBuffer[READ_BUFFER_SIZE];
 #endif
+
+#ifdef XFSBL_PERF_DEC_HASH
+/* Time spent in the hash callback of the ongoing bitstream decryption */
+static XTime tDecHash;
+#endif
 /*****************************************************************************/
 /**
  * This function loads the partition
@@ -1112,6 +1128,7 @@ static u32 XFsbl_PartitionCopy(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 					LoadAddress, Length);
 
 #ifdef XFSBL_PERF
+	XFsbl_PerfStageAdd(XFSBL_PERF_STAGE_READ, tCur);
 	XFsbl_MeasurePerfTime(tCur);
 	XFsbl_Printf(DEBUG_PRINT_ALWAYS, ": P%u Copy time, Size: %0u \r\n",
 				PartitionNum, Length);
@@ -1486,6 +1503,7 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 			}
 
 #ifdef XFSBL_PERF
+			XFsbl_PerfStageAdd(XFSBL_PERF_STAGE_DECRYPT, tCur);
 			XFsbl_MeasurePerfTime(tCur);
 			XFsbl_Printf(DEBUG_PRINT_ALWAYS, ": P%d Dec. Time \r\n",
 							PartitionNum);
@@ -1536,7 +1554,12 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 			SecureAes.IsPlDecryptToMemEnabled =
 				XSECURE_PL_DEC_TO_MEM_ENABLED;
 			XFsbl_ShaStart(NULL, XFSBL_HASH_TYPE_SHA3);
+#ifdef XFSBL_PERF
+			tDecHash = 0U;
+			SecureAes.ShaUpdate = XFsbl_DecShaUpdate;
+#else
 			SecureAes.ShaUpdate = XFsbl_ShaUpdate;
+#endif
 #endif
 			Status = (u32)XSecure_AesDecrypt(&SecureAes,
 				(u8 *)XFSBL_DESTINATION_PCAP_ADDR, (u8 *)LoadAddress,
@@ -1566,6 +1589,12 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 #endif
 
 #ifdef XFSBL_PERF
+#ifdef XFSBL_PERF_DEC_HASH
+			/* The hash is accounted to its own stage, leave it out */
+			tCur += tDecHash;
+#endif
+			/* Decryption streams to PCAP, both are accounted here */
+			XFsbl_PerfStageAdd(XFSBL_PERF_STAGE_DECRYPT, tCur);
 			XFsbl_MeasurePerfTime(tCur);
 			XFsbl_Printf(DEBUG_PRINT_ALWAYS, ": P%d (sec. bitstream)"
 						" Dec. + Pcap Load Time \r\n", PartitionNum);
@@ -2109,3 +2138,30 @@ static u8 XFsbl_GetPcrIndex(const XFsblPs * FsblInstancePtr, u32 PartitionNum)
 	return PcrIndex;
 }
 #endif
+
+#ifdef XFSBL_PERF_DEC_HASH
+/*****************************************************************************/
+/**
+ * This function is the hash callback of the bitstream decryption. It updates
+ * the hash and accumulates its time, so that the decryption time can exclude
+ * it.
+ *
+ * @param	Ctx is the hash context
+ * @param	Data is the decrypted chunk to hash
+ * @param	Size is the size of the chunk
+ * @param	HashLen is the hash type
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_DecShaUpdate(void * Ctx, u8 * Data, u32 Size, u32 HashLen)
+{
+	XTime tStart = 0U;
+	XTime tEnd = 0U;
+
+	XTime_GetTime(&tStart);
+	XFsbl_ShaUpdate(Ctx, Data, Size, HashLen);
+	XTime_GetTime(&tEnd);
+	tDecHash += tEnd - tStart;
+}
+#endif
@@ -23,6 +23,7 @@
  * 4.0   har  06/17/20  Removed references to unused algorithms
  * 5.0   bsv  03/11/21  Fixed build issues
  *       kpt  03/16/21  Updated function headers with appropriate description
+ *       dc   10/27/21  Account SHA3 time to the boot time report
  *
  * </pre>
  *
@@ -59,12 +60,21 @@ static XSecure_Sha3 SecureSha3;
  ******************************************************************************/
 void XFsbl_ShaDigest(const u8 *In, const u32 Size, u8 *Out, u32 HashLen)
 {
+#ifdef XFSBL_PERF
+	XTime tCur = 0;
+
+	XTime_GetTime(&tCur);
+#endif
 
 	if(XFSBL_HASH_TYPE_SHA3 == HashLen)
 	{
 		(void)XSecure_Sha3Initialize(&SecureSha3, &CsuDma);
 		XSecure_Sha3Digest(&SecureSha3, In, Size, Out);
 	}
+
+#ifdef XFSBL_PERF
+	XFsbl_PerfStageAdd(XFSBL_PERF_STAGE_HASH, tCur);
+#endif
 }
 
 /*****************************************************************************
@@ -82,11 +92,20 @@ void XFsbl_ShaDigest(const u8 *In, const u32 Size, u8 *Out, u32 HashLen)
  ******************************************************************************/
 void XFsbl_ShaFinish(void * Ctx, u8 * Hash, u32 HashLen)
 {
+#ifdef XFSBL_PERF
+	XTime tCur = 0;
+
+	XTime_GetTime(&tCur);
+#endif
 
 	if(XFSBL_HASH_TYPE_SHA3 == HashLen)
 	{
 		XSecure_Sha3Finish(&SecureSha3, Hash);
 	}
+
+#ifdef XFSBL_PERF
+	XFsbl_PerfStageAdd(XFSBL_PERF_STAGE_HASH, tCur);
+#endif
 }
 /*****************************************************************************
  * This function starts the SHA3 engine.
@@ -125,10 +144,20 @@ void XFsbl_ShaStart(void * Ctx, u32 HashLen)
  ******************************************************************************/
 void XFsbl_ShaUpdate(void * Ctx, u8 * Data, u32 Size, u32 HashLen)
 {
+#ifdef XFSBL_PERF
+	XTime tCur = 0;
+
+	XTime_GetTime(&tCur);
+#endif
+
 	if(XFSBL_HASH_TYPE_SHA3 == HashLen)
 	{
 		XSecure_Sha3Update(&SecureSha3, Data, Size);
 	}
+
+#ifdef XFSBL_PERF
+	XFsbl_PerfStageAdd(XFSBL_PERF_STAGE_HASH, tCur);
+#endif
 }
 
 #ifdef XFSBL_SECURE
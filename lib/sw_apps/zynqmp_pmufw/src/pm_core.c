@@ -34,6 +34,7 @@
 #endif
 #include "xpfw_platform.h"
 #include "xpfw_resets.h"
+#include "xpfw_boot_trace.h"
 #include "rpu.h"
 #ifdef ENABLE_SECURE
 #include "xsecure.h"
@@ -1377,6 +1378,8 @@ static void PmSetConfiguration(const PmMaster *const master, const u32 address)
 	}
 
 	status = PmConfigLoadObject(configAddr, callerIpiMask);
+	XPfw_BootTraceEvent(XPFW_BOOT_TRACE_PM_CFG,
+			    (XST_SUCCESS == status) ? 0U : 1U);
 	/*
 	 * Respond using the saved IPI mask of the caller (master's IPI mask
 	 * may change after setting the configuration)
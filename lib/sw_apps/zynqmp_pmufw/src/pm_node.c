@@ -24,27 +24,56 @@ static PmNodeClass* pmNodeClasses[] = {
 	&pmNodeClassPll_g,
 };
 
+/*
+ * Nodes indexed by node ID, so that the lookup on every PM API call does not
+ * have to walk through the buckets of all node classes. The table is built
+ * from the buckets on first use.
+ */
+static PmNode* pmNodeTable[NODE_MAX + 1U];
+static bool pmNodeTableBuilt;
+
 /**
- * PmGetNodeById() - Find node that matches a given node ID
- * @nodeId      ID of the node to find
+ * PmNodeTableBuild() - Fill in the table of nodes indexed by node ID
  *
- * @returns     Pointer to PmNode structure (or NULL if not found)
+ * @note	Buckets are processed in the same order as they used to be
+ *		searched, so if a node ID is used twice the first node wins.
  */
-PmNode* PmGetNodeById(const u32 nodeId)
+static void PmNodeTableBuild(void)
 {
 	u32 i, n;
-	PmNode* node = NULL;
 
 	for (i = 0U; i < ARRAY_SIZE(pmNodeClasses); i++) {
 		for (n = 0U; n < pmNodeClasses[i]->bucketSize; n++) {
-			if (nodeId == pmNodeClasses[i]->bucket[n]->nodeId) {
-				node = pmNodeClasses[i]->bucket[n];
-				goto done;
+			PmNode* node = pmNodeClasses[i]->bucket[n];
+
+			if ((node->nodeId <= NODE_MAX) &&
+			    (NULL == pmNodeTable[node->nodeId])) {
+				pmNodeTable[node->nodeId] = node;
 			}
 		}
 	}
 
-done:
+	pmNodeTableBuilt = true;
+}
+
+/**
+ * PmGetNodeById() - Find node that matches a given node ID
+ * @nodeId      ID of the node to find
+ *
+ * @returns     Pointer to PmNode structure (or NULL if not found)
+ */
+PmNode* PmGetNodeById(const u32 nodeId)
+{
+	PmNode* node = NULL;
+
+	if (false == pmNodeTableBuilt) {
+		PmNodeTableBuild();
+	}
+
+	if (nodeId <= NODE_MAX) {
+		node = pmNodeTable[nodeId];
+	}
+
 	return node;
 }
 
@@ -99,49 +128,6 @@ done:
 	return status;
 }
 
-/**
- * PmNodeGetClassById() - Get node class by class ID
- * @id		ID of the class to get
- *
- * @return	Pointer to class if found, NULL otherwise.
- */
-static PmNodeClass* PmNodeGetClassById(const u8 id)
-{
-	u32 i;
-	PmNodeClass* class = NULL;
-
-	for (i = 0U; i < ARRAY_SIZE(pmNodeClasses); i++) {
-		if (id == pmNodeClasses[i]->id) {
-			class = pmNodeClasses[i];
-			break;
-		}
-	}
-
-	return class;
-}
-
-/**
- * PmNodeGetFromClass() - Get node with given ID from class
- * @class	Node class to search through
- * @nid		ID of the node to get
- *
- * @return	Pointer to node if found, NULL otherwise.
- */
-static PmNode* PmNodeGetFromClass(const PmNodeClass* const class, const u8 nid)
-{
-	u32 i;
-	PmNode* node = NULL;
-
-	for (i = 0U; i < class->bucketSize; i++) {
-		if (nid == class->bucket[i]->nodeId) {
-			node = class->bucket[i];
-			break;
-		}
-	}
-
-	return node;
-}
-
 /**
  * PmNodeGetDerived() - Get pointer to the derived structure of the node
  * @nodeClass	Node class
@@ -152,14 +138,9 @@ static PmNode* PmNodeGetFromClass(const PmNodeClass* const class, const u8 nid)
 void* PmNodeGetDerived(const u8 nodeClass, const u32 nodeId)
 {
 	void* ptr = NULL;
-	PmNode* node = NULL;
-	PmNodeClass* class = PmNodeGetClassById(nodeClass);
-
-	if (NULL != class) {
-		node = PmNodeGetFromClass(class, (u8)nodeId);
-	}
+	PmNode* node = PmGetNodeById((u8)nodeId);
 
-	if (NULL != node) {
+	if ((NULL != node) && (nodeClass == node->class->id)) {
 		ptr = node->derived;
 	}
 
@@ -195,6 +176,7 @@ void PmNodeConstruct(void)
 	u32 i, n;
 
 	PmClockConstructList();
+	PmNodeTableBuild();
 
 	for (i = 0U; i < ARRAY_SIZE(pmNodeClasses); i++) {
 		for (n = 0U; n < pmNodeClasses[i]->bucketSize; n++) {
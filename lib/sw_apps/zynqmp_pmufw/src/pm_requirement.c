@@ -26,6 +26,87 @@ static PmRequirement pmReqData[PM_REQUIREMENT_MAX];
 /* Top of the heap = index of the first free entry in pmReqData array (heap) */
 static u32 pmReqTop;
 
+/*
+ * Requirement map: for every slave node ID and every owner of requirements
+ * (one of the masters or the system) holds the index + 1 of the requirement
+ * in pmReqData array, 0 if there is no such requirement. The map is filled in
+ * as requirements are added while the configuration object is loaded, so
+ * that PM API calls do not have to walk through the requirements lists.
+ */
+#define PM_REQ_OWNER_APU	0U
+#define PM_REQ_OWNER_RPU	1U
+#define PM_REQ_OWNER_RPU_0	2U
+#define PM_REQ_OWNER_RPU_1	3U
+#define PM_REQ_OWNER_SYSTEM	4U
+#define PM_REQ_OWNER_MAX	5U
+
+static u8 pmReqMap[NODE_MAX + 1U][PM_REQ_OWNER_MAX];
+
+/**
+ * PmRequirementGetOwner() - Get index of the requirement owner in the map
+ * @master	Master that owns the requirement, NULL for system requirement
+ *
+ * @return	Index of the owner or PM_REQ_OWNER_MAX if the master is unknown
+ */
+static u32 PmRequirementGetOwner(const PmMaster* const master)
+{
+	u32 owner;
+
+	if (NULL == master) {
+		owner = PM_REQ_OWNER_SYSTEM;
+		goto done;
+	}
+
+	switch (master->nid) {
+	case NODE_APU:
+		owner = PM_REQ_OWNER_APU;
+		break;
+	case NODE_RPU:
+		owner = PM_REQ_OWNER_RPU;
+		break;
+	case NODE_RPU_0:
+		owner = PM_REQ_OWNER_RPU_0;
+		break;
+	case NODE_RPU_1:
+		owner = PM_REQ_OWNER_RPU_1;
+		break;
+	default:
+		owner = PM_REQ_OWNER_MAX;
+		break;
+	}
+
+done:
+	return owner;
+}
+
+/**
+ * PmRequirementMapGet() - Look up the requirement map
+ * @master	Master that owns the requirement, NULL for system requirement
+ * @slave	Slave in question
+ * @req		Pointer to the location where the requirement is stored (NULL
+ *		if the master/slave pair has no requirement)
+ *
+ * @return	True if the pair is covered by the map, false if the caller has
+ *		to search through the requirements list
+ */
+static bool PmRequirementMapGet(const PmMaster* const master,
+				const PmSlave* const slave,
+				PmRequirement** const req)
+{
+	bool found = false;
+	u32 owner = PmRequirementGetOwner(master);
+	u32 nodeId = slave->node.nodeId;
+
+	if ((owner < PM_REQ_OWNER_MAX) && (nodeId <= NODE_MAX)) {
+		u32 idx = pmReqMap[nodeId][owner];
+
+		*req = (0U != idx) ? &pmReqData[idx - 1U] : NULL;
+		found = true;
+	}
+
+	return found;
+}
+
 /**
  * PmRequirementLink() - Link requirement struct into master's and slave's lists
  * @req	Pointer to the requirement structure to be linked in lists
@@ -73,6 +154,8 @@ void PmRequirementFreeAll(void)
 
 	/* Reset top of the heap */
 	pmReqTop = 0U;
+
+	(void)memset(pmReqMap, (s32)0U, sizeof(pmReqMap));
 }
 
 /**
@@ -86,6 +169,7 @@ void PmRequirementFreeAll(void)
 PmRequirement* PmRequirementAdd(PmMaster* const master, PmSlave* const slave)
 {
 	PmRequirement* req = PmRequirementMalloc();
+	u32 owner;
 
 	if (NULL == req) {
 		goto done;
@@ -95,6 +179,12 @@ PmRequirement* PmRequirementAdd(PmMaster* const master, PmSlave* const slave)
 	req->slave = slave;
 	PmRequirementLink(req);
 
+	/* The latest requirement is the head of the lists, map it as well */
+	owner = PmRequirementGetOwner(master);
+	if ((owner < PM_REQ_OWNER_MAX) && (slave->node.nodeId <= NODE_MAX)) {
+		pmReqMap[slave->node.nodeId][owner] = (u8)pmReqTop;
+	}
+
 done:
 	return req;
 }
@@ -374,8 +464,13 @@ void PmRequirementClear(PmRequirement* const req)
 PmRequirement* PmRequirementGet(const PmMaster* const master,
 				const PmSlave* const slave)
 {
-	PmRequirement* req = master->reqs;
+	PmRequirement* req;
+
+	if (true == PmRequirementMapGet(master, slave, &req)) {
+		goto done;
+	}
 
+	req = master->reqs;
 	while (NULL != req) {
 		if (slave == req->slave) {
 			break;
@@ -383,6 +478,7 @@ PmRequirement* PmRequirementGet(const PmMaster* const master,
 		req = req->nextSlave;
 	}
 
+done:
 	return req;
 }
 
@@ -394,8 +490,13 @@ PmRequirement* PmRequirementGet(const PmMaster* const master,
  */
 PmRequirement* PmRequirementGetNoMaster(const PmSlave* const slave)
 {
-	PmRequirement* req = slave->reqs;
+	PmRequirement* req;
 
+	if (true == PmRequirementMapGet(NULL, slave, &req)) {
+		goto done;
+	}
+
+	req = slave->reqs;
 	while (NULL != req) {
 		if (NULL == req->master) {
 			break;
@@ -403,6 +504,7 @@ PmRequirement* PmRequirementGetNoMaster(const PmSlave* const slave)
 		req = req->nextMaster;
 	}
 
+done:
 	return req;
 }
 
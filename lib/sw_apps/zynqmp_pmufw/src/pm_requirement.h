@@ -33,7 +33,8 @@ typedef enum {
 /*
  * Max number of master/slave pairs (max number of combinations that can
  * exist at the runtime). The value is used to statically initialize
- * size of the pmReqData array, which is used as the heap.
+ * size of the pmReqData array, which is used as the heap. Must not exceed
+ * 255 because requirements are mapped by 8-bit indices.
  */
 #define PM_REQUIREMENT_MAX	200U
 
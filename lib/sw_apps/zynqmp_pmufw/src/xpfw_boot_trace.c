@@ -0,0 +1,77 @@
+/******************************************************************************
+* Copyright (c) 2021 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+#include "xpfw_boot_trace.h"
+
+#ifdef ENABLE_BOOT_TRACE
+
+static XPfw_BootTrace_t * const BootTracePtr =
+		(XPfw_BootTrace_t *)XPFW_BOOT_TRACE_ADDR;
+
+/**
+ * Read the 64 bit system timestamp counter
+ * @return Counter value
+ */
+static u64 XPfw_BootTraceGetCount(void)
+{
+	u32 Upper;
+	u32 Lower;
+
+	/* Read the upper word again if the lower word wrapped in between */
+	do {
+		Upper = XPfw_Read32(IOU_SCNTRS_CNT_UPPER);
+		Lower = XPfw_Read32(IOU_SCNTRS_CNT_LOWER);
+	} while (Upper != XPfw_Read32(IOU_SCNTRS_CNT_UPPER));
+
+	return ((u64)Upper << 32U) | Lower;
+}
+
+/**
+ * Start the system timestamp counter if it is not running yet and clear
+ * the PMU firmware log. The PMU firmware may start before the FSBL, so the
+ * counter is started here to get both logs on one time line.
+ */
+void XPfw_BootTraceInit(void)
+{
+	if ((XPfw_Read32(IOU_SCNTRS_CNT_CNTRL) & IOU_SCNTRS_CNT_CNTRL_EN) == 0U) {
+#ifdef XPAR_PSU_CORTEXA53_0_TIMESTAMP_CLK_FREQ
+		XPfw_Write32(IOU_SCNTRS_FREQ,
+				XPAR_PSU_CORTEXA53_0_TIMESTAMP_CLK_FREQ);
+#endif
+		XPfw_Write32(IOU_SCNTRS_CNT_CNTRL, IOU_SCNTRS_CNT_CNTRL_EN);
+	}
+
+	BootTracePtr->Magic = 0U;
+	BootTracePtr->Count = 0U;
+	BootTracePtr->Dropped = 0U;
+	BootTracePtr->Freq = XPfw_Read32(IOU_SCNTRS_FREQ);
+	BootTracePtr->Magic = XPFW_BOOT_TRACE_MAGIC;
+}
+
+/**
+ * Record a boot milestone in the PMU firmware log
+ * @param Id is one of XPFW_BOOT_TRACE_*
+ * @param Arg is an 8 bit argument of the milestone
+ */
+void XPfw_BootTraceEvent(u32 Id, u32 Arg)
+{
+	u64 Count = XPfw_BootTraceGetCount();
+	u32 Index = BootTracePtr->Count;
+
+	if (Index >= XPFW_BOOT_TRACE_MAX_EVENTS) {
+		BootTracePtr->Dropped += 1U;
+	} else {
+		BootTracePtr->Event[Index][0U] = ((Id & 0xFFU) << 24U) |
+				((Arg & 0xFFU) << 16U) | ((u32)(Count >> 32U) & 0xFFFFU);
+		BootTracePtr->Event[Index][1U] = (u32)Count;
+		BootTracePtr->Count = Index + 1U;
+	}
+
+	/* The counter frequency may be programmed after the first events */
+	BootTracePtr->Freq = XPfw_Read32(IOU_SCNTRS_FREQ);
+}
+
+#endif /* ENABLE_BOOT_TRACE */
@@ -0,0 +1,69 @@
+/******************************************************************************
+* Copyright (c) 2021 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+#ifndef XPFW_BOOT_TRACE_H_
+#define XPFW_BOOT_TRACE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xpfw_default.h"
+
+/**
+ * PMU firmware boot timestamp trace
+ *
+ * Boot milestones are recorded with the 64 bit IOU system timestamp counter
+ * into the upper 96 bytes of the OCM region reserved by the FSBL for its own
+ * boot trace (see xfsbl_boot_trace.h), so that FSBL and PMU firmware events
+ * can be put on one time line. The log has the same layout as the FSBL log.
+ *
+ * Each event is two words:
+ *   - Word 0: Id [31:24], Arg [23:16], counter bits [47:32]
+ *   - Word 1: counter bits [31:0]
+ */
+#define XPFW_BOOT_TRACE_ADDR		0xFFFE9FA0U
+#define XPFW_BOOT_TRACE_MAGIC		0x31505442U /* "BTP1" */
+#define XPFW_BOOT_TRACE_MAX_EVENTS	10U
+
+/* IOU system timestamp counter */
+#define IOU_SCNTRS_BASE				0xFF260000U
+#define IOU_SCNTRS_CNT_CNTRL		(IOU_SCNTRS_BASE + 0x0U)
+#define IOU_SCNTRS_CNT_LOWER		(IOU_SCNTRS_BASE + 0x8U)
+#define IOU_SCNTRS_CNT_UPPER		(IOU_SCNTRS_BASE + 0xCU)
+#define IOU_SCNTRS_FREQ				(IOU_SCNTRS_BASE + 0x20U)
+#define IOU_SCNTRS_CNT_CNTRL_EN		0x1U
+
+/* PMU firmware boot milestones, Arg is 0 unless noted */
+#define XPFW_BOOT_TRACE_START		0x01U	/* Entry to XPfw_Main */
+#define XPFW_BOOT_TRACE_CORE_INIT	0x02U	/* Core initialized */
+#define XPFW_BOOT_TRACE_USER_STARTUP	0x03U	/* Modules added */
+#define XPFW_BOOT_TRACE_CORE_CFG	0x04U	/* Modules configured */
+#define XPFW_BOOT_TRACE_CORE_LOOP	0x05U	/* Entry to the event loop */
+#define XPFW_BOOT_TRACE_PM_CFG		0x06U	/* PM configuration object
+						 * loaded, Arg is 1 on error */
+
+typedef struct {
+	u32 Magic;	/* XPFW_BOOT_TRACE_MAGIC when valid */
+	u32 Count;	/* Number of recorded events */
+	u32 Freq;	/* Counter frequency in Hz, 0 if not programmed */
+	u32 Dropped;	/* Number of events dropped for lack of space */
+	u32 Event[XPFW_BOOT_TRACE_MAX_EVENTS][2U];
+} XPfw_BootTrace_t;
+
+#ifdef ENABLE_BOOT_TRACE
+void XPfw_BootTraceInit(void);
+void XPfw_BootTraceEvent(u32 Id, u32 Arg);
+#else
+#define XPfw_BootTraceInit()
+#define XPfw_BootTraceEvent(Id, Arg)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XPFW_BOOT_TRACE_H_ */
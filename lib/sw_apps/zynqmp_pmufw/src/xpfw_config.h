@@ -101,6 +101,8 @@ extern "C" {
  *              to DDR from OCM if FSBL is running on APU. This is to free-up
  *              OCM memory for other uses.
  *  - ENABLE_RPU_RUN_MODE: Enables RPU monitoring module
+ *  - ENABLE_BOOT_TRACE : Enables boot timestamp trace in OCM, see
+ *              xpfw_boot_trace.h
  *
  * 	These macros are specific to ZCU100 design where it uses GPO1[2] as a
  * 	board power line and
@@ -258,6 +260,10 @@ extern "C" {
 #define ENABLE_RPU_RUN_MODE_VAL				(0U)
 #endif
 
+#ifndef ENABLE_BOOT_TRACE_VAL
+#define ENABLE_BOOT_TRACE_VAL				(0U)
+#endif
+
 #ifndef ENABLE_IOCTL_VAL
 #define ENABLE_IOCTL_VAL				(0U)
 #endif
@@ -377,6 +383,10 @@ extern "C" {
 #define ENABLE_RPU_RUN_MODE
 #endif
 
+#if (ENABLE_BOOT_TRACE_VAL) && (!defined(ENABLE_BOOT_TRACE))
+#define ENABLE_BOOT_TRACE
+#endif
+
 #if (ENABLE_FPGA_LOAD_VAL) && (!defined(ENABLE_FPGA_LOAD))
 #define ENABLE_FPGA_LOAD
 #endif
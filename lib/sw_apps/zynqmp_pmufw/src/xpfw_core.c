@@ -18,6 +18,7 @@
 #include "pm_node_idle.h"
 #include "pm_csudma.h"
 #include "pm_qspi.h"
+#include "xpfw_boot_trace.h"
 
 #define CORE_IS_READY	((u16)0x5AFEU)
 #define CORE_IS_DEAD	((u16)0xDEADU)
@@ -361,6 +362,7 @@ XStatus XPfw_CoreLoop(void)
 			XPfw_InterruptEnable(PMU_IOMODULE_IRQ_ENABLE_PIT1_MASK);
 		}
 		#endif
+		XPfw_BootTraceEvent(XPFW_BOOT_TRACE_CORE_LOOP, 0U);
 		do {
 
 		#ifdef SLEEP_WHEN_IDLE
@@ -393,6 +395,8 @@ void XPfw_CorePrintStats(void)
 			((CorePtr->Scheduler.Enabled == TRUE)?"ENABLED":"DISABLED"));
 	XPfw_Printf(DEBUG_DETAILED,"Scheduler Ticks: %lu\r\n",
 			CorePtr->Scheduler.Tick);
+	XPfw_Printf(DEBUG_DETAILED,"Scheduler Missed Deadlines: %lu\r\n",
+			CorePtr->Scheduler.Missed);
 	XPfw_Printf(DEBUG_DETAILED,
 			"######################################################\r\n");
 	}
@@ -15,6 +15,7 @@
 #include "xpfw_core.h"
 #include "xpfw_user_startup.h"
 #include "xpfw_platform.h"
+#include "xpfw_boot_trace.h"
 #ifdef PMU_RAM_EINJ_ADDR
 #include "xstl_defs.h"
 #include "xstl_pmuerrinj.h"
@@ -50,6 +51,9 @@ XStatus XPfw_Main(void)
 	u32 RegVal;
 #endif
 
+	XPfw_BootTraceInit();
+	XPfw_BootTraceEvent(XPFW_BOOT_TRACE_START, 0U);
+
 	/* Start the Init Routine */
 	XPfw_Printf(DEBUG_PRINT_ALWAYS,"PMU Firmware %s\t%s   %s\r\n",
 			ZYNQMP_XPFW_VERSION, __DATE__, __TIME__);
@@ -71,9 +75,11 @@ XStatus XPfw_Main(void)
 		XPfw_Printf(DEBUG_ERROR,"%s: Error! Core Init failed\r\n", __func__);
 		goto Done;
 	}
+	XPfw_BootTraceEvent(XPFW_BOOT_TRACE_CORE_INIT, 0U);
 
 	/* Call the User Start Up Code to add Mods, Handlers and Tasks */
 	XPfw_UserStartUp();
+	XPfw_BootTraceEvent(XPFW_BOOT_TRACE_USER_STARTUP, 0U);
 
 #ifdef PMU_RAM_EINJ_ADDR
 	/* Invoke PMU RAM ECC Error Injection STL */
@@ -108,6 +114,7 @@ XStatus XPfw_Main(void)
 		XPfw_Printf(DEBUG_ERROR,"%s: Error! Core Cfg failed\r\n", __func__);
 		goto Done;
 	}
+	XPfw_BootTraceEvent(XPFW_BOOT_TRACE_CORE_CFG, 0U);
 
 #ifdef ENABLE_DDR_SR_WR
 	if (PM_SUSPEND_TYPE_POWER_OFF != PmSystemSuspendType()) {
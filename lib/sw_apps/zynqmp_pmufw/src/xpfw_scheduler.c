@@ -1,5 +1,5 @@
 /******************************************************************************
-* Copyright (c) 2015 - 2020 Xilinx, Inc.  All rights reserved.
+* Copyright (c) 2015 - 2021 Xilinx, Inc.  All rights reserved.
 * SPDX-License-Identifier: MIT
 ******************************************************************************/
 
@@ -13,6 +13,9 @@
 #define TICK_MILLISECONDS	10U
 #define COUNT_PER_TICK ((PMU_PIT_CLK_FREQ / 1000U)* TICK_MILLISECONDS )
 
+/* Longest period the PIT can be programmed for, in ticks */
+#define MAX_PIT_TICKS		(0xFFFFFFFFU / COUNT_PER_TICK)
+
 /**
  * Microblaze IOModule PIT Register Offsets
  * Used internally in this file
@@ -21,39 +24,142 @@
 #define PIT_COUNTER_OFFSET	4U
 #define PIT_CONTROL_OFFSET	8U
 
-static u32 is_task_active(XPfw_Scheduler_t *SchedPtr, u32 TaskListIndex)
+/* PIT control: enable counting and reload the counter on expiry */
+#define PIT_CONTROL_EN_RELOAD	3U
+
+/* The scheduler runs on PIT1 */
+#define PIT_IRQ_MASK		PMU_IOMODULE_IRQ_STATUS_PIT1_MASK
+
+/* Interrupt enable bit of the MicroBlaze MSR */
+#define MSR_IE_MASK		0x2U
+
+/**
+ * Check if the deadline has been reached
+ * @param Deadline is the deadline in ticks
+ * @param Tick is the current tick
+ * @return TRUE if the deadline is not in the future
+ */
+static u32 is_deadline_due(u32 Deadline, u32 Tick)
 {
-	u32 ReturnVal;
-
-	/* Periodic */
-	if ((0U != SchedPtr->TaskList[TaskListIndex].Interval)
-		&& (NULL != SchedPtr->TaskList[TaskListIndex].Callback)
-		&& (0U == (SchedPtr->Tick
-				% SchedPtr->TaskList[TaskListIndex].Interval))) {
-		ReturnVal = (u32)TRUE;
-	} else if ((0U == SchedPtr->TaskList[TaskListIndex].Interval)
-			&& (NULL != SchedPtr->TaskList[TaskListIndex].Callback)) {
-		/* Non-Periodic */
-		ReturnVal = (u32)TRUE;
+	return (((s32)(Deadline - Tick) <= 0) ? (u32)TRUE : (u32)FALSE);
+}
+
+/**
+ * Check if the PIT has expired and the tick handler has not run yet
+ * @return TRUE if the PIT interrupt is pending
+ */
+static u32 is_pit_pending(void)
+{
+	return ((0U != (XPfw_Read32(PMU_IOMODULE_IRQ_STATUS) & PIT_IRQ_MASK)) ?
+			(u32)TRUE : (u32)FALSE);
+}
+
+/**
+ * Get the current tick, including the part of the PIT period which has
+ * already elapsed
+ * @param SchedPtr is the scheduler
+ * @param PitPending is TRUE if the PIT interrupt is pending
+ * @param Elapsed returns the PIT counts elapsed since the current tick began
+ * @return Current tick
+ */
+static u32 get_current_tick(const XPfw_Scheduler_t *SchedPtr, u32 PitPending,
+		u32 *Elapsed)
+{
+	u32 Count;
+	u32 Tick = SchedPtr->Tick;
+
+	*Elapsed = 0U;
+	if ((u32)TRUE != SchedPtr->Enabled) {
+		goto done;
+	}
+
+	if ((u32)TRUE == PitPending) {
+		/* The whole period has elapsed, the counter has been reloaded */
+		Tick += SchedPtr->PitTicks;
 	} else {
-		ReturnVal = (u32)FALSE;
+		/*
+		 * The PIT counts down from the preload value and expires on a
+		 * tick boundary
+		 */
+		Count = XPfw_Read32(SchedPtr->PitBaseAddr + PIT_COUNTER_OFFSET);
+		Tick += SchedPtr->PitTicks - ((Count + COUNT_PER_TICK - 1U) /
+				COUNT_PER_TICK);
+		*Elapsed = (COUNT_PER_TICK - (Count % COUNT_PER_TICK)) %
+				COUNT_PER_TICK;
 	}
 
-	return ReturnVal;
+done:
+	return Tick;
 }
 
-static u32 is_task_non_periodic(XPfw_Scheduler_t *SchedPtr, u32 TaskListIndex)
+/**
+ * Program the PIT to expire after the given number of ticks
+ * @param SchedPtr is the scheduler
+ * @param Ticks is the number of ticks
+ * @param Elapsed is the number of PIT counts of the period which have
+ *	  already elapsed. They are taken off the first period, so that the
+ *	  PIT keeps expiring on tick boundaries.
+ */
+static void pit_program(XPfw_Scheduler_t *SchedPtr, u32 Ticks, u32 Elapsed)
 {
-	u32 ReturnVal;
+	u32 Load;
+
+	/*
+	 * The PIT reloads the shortened first period on expiry. Keep it at
+	 * least half a tick long, so that it can not expire a second time
+	 * before the tick handler has reprogrammed the PIT.
+	 */
+	while ((Ticks < MAX_PIT_TICKS) &&
+			(((Ticks * COUNT_PER_TICK) - (COUNT_PER_TICK / 2U)) <
+			 Elapsed)) {
+		Ticks++;
+	}
 
-	if ((0U == SchedPtr->TaskList[TaskListIndex].Interval)
-		&& (NULL != SchedPtr->TaskList[TaskListIndex].Callback)) {
-		ReturnVal = (u32)TRUE;
+	Load = Ticks * COUNT_PER_TICK;
+	if (Elapsed < Load) {
+		Load -= Elapsed;
 	} else {
-		ReturnVal = (u32)FALSE;
+		Load = 1U;
 	}
 
-	return ReturnVal;
+	SchedPtr->PitTicks = Ticks;
+	SchedPtr->PitLoad = Load;
+
+	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_CONTROL_OFFSET, 0U);
+	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_PRELOAD_OFFSET, Load);
+	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_CONTROL_OFFSET,
+			PIT_CONTROL_EN_RELOAD);
+}
+
+/**
+ * Get the number of ticks until the earliest deadline of the tasks
+ * @param SchedPtr is the scheduler
+ * @return Number of ticks, at least 1 and at most MAX_PIT_TICKS
+ */
+static u32 get_next_period(const XPfw_Scheduler_t *SchedPtr)
+{
+	u32 Idx;
+	u32 Ticks = MAX_PIT_TICKS;
+
+	for (Idx = 0U; Idx < XPFW_SCHED_MAX_TASK; Idx++) {
+		const struct XPfw_Task_t *Task = &SchedPtr->TaskList[Idx];
+
+		if ((NULL == Task->Callback) ||
+				(XPFW_SCHED_NO_DEADLINE == Task->Deadline)) {
+			continue;
+		}
+
+		if ((u32)TRUE == is_deadline_due(Task->Deadline, SchedPtr->Tick)) {
+			Ticks = 1U;
+			break;
+		}
+
+		if ((Task->Deadline - SchedPtr->Tick) < Ticks) {
+			Ticks = Task->Deadline - SchedPtr->Tick;
+		}
+	}
+
+	return Ticks;
 }
 
 XStatus XPfw_SchedulerInit(XPfw_Scheduler_t *SchedPtr, u32 PitBaseAddr)
@@ -71,11 +177,17 @@ XStatus XPfw_SchedulerInit(XPfw_Scheduler_t *SchedPtr, u32 PitBaseAddr)
 		SchedPtr->TaskList[Idx].Interval = 0U;
 		SchedPtr->TaskList[Idx].Callback = NULL;
 		SchedPtr->TaskList[Idx].Status = XPFW_TASK_STATUS_DISABLED;
+		SchedPtr->TaskList[Idx].Deadline = XPFW_SCHED_NO_DEADLINE;
+		SchedPtr->TaskList[Idx].Missed = 0U;
 	}
 
 	SchedPtr->Enabled = (u32)FALSE;
 	SchedPtr->PitBaseAddr = PitBaseAddr;
 	SchedPtr->Tick = 0U;
+	SchedPtr->PitTicks = 0U;
+	SchedPtr->PitLoad = 0U;
+	SchedPtr->Triggered = 0U;
+	SchedPtr->Missed = 0U;
 	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_CONTROL_OFFSET, 0U);
 
 	/* Successfully completed init */
@@ -94,11 +206,8 @@ XStatus XPfw_SchedulerStart(XPfw_Scheduler_t *SchedPtr)
 		goto done;
 	}
 
+	pit_program(SchedPtr, get_next_period(SchedPtr), 0U);
 	SchedPtr->Enabled = (u32)TRUE;
-
-	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_PRELOAD_OFFSET,
-			COUNT_PER_TICK);
-	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_CONTROL_OFFSET, 3U);
 	Status = XST_SUCCESS;
 
 done:
@@ -118,15 +227,55 @@ XStatus XPfw_SchedulerStop(XPfw_Scheduler_t *SchedPtr)
 void XPfw_SchedulerTickHandler(XPfw_Scheduler_t *SchedPtr)
 {
 	u32 Idx;
+	u32 Ticks;
+	u32 Count;
 
-	SchedPtr->Tick++;
+	SchedPtr->Tick += SchedPtr->PitTicks;
 	for (Idx = 0U; Idx < XPFW_SCHED_MAX_TASK; Idx++) {
+		struct XPfw_Task_t *Task = &SchedPtr->TaskList[Idx];
+
 		/* Check if it this task can be triggered */
-		if ((u32)TRUE == is_task_active(SchedPtr, Idx)) {
-			/* Mark the Task as TRIGGERED */
-			SchedPtr->TaskList[Idx].Status = XPFW_TASK_STATUS_TRIGGERED;
+		if ((NULL == Task->Callback) ||
+			(XPFW_SCHED_NO_DEADLINE == Task->Deadline) ||
+			((u32)FALSE == is_deadline_due(Task->Deadline, SchedPtr->Tick))) {
+			continue;
+		}
+
+		/* The previous trigger of the task has not been processed yet */
+		if (XPFW_TASK_STATUS_TRIGGERED == Task->Status) {
+			Task->Missed++;
+			SchedPtr->Missed++;
+		}
+
+		/* Mark the Task as TRIGGERED */
+		Task->Status = XPFW_TASK_STATUS_TRIGGERED;
+		SchedPtr->Triggered = (u32)TRUE;
+
+		if (0U == Task->Interval) {
+			Task->Deadline = XPFW_SCHED_NO_DEADLINE;
+		} else {
+			Task->Deadline += Task->Interval;
+			/* Skip the periods which have already passed */
+			while ((u32)TRUE == is_deadline_due(Task->Deadline,
+						SchedPtr->Tick)) {
+				Task->Deadline += Task->Interval;
+				Task->Missed++;
+				SchedPtr->Missed++;
+			}
 		}
 	}
+
+	/*
+	 * Sleep until the next deadline. The PIT has reloaded on expiry and
+	 * keeps running, so it is only reprogrammed when the period changes,
+	 * and the counts elapsed since the expiry are carried forward.
+	 */
+	Ticks = get_next_period(SchedPtr);
+	if ((Ticks != SchedPtr->PitTicks) ||
+			(SchedPtr->PitLoad != (Ticks * COUNT_PER_TICK))) {
+		Count = XPfw_Read32(SchedPtr->PitBaseAddr + PIT_COUNTER_OFFSET);
+		pit_program(SchedPtr, Ticks, SchedPtr->PitLoad - Count);
+	}
 }
 
 void XPfw_SchedulerProcess(XPfw_Scheduler_t *SchedPtr)
@@ -134,6 +283,11 @@ void XPfw_SchedulerProcess(XPfw_Scheduler_t *SchedPtr)
 	u32 Idx;
 	u32 CallCount = 0U;
 
+	if (0U == SchedPtr->Triggered) {
+		goto done;
+	}
+	SchedPtr->Triggered = 0U;
+
 	for (Idx = 0U; Idx < XPFW_SCHED_MAX_TASK; Idx++) {
 		/* Check if the task is triggered and has a valid Callback */
 		if ((XPFW_TASK_STATUS_TRIGGERED == SchedPtr->TaskList[Idx].Status) &&
@@ -144,16 +298,24 @@ void XPfw_SchedulerProcess(XPfw_Scheduler_t *SchedPtr)
 			SchedPtr->TaskList[Idx].Status = XPFW_TASK_STATUS_DISABLED;
 			CallCount++;
 	                /* Remove the Non-Periodic Task */
-		        if ((u32)TRUE == is_task_non_periodic(SchedPtr, Idx)) {
+		        if (0U == SchedPtr->TaskList[Idx].Interval) {
 			        SchedPtr->TaskList[Idx].Callback = NULL;
 			}
 		}
 	}
+
+done:
+	return;
 }
 
 XStatus XPfw_SchedulerAddTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId,u32 MilliSeconds, XPfw_Callback_t CallbackFn)
 {
 	u32 Idx;
+	u32 Msr;
+	u32 Now;
+	u32 Elapsed;
+	u32 Interval;
+	u32 PitPending;
 	XStatus Status;
 
 	/* Get the Next Free Task Index */
@@ -170,9 +332,42 @@ XStatus XPfw_SchedulerAddTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId,u32 MilliS
 	}
 
 	/* Add Interval as a factor of TICK_MILLISECONDS */
-	SchedPtr->TaskList[Idx].Interval = MilliSeconds/TICK_MILLISECONDS;
+	Interval = MilliSeconds/TICK_MILLISECONDS;
+
+	/* Tasks may also be added from interrupt handlers */
+	Msr = (u32)mfmsr();
+	microblaze_disable_interrupts();
+
+	PitPending = is_pit_pending();
+	Now = get_current_tick(SchedPtr, PitPending, &Elapsed);
+	SchedPtr->TaskList[Idx].Interval = Interval;
 	SchedPtr->TaskList[Idx].OwnerId = OwnerId;
+	SchedPtr->TaskList[Idx].Status = XPFW_TASK_STATUS_DISABLED;
+	SchedPtr->TaskList[Idx].Missed = 0U;
+	if (0U == Interval) {
+		/* Non-periodic tasks are triggered on the next tick */
+		SchedPtr->TaskList[Idx].Deadline = Now + 1U;
+	} else {
+		/* Periodic tasks are triggered on multiples of the interval */
+		SchedPtr->TaskList[Idx].Deadline = ((Now / Interval) + 1U) * Interval;
+	}
 	SchedPtr->TaskList[Idx].Callback = CallbackFn;
+
+	/*
+	 * Bring the PIT expiry forward if the task is due before it, unless
+	 * the PIT has already expired and the tick handler is pending
+	 */
+	if (((u32)TRUE == SchedPtr->Enabled) &&
+		((u32)FALSE == PitPending) &&
+		((SchedPtr->TaskList[Idx].Deadline - SchedPtr->Tick) <
+				SchedPtr->PitTicks)) {
+		SchedPtr->Tick = Now;
+		pit_program(SchedPtr, get_next_period(SchedPtr), Elapsed);
+	}
+
+	if (0U != (Msr & MSR_IE_MASK)) {
+		microblaze_enable_interrupts();
+	}
 	Status = XST_SUCCESS;
 
 done:
@@ -193,6 +388,7 @@ XStatus XPfw_SchedulerRemoveTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId, u32 Mi
 			SchedPtr->TaskList[Idx].Interval = 0U;
 			SchedPtr->TaskList[Idx].OwnerId = 0U;
 			SchedPtr->TaskList[Idx].Callback = NULL;
+			SchedPtr->TaskList[Idx].Deadline = XPFW_SCHED_NO_DEADLINE;
 			TaskCount++;
 		}
 	}
@@ -15,23 +15,60 @@ extern "C" {
 
 #define XPFW_SCHED_MAX_TASK	10U
 
+/* Deadline of a task which does not need to be triggered any more */
+#define XPFW_SCHED_NO_DEADLINE	0xFFFFFFFFU
+
 /* Values for TaskPtr->Status */
 #define XPFW_TASK_STATUS_TRIGGERED	0x5AFEC0C0U
 #define XPFW_TASK_STATUS_DISABLED	0x00000000U
 
 typedef void (*XPfw_Callback_t) (void);
 
+/**
+ * Scheduler task
+ * @Interval	Period of the task in ticks, 0 for a non-periodic task
+ * @OwnerId	ID of the module which added the task
+ * @Status	XPFW_TASK_STATUS_*
+ * @Deadline	Tick at which the task is triggered next
+ * @Missed	Number of times the task was due again before it was processed
+ * @Callback	Task function, NULL if the entry is free
+ */
 struct XPfw_Task_t{
 	u32 Interval;
 	u32 OwnerId;
 	u32 Status;
+	u32 Deadline;
+	u32 Missed;
 	XPfw_Callback_t Callback;
 };
 
+/**
+ * Scheduler
+ *
+ * The PIT does not interrupt on every tick, it is programmed to expire at the
+ * earliest deadline of the tasks. Tick is the number of ticks elapsed up to
+ * the last expiry of the PIT and PitTicks is the number of ticks the PIT is
+ * currently programmed for. PitLoad is shorter than PitTicks when the part of
+ * the first tick which had already elapsed was taken off, so that the PIT
+ * keeps expiring on tick boundaries.
+ *
+ * @TaskList	List of tasks
+ * @PitBaseAddr	Base address of the PIT used by the scheduler
+ * @Tick	Number of elapsed ticks
+ * @PitTicks	Number of ticks until the next expiry of the PIT
+ * @PitLoad	PIT counts loaded on every expiry
+ * @Triggered	Non-zero when there are triggered tasks to process
+ * @Missed	Total number of missed deadlines of all the tasks
+ * @Enabled	TRUE when the scheduler is running
+ */
 typedef struct {
 	struct XPfw_Task_t TaskList[XPFW_SCHED_MAX_TASK];
 	u32 PitBaseAddr;
 	u32 Tick;
+	u32 PitTicks;
+	u32 PitLoad;
+	u32 Triggered;
+	u32 Missed;
 	u32 Enabled;
 } XPfw_Scheduler_t ;
 
@@ -36,6 +36,9 @@
 *       bsv  07/16/2021 Fix doxygen warnings
 *       bsv  08/02/2021 Removed unnecessary initializations to reduce code size
 *       bsv  08/15/2021 Removed unwanted goto statements
+* 1.05  dc   10/29/21 Keep the absolute trigger time of periodic tasks instead
+*                     of the modulo check, skip the task list on ticks with no
+*                     task due and count missed deadlines
 *
 * </pre>
 *
@@ -59,6 +62,7 @@
 /***************** Macros (Inline Functions) Definitions *********************/
 
 #define XPLMI_SCHED_TICK	(10U)
+#define XPLMI_SCHED_NO_TRIGGER	(0xFFFFFFFFU)
 
 /**
  * @}
@@ -66,8 +70,6 @@
  */
 
 /************************** Function Prototypes ******************************/
-static u8 XPlmi_IsTaskNonPeriodic(const XPlmi_Scheduler_t *SchedPtr,
-	u32 TaskListIndex);
 
 /************************** Variable Definitions *****************************/
 static XPlmi_Scheduler_t Sched;
@@ -93,44 +95,15 @@ static u8 XPlmi_IsTaskActive(XPlmi_Scheduler_t *SchedPtr, u32 TaskListIndex)
 		goto END;
 	}
 
-	if (XPlmi_IsTaskNonPeriodic(SchedPtr, TaskListIndex) == (u8)TRUE) {
-		if (SchedPtr->TaskList[TaskListIndex].TriggerTime <=
-			SchedPtr->Tick) {
-			ReturnVal = (u8)TRUE;
-		}
-	} else {
-		if ((0U != SchedPtr->TaskList[TaskListIndex].Interval)
-		&& (0U == (SchedPtr->Tick
-		% SchedPtr->TaskList[TaskListIndex].Interval))) {
-			/* Periodic */
-			ReturnVal = (u8)TRUE;
-		}
-	}
-
-END:
-	return ReturnVal;
-}
-
-/******************************************************************************/
-/**
-* @brief	The function checks the specified task is periodic or not, returns
-* corresponding periodicity status.
-*
-* @param    SchedPtr is the Scheduler pointer
-* @param    TaskListIndex is the Task index
-*
-* @return	TRUE or FALSE based on the task peridocity status
-*
-****************************************************************************/
-static u8 XPlmi_IsTaskNonPeriodic(const XPlmi_Scheduler_t *SchedPtr,
-	u32 TaskListIndex)
-{
-	u8 ReturnVal = (u8)FALSE;
-
-	if (SchedPtr->TaskList[TaskListIndex].Type == XPLMI_NON_PERIODIC_TASK) {
+	/*
+	 * Periodic tasks are triggered on multiples of the interval, their
+	 * trigger time is advanced by the interval every time they trigger
+	 */
+	if (SchedPtr->TaskList[TaskListIndex].TriggerTime <= SchedPtr->Tick) {
 		ReturnVal = (u8)TRUE;
 	}
 
+END:
 	return ReturnVal;
 }
 
@@ -150,10 +123,12 @@ void XPlmi_SchedulerInit(void)
 	for (Idx = 0U; Idx < XPLMI_SCHED_MAX_TASK; Idx++) {
 		Sched.TaskList[Idx].Interval = 0U;
 		Sched.TaskList[Idx].CustomerFunc = NULL;
+		Sched.TaskList[Idx].TriggerTime = XPLMI_SCHED_NO_TRIGGER;
 	}
 
 	Sched.LastTimerTick = XPlmi_GetTimerValue();
 	Sched.Tick = 0U;
+	Sched.NextTriggerTime = XPLMI_SCHED_NO_TRIGGER;
 }
 
 /******************************************************************************/
@@ -173,10 +148,17 @@ void XPlmi_SchedulerHandler(void *Data)
 	u8 Idx;
 	(void)Data;
 	XPlmi_TaskNode *Task = NULL;
+	u32 NextTriggerTime = XPLMI_SCHED_NO_TRIGGER;
 
 	Sched.LastTimerTick = XPlmi_GetTimerValue();
 	Sched.Tick++;
 	XPlmi_UtilRMW(PMC_PMC_MB_IO_IRQ_ACK, PMC_PMC_MB_IO_IRQ_ACK, 0x20U);
+
+	/* Nothing to do on this tick if no task is due */
+	if (Sched.Tick < Sched.NextTriggerTime) {
+		goto END;
+	}
+
 	for (Idx = 0U; Idx < XPLMI_SCHED_MAX_TASK; Idx++) {
 		/* Check if the task is active and has a valid Callback */
 		if (XPlmi_IsTaskActive(&Sched, Idx) == (u8)TRUE) {
@@ -186,6 +168,9 @@ void XPlmi_SchedulerHandler(void *Data)
 				Task->State &= (u8)(~XPLMI_SCHED_TASK_MISSED);
 				XPlmi_TaskTriggerNow(Task);
 			} else {
+				/* The previous trigger of the task is not processed yet */
+				Sched.TaskList[Idx].MissedCount++;
+				Sched.MissedCount++;
 				/*
 				 * Check if a module has registered ErrorFunc for the task and
 				 * the previously scheduled task is executed or not
@@ -207,9 +192,19 @@ void XPlmi_SchedulerHandler(void *Data)
 				Sched.TaskList[Idx].OwnerId = 0U;
 				Sched.TaskList[Idx].CustomerFunc = NULL;
 				Sched.TaskList[Idx].ErrorFunc = NULL;
+				Sched.TaskList[Idx].TriggerTime = XPLMI_SCHED_NO_TRIGGER;
+			} else {
+				Sched.TaskList[Idx].TriggerTime += Sched.TaskList[Idx].Interval;
 			}
 		}
+		if ((Sched.TaskList[Idx].CustomerFunc != NULL) &&
+			(Sched.TaskList[Idx].TriggerTime < NextTriggerTime)) {
+			NextTriggerTime = Sched.TaskList[Idx].TriggerTime;
+		}
 	}
+	Sched.NextTriggerTime = NextTriggerTime;
+
+END:
 	XPlmi_WdtHandler();
 
 	return;
@@ -241,7 +236,7 @@ int XPlmi_SchedulerAddTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 	int Status = XST_FAILURE;
 	XPlmi_PerfTime ExtraTime;
 	u8 Idx;
-	u32 TriggerTime = 0U;
+	u32 TriggerTime = XPLMI_SCHED_NO_TRIGGER;
 	XPlmi_TaskNode *Task = NULL;
 
 	if ((TaskType !=  XPLMI_PERIODIC_TASK) &&
@@ -279,8 +274,16 @@ int XPlmi_SchedulerAddTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 			}
 			Task->IntrId = XPLMI_INVALID_INTR_ID;
 			Sched.TaskList[Idx].Task = Task;
+			Sched.TaskList[Idx].MissedCount = 0U;
 			if (TaskType == XPLMI_PERIODIC_TASK) {
 				Task->State |= (u8)XPLMI_TASK_IS_PERSISTENT;
+				microblaze_disable_interrupts();
+				/* Trigger on the next multiple of the interval */
+				if (Sched.TaskList[Idx].Interval != 0U) {
+					TriggerTime = ((Sched.Tick /
+						Sched.TaskList[Idx].Interval) + 1U) *
+						Sched.TaskList[Idx].Interval;
+				}
 			}
 			else {
 				Task->State &= (u8)(~XPLMI_TASK_IS_PERSISTENT);
@@ -292,9 +295,12 @@ int XPlmi_SchedulerAddTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 				TriggerTime = Sched.Tick +
 					   (((u32)ExtraTime.TPerfMs + MilliSeconds) /
 					   XPLMI_SCHED_TICK);
-				microblaze_enable_interrupts();
 			}
 			Sched.TaskList[Idx].TriggerTime = TriggerTime;
+			if (TriggerTime < Sched.NextTriggerTime) {
+				Sched.NextTriggerTime = TriggerTime;
+			}
+			microblaze_enable_interrupts();
 			Status = XST_SUCCESS;
 			break;
 		}
@@ -337,6 +343,7 @@ int XPlmi_SchedulerRemoveTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 			Sched.TaskList[Idx].OwnerId = 0U;
 			Sched.TaskList[Idx].CustomerFunc = NULL;
 			Sched.TaskList[Idx].Data = NULL;
+			Sched.TaskList[Idx].TriggerTime = XPLMI_SCHED_NO_TRIGGER;
 			Sched.TaskList[Idx].Task->State &= (u8)(~XPLMI_TASK_IS_PERSISTENT);
 			microblaze_disable_interrupts();
 			XPlmi_TaskDelete(Sched.TaskList[Idx].Task);
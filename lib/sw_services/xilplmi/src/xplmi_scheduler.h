@@ -29,6 +29,7 @@
 *                       task
 *       bsv  07/16/2021 Fix doxygen warnings
 *       bsv  08/15/2021 Removed redundant element in structure
+* 1.04  dc   10/29/21 Added next trigger time and missed deadline counters
 *
 * </pre>
 *
@@ -68,6 +69,7 @@ struct XPlmi_Task_t{
 	XPlmi_ErrorFunc_t ErrorFunc;
 	XPlmi_TaskNode *Task;
 	const void *Data;
+	u32 MissedCount;
 	u8 Type;
 };
 
@@ -76,6 +78,8 @@ typedef struct {
 	u64 LastTimerTick;
 	u32 TaskCount;
 	u32 Tick;
+	u32 NextTriggerTime;
+	u32 MissedCount;
 } XPlmi_Scheduler_t ;
 
 void XPlmi_SchedulerInit(void);
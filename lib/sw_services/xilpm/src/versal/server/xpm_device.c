@@ -124,6 +124,12 @@ static XPm_Requirement *FindReqm(const XPm_Device *Device, const XPm_Subsystem *
 {
 	XPm_Requirement *Reqm = NULL;
 
+	/* Most subsystems have no requirement on a given device */
+	if ((NULL == Subsystem) || (0U == (Device->ReqmSubsysMask &
+			BIT16(NODEINDEX(Subsystem->Id))))) {
+		goto done;
+	}
+
 	Reqm = Device->Requirements;
 	while (NULL != Reqm) {
 		if (Reqm->Subsystem == Subsystem) {
@@ -132,6 +138,7 @@ static XPm_Requirement *FindReqm(const XPm_Device *Device, const XPm_Subsystem *
 		Reqm = Reqm->NextSubsystem;
 	}
 
+done:
 	return Reqm;
 }
 
@@ -113,6 +113,8 @@ struct XPm_DeviceNode {
 	XPm_ResetHandle *RstHandles; /**< Head of the list device resets */
 	struct XPm_Reqm *Requirements;
 		/**< Head of the list of requirements for all subsystems */
+	u16 ReqmSubsysMask;
+		/**< Subsystems, by index, which have a requirement on the device */
 
 	struct XPm_Reqm *PendingReqm; /**< Requirement being updated */
 	u8 WfDealloc; /**< Deallocation is pending */
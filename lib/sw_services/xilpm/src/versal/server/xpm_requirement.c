@@ -22,6 +22,7 @@ static void XPmRequirement_Init(XPm_Requirement *Reqm, XPm_Subsystem *Subsystem,
 	Reqm->NextSubsystem = Device->Requirements;
 	Device->Requirements = Reqm;
 	Reqm->Device = Device;
+	Device->ReqmSubsysMask |= BIT16(NODEINDEX(Subsystem->Id));
 
 	Reqm->Allocated = 0;
 	Reqm->SetLatReq = 0;
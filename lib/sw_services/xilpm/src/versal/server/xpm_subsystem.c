@@ -21,6 +21,13 @@
 XPm_Subsystem *PmSubsystems;
 static u32 MaxSubsysIdx;
 
+/*
+ * Subsystems indexed by subsystem node index, so that the lookup on every PM
+ * API call does not walk the list. A subsystem which is added again replaces
+ * the previous one, which stays in the list behind it.
+ */
+static XPm_Subsystem *PmSubsystemsByIdx[MAX_NUM_SUBSYSTEMS];
+
 XStatus XPmSubsystem_AddPermission(const XPm_Subsystem *Host,
 				   XPm_Subsystem *Target,
 				   const u32 Operations)
@@ -502,12 +509,9 @@ XPm_Subsystem * XPmSubsystem_GetById(u32 SubsystemId)
 		goto done;
 	}
 
-	SubSystem = PmSubsystems;
-	while (NULL != SubSystem) {
-		if (SubSystem->Id == SubsystemId) {
-			break;
-		}
-		SubSystem = SubSystem->NextSubsystem;
+	SubSystem = PmSubsystemsByIdx[NODEINDEX(SubsystemId)];
+	if ((NULL != SubSystem) && (SubSystem->Id != SubsystemId)) {
+		SubSystem = NULL;
 	}
 
 done:
@@ -532,17 +536,14 @@ done:
  ****************************************************************************/
 XPm_Subsystem *XPmSubsystem_GetByIndex(u32 SubSysIdx)
 {
-	XPm_Subsystem *Subsystem = PmSubsystems;
+	XPm_Subsystem *Subsystem = NULL;
 
 	/*
 	 * We assume that Subsystem class, subclass and type have been
 	 * validated before, so just validate index against bounds here
 	 */
-	while (NULL != Subsystem) {
-		if (SubSysIdx == NODEINDEX(Subsystem->Id)) {
-			break;
-		}
-		Subsystem = Subsystem->NextSubsystem;
+	if (SubSysIdx < MAX_NUM_SUBSYSTEMS) {
+		Subsystem = PmSubsystemsByIdx[SubSysIdx];
 	}
 
 	return Subsystem;
@@ -840,6 +841,7 @@ XStatus XPmSubsystem_Add(u32 SubsystemId)
 		Subsystem->IpiMask = 0U;
 	}
 	PmSubsystems = Subsystem;
+	PmSubsystemsByIdx[NODEINDEX(SubsystemId)] = Subsystem;
 
 	if (NODEINDEX(SubsystemId) > MaxSubsysIdx) {
 		MaxSubsysIdx = NODEINDEX(SubsystemId);
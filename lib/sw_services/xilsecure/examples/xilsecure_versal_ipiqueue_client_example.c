@@ -0,0 +1,285 @@
+/******************************************************************************
+* Copyright (c) 2021 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file	xilsecure_versal_ipiqueue_client_example.c
+* @addtogroup xsecure_ipi_queue_example_apis XilSecure IPI queue API Example
+* Usage
+* @{
+* This example calculates the SHA3 hash of a buffer in chunks, first with the
+* blocking XSecure_Sha3Update API and then with XSecure_Sha3UpdateAsync, and
+* prints the number of update requests served per second in both modes along
+* with the queue statistics. Both hashes must match.
+*
+* MODIFICATION HISTORY:
+* <pre>
+* Ver   Who    Date     Changes
+* ----- ------ -------- -------------------------------------------------
+* 4.7   dc     10/18/21 First Release
+*
+* </pre>
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xil_cache.h"
+#include "xil_util.h"
+#include "xtime_l.h"
+#include "xsecure_ipi.h"
+#include "xsecure_ipiqueue.h"
+#include "xsecure_shaclient.h"
+
+/************************** Constant Definitions *****************************/
+
+static XIpiPsu IpiInst;
+static XSecure_IpiQueue IpiQueue;
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define SHA3_HASH_LEN_IN_BYTES	48U
+#define SHA3_DATA_LEN_IN_BYTES	(256U * 1024U)
+#define SHA3_CHUNK_LEN_IN_BYTES	(4U * 1024U)
+#define SHA3_CHUNK_COUNT	(SHA3_DATA_LEN_IN_BYTES / SHA3_CHUNK_LEN_IN_BYTES)
+
+/************************** Function Prototypes ******************************/
+
+static int SecureIpiQueueSyncHash(u8 *Hash, XTime *Ticks);
+static int SecureIpiQueueAsyncHash(u8 *Hash, XTime *Ticks);
+static void SecureIpiQueuePrintRate(const char *Mode, XTime Ticks);
+static void SecureIpiQueueDone(void *CallbackRef, u32 Tag, int Status);
+
+/************************** Variable Definitions *****************************/
+
+static u8 Data[SHA3_DATA_LEN_IN_BYTES] __attribute__ ((aligned (64)));
+static u8 SyncHash[SHA3_HASH_LEN_IN_BYTES] __attribute__ ((aligned (64)));
+static u8 AsyncHash[SHA3_HASH_LEN_IN_BYTES] __attribute__ ((aligned (64)));
+static volatile u32 DoneCount;
+
+/*****************************************************************************/
+/**
+*
+* Main function to call the IPI queue example
+*
+* @return
+*		- XST_SUCCESS if both hashes match
+*		- XST_FAILURE if the example failed
+*
+******************************************************************************/
+int main(void)
+{
+	int Status;
+	XTime SyncTicks = 0U;
+	XTime AsyncTicks = 0U;
+	u32 Index;
+
+	Status = XSecure_InitializeIpi(&IpiInst);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = XSecure_SetIpi(&IpiInst);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = XSecure_IpiQueueInit(&IpiQueue);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	for (Index = 0U; Index < SHA3_DATA_LEN_IN_BYTES; Index++) {
+		Data[Index] = (u8)(Index * 31U);
+	}
+	Xil_DCacheFlushRange((UINTPTR)Data, SHA3_DATA_LEN_IN_BYTES);
+
+	Status = SecureIpiQueueSyncHash(SyncHash, &SyncTicks);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Blocking SHA3 failed, Status = %x \n\r", Status);
+		goto END;
+	}
+
+	Status = SecureIpiQueueAsyncHash(AsyncHash, &AsyncTicks);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Queued SHA3 failed, Status = %x \n\r", Status);
+		goto END;
+	}
+
+	for (Index = 0U; Index < SHA3_HASH_LEN_IN_BYTES; Index++) {
+		if (SyncHash[Index] != AsyncHash[Index]) {
+			Status = XST_FAILURE;
+			xil_printf("Hash mismatch at byte %d \n\r", Index);
+			goto END;
+		}
+	}
+
+	SecureIpiQueuePrintRate("blocking", SyncTicks);
+	SecureIpiQueuePrintRate("queued  ", AsyncTicks);
+	xil_printf("queue: submitted %d completed %d failed %d max depth %d\r\n",
+		IpiQueue.Submitted, IpiQueue.Completed, IpiQueue.Failed,
+		IpiQueue.MaxCount);
+
+END:
+	if (Status == XST_SUCCESS) {
+		xil_printf("Successfully ran IPI queue example");
+	}
+	else {
+		xil_printf("IPI queue example failed");
+	}
+
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* This function hashes the data buffer chunk by chunk with blocking calls
+*
+* @param	Hash	Buffer of SHA3_HASH_LEN_IN_BYTES to store the hash
+* @param	Ticks	Pointer to store the elapsed timer ticks
+*
+* @return	XST_SUCCESS on success, error code otherwise
+*
+****************************************************************************/
+static int SecureIpiQueueSyncHash(u8 *Hash, XTime *Ticks)
+{
+	int Status = XST_FAILURE;
+	XTime Start;
+	XTime End;
+	u32 Index;
+
+	XTime_GetTime(&Start);
+
+	Status = XSecure_Sha3Initialize();
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	for (Index = 0U; Index < SHA3_CHUNK_COUNT; Index++) {
+		Status = XSecure_Sha3Update((UINTPTR)&Data[Index *
+				SHA3_CHUNK_LEN_IN_BYTES], SHA3_CHUNK_LEN_IN_BYTES);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+
+	Status = XSecure_Sha3Finish((UINTPTR)Hash);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	XTime_GetTime(&End);
+	*Ticks = End - Start;
+	Xil_DCacheInvalidateRange((UINTPTR)Hash, SHA3_HASH_LEN_IN_BYTES);
+
+END:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* This function hashes the data buffer by keeping the IPI queue filled with
+* update requests and polling it for completions
+*
+* @param	Hash	Buffer of SHA3_HASH_LEN_IN_BYTES to store the hash
+* @param	Ticks	Pointer to store the elapsed timer ticks
+*
+* @return	XST_SUCCESS on success, error code otherwise
+*
+****************************************************************************/
+static int SecureIpiQueueAsyncHash(u8 *Hash, XTime *Ticks)
+{
+	int Status = XST_FAILURE;
+	XTime Start;
+	XTime End;
+	u32 Index = 0U;
+
+	DoneCount = 0U;
+	XTime_GetTime(&Start);
+
+	Status = XSecure_Sha3Initialize();
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	while (Index < SHA3_CHUNK_COUNT) {
+		Status = XSecure_Sha3UpdateAsync(&IpiQueue,
+				(UINTPTR)&Data[Index * SHA3_CHUNK_LEN_IN_BYTES],
+				SHA3_CHUNK_LEN_IN_BYTES, SecureIpiQueueDone, NULL);
+		if (Status == XST_DEVICE_BUSY) {
+			(void)XSecure_IpiQueuePoll(&IpiQueue);
+			continue;
+		}
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		Index++;
+	}
+
+	while (XSecure_IpiQueueIsFull(&IpiQueue)) {
+		(void)XSecure_IpiQueuePoll(&IpiQueue);
+	}
+
+	Status = XSecure_Sha3FinishAsync(&IpiQueue, (UINTPTR)Hash,
+			SecureIpiQueueDone, NULL);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = XSecure_IpiQueueWaitAll(&IpiQueue);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	XTime_GetTime(&End);
+	*Ticks = End - Start;
+	Xil_DCacheInvalidateRange((UINTPTR)Hash, SHA3_HASH_LEN_IN_BYTES);
+
+	if (DoneCount != (SHA3_CHUNK_COUNT + 1U)) {
+		Status = XST_FAILURE;
+	}
+
+END:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* This function prints the request rate for the given elapsed time
+*
+****************************************************************************/
+static void SecureIpiQueuePrintRate(const char *Mode, XTime Ticks)
+{
+	u64 Rate = 0U;
+	u64 Us = ((u64)Ticks * 1000000U) / COUNTS_PER_SECOND;
+
+	if (Us != 0U) {
+		Rate = ((u64)(SHA3_CHUNK_COUNT + 1U) * 1000000U) / Us;
+	}
+
+	xil_printf("%s: %d requests in %d us, %d ops/sec\r\n", Mode,
+		SHA3_CHUNK_COUNT + 1U, (u32)Us, (u32)Rate);
+}
+
+/****************************************************************************/
+/**
+*
+* Completion callback of the queued requests
+*
+****************************************************************************/
+static void SecureIpiQueueDone(void *CallbackRef, u32 Tag, int Status)
+{
+	(void)CallbackRef;
+	(void)Tag;
+
+	if (Status == XST_SUCCESS) {
+		DoneCount++;
+	}
+}
+/** @} */
@@ -21,6 +21,8 @@
 *       har  04/14/21 Added XSecure_AesEncryptData and XSecure_AesDecryptData
 * 4.6   har  08/31/21 Updated check for Size in XSecure_AesKekDecrypt
 *       kpt  09/27/21 Fixed compilation warnings
+* 4.7   dc   10/18/21 Added XSecure_AesEncryptUpdateAsync and
+*                     XSecure_AesDecryptUpdateAsync
 *
 * </pre>
 * @note
@@ -40,6 +42,9 @@
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
+static int XSecure_AesUpdateAsync(XSecure_IpiQueue *Queue, u32 ApiId,
+	u64 InDataAddr, u64 OutDataAddr, u32 Size, u32 IsLast,
+	XSecure_IpiCallback Callback, void *CallbackRef);
 
 /************************** Variable Definitions *****************************/
 
@@ -251,6 +256,72 @@ int XSecure_AesDecryptUpdate(u64 InDataAddr, u64 OutDataAddr,
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function queues a request to update the input data to
+ * 		AES engine for encryption and returns without waiting for
+ * 		the PLM
+ *
+ * @param	Queue		- Pointer to the IPI command queue
+ * @param	InDataAddr	- Address of the input data which needs to be
+ * 				encrypted
+ * @param	OutDataAddr	- Address of the buffer where the encrypted data
+ * 				to be updated
+ * @param	Size		- Size of the input data to be encrypted
+ * @param	IsLast		- If this is the last update of data to be
+ * 				encrypted, this parameter should be set to TRUE
+ * 				otherwise FALSE
+ * @param	Callback	- Function called with the response status once
+ * 				the PLM has processed the request, can be NULL
+ * @param	CallbackRef	- Argument passed to Callback
+ *
+ * @return	- XST_SUCCESS - If the request is queued
+ *		- XST_DEVICE_BUSY - If the queue is full
+ *		- XST_INVALID_PARAM - On invalid parameter
+ *
+ *****************************************************************************/
+int XSecure_AesEncryptUpdateAsync(XSecure_IpiQueue *Queue, u64 InDataAddr,
+	u64 OutDataAddr, u32 Size, u32 IsLast, XSecure_IpiCallback Callback,
+	void *CallbackRef)
+{
+	return XSecure_AesUpdateAsync(Queue, XSECURE_API_AES_ENCRYPT_UPDATE,
+			InDataAddr, OutDataAddr, Size, IsLast, Callback,
+			CallbackRef);
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function queues a request to update the encrypted data to
+ * 		AES engine for decryption and returns without waiting for
+ * 		the PLM
+ *
+ * @param	Queue		- Pointer to the IPI command queue
+ * @param	InDataAddr	- Address of the encrypted data which needs to
+ * 				be decrypted
+ * @param	OutDataAddr	- Address of output buffer where the decrypted
+ * 				to be updated
+ * @param	Size		- Size of input data to be decrypted
+ * @param	IsLast		- If this is the last update of data to be
+ * 				decrypted, this parameter should be set to TRUE
+ * 				otherwise FALSE
+ * @param	Callback	- Function called with the response status once
+ * 				the PLM has processed the request, can be NULL
+ * @param	CallbackRef	- Argument passed to Callback
+ *
+ * @return	- XST_SUCCESS - If the request is queued
+ *		- XST_DEVICE_BUSY - If the queue is full
+ *		- XST_INVALID_PARAM - On invalid parameter
+ *
+ *****************************************************************************/
+int XSecure_AesDecryptUpdateAsync(XSecure_IpiQueue *Queue, u64 InDataAddr,
+	u64 OutDataAddr, u32 Size, u32 IsLast, XSecure_IpiCallback Callback,
+	void *CallbackRef)
+{
+	return XSecure_AesUpdateAsync(Queue, XSECURE_API_AES_DECRYPT_UPDATE,
+			InDataAddr, OutDataAddr, Size, IsLast, Callback,
+			CallbackRef);
+}
+
 /******************************************************************************/
 /**
  * @brief	This function sends IPI request to verify the GcmTag provided
@@ -532,3 +603,62 @@ int XSecure_AesDecryptData(XSecure_AesKeySource KeySrc, u32 KeySize, u64 IvAddr,
 END:
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ * @brief	This function fills the parameter block of a free queue slot
+ * 		and queues the AES update request. The parameter block lives
+ * 		in the slot so that it stays valid until the PLM reads it.
+ *
+ * @param	Queue		- Pointer to the IPI command queue
+ * @param	ApiId		- XSECURE_API_AES_ENCRYPT_UPDATE or
+ * 				XSECURE_API_AES_DECRYPT_UPDATE
+ * @param	InDataAddr	- Address of the input data
+ * @param	OutDataAddr	- Address of the output buffer
+ * @param	Size		- Size of input data
+ * @param	IsLast		- TRUE for the last update
+ * @param	Callback	- Completion callback, can be NULL
+ * @param	CallbackRef	- Argument passed to Callback
+ *
+ * @return	- XST_SUCCESS - If the request is queued
+ *		- XST_DEVICE_BUSY - If the queue is full
+ *		- XST_INVALID_PARAM - On invalid parameter
+ *
+ *****************************************************************************/
+static int XSecure_AesUpdateAsync(XSecure_IpiQueue *Queue, u32 ApiId,
+	u64 InDataAddr, u64 OutDataAddr, u32 Size, u32 IsLast,
+	XSecure_IpiCallback Callback, void *CallbackRef)
+{
+	int Status = XST_INVALID_PARAM;
+	XSecure_IpiCmd *Cmd;
+	u64 SrcAddr;
+
+	if (NULL == Queue) {
+		goto END;
+	}
+
+	Cmd = XSecure_IpiQueueGetSlot(Queue);
+	if (NULL == Cmd) {
+		Status = XST_DEVICE_BUSY;
+		goto END;
+	}
+
+	Cmd->AesParams.InDataAddr = InDataAddr;
+	Cmd->AesParams.Size = Size;
+	Cmd->AesParams.IsLast = IsLast;
+	SrcAddr = (u64)(UINTPTR)&Cmd->AesParams;
+
+	Cmd->Payload[0U] = HEADER(0UL, ApiId);
+	Cmd->Payload[1U] = (u32)SrcAddr;
+	Cmd->Payload[2U] = (u32)(SrcAddr >> 32);
+	Cmd->Payload[3U] = (u32)OutDataAddr;
+	Cmd->Payload[4U] = (u32)(OutDataAddr >> 32);
+	Cmd->Payload[5U] = XSECURE_IPI_UNUSED_PARAM;
+	Cmd->Payload[6U] = 0U;
+	Cmd->Payload[7U] = 0U;
+
+	Status = XSecure_IpiQueueCommit(Queue, Cmd, Callback, CallbackRef, NULL);
+
+END:
+	return Status;
+}
@@ -20,6 +20,7 @@
 * 1.0   kal  03/23/21 Initial release
 * 4.5   kal  03/23/20 Updated file version to sync with library version
 *       har  04/14/21 Added XSecure_AesEncryptData and XSecure_AesDecryptData
+* 4.7   dc   10/18/21 Added asynchronous update APIs
 *
 * </pre>
 * @note
@@ -35,6 +36,7 @@ extern "C" {
 
 /***************************** Include Files *********************************/
 #include "xil_types.h"
+#include "xsecure_ipiqueue.h"
 
 /**************************** Type Definitions *******************************/
 typedef enum {
@@ -94,6 +96,12 @@ int XSecure_AesEncryptData(XSecure_AesKeySource KeySrc, u32 KeySize, u64 IvAddr,
 	u64 InDataAddr, u64 OutDataAddr, u32 Size, u64 GcmTagAddr);
 int XSecure_AesDecryptData(XSecure_AesKeySource KeySrc, u32 KeySize, u64 IvAddr,
 	u64 InDataAddr, u64 OutDataAddr, u32 Size, u64 GcmTagAddr);
+int XSecure_AesEncryptUpdateAsync(XSecure_IpiQueue *Queue, u64 InDataAddr,
+	u64 OutDataAddr, u32 Size, u32 IsLast, XSecure_IpiCallback Callback,
+	void *CallbackRef);
+int XSecure_AesDecryptUpdateAsync(XSecure_IpiQueue *Queue, u64 InDataAddr,
+	u64 OutDataAddr, u32 Size, u32 IsLast, XSecure_IpiCallback Callback,
+	void *CallbackRef);
 
 #ifdef __cplusplus
 }
@@ -24,6 +24,10 @@
 *       am   05/22/21 Resolved MISRA C violations
 * 4.6   har  07/14/21 Fixed doxygen warnings
 *       kpt  09/27/21 Fixed compilation warnings
+* 4.7   dc   10/18/21 Added XSecure_IpiPollForAck
+*       dc   10/18/21 Added XSecure_IpiSendAsync and XSecure_IpiReadAsync,
+*                     blocking requests fail while an asynchronous request
+*                     is in flight
 *
 * </pre>
 *
@@ -40,6 +44,8 @@
 
 /************************** Constant Definitions *****************************/
 static XIpiPsu *IpiPtr;
+static u32 IpiAsyncBusy = (u32)FALSE;
+			/**< TRUE while an asynchronous request is with PLM */
 
 /**************************** Type Definitions *******************************/
 
@@ -60,10 +66,15 @@ static XIpiPsu *IpiPtr;
  * @param	Arg5		Payload argument 5
  *
  * @return	- XST_SUCCESS - If the IPI send and receive is successful
+ * 		- XST_DEVICE_BUSY - If a request of the IPI command queue is
+ * 				in flight
  * 		- XST_FAILURE - If there is a failure
  *
  * @note	Payload  consists of API id and call arguments to be written
- * 		in IPI buffer
+ * 		in IPI buffer. The response buffer of the IPI channel holds
+ * 		the response of one request only, so blocking requests are
+ * 		refused while a queued request is with the PLM. The queue
+ * 		is to be drained with XSecure_IpiQueueWaitAll first.
  *
  ****************************************************************************/
 int XSecure_ProcessIpi(u32 Arg0, u32 Arg1, u32 Arg2, u32 Arg3,
@@ -72,6 +83,14 @@ int XSecure_ProcessIpi(u32 Arg0, u32 Arg1, u32 Arg2, u32 Arg3,
 	int Status = XST_FAILURE;
 	u32 Payload[PAYLOAD_ARG_CNT];
 
+	if (IpiAsyncBusy == (u32)TRUE) {
+		XSecure_Printf(XSECURE_DEBUG_GENERAL,
+			"Asynchronous IPI request in flight in %s\r\n",
+			__func__);
+		Status = XST_DEVICE_BUSY;
+		goto END;
+	}
+
 	Payload[0] = (u32)Arg0;
 	Payload[1] = (u32)Arg1;
 	Payload[2] = (u32)Arg2;
@@ -282,6 +301,92 @@ END:
 	return Status;
 }
 
+/****************************************************************************/
+/**
+ * @brief	This function sends an asynchronous IPI request to the target
+ * 		module. The IPI channel is owned by the request until its
+ * 		response is read with XSecure_IpiReadAsync.
+ *
+ * @param	Payload 	API id and call arguments to be written
+ * 				in IPI buffer
+ *
+ * @return	- XST_SUCCESS - If the IPI send is successful
+ * 		- XST_DEVICE_BUSY - If an asynchronous request is in flight
+ * 		- XST_FAILURE - If there is a failure
+ *
+ ****************************************************************************/
+int XSecure_IpiSendAsync(u32 *Payload)
+{
+	int Status = XST_DEVICE_BUSY;
+
+	if (IpiAsyncBusy == (u32)TRUE) {
+		goto END;
+	}
+
+	Status = XSecure_IpiSend(Payload);
+	if (Status == XST_SUCCESS) {
+		IpiAsyncBusy = (u32)TRUE;
+	}
+
+END:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief	This function reads the response of the asynchronous IPI
+ * 		request in flight and releases the IPI channel
+ *
+ * @return	- Response status of the request
+ * 		- XST_FAILURE - If no asynchronous request is in flight or
+ * 				reading the response fails
+ *
+ ****************************************************************************/
+int XSecure_IpiReadAsync(void)
+{
+	int Status = XST_FAILURE;
+
+	if (IpiAsyncBusy != (u32)TRUE) {
+		goto END;
+	}
+
+	Status = XSecure_IpiReadBuff32();
+	IpiAsyncBusy = (u32)FALSE;
+
+END:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief	This function checks whether the target module has acknowledged
+ * 		the IPI request sent last, polling at most TimeOutCount times
+ *
+ * @param	TimeOutCount	Number of times the observation register is
+ * 				polled, 1U makes the check non-blocking
+ *
+ * @return	- XST_SUCCESS - If the target module has handled the request
+ * 		- XST_FAILURE - If the request is still being processed or
+ * 				IPI instance is not set
+ *
+ ****************************************************************************/
+int XSecure_IpiPollForAck(u32 TimeOutCount)
+{
+	int Status = XST_FAILURE;
+
+	if (NULL == IpiPtr) {
+		XSecure_Printf(XSECURE_DEBUG_GENERAL,
+			"Passing NULL pointer to %s\r\n", __func__);
+		goto END;
+	}
+
+	Status = XIpiPsu_PollForAck(IpiPtr, TARGET_IPI_INT_MASK,
+				    TimeOutCount);
+
+END:
+	return Status;
+}
+
 /****************************************************************************/
 /**
  * @brief  	Sets Ipi instance for xilsecure library
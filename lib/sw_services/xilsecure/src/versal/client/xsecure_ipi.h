@@ -21,6 +21,9 @@
 *                     Added XSecure_InitializeIpi
 *       am   05/22/21 Resolved MISRA C violation
 * 4.6   har  07/14/21 Fixed doxygen warnings
+* 4.7   dc   10/18/21 Added XSecure_IpiPollForAck for non-blocking response
+*                     polling used by the IPI command queue
+*       dc   10/18/21 Added XSecure_IpiSendAsync and XSecure_IpiReadAsync
 *
 * </pre>
 * @note
@@ -79,6 +82,9 @@ int XSecure_ProcessIpiWithPayload5(u32 ApiId, u32 Arg1, u32 Arg2, u32 Arg3,
 	u32 Arg4, u32 Arg5);
 int XSecure_IpiSend(u32 *Payload);
 int XSecure_IpiReadBuff32(void);
+int XSecure_IpiPollForAck(u32 TimeOutCount);
+int XSecure_IpiSendAsync(u32 *Payload);
+int XSecure_IpiReadAsync(void);
 int XSecure_SetIpi(XIpiPsu* const IpiInst);
 int XSecure_InitializeIpi(XIpiPsu* const IpiInstPtr);
 
@@ -0,0 +1,345 @@
+/******************************************************************************
+* Copyright (c) 2021 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xsecure_ipiqueue.c
+*
+* This file contains the implementation of the IPI command queue used by the
+* asynchronous client APIs. Refer to the header file xsecure_ipiqueue.h for
+* more detailed information.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 4.7   dc   10/18/21 Initial release
+*
+* </pre>
+*
+* @note
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xil_cache.h"
+#include "xsecure_ipiqueue.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define XSECURE_IPI_QUEUE_NEXT(Index) \
+	(((Index) + 1U) % XSECURE_IPI_QUEUE_DEPTH)
+
+/************************** Function Prototypes ******************************/
+static void XSecure_IpiQueueComplete(XSecure_IpiQueue *Queue, int Status);
+static void XSecure_IpiQueueKick(XSecure_IpiQueue *Queue);
+
+/************************** Variable Definitions *****************************/
+
+/****************************************************************************/
+/**
+ * @brief	This function initializes the IPI command queue
+ *
+ * @param	Queue	Pointer to the queue instance
+ *
+ * @return	- XST_SUCCESS - On successful initialization
+ * 		- XST_FAILURE - If Queue is NULL
+ *
+ ****************************************************************************/
+int XSecure_IpiQueueInit(XSecure_IpiQueue *Queue)
+{
+	int Status = XST_FAILURE;
+
+	if (NULL == Queue) {
+		goto END;
+	}
+
+	Queue->Head = 0U;
+	Queue->Tail = 0U;
+	Queue->Count = 0U;
+	Queue->IsBusy = (u32)FALSE;
+	Queue->NextTag = 0U;
+	Queue->Submitted = 0U;
+	Queue->Completed = 0U;
+	Queue->Failed = 0U;
+	Queue->MaxCount = 0U;
+	Queue->LastError = XST_SUCCESS;
+
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief	This function returns the next free command slot of the queue.
+ * 		The slot is owned by the caller until it is passed to
+ * 		XSecure_IpiQueueCommit.
+ *
+ * @param	Queue	Pointer to the queue instance
+ *
+ * @return	- Pointer to the free slot
+ * 		- NULL if the queue is full
+ *
+ ****************************************************************************/
+XSecure_IpiCmd *XSecure_IpiQueueGetSlot(XSecure_IpiQueue *Queue)
+{
+	XSecure_IpiCmd *Cmd = NULL;
+
+	if ((NULL == Queue) || (XSecure_IpiQueueIsFull(Queue))) {
+		goto END;
+	}
+
+	Cmd = &Queue->Cmd[Queue->Head];
+
+END:
+	return Cmd;
+}
+
+/****************************************************************************/
+/**
+ * @brief	This function posts a filled command slot to the queue and
+ * 		hands it to the PLM if the IPI channel is idle
+ *
+ * @param	Queue		Pointer to the queue instance
+ * @param	Cmd		Slot returned by XSecure_IpiQueueGetSlot with
+ * 				Payload filled
+ * @param	Callback	Function called when the request completes,
+ * 				can be NULL
+ * @param	CallbackRef	Argument passed to Callback
+ * @param	TagPtr		Pointer to store the request tag, can be NULL
+ *
+ * @return	- XST_SUCCESS - If the request is queued
+ * 		- XST_INVALID_PARAM - If Cmd is not the next free slot
+ *
+ ****************************************************************************/
+int XSecure_IpiQueueCommit(XSecure_IpiQueue *Queue, XSecure_IpiCmd *Cmd,
+	XSecure_IpiCallback Callback, void *CallbackRef, u32 *TagPtr)
+{
+	int Status = XST_INVALID_PARAM;
+
+	if ((NULL == Queue) || (XSecure_IpiQueueIsFull(Queue)) ||
+		(Cmd != &Queue->Cmd[Queue->Head])) {
+		goto END;
+	}
+
+	/* PLM reads the parameter block directly from memory */
+	Xil_DCacheFlushRange((INTPTR)&Cmd->AesParams, sizeof(Cmd->AesParams));
+
+	Cmd->Callback = Callback;
+	Cmd->CallbackRef = CallbackRef;
+	Cmd->Tag = Queue->NextTag;
+	if (NULL != TagPtr) {
+		*TagPtr = Cmd->Tag;
+	}
+
+	Queue->NextTag++;
+	Queue->Head = XSECURE_IPI_QUEUE_NEXT(Queue->Head);
+	Queue->Count++;
+	Queue->Submitted++;
+	if (Queue->Count > Queue->MaxCount) {
+		Queue->MaxCount = Queue->Count;
+	}
+
+	XSecure_IpiQueueKick(Queue);
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief	This function queues an IPI request with up to 5 payload
+ * 		arguments
+ *
+ * @param	Queue		Pointer to the queue instance
+ * @param	ApiId		API id of the IPI command
+ * @param	Arg1		Payload argument 1
+ * @param	Arg2		Payload argument 2
+ * @param	Arg3		Payload argument 3
+ * @param	Arg4		Payload argument 4
+ * @param	Arg5		Payload argument 5
+ * @param	Callback	Function called when the request completes,
+ * 				can be NULL
+ * @param	CallbackRef	Argument passed to Callback
+ * @param	TagPtr		Pointer to store the request tag, can be NULL
+ *
+ * @return	- XST_SUCCESS - If the request is queued
+ * 		- XST_DEVICE_BUSY - If the queue is full
+ * 		- XST_INVALID_PARAM - On invalid parameter
+ *
+ ****************************************************************************/
+int XSecure_IpiQueueSubmit(XSecure_IpiQueue *Queue, u32 ApiId, u32 Arg1,
+	u32 Arg2, u32 Arg3, u32 Arg4, u32 Arg5, XSecure_IpiCallback Callback,
+	void *CallbackRef, u32 *TagPtr)
+{
+	int Status = XST_INVALID_PARAM;
+	XSecure_IpiCmd *Cmd;
+
+	if (NULL == Queue) {
+		goto END;
+	}
+
+	Cmd = XSecure_IpiQueueGetSlot(Queue);
+	if (NULL == Cmd) {
+		Status = XST_DEVICE_BUSY;
+		goto END;
+	}
+
+	Cmd->Payload[0U] = HEADER(0UL, ApiId);
+	Cmd->Payload[1U] = Arg1;
+	Cmd->Payload[2U] = Arg2;
+	Cmd->Payload[3U] = Arg3;
+	Cmd->Payload[4U] = Arg4;
+	Cmd->Payload[5U] = Arg5;
+	Cmd->Payload[6U] = 0U;
+	Cmd->Payload[7U] = 0U;
+
+	Status = XSecure_IpiQueueCommit(Queue, Cmd, Callback, CallbackRef,
+		TagPtr);
+
+END:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief	This function makes progress on the queue without blocking.
+ * 		If the PLM has acknowledged the request in flight, its
+ * 		response is read, its callback is invoked and the next
+ * 		pending request is sent.
+ *
+ * @param	Queue	Pointer to the queue instance
+ *
+ * @return	Number of requests completed by this call
+ *
+ ****************************************************************************/
+u32 XSecure_IpiQueuePoll(XSecure_IpiQueue *Queue)
+{
+	u32 Done = 0U;
+	u32 Completed;
+	int Status;
+
+	if (NULL == Queue) {
+		goto END;
+	}
+
+	Completed = Queue->Completed;
+
+	if (Queue->IsBusy == (u32)TRUE) {
+		Status = XSecure_IpiPollForAck(1U);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		Status = XSecure_IpiReadAsync();
+		Queue->IsBusy = (u32)FALSE;
+		XSecure_IpiQueueComplete(Queue, Status);
+	}
+
+	XSecure_IpiQueueKick(Queue);
+	Done = Queue->Completed - Completed;
+
+END:
+	return Done;
+}
+
+/****************************************************************************/
+/**
+ * @brief	This function polls the queue until all pending requests are
+ * 		completed
+ *
+ * @param	Queue	Pointer to the queue instance
+ *
+ * @return	- XST_SUCCESS - If all requests completed successfully
+ * 		- Status of the last failed request otherwise
+ *
+ ****************************************************************************/
+int XSecure_IpiQueueWaitAll(XSecure_IpiQueue *Queue)
+{
+	int Status = XST_INVALID_PARAM;
+
+	if (NULL == Queue) {
+		goto END;
+	}
+
+	while (!XSecure_IpiQueueIsEmpty(Queue)) {
+		(void)XSecure_IpiQueuePoll(Queue);
+	}
+
+	Status = Queue->LastError;
+	Queue->LastError = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief	This function retires the request at the tail of the queue and
+ * 		invokes its callback. The slot is released before the callback
+ * 		is called so that the callback can submit a new request.
+ *
+ * @param	Queue	Pointer to the queue instance
+ * @param	Status	Response status of the request
+ *
+ ****************************************************************************/
+static void XSecure_IpiQueueComplete(XSecure_IpiQueue *Queue, int Status)
+{
+	const XSecure_IpiCmd *Cmd = &Queue->Cmd[Queue->Tail];
+	XSecure_IpiCallback Callback = Cmd->Callback;
+	void *CallbackRef = Cmd->CallbackRef;
+	u32 Tag = Cmd->Tag;
+
+	Queue->Tail = XSECURE_IPI_QUEUE_NEXT(Queue->Tail);
+	Queue->Count--;
+	Queue->Completed++;
+	if (Status != XST_SUCCESS) {
+		Queue->Failed++;
+		Queue->LastError = Status;
+		XSecure_Printf(XSECURE_DEBUG_GENERAL,
+			"IPI request %x failed with status %x\r\n", Tag, Status);
+	}
+
+	if (NULL != Callback) {
+		Callback(CallbackRef, Tag, Status);
+	}
+}
+
+/****************************************************************************/
+/**
+ * @brief	This function sends the request at the tail of the queue to
+ * 		the PLM if no request is in flight. If the IPI channel is
+ * 		owned by a request of another queue, the request stays
+ * 		pending until a later poll. Requests which cannot be sent
+ * 		are completed with the send status.
+ *
+ * @param	Queue	Pointer to the queue instance
+ *
+ ****************************************************************************/
+static void XSecure_IpiQueueKick(XSecure_IpiQueue *Queue)
+{
+	int Status;
+
+	while ((Queue->IsBusy == (u32)FALSE) &&
+		(!XSecure_IpiQueueIsEmpty(Queue))) {
+		Status = XSecure_IpiSendAsync(Queue->Cmd[Queue->Tail].Payload);
+		if (Status == XST_SUCCESS) {
+			Queue->IsBusy = (u32)TRUE;
+		}
+		else if (Status == XST_DEVICE_BUSY) {
+			break;
+		}
+		else {
+			XSecure_IpiQueueComplete(Queue, Status);
+		}
+	}
+}
@@ -0,0 +1,110 @@
+/******************************************************************************
+* Copyright (c) 2021 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xsecure_ipiqueue.h
+* @addtogroup xsecure_ipi_queue_apis XilSecure IPI command queue APIs
+* @{
+* @cond xsecure_internal
+* This file contains the command queue used by the asynchronous client APIs.
+*
+* Requests are posted into a ring of command slots and the caller continues
+* while the PLM works on them. XSecure_IpiQueuePoll() hands the slot at the
+* tail of the ring to the PLM whenever the IPI channel is free, collects the
+* response once the PLM acknowledges it and invokes the completion callback
+* of the request. Requests are executed strictly in submission order, so
+* chunked SHA3/AES updates can be posted back to back.
+*
+* The queue shares the IPI channel with the blocking client APIs, and the
+* response buffer holds the response of one request only. While a queued
+* request is in flight, blocking client APIs return XST_DEVICE_BUSY without
+* touching the channel. Drain the queue with XSecure_IpiQueueWaitAll before
+* calling them. XSecure_IpiQueuePoll must not be called from an interrupt
+* handler which can preempt a blocking client API.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 4.7   dc   10/18/21 Initial release
+*
+* </pre>
+* @note
+*
+******************************************************************************/
+
+#ifndef XSECURE_IPIQUEUE_H
+#define XSECURE_IPIQUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+#include "xsecure_defs.h"
+#include "xsecure_ipi.h"
+
+/************************** Constant Definitions ****************************/
+#define XSECURE_IPI_QUEUE_DEPTH		(16U)
+				/**< Number of command slots in the queue */
+
+/**************************** Type Definitions *******************************/
+/**
+ * Completion callback of a queued request. Tag is the value returned by
+ * XSecure_IpiQueueCommit and Status is the response status from the PLM.
+ */
+typedef void (*XSecure_IpiCallback)(void *CallbackRef, u32 Tag, int Status);
+
+typedef struct {
+	XSecure_AesInParams AesParams __attribute__ ((aligned (64)));
+			/**< Parameter block read by PLM for AES updates */
+	u32 Payload[PAYLOAD_ARG_CNT];	/**< IPI request payload */
+	XSecure_IpiCallback Callback;	/**< Completion callback */
+	void *CallbackRef;		/**< Argument to completion callback */
+	u32 Tag;			/**< Request tag */
+} XSecure_IpiCmd;
+
+typedef struct {
+	XSecure_IpiCmd Cmd[XSECURE_IPI_QUEUE_DEPTH];	/**< Command ring */
+	u32 Head;		/**< Next free slot */
+	u32 Tail;		/**< Oldest pending slot */
+	u32 Count;		/**< Number of pending requests */
+	u32 IsBusy;		/**< TRUE when tail slot is with the PLM */
+	u32 NextTag;		/**< Tag assigned to next request */
+	u32 Submitted;		/**< Total requests submitted */
+	u32 Completed;		/**< Total requests completed */
+	u32 Failed;		/**< Total requests failed */
+	u32 MaxCount;		/**< High-water mark of pending requests */
+	int LastError;		/**< Status of the last failed request */
+} XSecure_IpiQueue;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define XSecure_IpiQueueIsFull(Queue) \
+	((Queue)->Count == XSECURE_IPI_QUEUE_DEPTH)
+				/**< TRUE if no command slot is available */
+
+#define XSecure_IpiQueueIsEmpty(Queue)	((Queue)->Count == 0U)
+				/**< TRUE if no request is pending */
+
+/************************** Function Definitions *****************************/
+int XSecure_IpiQueueInit(XSecure_IpiQueue *Queue);
+XSecure_IpiCmd *XSecure_IpiQueueGetSlot(XSecure_IpiQueue *Queue);
+int XSecure_IpiQueueCommit(XSecure_IpiQueue *Queue, XSecure_IpiCmd *Cmd,
+	XSecure_IpiCallback Callback, void *CallbackRef, u32 *TagPtr);
+int XSecure_IpiQueueSubmit(XSecure_IpiQueue *Queue, u32 ApiId, u32 Arg1,
+	u32 Arg2, u32 Arg3, u32 Arg4, u32 Arg5, XSecure_IpiCallback Callback,
+	void *CallbackRef, u32 *TagPtr);
+u32 XSecure_IpiQueuePoll(XSecure_IpiQueue *Queue);
+int XSecure_IpiQueueWaitAll(XSecure_IpiQueue *Queue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* XSECURE_IPIQUEUE_H */
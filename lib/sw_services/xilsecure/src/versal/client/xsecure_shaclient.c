@@ -24,6 +24,9 @@
 *                     state using XSecure_ShaState
 * 4.6   kal  08/22/21 Updated doxygen comment description for
 *                     XSecure_Sha3Initialize API
+* 4.7   dc   10/18/21 Added XSecure_Sha3UpdateAsync and XSecure_Sha3FinishAsync
+*       dc   10/18/21 SHA3 state of asynchronous requests is advanced when
+*                     the PLM completes them
 *
 * </pre>
 *
@@ -38,15 +41,32 @@
 
 /************************** Constant Definitions *****************************/
 static XSecure_ShaState Sha3State = XSECURE_SHA_UNINITIALIZED;
+			/**< SHA3 state after the requests completed by PLM */
+static XSecure_ShaState Sha3QueuedState = XSECURE_SHA_UNINITIALIZED;
+			/**< SHA3 state after the queued requests */
 /**************************** Type Definitions *******************************/
+typedef struct {
+	XSecure_IpiCallback Callback;	/**< Completion callback of caller */
+	void *CallbackRef;		/**< Argument to completion callback */
+	XSecure_ShaState NextState;	/**< SHA3 state after the request */
+} XSecure_Sha3AsyncReq;
 
 /***************** Macros (Inline Functions) Definitions *********************/
 #define XSECURE_SHA_FIRST_PACKET_SHIFT		(30U)
 #define XSECURE_SHA_UPDATE_CONTINUE_SHIFT	(31U)
 
 /************************** Function Prototypes ******************************/
+static int XSecure_Sha3SubmitAsync(XSecure_IpiQueue *Queue, u32 Arg1,
+	u32 Arg2, u32 Arg3, u32 Arg4, u32 Arg5, XSecure_ShaState NextState,
+	XSecure_IpiCallback Callback, void *CallbackRef);
+static void XSecure_Sha3AsyncDone(void *CallbackRef, u32 Tag, int Status);
 
 /************************** Variable Definitions *****************************/
+static XSecure_Sha3AsyncReq Sha3AsyncReq[XSECURE_IPI_QUEUE_DEPTH];
+			/**< Asynchronous SHA3 requests, used round robin */
+static u32 Sha3AsyncNext = 0U;	/**< Next free entry of Sha3AsyncReq */
+static u32 Sha3AsyncPending = 0U;
+			/**< Number of asynchronous SHA3 requests queued */
 
 /*****************************************************************************/
 /**
@@ -54,15 +74,19 @@ static XSecure_ShaState Sha3State = XSECURE_SHA_UNINITIALIZED;
  *              if the current state is uninitialized.
  *
  * @return	- XST_SUCCESS - If the Sha3 state is changed to initialized state
- * 		- XST_FAILURE - If the Sha3 is not in uninitialized state
+ * 		- XST_FAILURE - If the Sha3 is not in uninitialized state or
+ * 				the final request of the previous hash is
+ * 				still queued
  *
  ******************************************************************************/
 int XSecure_Sha3Initialize(void)
 {
 	volatile int Status = XST_FAILURE;
 
-	if (Sha3State == XSECURE_SHA_UNINITIALIZED) {
+	if ((Sha3State == XSECURE_SHA_UNINITIALIZED) &&
+		(Sha3AsyncPending == 0U)) {
 		Sha3State = XSECURE_SHA_INITIALIZED;
+		Sha3QueuedState = XSECURE_SHA_INITIALIZED;
 		Status = XST_SUCCESS;
 	}
 
@@ -79,6 +103,7 @@ int XSecure_Sha3Initialize(void)
  * @param	Size		Size of the data to be updated to SHA3 engine
  *
  * @return	- XST_SUCCESS - If the update is successful
+ * 		- XST_DEVICE_BUSY - If asynchronous SHA3 requests are queued
  * 		- XST_FAILURE - If there is a failure
  *
  ******************************************************************************/
@@ -87,6 +112,11 @@ int XSecure_Sha3Update(const u64 InDataAddr, u32 Size)
 	volatile int Status = XST_FAILURE;
 	u32 Sha3InitializeMask = 0U;
 
+	if (Sha3AsyncPending != 0U) {
+		Status = XST_DEVICE_BUSY;
+		goto END;
+	}
+
 	if ((Sha3State != XSECURE_SHA_INITIALIZED) &&
 		(Sha3State != XSECURE_SHA_UPDATE)) {
 		XSecure_Printf(XSECURE_DEBUG_GENERAL, "Invalid SHA3 State \r\n");
@@ -108,6 +138,7 @@ int XSecure_Sha3Update(const u64 InDataAddr, u32 Size)
 	}
 
 	Sha3State = XSECURE_SHA_UPDATE;
+	Sha3QueuedState = XSECURE_SHA_UPDATE;
 END:
 	return Status;
 }
@@ -123,6 +154,7 @@ END:
  * @return	- XST_SUCCESS - If finished without any errors
  *		- XSECURE_SHA3_INVALID_PARAM - On invalid parameter
  *		- XSECURE_SHA3_STATE_MISMATCH_ERROR - If State mismatch is occurred
+ *		- XST_DEVICE_BUSY - If asynchronous SHA3 requests are queued
  *		- XST_FAILURE - If Sha3PadType is other than KECCAK or NIST
  *
  *****************************************************************************/
@@ -130,6 +162,11 @@ int XSecure_Sha3Finish(const u64 OutDataAddr)
 {
 	volatile int Status = XST_FAILURE;
 
+	if (Sha3AsyncPending != 0U) {
+		Status = XST_DEVICE_BUSY;
+		goto END;
+	}
+
 	if ((Sha3State != XSECURE_SHA_INITIALIZED) &&
 		(Sha3State != XSECURE_SHA_UPDATE)) {
 		XSecure_Printf(XSECURE_DEBUG_GENERAL, "Invalid SHA3 State \r\n");
@@ -142,6 +179,7 @@ int XSecure_Sha3Finish(const u64 OutDataAddr)
 			(u32)(OutDataAddr >> 32));
 
 	Sha3State = XSECURE_SHA_UNINITIALIZED;
+	Sha3QueuedState = XSECURE_SHA_UNINITIALIZED;
 END:
 	return Status;
 }
@@ -186,6 +224,184 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function queues a request to update the SHA3 engine with
+ *		the input data and returns without waiting for the PLM. The
+ *		updates of one hash can be queued back to back, the SHA3 state
+ *		is advanced when the PLM completes them.
+ *
+ * @param	Queue		Pointer to the IPI command queue
+ * @param	InDataAddr	Address of the input data
+ * @param	Size		Size of the data to be updated to SHA3 engine
+ * @param	Callback	Function called with the response status once
+ *				the PLM has processed the request, can be NULL
+ * @param	CallbackRef	Argument passed to Callback
+ *
+ * @return	- XST_SUCCESS - If the request is queued
+ *		- XST_DEVICE_BUSY - If the queue is full
+ *		- XST_FAILURE - If SHA3 is not initialized
+ *
+ * @note	All asynchronous requests of one hash are to be queued on
+ *		the same queue, so that they complete in order.
+ *
+ ******************************************************************************/
+int XSecure_Sha3UpdateAsync(XSecure_IpiQueue *Queue, const u64 InDataAddr,
+	u32 Size, XSecure_IpiCallback Callback, void *CallbackRef)
+{
+	volatile int Status = XST_FAILURE;
+	u32 Sha3InitializeMask = 0U;
+
+	if ((Sha3QueuedState != XSECURE_SHA_INITIALIZED) &&
+		(Sha3QueuedState != XSECURE_SHA_UPDATE)) {
+		XSecure_Printf(XSECURE_DEBUG_GENERAL, "Invalid SHA3 State \r\n");
+		goto END;
+	}
+
+	if (Sha3QueuedState == XSECURE_SHA_INITIALIZED) {
+		Sha3InitializeMask = 1U << XSECURE_SHA_FIRST_PACKET_SHIFT;
+	}
+
+	Status = XSecure_Sha3SubmitAsync(Queue, (u32)InDataAddr,
+			(u32)(InDataAddr >> 32U),
+			((1U << XSECURE_SHA_UPDATE_CONTINUE_SHIFT)|
+			(Sha3InitializeMask) | Size),
+			XSECURE_IPI_UNUSED_PARAM, XSECURE_IPI_UNUSED_PARAM,
+			XSECURE_SHA_UPDATE, Callback, CallbackRef);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function queues the final request of the SHA3 calculation
+ *		which adds SHA3 padding and writes the hash to OutDataAddr
+ *
+ * @param	Queue		Pointer to the IPI command queue
+ * @param	OutDataAddr	Address of the output buffer to store the
+ * 				output hash
+ * @param	Callback	Function called with the response status once
+ *				the hash is available, can be NULL
+ * @param	CallbackRef	Argument passed to Callback
+ *
+ * @return	- XST_SUCCESS - If the request is queued
+ *		- XST_DEVICE_BUSY - If the queue is full
+ *		- XST_FAILURE - If SHA3 is not initialized
+ *
+ *****************************************************************************/
+int XSecure_Sha3FinishAsync(XSecure_IpiQueue *Queue, const u64 OutDataAddr,
+	XSecure_IpiCallback Callback, void *CallbackRef)
+{
+	volatile int Status = XST_FAILURE;
+
+	if ((Sha3QueuedState != XSECURE_SHA_INITIALIZED) &&
+		(Sha3QueuedState != XSECURE_SHA_UPDATE)) {
+		XSecure_Printf(XSECURE_DEBUG_GENERAL, "Invalid SHA3 State \r\n");
+		goto END;
+	}
+
+	Status = XSecure_Sha3SubmitAsync(Queue, XSECURE_IPI_UNUSED_PARAM,
+			XSECURE_IPI_UNUSED_PARAM, XSECURE_IPI_UNUSED_PARAM,
+			(u32)OutDataAddr, (u32)(OutDataAddr >> 32),
+			XSECURE_SHA_UNINITIALIZED, Callback, CallbackRef);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function queues an asynchronous SHA3 request with
+ *		XSecure_Sha3AsyncDone as completion callback
+ *
+ * @param	Queue		Pointer to the IPI command queue
+ * @param	Arg1		Payload argument 1
+ * @param	Arg2		Payload argument 2
+ * @param	Arg3		Payload argument 3
+ * @param	Arg4		Payload argument 4
+ * @param	Arg5		Payload argument 5
+ * @param	NextState	SHA3 state once the request is completed
+ * @param	Callback	Completion callback of the caller, can be NULL
+ * @param	CallbackRef	Argument passed to Callback
+ *
+ * @return	- XST_SUCCESS - If the request is queued
+ *		- XST_DEVICE_BUSY - If the queue is full
+ *		- XST_INVALID_PARAM - On invalid parameter
+ *
+ *****************************************************************************/
+static int XSecure_Sha3SubmitAsync(XSecure_IpiQueue *Queue, u32 Arg1,
+	u32 Arg2, u32 Arg3, u32 Arg4, u32 Arg5, XSecure_ShaState NextState,
+	XSecure_IpiCallback Callback, void *CallbackRef)
+{
+	volatile int Status = XST_DEVICE_BUSY;
+	XSecure_ShaState QueuedState = Sha3QueuedState;
+	XSecure_Sha3AsyncReq *Req;
+
+	if (Sha3AsyncPending == XSECURE_IPI_QUEUE_DEPTH) {
+		goto END;
+	}
+
+	Req = &Sha3AsyncReq[Sha3AsyncNext];
+	Req->Callback = Callback;
+	Req->CallbackRef = CallbackRef;
+	Req->NextState = NextState;
+
+	/*
+	 * The request can complete within XSecure_IpiQueueSubmit when it can
+	 * not be sent, so it is accounted for before it is submitted
+	 */
+	Sha3AsyncNext = (Sha3AsyncNext + 1U) % XSECURE_IPI_QUEUE_DEPTH;
+	Sha3AsyncPending++;
+	Sha3QueuedState = NextState;
+
+	Status = XSecure_IpiQueueSubmit(Queue, XSECURE_API_SHA3_UPDATE,
+			Arg1, Arg2, Arg3, Arg4, Arg5, XSecure_Sha3AsyncDone, Req,
+			NULL);
+	if (Status != XST_SUCCESS) {
+		Sha3AsyncNext = (Sha3AsyncNext + XSECURE_IPI_QUEUE_DEPTH - 1U) %
+			XSECURE_IPI_QUEUE_DEPTH;
+		Sha3AsyncPending--;
+		Sha3QueuedState = QueuedState;
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function is the completion callback of the asynchronous
+ *		SHA3 requests. It advances the SHA3 state as the blocking
+ *		APIs do and invokes the completion callback of the caller.
+ *
+ * @param	CallbackRef	Pointer to the asynchronous SHA3 request
+ * @param	Tag		Tag of the request
+ * @param	Status		Response status from the PLM
+ *
+ *****************************************************************************/
+static void XSecure_Sha3AsyncDone(void *CallbackRef, u32 Tag, int Status)
+{
+	const XSecure_Sha3AsyncReq *Req =
+		(const XSecure_Sha3AsyncReq *)CallbackRef;
+
+	/* The final request ends the hash also on failure */
+	if ((Status == XST_SUCCESS) ||
+		(Req->NextState == XSECURE_SHA_UNINITIALIZED)) {
+		Sha3State = Req->NextState;
+	}
+
+	Sha3AsyncPending--;
+	if (Sha3AsyncPending == 0U) {
+		/* Failed updates are not applied, updates can be retried */
+		Sha3QueuedState = Sha3State;
+	}
+
+	if (NULL != Req->Callback) {
+		Req->Callback(Req->CallbackRef, Tag, Status);
+	}
+}
+
 /*****************************************************************************/
 /**
  *
@@ -21,6 +21,7 @@
 * 1.0   kal  03/17/21 Initial release
 * 4.5   kal  03/23/20 Updated file version to sync with library version
 *       kpt  04/28/21 Added enum XSecure_ShaState to update sha driver states
+* 4.7   dc   10/18/21 Added asynchronous update and finish APIs
 *
 * </pre>
 *
@@ -37,6 +38,7 @@ extern "C" {
 
 /***************************** Include Files *********************************/
 #include "xil_types.h"
+#include "xsecure_ipiqueue.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -54,6 +56,10 @@ int XSecure_Sha3Update(const u64 InDataAddr, u32 Size);
 int XSecure_Sha3Finish(const u64 OutDataAddr);
 int XSecure_Sha3Digest(const u64 InDataAddr, const u64 OutDataAddr, u32 Size);
 int XSecure_Sha3Kat(void);
+int XSecure_Sha3UpdateAsync(XSecure_IpiQueue *Queue, const u64 InDataAddr,
+	u32 Size, XSecure_IpiCallback Callback, void *CallbackRef);
+int XSecure_Sha3FinishAsync(XSecure_IpiQueue *Queue, const u64 OutDataAddr,
+	XSecure_IpiCallback Callback, void *CallbackRef);
 
 /************************** Variable Definitions *****************************/
 